@@ -0,0 +1,396 @@
+/**
+ * \file libsat/aig.h
+ *
+ * \brief And-inverter graphs for libsat.
+ *
+ * An and-inverter graph (AIG) represents a formula with two-input AND nodes
+ * and complemented edges only. Nodes are structurally hashed, so that the same
+ * AND of the same edges is only ever built once, and negation is a flip of an
+ * edge rather than a node. Other operators are lowered to ANDs, and the graph
+ * can be rewritten over small cuts before it is encoded as clauses.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/function_decl.h>
+#include <libsat/libsat_fwd.h>
+#include <libsat/parser.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief An and-inverter graph.
+ */
+typedef struct LIBSAT_SYM(libsat_aig) LIBSAT_SYM(libsat_aig);
+
+/**
+ * \brief An edge to a node in an and-inverter graph, which may be
+ * complemented.
+ */
+typedef size_t LIBSAT_SYM(libsat_aig_edge);
+
+/**
+ * \brief Make an edge from a node index and a complement flag.
+ */
+#define LIBSAT_AIG_EDGE_MAKE(node, complemented) \
+    ((((size_t)(node)) << 1) | ((complemented) ? 1 : 0))
+
+/**
+ * \brief Get the node index of an edge.
+ */
+#define LIBSAT_AIG_EDGE_NODE(edge) \
+    (((size_t)(edge)) >> 1)
+
+/**
+ * \brief Return true if an edge is complemented.
+ */
+#define LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge) \
+    (0 != (((size_t)(edge)) & 1))
+
+/**
+ * \brief Complement an edge.
+ */
+#define LIBSAT_AIG_EDGE_NOT(edge) \
+    (((size_t)(edge)) ^ 1)
+
+/**
+ * \brief The edge to the constant false node.
+ */
+#define LIBSAT_AIG_EDGE_FALSE                                       ((size_t)0)
+
+/**
+ * \brief The edge to the complement of the constant false node.
+ */
+#define LIBSAT_AIG_EDGE_TRUE                                        ((size_t)1)
+
+/**
+ * \brief The variable of an output with no name.
+ */
+#define LIBSAT_AIG_NO_VARIABLE                                   ((size_t)-1)
+
+/**
+ * \brief A sequential circuit over an and-inverter graph, as read from or
+ * written to AIGER.
+ *
+ * Inputs and latches are context variables, and so are input nodes of the
+ * graph. The current state of a latch is its variable, and its next state is
+ * an edge. Outputs are edges, which may be named by context variables.
+ */
+typedef struct LIBSAT_SYM(libsat_aig_circuit) LIBSAT_SYM(libsat_aig_circuit);
+struct LIBSAT_SYM(libsat_aig_circuit)
+{
+    /** \brief The variable of each input. */
+    const size_t* inputs;
+    /** \brief The number of inputs. */
+    size_t input_count;
+    /** \brief The variable of each latch. */
+    const size_t* latches;
+    /** \brief The next state of each latch. */
+    const LIBSAT_SYM(libsat_aig_edge)* next;
+    /** \brief The number of latches. */
+    size_t latch_count;
+    /** \brief The outputs. */
+    const LIBSAT_SYM(libsat_aig_edge)* outputs;
+    /**
+     * \brief The variable whose name names each output, or
+     * LIBSAT_AIG_NO_VARIABLE; NULL if no output is named.
+     */
+    const size_t* output_names;
+    /** \brief The number of outputs. */
+    size_t output_count;
+};
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an empty and-inverter graph.
+ *
+ * The graph starts with its constant node only. Its inputs are variables of
+ * the given context, and it is encoded into the clauses of that context.
+ *
+ * \param aig           Pointer to the graph pointer to be set to this created
+ *                      graph on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_create)(
+    LIBSAT_SYM(libsat_aig)** aig, LIBSAT_SYM(libsat_context)* context);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the edge to the input node for a context variable, creating the
+ * node if needed.
+ *
+ * \param edge          Pointer to receive the edge to this input on success.
+ * \param aig           The graph for this operation.
+ * \param var_id        The variable of this input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_input)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    size_t var_id);
+
+/**
+ * \brief Get the edge to the AND of two edges.
+ *
+ * Constants, repeated edges, and complementary edges are folded away, and an
+ * AND that is already in the graph is reused rather than built again.
+ *
+ * \param edge          Pointer to receive the edge to this AND on success.
+ * \param aig           The graph for this operation.
+ * \param lhs           The left-hand side of the AND.
+ * \param rhs           The right-hand side of the AND.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if an edge is not in this graph.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_and)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    LIBSAT_SYM(libsat_aig_edge) lhs, LIBSAT_SYM(libsat_aig_edge) rhs);
+
+/**
+ * \brief Add a parsed AST to this graph.
+ *
+ * Negations flip edges, disjunctions and implications become complemented
+ * ANDs, and exclusive disjunctions and biconditionals become three ANDs each.
+ * A statement list becomes the AND of its hard statements; soft statements
+ * are skipped.
+ *
+ * \param edge          Pointer to receive the edge for this AST on success.
+ * \param aig           The graph for this operation.
+ * \param node          The AST to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_add_ast)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    const LIBSAT_SYM(libsat_ast_node)* node);
+
+/**
+ * \brief Rewrite this graph over 4-input cuts, keeping only what the given
+ * roots need.
+ *
+ * The function of each AND over each of its cuts of up to four nodes is
+ * computed as a truth table. An AND whose function over a cut is a constant,
+ * a single cut node, or a single AND of two cut nodes is replaced by that,
+ * and an AND whose function over a cut matches one already rebuilt over the
+ * same nodes reuses it. The graph is then rebuilt from the roots, so that the
+ * nodes left unused are dropped.
+ *
+ * \param aig           The graph for this operation.
+ * \param roots         The edges to keep. On success, each is replaced by the
+ *                      equivalent edge in the rewritten graph.
+ * \param count         The number of roots.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if a root is not in this graph.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_rewrite)(
+    LIBSAT_SYM(libsat_aig)* aig, LIBSAT_SYM(libsat_aig_edge)* roots,
+    size_t count);
+
+/**
+ * \brief Assert that an edge of this graph is true in its context.
+ *
+ * A root AND is split into its fanins, and a complemented root AND becomes a
+ * single clause over the fanins of its AND tree. Each AND below that gets a
+ * fresh variable, defined only in the polarities in which it is used. The
+ * clauses are added to the current scope of the context.
+ *
+ * \param aig           The graph for this operation.
+ * \param root          The edge to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if the root is not in this graph.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_assert)(
+    LIBSAT_SYM(libsat_aig)* aig, LIBSAT_SYM(libsat_aig_edge) root);
+
+/**
+ * \brief Read a circuit in AIGER format into this graph.
+ *
+ * Both the ASCII (aag) and the binary (aig) formats are read; the binary
+ * format stores its ANDs in order, as two delta-compressed fanins each. An
+ * input or latch named in the symbol table is the context variable of that
+ * name, and any other gets a fresh unnamed variable. A named output names the
+ * context variable of that name. Only the ANDs that an output or a next state
+ * needs are added. Latches must be reset to zero, and the header may not
+ * declare bad state, invariant, justice, or fairness properties.
+ *
+ * \note The arrays of the circuit are owned by this graph, and are
+ * invalidated by the next read or rewrite.
+ *
+ * \param circuit       Pointer to receive the circuit on success.
+ * \param aig           The graph for this operation.
+ * \param data          The AIGER data.
+ * \param size          The size of the AIGER data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_FORMAT if the data is not AIGER that can be
+ *        read.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_read_aiger)(
+    LIBSAT_SYM(libsat_aig_circuit)* circuit, LIBSAT_SYM(libsat_aig)* aig,
+    const uint8_t* data, size_t size);
+
+/**
+ * \brief Write a circuit over this graph in AIGER format.
+ *
+ * Inputs and then latches take the first AIGER variables, in order, and the
+ * ANDs that the outputs and next states need follow them in the order of the
+ * graph, which is the order that the binary format requires. Inputs, latches,
+ * and outputs whose variables have names in the context are written to the
+ * symbol table.
+ *
+ * \note The data is owned by this graph, and is invalidated by the next
+ * write.
+ *
+ * \param data          Pointer to receive the AIGER data on success.
+ * \param size          Pointer to receive the size of the data, in bytes.
+ * \param aig           The graph for this operation.
+ * \param circuit       The circuit to write.
+ * \param binary        true for the binary format, false for ASCII.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if an edge is not in this graph.
+ *      - ERROR_LIBSAT_AIG_UNBOUND_INPUT if an output or next state needs an
+ *        input node whose variable is neither an input nor a latch.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_write_aiger)(
+    const uint8_t** data, size_t* size, LIBSAT_SYM(libsat_aig)* aig,
+    const LIBSAT_SYM(libsat_aig_circuit)* circuit, bool binary);
+
+/**
+ * \brief Get the number of AND nodes in this graph.
+ *
+ * \param aig           The graph for this operation.
+ *
+ * \returns the number of AND nodes in this graph.
+ */
+size_t
+LIBSAT_SYM(libsat_aig_and_count)(
+    const LIBSAT_SYM(libsat_aig)* aig);
+
+/**
+ * \brief Given a \ref libsat_aig instance, return the resource handle for this
+ * instance.
+ *
+ * \param aig           The \ref libsat_aig instance from which the resource
+ *                      handle is returned.
+ *
+ * \returns the resource handle for this graph.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_aig_resource_handle)(
+    LIBSAT_SYM(libsat_aig)* aig);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_aig_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_aig) sym ## libsat_aig; \
+    typedef LIBSAT_SYM(libsat_aig_edge) sym ## libsat_aig_edge; \
+    typedef LIBSAT_SYM(libsat_aig_circuit) sym ## libsat_aig_circuit; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_create( \
+        LIBSAT_SYM(libsat_aig)** x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_aig_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_input( \
+        LIBSAT_SYM(libsat_aig_edge)* x, LIBSAT_SYM(libsat_aig)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(libsat_aig_input)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_and( \
+        LIBSAT_SYM(libsat_aig_edge)* w, LIBSAT_SYM(libsat_aig)* x, \
+        LIBSAT_SYM(libsat_aig_edge) y, LIBSAT_SYM(libsat_aig_edge) z) { \
+            return LIBSAT_SYM(libsat_aig_and)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_add_ast( \
+        LIBSAT_SYM(libsat_aig_edge)* x, LIBSAT_SYM(libsat_aig)* y, \
+        const LIBSAT_SYM(libsat_ast_node)* z) { \
+            return LIBSAT_SYM(libsat_aig_add_ast)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_rewrite( \
+        LIBSAT_SYM(libsat_aig)* x, LIBSAT_SYM(libsat_aig_edge)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(libsat_aig_rewrite)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_assert( \
+        LIBSAT_SYM(libsat_aig)* x, LIBSAT_SYM(libsat_aig_edge) y) { \
+            return LIBSAT_SYM(libsat_aig_assert)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_read_aiger( \
+        LIBSAT_SYM(libsat_aig_circuit)* w, LIBSAT_SYM(libsat_aig)* x, \
+        const uint8_t* y, size_t z) { \
+            return LIBSAT_SYM(libsat_aig_read_aiger)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_write_aiger( \
+        const uint8_t** v, size_t* w, LIBSAT_SYM(libsat_aig)* x, \
+        const LIBSAT_SYM(libsat_aig_circuit)* y, bool z) { \
+            return LIBSAT_SYM(libsat_aig_write_aiger)(v,w,x,y,z); } \
+    static inline size_t \
+    sym ## libsat_aig_and_count( \
+        const LIBSAT_SYM(libsat_aig)* x) { \
+            return LIBSAT_SYM(libsat_aig_and_count)(x); } \
+    static inline RCPR_SYM(resource)* \
+    sym ## libsat_aig_resource_handle( \
+        LIBSAT_SYM(libsat_aig)* x) { \
+            return LIBSAT_SYM(libsat_aig_resource_handle)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_aig_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_aig_sym(sym ## _)
+#define LIBSAT_IMPORT_aig \
+    __INTERNAL_LIBSAT_IMPORT_aig_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,302 @@
+/**
+ * \file libsat/cnf.h
+ *
+ * \brief Clause database and constraint encodings for libsat.
+ *
+ * A \ref libsat_cnf holds clauses over the variable ids of a
+ * \ref libsat_context. Cardinality and linear pseudo-Boolean constraints can be
+ * added directly, either encoded into clauses using one of several encodings
+ * or kept as native constraints for a propagator.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/function_decl.h>
+#include <libsat/libsat_fwd.h>
+#include <libsat/literal.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A database of clauses and native constraints.
+ */
+typedef struct LIBSAT_SYM(libsat_cnf) LIBSAT_SYM(libsat_cnf);
+
+/**
+ * \brief The relation of a cardinality or pseudo-Boolean constraint.
+ */
+enum LIBSAT_SYM(libsat_cnf_relation)
+{
+    /** \brief The weighted sum is at most the bound. */
+    LIBSAT_CNF_RELATION_AT_MOST =                                   0x0000,
+
+    /** \brief The weighted sum is at least the bound. */
+    LIBSAT_CNF_RELATION_AT_LEAST =                                  0x0001,
+
+    /** \brief The weighted sum is exactly the bound. */
+    LIBSAT_CNF_RELATION_EXACTLY =                                   0x0002,
+};
+
+/**
+ * \brief The encoding used for a cardinality or pseudo-Boolean constraint.
+ */
+enum LIBSAT_SYM(libsat_cnf_encoding)
+{
+    /** \brief Sequential (weight) counter. Adds O(n * k) variables and clauses,
+     * and is a good fit for small bounds. */
+    LIBSAT_CNF_ENCODING_SEQUENTIAL_COUNTER =                        0x0000,
+
+    /** \brief (Generalized) totalizer. Adds a tree of unary counters, and is a
+     * good fit for larger bounds with few distinct weights. */
+    LIBSAT_CNF_ENCODING_TOTALIZER =                                 0x0001,
+
+    /** \brief Odd-even merge sorting network. Adds O(n log^2 n) comparators
+     * over the unary expansion of the weights. */
+    LIBSAT_CNF_ENCODING_SORTING_NETWORK =                           0x0002,
+
+    /** \brief No clauses are added; the constraint is kept for the native
+     * propagator instead. */
+    LIBSAT_CNF_ENCODING_NATIVE =                                    0x0003,
+};
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an empty clause database.
+ *
+ * \note Auxiliary variables introduced by constraint encodings are created in
+ * the given context, which must outlive this instance.
+ *
+ * \param cnf           Pointer to the cnf pointer to be set to this created
+ *                      instance on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_create)(
+    LIBSAT_SYM(libsat_cnf)** cnf, LIBSAT_SYM(libsat_context)* context);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Add a clause to the database.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals in this clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_clause)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count);
+
+/**
+ * \brief Add a cardinality constraint over the given literals.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals to count.
+ * \param count         The number of literals.
+ * \param relation      The \ref libsat_cnf_relation of this constraint.
+ * \param k             The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_BAD_RELATION if the relation is not recognized.
+ *      - ERROR_LIBSAT_CNF_BAD_ENCODING if the encoding is not recognized.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_cardinality)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count, int relation, size_t k, int encoding);
+
+/**
+ * \brief Add a linear pseudo-Boolean constraint over the given literals.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal, or NULL if every weight is
+ *                      one.
+ * \param count         The number of literals.
+ * \param relation      The \ref libsat_cnf_relation of this constraint.
+ * \param bound         The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_BAD_RELATION if the relation is not recognized.
+ *      - ERROR_LIBSAT_CNF_BAD_ENCODING if the encoding is not recognized.
+ *      - ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW if the weights sum past 64 bits.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_pseudo_boolean)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, int relation, uint64_t bound,
+    int encoding);
+
+/**
+ * \brief Get the number of clauses in the database.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns the number of clauses in this database.
+ */
+size_t
+LIBSAT_SYM(libsat_cnf_clause_count)(
+    const LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Get a clause from the database.
+ *
+ * \note The returned literals are owned by the database, and are invalidated
+ * when another clause is added.
+ *
+ * \param lits          Pointer to receive the literals of this clause.
+ * \param count         Pointer to receive the number of literals.
+ * \param cnf           The database for this operation.
+ * \param index         The index of the clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_INDEX_OUT_OF_RANGE if there is no such clause.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_clause_get)(
+    const LIBSAT_SYM(libsat_literal)** lits, size_t* count,
+    const LIBSAT_SYM(libsat_cnf)* cnf, size_t index);
+
+/**
+ * \brief Get the number of native constraints in the database.
+ *
+ * \note Every native constraint is stored in at-most form.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns the number of native constraints in this database.
+ */
+size_t
+LIBSAT_SYM(libsat_cnf_native_count)(
+    const LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Propagate the native constraints under a partial assignment.
+ *
+ * Each native constraint is kept as sum(w_i * l_i) <= bound. Any unassigned
+ * literal whose weight exceeds the remaining slack of its constraint is
+ * implied false.
+ *
+ * \param implied_count Pointer to receive the number of implied literals.
+ * \param cnf           The database for this operation.
+ * \param values        The current assignment, indexed by variable id. Each
+ *                      entry is a \ref libsat_value.
+ * \param value_count   The number of entries in \p values. Variables beyond
+ *                      this count are unassigned.
+ * \param implied       Array to receive the implied literals.
+ * \param implied_max   The capacity of \p implied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_CONFLICT if the assignment violates a constraint.
+ *      - ERROR_LIBSAT_CNF_IMPLIED_BUFFER_TOO_SMALL if more than
+ *        \p implied_max literals are implied.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_native_propagate)(
+    size_t* implied_count, const LIBSAT_SYM(libsat_cnf)* cnf,
+    const uint8_t* values, size_t value_count,
+    LIBSAT_SYM(libsat_literal)* implied, size_t implied_max);
+
+/**
+ * \brief Given a \ref libsat_cnf instance, return the resource handle for this
+ * instance.
+ *
+ * \param cnf           The \ref libsat_cnf instance from which the resource
+ *                      handle is returned.
+ *
+ * \returns the resource handle for this cnf instance.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_cnf_resource_handle)(
+    LIBSAT_SYM(libsat_cnf)* cnf);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_cnf_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_cnf) sym ## libsat_cnf; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_create( \
+        LIBSAT_SYM(libsat_cnf)** x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_cnf_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_add_clause( \
+        LIBSAT_SYM(libsat_cnf)* x, const LIBSAT_SYM(libsat_literal)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(libsat_cnf_add_clause)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_add_cardinality( \
+        LIBSAT_SYM(libsat_cnf)* u, const LIBSAT_SYM(libsat_literal)* v, \
+        size_t w, int x, size_t y, int z) { \
+            return LIBSAT_SYM(libsat_cnf_add_cardinality)(u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_add_pseudo_boolean( \
+        LIBSAT_SYM(libsat_cnf)* t, const LIBSAT_SYM(libsat_literal)* u, \
+        const uint64_t* v, size_t w, int x, uint64_t y, int z) { \
+            return \
+                LIBSAT_SYM(libsat_cnf_add_pseudo_boolean)(t,u,v,w,x,y,z); } \
+    static inline size_t \
+    sym ## libsat_cnf_clause_count( \
+        const LIBSAT_SYM(libsat_cnf)* x) { \
+            return LIBSAT_SYM(libsat_cnf_clause_count)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_clause_get( \
+        const LIBSAT_SYM(libsat_literal)** w, size_t* x, \
+        const LIBSAT_SYM(libsat_cnf)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_cnf_clause_get)(w,x,y,z); } \
+    static inline size_t \
+    sym ## libsat_cnf_native_count( \
+        const LIBSAT_SYM(libsat_cnf)* x) { \
+            return LIBSAT_SYM(libsat_cnf_native_count)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_native_propagate( \
+        size_t* u, const LIBSAT_SYM(libsat_cnf)* v, const uint8_t* w, \
+        size_t x, LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_cnf_native_propagate)(u,v,w,x,y,z); } \
+    static inline RCPR_SYM(resource)* \
+    sym ## libsat_cnf_resource_handle( \
+        LIBSAT_SYM(libsat_cnf)* x) { \
+            return LIBSAT_SYM(libsat_cnf_resource_handle)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_cnf_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_cnf_sym(sym ## _)
+#define LIBSAT_IMPORT_cnf \
+    __INTERNAL_LIBSAT_IMPORT_cnf_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -33,6 +33,21 @@ enum libsat_subcomponents
 
     /** \brief Parser subcomponent. */
     LIBSAT_SUBCOMPONENT_PARSER =                                          0x01,
+
+    /** \brief Xor subcomponent. */
+    LIBSAT_SUBCOMPONENT_XOR =                                             0x02,
+
+    /** \brief CNF subcomponent. */
+    LIBSAT_SUBCOMPONENT_CNF =                                             0x03,
+
+    /** \brief Solver subcomponent. */
+    LIBSAT_SUBCOMPONENT_SOLVER =                                          0x04,
+
+    /** \brief AIG subcomponent. */
+    LIBSAT_SUBCOMPONENT_AIG =                                             0x05,
+
+    /** \brief Snapshot subcomponent. */
+    LIBSAT_SUBCOMPONENT_SNAPSHOT =                                        0x06,
 };
 
 /** \brief Base component scope. */
@@ -43,6 +58,27 @@ enum libsat_subcomponents
 #define LIBSAT_COMPONENT_PARSER \
     COMPONENT_MAKE(LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_PARSER)
 
+/** \brief Xor component scope. */
+#define LIBSAT_COMPONENT_XOR \
+    COMPONENT_MAKE(LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_XOR)
+
+/** \brief CNF component scope. */
+#define LIBSAT_COMPONENT_CNF \
+    COMPONENT_MAKE(LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_CNF)
+
+/** \brief Solver component scope. */
+#define LIBSAT_COMPONENT_SOLVER \
+    COMPONENT_MAKE(LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_SOLVER)
+
+/** \brief AIG component scope. */
+#define LIBSAT_COMPONENT_AIG \
+    COMPONENT_MAKE(LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_AIG)
+
+/** \brief Snapshot component scope. */
+#define LIBSAT_COMPONENT_SNAPSHOT \
+    COMPONENT_MAKE( \
+        LIBSAT_RESERVED_COMPONENT_FAMILY, LIBSAT_SUBCOMPONENT_SNAPSHOT)
+
 /* C++ compatibility. */
 # ifdef   __cplusplus
 }
@@ -9,9 +9,15 @@
 
 #pragma once
 
+#include <libsat/aig.h>
+#include <libsat/cnf.h>
 #include <libsat/function_decl.h>
+#include <libsat/literal.h>
 #include <libsat/parser.h>
 #include <libsat/scanner.h>
+#include <libsat/snapshot.h>
+#include <libsat/solver.h>
+#include <libsat/xor.h>
 #include <rcpr/allocator.h>
 #include <rcpr/resource.h>
 #include <stdbool.h>
@@ -80,6 +86,30 @@ status FN_DECL_MUST_CHECK
 LIBSAT_SYM(libsat_context_create)(
     LIBSAT_SYM(libsat_context)** context, RCPR_SYM(allocator)* alloc);
 
+/**
+ * \brief Create an overlay over a frozen context.
+ *
+ * The overlay is a context of its own that sees every variable of its base.
+ * Names that the base does not know are created in the overlay, and are given
+ * their final ids in the base by \ref libsat_context_overlay_merge. Overlays
+ * of the same base can be created and used concurrently. The base must
+ * outlive the overlay, and must stay frozen while the overlay is in use.
+ *
+ * \param overlay       Pointer to the context pointer to be set to the created
+ *                      overlay on success.
+ * \param base          The frozen context to overlay.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_FROZEN if the base is not frozen.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_IS_OVERLAY if the base is itself an
+ *        overlay.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_create)(
+    LIBSAT_SYM(libsat_context)** overlay, LIBSAT_SYM(libsat_context)* base);
+
 /******************************************************************************/
 /* Start of public methods.                                                   */
 /******************************************************************************/
@@ -102,6 +132,86 @@ LIBSAT_SYM(libsat_context_variable_get)(
     size_t* var_id, LIBSAT_SYM(libsat_context)* context, const char* var_name,
     int flags);
 
+/**
+ * \brief Freeze the variable table of a context.
+ *
+ * A frozen context never changes its variable table, so any number of threads
+ * may look up its variables, or parse against it, at the same time. Names that
+ * are not yet known can be created in an overlay of the frozen context.
+ *
+ * \param context       The context to freeze.
+ */
+void
+LIBSAT_SYM(libsat_context_freeze)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Thaw a frozen context, so that it can be changed again.
+ *
+ * No overlay of this context may be in use while it is thawed.
+ *
+ * \param context       The context to thaw.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_MERGED if the context is an overlay that
+ *        has been merged.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_thaw)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Merge the variables created in an overlay into its base.
+ *
+ * The variables of the overlay are visited in the order in which the overlay
+ * created them. A name already known to the base keeps its id in the base;
+ * any other variable is given the next id of the base. Merging the overlays
+ * of a set of inputs in input order therefore numbers every variable exactly
+ * as parsing the same inputs in order against the base would.
+ *
+ * Afterward, the overlay is frozen, and \ref libsat_context_overlay_translate
+ * maps its ids to those of the base. No overlay of the base may be in use
+ * while this runs.
+ *
+ * \param base          The base of the overlay.
+ * \param overlay       The overlay to merge.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the overlay is not an
+ *        overlay of this base.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_MERGED if the overlay was already merged.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_merge)(
+    LIBSAT_SYM(libsat_context)* base, LIBSAT_SYM(libsat_context)* overlay);
+
+/**
+ * \brief Translate a variable id of a merged overlay to its id in the base.
+ *
+ * \param var_id        Pointer to the variable id to be set to the id in the
+ *                      base on success.
+ * \param overlay       The merged overlay.
+ * \param overlay_id    The variable id in the overlay.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the context is not an
+ *        overlay.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED if the overlay has not been
+ *        merged.
+ *      - ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND if the overlay has no
+ *        such variable.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_translate)(
+    size_t* var_id, const LIBSAT_SYM(libsat_context)* overlay,
+    size_t overlay_id);
+
 /**
  * \brief Given a \ref libsat_context instance, return the resource handle for
  * this instance.
@@ -125,9 +235,27 @@ LIBSAT_SYM(libsat_context_resource_handle)(
         LIBSAT_SYM(libsat_context)** x, RCPR_SYM(allocator)* y) { \
             return LIBSAT_SYM(libsat_context_create)(x,y); } \
     static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_overlay_create( \
+        LIBSAT_SYM(libsat_context)** x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_context_overlay_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
     sym ## libsat_context_variable_get( \
         size_t* w, LIBSAT_SYM(libsat_context)* x, const char* y, int z) { \
             return LIBSAT_SYM(libsat_context_variable_get)(w,x,y,z); } \
+    static inline void sym ## libsat_context_freeze( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            LIBSAT_SYM(libsat_context_freeze)(x); } \
+    static inline status FN_DECL_MUST_CHECK sym ## libsat_context_thaw( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_thaw)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_overlay_merge( \
+        LIBSAT_SYM(libsat_context)* x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_context_overlay_merge)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_overlay_translate( \
+        size_t* x, const LIBSAT_SYM(libsat_context)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_context_overlay_translate)(x,y,z); } \
     static inline RCPR_SYM(resource)* \
     sym ## libsat_context_resource_handle( \
         LIBSAT_SYM(libsat_context)* x) { \
@@ -0,0 +1,85 @@
+/**
+ * \file libsat/literal.h
+ *
+ * \brief Literals and variable values for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/function_decl.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A literal is a variable id from a \ref libsat_context, shifted left
+ * by one, with the low bit set if the variable is negated.
+ */
+typedef size_t LIBSAT_SYM(libsat_literal);
+
+/**
+ * \brief The value of a variable in a partial assignment.
+ *
+ * Assignments are passed around as arrays of uint8_t, indexed by variable id.
+ */
+enum LIBSAT_SYM(libsat_value)
+{
+    /** \brief The variable has not yet been assigned. */
+    LIBSAT_VALUE_UNASSIGNED =                                       0x00,
+
+    /** \brief The variable is assigned true. */
+    LIBSAT_VALUE_TRUE =                                             0x01,
+
+    /** \brief The variable is assigned false. */
+    LIBSAT_VALUE_FALSE =                                            0x02,
+};
+
+/**
+ * \brief Make a literal from a variable id and a negation flag.
+ */
+#define LIBSAT_LITERAL_MAKE(var_id, negated) \
+    ((((size_t)(var_id)) << 1) | ((negated) ? 1 : 0))
+
+/**
+ * \brief Get the variable id of a literal.
+ */
+#define LIBSAT_LITERAL_VARIABLE(lit) \
+    (((size_t)(lit)) >> 1)
+
+/**
+ * \brief Returns true if the given literal is negated.
+ */
+#define LIBSAT_LITERAL_IS_NEGATED(lit) \
+    (0 != (((size_t)(lit)) & 1))
+
+/**
+ * \brief Negate the given literal.
+ */
+#define LIBSAT_LITERAL_NEGATE(lit) \
+    (((size_t)(lit)) ^ 1)
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_literal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_literal) sym ## libsat_literal; \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_literal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_literal_sym(sym ## _)
+#define LIBSAT_IMPORT_literal \
+    __INTERNAL_LIBSAT_IMPORT_literal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
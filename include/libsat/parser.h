@@ -14,6 +14,7 @@
 #include <rcpr/allocator.h>
 #include <rcpr/resource.h>
 #include <rcpr/resource/protected.h>
+#include <stdint.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
@@ -59,6 +60,22 @@ enum LIBSAT_SYM(libsat_parser_ast_node_type)
     LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST,
 };
 
+/**
+ * \brief The span of input that a statement was parsed from.
+ *
+ * Lines and columns count from one, as in \ref libsat_scanner_token. The span
+ * runs from the first token of the statement to its terminating semicolon, or
+ * to its last token if it is the last statement of the input.
+ */
+typedef struct LIBSAT_SYM(libsat_source_span) LIBSAT_SYM(libsat_source_span);
+struct LIBSAT_SYM(libsat_source_span)
+{
+    size_t begin_line;
+    size_t begin_col;
+    size_t end_line;
+    size_t end_col;
+};
+
 /**
  * \brief An AST node from the parser.
  */
@@ -69,6 +86,13 @@ struct LIBSAT_SYM(libsat_ast_node)
     RCPR_SYM(allocator)* alloc;
     LIBSAT_SYM(libsat_ast_node)* next;
     int type;
+
+    /** \brief source span of a parsed statement, or zero. */
+    LIBSAT_SYM(libsat_source_span) span;
+
+    /** \brief weight of a parsed soft statement, or zero for a hard one. */
+    uint64_t weight;
+
     union {
         /** \brief variable index. */
         size_t variable_index;
@@ -114,6 +138,35 @@ LIBSAT_SYM(libsat_parse)(
     LIBSAT_SYM(libsat_ast_node)** node, LIBSAT_SYM(libsat_context)* context,
     const char* input);
 
+/**
+ * \brief Parse an input string in chunks on several threads.
+ *
+ * The input is split after a semicolon into chunks of similar size, which are
+ * parsed concurrently against overlays of the context, or against the context
+ * itself if it is already frozen. The resulting statement list and variable
+ * ids are the same as those of \ref libsat_parse.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param node          The AST node created on success.
+ * \param context       The context for this operation.
+ * \param input         The input string to parse.
+ * \param thread_count  The number of threads to parse with. With one thread
+ *                      or fewer, a short input, or an overlay context, this
+ *                      is the same as \ref libsat_parse.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_parse_parallel)(
+    LIBSAT_SYM(libsat_ast_node)** node, LIBSAT_SYM(libsat_context)* context,
+    const char* input, size_t thread_count);
+
 /**
  * \brief Get the resource associated with a \ref libsat_ast_node.
  *
@@ -125,21 +178,191 @@ RCPR_SYM(resource)*
 LIBSAT_SYM(libsat_ast_node_resource_handle)(
     LIBSAT_SYM(libsat_ast_node)* node);
 
+/**
+ * \brief Rewrite the variables of an AST parsed against an overlay to their
+ * ids in the base, once the overlay has been merged.
+ *
+ * \param node          The AST to rebase.
+ * \param overlay       The merged overlay that the AST was parsed against.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the context is not an
+ *        overlay.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED if the overlay has not been
+ *        merged.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_node_rebase)(
+    LIBSAT_SYM(libsat_ast_node)* node,
+    const LIBSAT_SYM(libsat_context)* overlay);
+
+/**
+ * \brief Evaluate an AST under a single assignment.
+ *
+ * A statement list is true when all of its hard statements are; soft
+ * statements are skipped, since they do not have to hold in a model.
+ *
+ * \param result        Pointer to receive the value of the AST on success.
+ * \param node          The AST to evaluate.
+ * \param assignment    The bit-packed assignment, in which bit v % 64 of
+ *                      assignment[v / 64] is the value of variable v.
+ * \param variable_count The number of variables in the assignment.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if the AST refers to a variable
+ *        that is not in the assignment.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_evaluate)(
+    bool* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* assignment, size_t variable_count);
+
+/**
+ * \brief Evaluate an AST under 64 assignments at once.
+ *
+ * This evaluates the AST as \ref libsat_ast_evaluate does, with one bitwise
+ * operation per node covering all 64 assignments.
+ *
+ * \param result        Pointer to receive the value of the AST on success;
+ *                      bit i is its value under assignment i.
+ * \param node          The AST to evaluate.
+ * \param lanes         The assignments, in which bit i of lanes[v] is the
+ *                      value of variable v in assignment i.
+ * \param variable_count The number of variables in the lanes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if the AST refers to a variable
+ *        that is not in the lanes.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_evaluate_batch)(
+    uint64_t* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* lanes, size_t variable_count);
+
+/**
+ * \brief Cluster ASTs into candidate equivalence classes by random
+ * simulation.
+ *
+ * Each AST is evaluated under the same width * 64 random assignments, and its
+ * values form its signature. ASTs with different signatures differ under some
+ * assignment, so they cannot be equivalent; only ASTs that share a class need
+ * to be checked with the solver. Each variable is simulated as width words, so
+ * every operator works on a short run of words that vectorizes well.
+ *
+ * \param classes       Array of count entries to receive, for each AST, the
+ *                      lowest index of an AST with the same signature.
+ * \param negated       Optional array of count entries. If set, ASTs whose
+ *                      signatures are complements share a class, and this
+ *                      receives true for each AST that is a candidate for the
+ *                      negation of the AST that represents its class.
+ * \param nodes         The ASTs to cluster.
+ * \param count         The number of ASTs to cluster.
+ * \param variable_count The number of variables that the ASTs may refer to.
+ * \param width         The number of 64-bit words of assignments to simulate
+ *                      at once; 4 gives 256 assignments.
+ * \param seed          The seed of the random assignments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_WIDTH if width is zero.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if an AST refers to a variable at or
+ *        beyond variable_count.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_simulate)(
+    size_t* classes, bool* negated,
+    const LIBSAT_SYM(libsat_ast_node)* const* nodes, size_t count,
+    size_t variable_count, size_t width, uint64_t seed);
+
+/**
+ * \brief Print an AST in the syntax that the parser accepts.
+ *
+ * Operators are written with the same UTF-8 symbols that the scanner reads,
+ * with only the parentheses needed to keep the shape of the AST. Statements
+ * end with a semicolon and are separated by newlines, and soft statements are
+ * prefixed with their weight. Parsing the text of a statement list gives the
+ * same statements, weights, variables, and shape; only the source spans
+ * differ.
+ *
+ * \param text          Pointer to the buffer, allocated from alloc, or NULL.
+ *                      On success, this holds the zero-terminated text. The
+ *                      buffer is grown as needed, and can be reused for later
+ *                      prints; the caller reclaims it with alloc.
+ * \param capacity      Pointer to the capacity of the buffer, or zero.
+ * \param size          Pointer to receive the length of the text, without its
+ *                      terminating zero, on success.
+ * \param alloc         The allocator for the buffer.
+ * \param context       The context that holds the names of the variables.
+ * \param node          The AST to print.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if a variable has no name, or a name
+ *        that would not be read back as that variable.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_print)(
+    char** text, size_t* capacity, size_t* size, RCPR_SYM(allocator)* alloc,
+    const LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node);
+
 /******************************************************************************/
 /* Start of public exports.                                                   */
 /******************************************************************************/
 #define __INTERNAL_LIBSAT_IMPORT_parser_sym(sym) \
     LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_source_span) sym ## libsat_source_span; \
     typedef LIBSAT_SYM(libsat_ast_node) sym ## libsat_ast_node; \
     static inline status FN_DECL_MUST_CHECK \
     sym ## libsat_parse( \
         LIBSAT_SYM(libsat_ast_node)** x, LIBSAT_SYM(libsat_context)* y, \
         const char* z) { \
             return LIBSAT_SYM(libsat_parse)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_parse_parallel( \
+        LIBSAT_SYM(libsat_ast_node)** w, LIBSAT_SYM(libsat_context)* x, \
+        const char* y, size_t z) { \
+            return LIBSAT_SYM(libsat_parse_parallel)(w,x,y,z); } \
     static inline RCPR_SYM(resource)* \
     sym ## libsat_ast_node_resource_handle( \
         LIBSAT_SYM(libsat_ast_node)* x) { \
             return LIBSAT_SYM(libsat_ast_node_resource_handle)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_node_rebase( \
+        LIBSAT_SYM(libsat_ast_node)* x, \
+        const LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_ast_node_rebase)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_evaluate( \
+        bool* w, const LIBSAT_SYM(libsat_ast_node)* x, const uint64_t* y, \
+        size_t z) { \
+            return LIBSAT_SYM(libsat_ast_evaluate)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_evaluate_batch( \
+        uint64_t* w, const LIBSAT_SYM(libsat_ast_node)* x, \
+        const uint64_t* y, size_t z) { \
+            return LIBSAT_SYM(libsat_ast_evaluate_batch)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_simulate( \
+        size_t* t, bool* u, const LIBSAT_SYM(libsat_ast_node)* const* v, \
+        size_t w, size_t x, size_t y, uint64_t z) { \
+            return LIBSAT_SYM(libsat_ast_simulate)(t,u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_print( \
+        char** u, size_t* v, size_t* w, RCPR_SYM(allocator)* x, \
+        const LIBSAT_SYM(libsat_context)* y, \
+        const LIBSAT_SYM(libsat_ast_node)* z) { \
+            return LIBSAT_SYM(libsat_ast_print)(u,v,w,x,y,z); } \
     LIBSAT_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define LIBSAT_IMPORT_parser_as(sym) \
@@ -66,6 +66,9 @@ enum LIBSAT_SYM(libsat_scanner_token_type)
     /** \brief A false literal always evaluates to false. */
     LIBSAT_SCANNER_TOKEN_TYPE_LITERAL_FALSE,
 
+    /** \brief The weight of a soft statement, such as [5]. */
+    LIBSAT_SCANNER_TOKEN_TYPE_WEIGHT,
+
     /** \brief "No operator" dummy token type. */
     LIBSAT_SCANNER_TOKEN_TYPE_NOP = 0x1000,
 
@@ -0,0 +1,170 @@
+/**
+ * \file libsat/snapshot.h
+ *
+ * \brief Binary snapshots of contexts and parsed statements for libsat.
+ *
+ * A snapshot holds the variable table of a context, and optionally a parsed
+ * AST, in a flat, versioned binary format. Every field is a little-endian
+ * 64-bit word, and every reference between nodes is an index to an earlier
+ * node, so a snapshot can be mapped into memory as it is and loaded with a
+ * single relocation pass over its nodes, instead of being parsed again.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/function_decl.h>
+#include <libsat/libsat_fwd.h>
+#include <libsat/parser.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A snapshot writer and loader over a context.
+ */
+typedef struct LIBSAT_SYM(libsat_snapshot) LIBSAT_SYM(libsat_snapshot);
+
+/**
+ * \brief The version of the snapshot format that is written, and the only
+ * one that is read.
+ */
+#define LIBSAT_SNAPSHOT_VERSION                                   ((uint64_t)1)
+
+/**
+ * \brief The most variables that a snapshot can hold.
+ *
+ * Unnamed variables take no space in a snapshot, so the variable count is
+ * bounded on its own, to keep a small snapshot from creating a huge context.
+ */
+#define LIBSAT_SNAPSHOT_VARIABLE_MAX                        ((size_t)1 << 24)
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a snapshot writer and loader over a context.
+ *
+ * \param snapshot      Pointer to the snapshot pointer to be set to this
+ *                      created instance on success.
+ * \param context       The context whose variables are written and loaded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_create)(
+    LIBSAT_SYM(libsat_snapshot)** snapshot,
+    LIBSAT_SYM(libsat_context)* context);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Write a snapshot of the context's variables and an optional AST.
+ *
+ * \note The data is owned by this snapshot, and is invalidated by the next
+ * write.
+ *
+ * \param data          Pointer to receive the snapshot data on success.
+ * \param size          Pointer to receive the size of the data on success.
+ * \param snapshot      The snapshot for this operation.
+ * \param node          The AST to write, or NULL to write the variables only.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - ERROR_LIBSAT_SNAPSHOT_TOO_LARGE if the context has more than
+ *        \ref LIBSAT_SNAPSHOT_VARIABLE_MAX variables.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_write)(
+    const uint8_t** data, size_t* size, LIBSAT_SYM(libsat_snapshot)* snapshot,
+    const LIBSAT_SYM(libsat_ast_node)* node);
+
+/**
+ * \brief Load a snapshot into the context.
+ *
+ * \note The AST is owned by this snapshot, must not be released, and is
+ * invalidated by the next load. Nothing refers to the data once this returns,
+ * so the data can be unmapped right away.
+ *
+ * \param node          Pointer to receive the AST on success, or NULL if the
+ *                      snapshot has none.
+ * \param snapshot      The snapshot for this operation.
+ * \param data          The snapshot data.
+ * \param size          The size of the snapshot data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT if the data is not a snapshot.
+ *      - ERROR_LIBSAT_SNAPSHOT_BAD_VERSION if the snapshot is of another
+ *        version.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_load)(
+    const LIBSAT_SYM(libsat_ast_node)** node,
+    LIBSAT_SYM(libsat_snapshot)* snapshot, const uint8_t* data, size_t size);
+
+/**
+ * \brief Given a \ref libsat_snapshot instance, return the resource handle for
+ * this instance.
+ *
+ * \param snapshot      The \ref libsat_snapshot instance from which the
+ *                      resource handle is returned.
+ *
+ * \returns the resource handle for this snapshot.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_snapshot_resource_handle)(
+    LIBSAT_SYM(libsat_snapshot)* snapshot);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_snapshot_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_snapshot) sym ## libsat_snapshot; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_snapshot_create( \
+        LIBSAT_SYM(libsat_snapshot)** x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_snapshot_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_snapshot_write( \
+        const uint8_t** w, size_t* x, LIBSAT_SYM(libsat_snapshot)* y, \
+        const LIBSAT_SYM(libsat_ast_node)* z) { \
+            return LIBSAT_SYM(libsat_snapshot_write)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_snapshot_load( \
+        const LIBSAT_SYM(libsat_ast_node)** w, \
+        LIBSAT_SYM(libsat_snapshot)* x, const uint8_t* y, size_t z) { \
+            return LIBSAT_SYM(libsat_snapshot_load)(w,x,y,z); } \
+    static inline RCPR_SYM(resource)* \
+    sym ## libsat_snapshot_resource_handle( \
+        LIBSAT_SYM(libsat_snapshot)* x) { \
+            return LIBSAT_SYM(libsat_snapshot_resource_handle)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_snapshot_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_snapshot_sym(sym ## _)
+#define LIBSAT_IMPORT_snapshot \
+    __INTERNAL_LIBSAT_IMPORT_snapshot_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,822 @@
+/**
+ * \file libsat/solver.h
+ *
+ * \brief Incremental solving for libsat.
+ *
+ * Statements asserted into a \ref libsat_context accumulate in its clause
+ * database. Each call to \ref libsat_solve_with_assumptions solves the current
+ * database under a set of temporary assumptions, keeping learned clauses,
+ * variable activity, and saved phases for the next call.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/cnf.h>
+#include <libsat/function_decl.h>
+#include <libsat/libsat_fwd.h>
+#include <libsat/literal.h>
+#include <libsat/parser.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief The result of a solve.
+ */
+enum LIBSAT_SYM(libsat_solve_result)
+{
+    /** \brief The solve was interrupted before reaching an answer. */
+    LIBSAT_SOLVE_RESULT_UNKNOWN =                                   0x0000,
+
+    /** \brief The database is satisfiable under the assumptions. */
+    LIBSAT_SOLVE_RESULT_SATISFIABLE =                               0x0001,
+
+    /** \brief The database is unsatisfiable under the assumptions. */
+    LIBSAT_SOLVE_RESULT_UNSATISFIABLE =                             0x0002,
+};
+
+/**
+ * \brief The decision heuristic of a solve.
+ */
+enum LIBSAT_SYM(libsat_solve_heuristic)
+{
+    /** \brief Exponential VSIDS, deciding the most active variable. */
+    LIBSAT_SOLVE_HEURISTIC_EVSIDS =                                 0x0000,
+
+    /** \brief Variable move-to-front, deciding the most recently bumped
+     * variable. */
+    LIBSAT_SOLVE_HEURISTIC_VMTF =                                   0x0001,
+};
+
+/**
+ * \brief The restart policy of a solve.
+ */
+enum LIBSAT_SYM(libsat_solve_restart)
+{
+    /** \brief Restart on the Luby sequence. */
+    LIBSAT_SOLVE_RESTART_LUBY =                                     0x0000,
+
+    /** \brief Restart on a geometric sequence. */
+    LIBSAT_SOLVE_RESTART_GEOMETRIC =                                0x0001,
+
+    /** \brief Restart when the LBD of recent learned clauses rises above
+     * its long-running average, as glucose does. */
+    LIBSAT_SOLVE_RESTART_GLUCOSE =                                  0x0002,
+
+    /** \brief Alternate between focused phases, which restart as glucose
+     * does, and ever longer stable phases, which restart rarely and decide
+     * towards the longest assignment found so far. */
+    LIBSAT_SOLVE_RESTART_STABILIZING =                              0x0003,
+};
+
+/**
+ * \brief The format of an unsatisfiability proof.
+ */
+enum LIBSAT_SYM(libsat_proof_format)
+{
+    /** \brief Binary DRAT, listing learned and deleted clauses. */
+    LIBSAT_PROOF_FORMAT_DRAT =                                      0x0000,
+
+    /** \brief Binary LRAT, which also numbers every clause and lists the
+     * clauses that each learned clause follows from. */
+    LIBSAT_PROOF_FORMAT_LRAT =                                      0x0001,
+};
+
+/**
+ * \brief The strategy of a MaxSAT solve.
+ */
+enum LIBSAT_SYM(libsat_maxsat_strategy)
+{
+    /** \brief Relax the cores of the soft statements from below, as OLL does,
+     * until a model is found. */
+    LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED =                            0x0000,
+
+    /** \brief Require cheaper models from above, one at a time, until there
+     * is none. */
+    LIBSAT_MAXSAT_STRATEGY_LINEAR =                                 0x0001,
+};
+
+/**
+ * \brief Options for a single solve.
+ *
+ * Options should be set up with \ref libsat_solve_options_init before any
+ * field is changed, so that fields added later keep their defaults.
+ */
+typedef struct LIBSAT_SYM(libsat_solve_options)
+LIBSAT_SYM(libsat_solve_options);
+struct LIBSAT_SYM(libsat_solve_options)
+{
+    /** \brief The \ref libsat_solve_heuristic to decide with. */
+    int heuristic;
+
+    /** \brief The \ref libsat_solve_restart policy. */
+    int restart;
+
+    /** \brief Periodically reset saved phases, in turn to the longest
+     * assignment found, to false, to true, and to random values. */
+    bool rephase;
+
+    /** \brief Give up after this many conflicts, or zero for no limit. */
+    uint64_t conflict_limit;
+
+    /** \brief Give up after this many propagations, or zero for no limit. */
+    uint64_t propagation_limit;
+
+    /** \brief Give up after this many milliseconds, or zero for no limit. */
+    uint64_t time_limit_ms;
+
+    /** \brief Give up once the solver holds more than this many bytes, or zero
+     * for no limit. */
+    size_t memory_limit;
+};
+
+/**
+ * \brief Receive a model found by \ref libsat_enumerate_models.
+ *
+ * \param user          The user pointer given to the enumeration.
+ * \param values        The \ref libsat_value of each projection variable, in
+ *                      the order of the projection. A variable that is
+ *                      unassigned can take either value.
+ * \param count         The number of projection variables.
+ *
+ * \returns true to go on to the next model, or false to stop.
+ */
+typedef bool (*LIBSAT_SYM(libsat_model_callback))(
+    void* user, const uint8_t* values, size_t count);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Assert a parsed statement or statement list in this context.
+ *
+ * Statements are converted to clauses with the Tseitin transformation. Pure
+ * parity statements built around exclusive disjunction are instead added to
+ * the native xor matrix of the context. Outside of a scope, statements that
+ * only make one variable an alias of another, such as a ↔ b or a := ¬b, are
+ * merged instead of encoded; an alias that nothing else uses yet costs the
+ * solver no clauses. Soft statements, parsed with a weight such as [5], are
+ * not asserted, but recorded for \ref libsat_solve_maxsat.
+ *
+ * \param context       The context for this operation.
+ * \param node          The statement or statement list to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT if the node is not a statement or
+ *        statement list.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_assert)(
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node);
+
+/**
+ * \brief Open a new assertion scope in this context.
+ *
+ * Statements asserted and clauses added after a push are retracted by the
+ * matching \ref libsat_context_pop, together with their auxiliary variables
+ * and everything learned from them. Each scope is guarded by an activation
+ * literal that the solver assumes while the scope is open.
+ *
+ * \note Parity statements asserted in a scope are encoded as clauses rather
+ * than added to the native xor matrix, and rows added directly to the matrix
+ * are not retracted.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_push)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Close the most recent assertion scope in this context.
+ *
+ * Everything asserted since the matching push is retracted. Variables created
+ * since the push, named or unique, are forgotten, and their ids are reused by
+ * the next variables created.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_SCOPE if no scope is open.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_pop)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Get the clause database of this context.
+ *
+ * Clauses and constraints added directly to this database are solved together
+ * with the asserted statements.
+ *
+ * \note The returned database is owned by the context.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns the clause database of this context, or NULL if an overlay could
+ * not create it.
+ */
+LIBSAT_SYM(libsat_cnf)*
+LIBSAT_SYM(libsat_context_cnf)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Simplify the clauses asserted in this context before solving.
+ *
+ * Units are propagated, equivalent literals found as cycles of binary clauses
+ * are replaced by one of them, subsumed clauses are removed, clauses are
+ * strengthened by self-subsuming resolution, and variables are eliminated by
+ * bounded variable elimination. Variables used by native constraints, the
+ * native xor matrix, or soft statements are kept.
+ *
+ * Eliminated variables still have values in every model, reconstructed from
+ * the clauses that were removed. A variable that is eliminated and then used
+ * again, by a later assertion, a clause added to the database, or an
+ * assumption, is added back along with its clauses before the next solve.
+ * Opening a scope adds back every eliminated variable.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - ERROR_LIBSAT_SOLVER_SCOPE_OPEN if a scope is open.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_ACTIVE if a proof is being written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_preprocess)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions.
+ *
+ * The assumptions only hold for this call. Learned clauses, variable activity
+ * and saved phases are kept for the next call. Long searches periodically
+ * probe for failed literals, shorten learned clauses, and delete the learned
+ * clauses that have stopped paying their way.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if a proof is being written, and the
+ *        database has changed since it began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and the database holds native constraints or parity statements.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if the proof could not be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_with_assumptions)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count);
+
+/**
+ * \brief Set solve options to their defaults.
+ *
+ * \param options       The options to set up.
+ */
+void
+LIBSAT_SYM(libsat_solve_options_init)(
+    LIBSAT_SYM(libsat_solve_options)* options);
+
+/**
+ * \brief Ask a solve running in this context to give up.
+ *
+ * This may be called from any thread, including while another thread solves
+ * in this context. The solve gives up with an unknown result before its next
+ * decision. A request made while no solve is running stops the next solve
+ * instead. Each solve clears the request as it returns.
+ *
+ * \param context       The context for this operation.
+ */
+void
+LIBSAT_SYM(libsat_context_terminate)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions, with
+ * options for this call.
+ *
+ * This is \ref libsat_solve_with_assumptions, except that the options choose
+ * how this call searches. Learned clauses and saved phases carry over between
+ * calls whatever the options; a heuristic that was not used by the last call
+ * picks up where it left off. Instances that turn out satisfiable tend to
+ * favor stabilizing restarts with rephasing, and unsatisfiable ones tend to
+ * favor glucose restarts.
+ *
+ * The limits of the options only apply to this call. A solve that reaches any
+ * of them gives up with an unknown result; the clauses learned so far are kept
+ * for the next call. The memory limit counts the memory of the solver itself,
+ * not that of the clause database or of parsed statements.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param options       The options for this call.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if an option is out of range.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if a proof is being written, and the
+ *        database has changed since it began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and the database holds native constraints or parity statements.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if the proof could not be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_with_options)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_solve_options)* options,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions with a
+ * portfolio of diversified workers running in parallel.
+ *
+ * The solver of the context runs on the calling thread, and every other worker
+ * gets its own thread and solver. Workers share short learned clauses, and the
+ * first to reach an answer stops the others. Its model or failed assumptions
+ * are then available through the context as after
+ * \ref libsat_solve_with_assumptions.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and more than one worker is asked for.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_portfolio)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count,
+    size_t thread_count);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions by
+ * splitting them into cubes, and solving the cubes in parallel.
+ *
+ * A lookahead on the solver of the context splits the problem on the
+ * variables that propagate the most, into about eight cubes per worker. A
+ * pool of workers then solves the cubes, stealing from each other as their own
+ * cubes run out. The model or failed assumptions are then available through
+ * the context as after \ref libsat_solve_with_assumptions.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and more than one worker is asked for.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_cube_and_conquer)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count,
+    size_t thread_count);
+
+/**
+ * \brief Get the value of a variable in the model found by the last solve.
+ *
+ * \param value         Pointer to receive the \ref libsat_value of this
+ *                      variable.
+ * \param context       The context for this operation.
+ * \param var_id        The variable id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_MODEL if the last solve was not satisfiable.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_model_value)(
+    uint8_t* value, const LIBSAT_SYM(libsat_context)* context, size_t var_id);
+
+/**
+ * \brief Get the failed assumptions from the last solve.
+ *
+ * These are a subset of the assumptions that is unsatisfiable together with
+ * the asserted statements. An empty core means that the statements are
+ * unsatisfiable on their own.
+ *
+ * \note The returned literals are owned by the context, and are invalidated
+ * by the next solve.
+ *
+ * \param core          Pointer to receive the failed assumptions.
+ * \param count         Pointer to receive the number of failed assumptions.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_CORE if the last solve was not
+ *        unsatisfiable.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_failed_assumptions)(
+    const LIBSAT_SYM(libsat_literal)** core, size_t* count,
+    const LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Find the statements responsible for the unsatisfiability of a
+ * statement list.
+ *
+ * Each statement is asserted in a new scope, guarded by a selector literal of
+ * its own, and the list is solved with every selector assumed. If it is
+ * unsatisfiable, the failed selectors give a first core, which is then
+ * minimized by leaving out one statement at a time: a statement is kept if
+ * the rest becomes satisfiable without it, and otherwise the core shrinks to
+ * the failed selectors of that solve. Each statement of the minimal core that
+ * remains is necessary. The scope is popped before this returns.
+ *
+ * Statements from \ref libsat_parse carry the span of input they were parsed
+ * from, so the core can be reported against the source.
+ *
+ * \note The returned statements are owned by the context, and are
+ * invalidated by the next call. They are in the order of the list. An empty
+ * core means that the statements asserted in the context are unsatisfiable on
+ * their own. A solve that gives up leaves its statement in the core.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result of the
+ *                      statements together with the context.
+ * \param core          Pointer to receive the statements of the core.
+ * \param count         Pointer to receive the number of statements in the
+ *                      core, which is zero unless the result is
+ *                      unsatisfiable.
+ * \param context       The context for this operation.
+ * \param node          The statement or statement list to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT if the node is not a statement or
+ *        statement list.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_statement_core)(
+    int* result, const LIBSAT_SYM(libsat_ast_node)*** core, size_t* count,
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node);
+
+/**
+ * \brief Enumerate the models of this context, projected onto the given
+ * variables.
+ *
+ * Each model found is reported to the callback and then blocked, so that the
+ * next solve finds a model that differs on the projection. The solver is kept
+ * between solves, along with what it has learned. Before a model is blocked,
+ * it is shrunk to a prime implicant: a projection variable is left out when
+ * every clause stays satisfied without it, so a single blocking clause covers
+ * every model that agrees with the rest. Variables outside of the projection
+ * keep their values while a model is shrunk, and a variable fixed by the
+ * clauses is never left out. Models are not shrunk while the database holds
+ * native constraints or parity statements.
+ *
+ * The models reported are disjoint, and together they cover every projected
+ * model exactly once. The blocking clauses are added in a scope that is popped
+ * before this returns.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      unsatisfiable once every model has been reported,
+ *                      satisfiable if the callback stopped the enumeration,
+ *                      and unknown if a solve gave up.
+ * \param count         Pointer to receive the number of models reported.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ * \param callback      The callback to receive each model.
+ * \param user          The user pointer passed to the callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_enumerate_models)(
+    int* result, size_t* count, LIBSAT_SYM(libsat_context)* context,
+    const size_t* projection, size_t projection_count,
+    LIBSAT_SYM(libsat_model_callback) callback, void* user);
+
+/**
+ * \brief Count the models of this context, projected onto the given
+ * variables.
+ *
+ * The count is exact. After each decision, what is left of the constraints is
+ * split into independent components, whose counts are multiplied, and the
+ * count of each component is cached for the next time it is seen. Native
+ * constraints and parity statements are counted directly. The count can be
+ * stopped with \ref libsat_context_terminate.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if the count is not zero, unsatisfiable if
+ *                      it is zero, and unknown if the count was stopped.
+ * \param count         Pointer to receive the count, as 32-bit words with the
+ *                      least significant word first. It is owned by the
+ *                      context, and is invalidated by the next count.
+ * \param word_count    Pointer to receive the number of words in the count,
+ *                      which is zero for a count of zero.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_count_models)(
+    int* result, const uint32_t** count, size_t* word_count,
+    LIBSAT_SYM(libsat_context)* context, const size_t* projection,
+    size_t projection_count);
+
+/**
+ * \brief Estimate the number of models of this context, projected onto the
+ * given variables.
+ *
+ * Random parity constraints over the projection are added to the native xor
+ * matrix until the models left in the cell that they pick can be enumerated
+ * below a threshold, and the median of many such cells estimates the count.
+ * The estimate is cells · 2^hashes, and is within a factor of 1 + epsilon of
+ * the count with a probability of at least 1 - delta; a count below the
+ * threshold is exact, with no hashes. The same seed gives the same estimate.
+ * The parity constraints are gone when this returns.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if the estimate is not zero, unsatisfiable
+ *                      if it is zero, and unknown if a solve gave up.
+ * \param cells         Pointer to receive the number of models in the median
+ *                      cell.
+ * \param hashes        Pointer to receive the number of parity constraints of
+ *                      the median cell.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ * \param epsilon       The tolerance of the estimate, which must be positive.
+ * \param delta         The confidence of the estimate, which must be between
+ *                      zero and one.
+ * \param seed          The seed of the parity constraints.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if epsilon or delta is out of range.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_approx_count_models)(
+    int* result, size_t* cells, size_t* hashes,
+    LIBSAT_SYM(libsat_context)* context, const size_t* projection,
+    size_t projection_count, double epsilon, double delta, uint64_t seed);
+
+/**
+ * \brief Solve this context for the cheapest set of soft statements to
+ * violate.
+ *
+ * The cost of a model is the sum of the weights of the soft statements that
+ * it violates, and every statement without a weight must hold. The search
+ * reuses the incremental solver under a scope, and afterward the optimal model
+ * can be read with \ref libsat_model_value.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if an optimal model was found,
+ *                      unsatisfiable if the statements without a weight can
+ *                      not hold, and unknown if a solve gave up.
+ * \param cost          Pointer to receive the cost of the optimal model, or of
+ *                      the best model found if a solve gave up, or UINT64_MAX
+ *                      if there is no such model.
+ * \param context       The context for this operation.
+ * \param strategy      The \ref libsat_maxsat_strategy to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if the strategy is not recognized.
+ *      - ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW if the weights of the soft
+ *        statements sum past 64 bits.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_maxsat)(
+    int* result, uint64_t* cost, LIBSAT_SYM(libsat_context)* context,
+    int strategy);
+
+/**
+ * \brief Begin writing a proof of the solves in this context.
+ *
+ * Every clause learned or deleted by later solves is written to the given file
+ * descriptor, in binary DRAT or LRAT, through a large buffer. The proof checks
+ * against the clauses of the database in the order of
+ * \ref libsat_cnf_clause_get, which are numbered from one in LRAT. A solve
+ * that finds the database unsatisfiable ends the proof with the empty clause;
+ * under assumptions, it ends with the negation of the failed assumptions,
+ * including the activation literals of open scopes.
+ *
+ * The proof must begin before the first solve of the context, and the database
+ * must not change while it is written. Proofs cover clauses only, so the
+ * database may not hold native constraints or parity statements, and
+ * parallel solves are refused.
+ *
+ * \param context       The context for this operation.
+ * \param fd            The file descriptor to write to. It stays open, and
+ *                      remains owned by the caller.
+ * \param format        The \ref libsat_proof_format to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if the format is unknown.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_ACTIVE if a proof is already being written.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if the context has already
+ *        solved, or holds native constraints.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_proof_begin)(
+    LIBSAT_SYM(libsat_context)* context, int fd, int format);
+
+/**
+ * \brief Finish the proof being written in this context.
+ *
+ * Whatever is still buffered is written out. Solves after this are no longer
+ * logged.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_PROOF if no proof is being written.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if some part of the proof could not
+ *        be written.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_proof_end)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_solver_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_solve_options) sym ## libsat_solve_options; \
+    typedef LIBSAT_SYM(libsat_model_callback) sym ## libsat_model_callback; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_assert( \
+        LIBSAT_SYM(libsat_context)* x, \
+        const LIBSAT_SYM(libsat_ast_node)* y) { \
+            return LIBSAT_SYM(libsat_context_assert)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_push( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_push)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_pop( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_pop)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_preprocess( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_preprocess)(x); } \
+    static inline LIBSAT_SYM(libsat_cnf)* \
+    sym ## libsat_context_cnf( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_cnf)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_solve_with_assumptions( \
+        int* w, LIBSAT_SYM(libsat_context)* x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_solve_with_assumptions)(w,x,y,z); } \
+    static inline void \
+    sym ## libsat_solve_options_init( \
+        LIBSAT_SYM(libsat_solve_options)* x) { \
+            LIBSAT_SYM(libsat_solve_options_init)(x); } \
+    static inline void \
+    sym ## libsat_context_terminate( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            LIBSAT_SYM(libsat_context_terminate)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_solve_with_options( \
+        int* v, LIBSAT_SYM(libsat_context)* w, \
+        const LIBSAT_SYM(libsat_solve_options)* x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_solve_with_options)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_solve_portfolio( \
+        int* v, LIBSAT_SYM(libsat_context)* w, \
+        const LIBSAT_SYM(libsat_literal)* x, size_t y, size_t z) { \
+            return LIBSAT_SYM(libsat_solve_portfolio)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_solve_cube_and_conquer( \
+        int* v, LIBSAT_SYM(libsat_context)* w, \
+        const LIBSAT_SYM(libsat_literal)* x, size_t y, size_t z) { \
+            return LIBSAT_SYM(libsat_solve_cube_and_conquer)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_model_value( \
+        uint8_t* x, const LIBSAT_SYM(libsat_context)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_model_value)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_failed_assumptions( \
+        const LIBSAT_SYM(libsat_literal)** x, size_t* y, \
+        const LIBSAT_SYM(libsat_context)* z) { \
+            return LIBSAT_SYM(libsat_failed_assumptions)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_enumerate_models( \
+        int* t, size_t* u, LIBSAT_SYM(libsat_context)* v, const size_t* w, \
+        size_t x, LIBSAT_SYM(libsat_model_callback) y, void* z) { \
+            return LIBSAT_SYM(libsat_enumerate_models)(t,u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_count_models( \
+        int* u, const uint32_t** v, size_t* w, \
+        LIBSAT_SYM(libsat_context)* x, const size_t* y, size_t z) { \
+            return LIBSAT_SYM(libsat_count_models)(u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_approx_count_models( \
+        int* q, size_t* r, size_t* s, LIBSAT_SYM(libsat_context)* t, \
+        const size_t* u, size_t v, double w, double x, uint64_t y) { \
+            return LIBSAT_SYM(libsat_approx_count_models)( \
+                q,r,s,t,u,v,w,x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_solve_maxsat( \
+        int* w, uint64_t* x, LIBSAT_SYM(libsat_context)* y, int z) { \
+            return LIBSAT_SYM(libsat_solve_maxsat)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_statement_core( \
+        int* v, const LIBSAT_SYM(libsat_ast_node)*** w, size_t* x, \
+        LIBSAT_SYM(libsat_context)* y, \
+        const LIBSAT_SYM(libsat_ast_node)* z) { \
+            return LIBSAT_SYM(libsat_statement_core)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_proof_begin( \
+        LIBSAT_SYM(libsat_context)* x, int y, int z) { \
+            return LIBSAT_SYM(libsat_context_proof_begin)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_context_proof_end( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(libsat_context_proof_end)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_solver_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_solver_sym(sym ## _)
+#define LIBSAT_IMPORT_solver \
+    __INTERNAL_LIBSAT_IMPORT_solver_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -10,6 +10,11 @@
 #pragma once
 
 #include <libsat/component.h>
+#include <libsat/status/aig.h>
 #include <libsat/status/base.h>
+#include <libsat/status/cnf.h>
 #include <libsat/status/parser.h>
+#include <libsat/status/snapshot.h>
+#include <libsat/status/solver.h>
+#include <libsat/status/xor.h>
 #include <rcpr/status.h>
@@ -0,0 +1,30 @@
+/**
+ * \file libsat/status/aig.h
+ *
+ * \brief aig status codes for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/status.h>
+
+/**
+ * \brief An edge refers to a node that is not in the graph.
+ */
+#define ERROR_LIBSAT_AIG_BAD_EDGE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_AIG, 0x0000)
+
+/**
+ * \brief AIGER data is malformed, or uses a feature that can't be read.
+ */
+#define ERROR_LIBSAT_AIG_BAD_FORMAT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_AIG, 0x0001)
+
+/**
+ * \brief A circuit needs an input node that is neither an input nor a latch.
+ */
+#define ERROR_LIBSAT_AIG_UNBOUND_INPUT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_AIG, 0x0002)
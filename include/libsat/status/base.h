@@ -29,3 +29,39 @@
  */
 #define ERROR_LIBSAT_BASE_VARIABLE_GET_CREATE_ALREADY_EXISTS \
     STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0002)
+
+/**
+ * \brief The context is frozen, and its variable table can't be changed.
+ */
+#define ERROR_LIBSAT_BASE_CONTEXT_FROZEN \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0003)
+
+/**
+ * \brief An overlay can only be created over a frozen context.
+ */
+#define ERROR_LIBSAT_BASE_CONTEXT_NOT_FROZEN \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0004)
+
+/**
+ * \brief The context is an overlay, and can't be used as a base.
+ */
+#define ERROR_LIBSAT_BASE_CONTEXT_IS_OVERLAY \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0005)
+
+/**
+ * \brief The context is not an overlay of the given base.
+ */
+#define ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0006)
+
+/**
+ * \brief The overlay has already been merged into its base.
+ */
+#define ERROR_LIBSAT_BASE_OVERLAY_MERGED \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0007)
+
+/**
+ * \brief The overlay has not yet been merged into its base.
+ */
+#define ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED \
+    STATUS_CODE(1, LIBSAT_COMPONENT_BASE, 0x0008)
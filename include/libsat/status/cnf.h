@@ -0,0 +1,54 @@
+/**
+ * \file libsat/status/cnf.h
+ *
+ * \brief cnf status codes for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/status.h>
+
+/**
+ * \brief The constraint relation is not recognized.
+ */
+#define ERROR_LIBSAT_CNF_BAD_RELATION \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0000)
+
+/**
+ * \brief The constraint encoding is not recognized.
+ */
+#define ERROR_LIBSAT_CNF_BAD_ENCODING \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0001)
+
+/**
+ * \brief The sum of the constraint weights does not fit in 64 bits.
+ */
+#define ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0002)
+
+/**
+ * \brief The clause index is out of range.
+ */
+#define ERROR_LIBSAT_CNF_INDEX_OUT_OF_RANGE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0003)
+
+/**
+ * \brief The current assignment violates a native constraint.
+ */
+#define ERROR_LIBSAT_CNF_CONFLICT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0004)
+
+/**
+ * \brief The buffer for implied literals is too small.
+ */
+#define ERROR_LIBSAT_CNF_IMPLIED_BUFFER_TOO_SMALL \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0005)
+
+/**
+ * \brief The requested encoding would be too large to build.
+ */
+#define ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_CNF, 0x0006)
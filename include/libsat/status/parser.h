@@ -58,3 +58,21 @@
  */
 #define ERROR_LIBSAT_PARSER_INCOMPLETE_EXPRESSION \
     STATUS_CODE(1, LIBSAT_COMPONENT_PARSER, 0x0007)
+
+/**
+ * \brief A parser worker thread could not be started.
+ */
+#define ERROR_LIBSAT_PARSER_THREAD_CREATE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_PARSER, 0x0008)
+
+/**
+ * \brief A variable is outside of the given assignment.
+ */
+#define ERROR_LIBSAT_PARSER_BAD_VARIABLE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_PARSER, 0x0009)
+
+/**
+ * \brief A simulation width of zero words was requested.
+ */
+#define ERROR_LIBSAT_PARSER_BAD_WIDTH \
+    STATUS_CODE(1, LIBSAT_COMPONENT_PARSER, 0x000A)
@@ -0,0 +1,31 @@
+/**
+ * \file libsat/status/snapshot.h
+ *
+ * \brief snapshot status codes for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/status.h>
+
+/**
+ * \brief Snapshot data is malformed.
+ */
+#define ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SNAPSHOT, 0x0000)
+
+/**
+ * \brief Snapshot data was written in a version of the format that can't be
+ * read.
+ */
+#define ERROR_LIBSAT_SNAPSHOT_BAD_VERSION \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SNAPSHOT, 0x0001)
+
+/**
+ * \brief A context has too many variables to be written to a snapshot.
+ */
+#define ERROR_LIBSAT_SNAPSHOT_TOO_LARGE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SNAPSHOT, 0x0002)
@@ -0,0 +1,96 @@
+/**
+ * \file libsat/status/solver.h
+ *
+ * \brief solver status codes for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/status.h>
+
+/**
+ * \brief An assumption refers to a variable that does not exist.
+ */
+#define ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0000)
+
+/**
+ * \brief There is no model, because the last solve was not satisfiable.
+ */
+#define ERROR_LIBSAT_SOLVER_NO_MODEL \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0001)
+
+/**
+ * \brief There is no core, because the last solve was not unsatisfiable.
+ */
+#define ERROR_LIBSAT_SOLVER_NO_CORE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0002)
+
+/**
+ * \brief The node to assert is not a statement or statement list.
+ */
+#define ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0003)
+
+/**
+ * \brief There is no scope to pop.
+ */
+#define ERROR_LIBSAT_SOLVER_NO_SCOPE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0004)
+
+/**
+ * \brief A portfolio worker thread could not be started.
+ */
+#define ERROR_LIBSAT_SOLVER_THREAD_CREATE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0005)
+
+/**
+ * \brief The operation needs every assertion scope to be closed.
+ */
+#define ERROR_LIBSAT_SOLVER_SCOPE_OPEN \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0006)
+
+/**
+ * \brief An option of a solve is out of range.
+ */
+#define ERROR_LIBSAT_SOLVER_BAD_OPTION \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0007)
+
+/**
+ * \brief A proof is already being written in this context.
+ */
+#define ERROR_LIBSAT_SOLVER_PROOF_ACTIVE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0008)
+
+/**
+ * \brief No proof is being written in this context.
+ */
+#define ERROR_LIBSAT_SOLVER_NO_PROOF \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x0009)
+
+/**
+ * \brief A proof cannot cover this context or this solve.
+ */
+#define ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x000a)
+
+/**
+ * \brief The clause database changed while a proof was being written.
+ */
+#define ERROR_LIBSAT_SOLVER_PROOF_STALE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x000b)
+
+/**
+ * \brief The proof could not be written.
+ */
+#define ERROR_LIBSAT_SOLVER_PROOF_WRITE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x000c)
+
+/**
+ * \brief A variable does not exist.
+ */
+#define ERROR_LIBSAT_SOLVER_BAD_VARIABLE \
+    STATUS_CODE(1, LIBSAT_COMPONENT_SOLVER, 0x000d)
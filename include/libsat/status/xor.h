@@ -0,0 +1,36 @@
+/**
+ * \file libsat/status/xor.h
+ *
+ * \brief xor status codes for libsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/status.h>
+
+/**
+ * \brief The statement is not a pure parity constraint.
+ */
+#define ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_XOR, 0x0000)
+
+/**
+ * \brief The parity constraints reduce to 0 = 1.
+ */
+#define ERROR_LIBSAT_XOR_INCONSISTENT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_XOR, 0x0001)
+
+/**
+ * \brief The current assignment violates a parity constraint.
+ */
+#define ERROR_LIBSAT_XOR_CONFLICT \
+    STATUS_CODE(1, LIBSAT_COMPONENT_XOR, 0x0002)
+
+/**
+ * \brief The buffer for implied literals is too small.
+ */
+#define ERROR_LIBSAT_XOR_IMPLIED_BUFFER_TOO_SMALL \
+    STATUS_CODE(1, LIBSAT_COMPONENT_XOR, 0x0003)
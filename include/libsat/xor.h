@@ -0,0 +1,216 @@
+/**
+ * \file libsat/xor.h
+ *
+ * \brief Native parity (xor) constraints for libsat.
+ *
+ * Chains of exclusive disjunctions are kept out of CNF and stored instead as
+ * rows of a bit-packed GF(2) matrix. Propagation performs Gaussian elimination
+ * over the unassigned columns of this matrix, which detects every unit and
+ * every conflict implied by the parity constraints as a whole.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/function_decl.h>
+#include <libsat/libsat_fwd.h>
+#include <libsat/literal.h>
+#include <libsat/parser.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A GF(2) matrix of parity constraints.
+ */
+typedef struct LIBSAT_SYM(libsat_xor_matrix) LIBSAT_SYM(libsat_xor_matrix);
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create an empty xor matrix instance.
+ *
+ * \param matrix        Pointer to the matrix pointer to be set to this created
+ *                      matrix instance on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_create)(
+    LIBSAT_SYM(libsat_xor_matrix)** matrix,
+    LIBSAT_SYM(libsat_context)* context);
+
+/******************************************************************************/
+/* Start of public methods.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Add a parsed statement to the matrix as a parity constraint.
+ *
+ * The statement must consist only of exclusive disjunctions, biconditionals,
+ * assignments, negations, variables, and boolean literals. Any such statement
+ * is equivalent to a single row of the form x1 ⊻ x2 ⊻ ... ⊻ xn = parity.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param statement     The statement node to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT if the statement contains any
+ *        other operator. The matrix is unchanged in this case.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_add_statement)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    const LIBSAT_SYM(libsat_ast_node)* statement);
+
+/**
+ * \brief Add a row of the form vars[0] ⊻ ... ⊻ vars[count-1] = parity.
+ *
+ * \note A variable that appears twice cancels itself out.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param vars          The variable ids in this row.
+ * \param count         The number of variable ids in this row.
+ * \param parity        The parity of this row.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_add_row)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, const size_t* vars, size_t count,
+    bool parity);
+
+/**
+ * \brief Reduce the matrix to reduced row echelon form, dropping redundant
+ * rows.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_INCONSISTENT if the rows reduce to 0 = 1.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_eliminate)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Propagate the matrix under a partial assignment.
+ *
+ * Gaussian elimination is performed on the fly over the unassigned columns of
+ * a working copy of the matrix. Every row that is left with a single
+ * unassigned variable implies a value for that variable, and every row that is
+ * left with no unassigned variables and the wrong parity is a conflict.
+ *
+ * \param implied_count Pointer to receive the number of implied literals.
+ * \param matrix        The matrix for this operation.
+ * \param values        The current assignment, indexed by variable id. Each
+ *                      entry is a \ref libsat_value.
+ * \param value_count   The number of entries in \p values. Variables beyond
+ *                      this count are unassigned.
+ * \param implied       Array to receive the implied literals. This must have
+ *                      room for \p implied_max literals.
+ * \param implied_max   The capacity of \p implied. A capacity equal to the
+ *                      row count of the matrix is always sufficient.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_CONFLICT if the assignment violates the matrix.
+ *      - ERROR_LIBSAT_XOR_IMPLIED_BUFFER_TOO_SMALL if more than
+ *        \p implied_max literals are implied.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_propagate)(
+    size_t* implied_count, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    const uint8_t* values, size_t value_count,
+    LIBSAT_SYM(libsat_literal)* implied, size_t implied_max);
+
+/**
+ * \brief Get the number of rows in the matrix.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns the number of rows in this matrix.
+ */
+size_t
+LIBSAT_SYM(libsat_xor_matrix_row_count)(
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Given a \ref libsat_xor_matrix instance, return the resource handle
+ * for this instance.
+ *
+ * \param matrix        The \ref libsat_xor_matrix instance from which the
+ *                      resource handle is returned.
+ *
+ * \returns the resource handle for this matrix instance.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_xor_matrix_resource_handle)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/******************************************************************************/
+/* Start of public exports.                                                   */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_xor_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_xor_matrix) sym ## libsat_xor_matrix; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_create( \
+        LIBSAT_SYM(libsat_xor_matrix)** x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(libsat_xor_matrix_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_add_statement( \
+        LIBSAT_SYM(libsat_xor_matrix)* x, \
+        const LIBSAT_SYM(libsat_ast_node)* y) { \
+            return LIBSAT_SYM(libsat_xor_matrix_add_statement)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_add_row( \
+        LIBSAT_SYM(libsat_xor_matrix)* w, const size_t* x, size_t y, \
+        bool z) { \
+            return LIBSAT_SYM(libsat_xor_matrix_add_row)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_eliminate( \
+        LIBSAT_SYM(libsat_xor_matrix)* x) { \
+            return LIBSAT_SYM(libsat_xor_matrix_eliminate)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_propagate( \
+        size_t* u, LIBSAT_SYM(libsat_xor_matrix)* v, const uint8_t* w, \
+        size_t x, LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(libsat_xor_matrix_propagate)(u,v,w,x,y,z); } \
+    static inline size_t \
+    sym ## libsat_xor_matrix_row_count( \
+        const LIBSAT_SYM(libsat_xor_matrix)* x) { \
+            return LIBSAT_SYM(libsat_xor_matrix_row_count)(x); } \
+    static inline RCPR_SYM(resource)* \
+    sym ## libsat_xor_matrix_resource_handle( \
+        LIBSAT_SYM(libsat_xor_matrix)* x) { \
+            return LIBSAT_SYM(libsat_xor_matrix_resource_handle)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_xor_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_xor_sym(sym ## _)
+#define LIBSAT_IMPORT_xor \
+    __INTERNAL_LIBSAT_IMPORT_xor_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
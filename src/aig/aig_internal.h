@@ -0,0 +1,151 @@
+/**
+ * \file aig/aig_internal.h
+ *
+ * \brief Internal details for and-inverter graphs.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/aig.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/resource/protected.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief A node of an and-inverter graph.
+ *
+ * Node 0 is the constant false node. An input node has a variable and no
+ * fanins. An AND node has LIBSAT_AIG_NO_VARIABLE as its variable, and its
+ * fanins are ordered so that fanin[0] < fanin[1]. Fanins always precede the
+ * nodes that use them.
+ */
+typedef struct LIBSAT_SYM(aig_node) LIBSAT_SYM(aig_node);
+struct LIBSAT_SYM(aig_node)
+{
+    LIBSAT_SYM(libsat_aig_edge) fanin[2];
+    size_t variable;
+};
+
+/**
+ * \brief libsat_aig implementation.
+ */
+struct LIBSAT_SYM(libsat_aig)
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    LIBSAT_SYM(libsat_context)* context;
+    LIBSAT_SYM(aig_node)* nodes;
+    size_t node_count;
+    size_t node_capacity;
+    size_t and_count;
+    size_t* table;
+    size_t table_count;
+    size_t table_capacity;
+    size_t* inputs;
+    size_t input_capacity;
+    size_t* circuit_variables;
+    LIBSAT_SYM(libsat_aig_edge)* circuit_edges;
+    uint8_t* buffer;
+    size_t buffer_capacity;
+};
+
+/**
+ * \brief Return true if the given node is an AND node.
+ */
+static inline bool aig_node_is_and(
+    const LIBSAT_SYM(libsat_aig)* aig, size_t node)
+{
+    return 0 != node && LIBSAT_AIG_NO_VARIABLE == aig->nodes[node].variable;
+}
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Release a \ref libsat_aig resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_resource_release)(
+    RCPR_SYM(resource)* r);
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Append a node to the graph, growing it if needed.
+ *
+ * \param node          Pointer to receive the index of the new node.
+ * \param aig           The graph for this operation.
+ * \param fanin0        The first fanin, or zero for an input.
+ * \param fanin1        The second fanin, or zero for an input.
+ * \param variable      The variable of an input, or LIBSAT_AIG_NO_VARIABLE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(aig_node_append)(
+    size_t* node, LIBSAT_SYM(libsat_aig)* aig,
+    LIBSAT_SYM(libsat_aig_edge) fanin0, LIBSAT_SYM(libsat_aig_edge) fanin1,
+    size_t variable);
+
+/**
+ * \brief Exchange the nodes, tables, and inputs of two graphs over the same
+ * context.
+ *
+ * \param lhs           The first graph.
+ * \param rhs           The second graph.
+ */
+void
+LIBSAT_SYM(aig_swap)(
+    LIBSAT_SYM(libsat_aig)* lhs, LIBSAT_SYM(libsat_aig)* rhs);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_aig_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(aig_node) sym ## aig_node; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_aig_resource_release( \
+        RCPR_SYM(resource)* x) { \
+            return LIBSAT_SYM(libsat_aig_resource_release)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## aig_node_append( \
+        size_t* v, LIBSAT_SYM(libsat_aig)* w, LIBSAT_SYM(libsat_aig_edge) x, \
+        LIBSAT_SYM(libsat_aig_edge) y, size_t z) { \
+            return LIBSAT_SYM(aig_node_append)(v,w,x,y,z); } \
+    static inline void \
+    sym ## aig_swap( \
+        LIBSAT_SYM(libsat_aig)* x, LIBSAT_SYM(libsat_aig)* y) { \
+            LIBSAT_SYM(aig_swap)(x,y); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_aig_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_aig_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_aig_internal \
+    __INTERNAL_LIBSAT_IMPORT_aig_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
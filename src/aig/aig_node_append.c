@@ -0,0 +1,61 @@
+/**
+ * \file aig/aig_node_append.c
+ *
+ * \brief Append a node to a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Append a node to the graph, growing it if needed.
+ *
+ * \param node          Pointer to receive the index of the new node.
+ * \param aig           The graph for this operation.
+ * \param fanin0        The first fanin, or zero for an input.
+ * \param fanin1        The second fanin, or zero for an input.
+ * \param variable      The variable of an input, or LIBSAT_AIG_NO_VARIABLE.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(aig_node_append)(
+    size_t* node, LIBSAT_SYM(libsat_aig)* aig,
+    LIBSAT_SYM(libsat_aig_edge) fanin0, LIBSAT_SYM(libsat_aig_edge) fanin1,
+    size_t variable)
+{
+    status retval;
+
+    /* grow the node array if needed. */
+    if (aig->node_count == aig->node_capacity)
+    {
+        size_t capacity =
+            (0 == aig->node_capacity) ? 64 : 2 * aig->node_capacity;
+
+        retval =
+            memory_resize(
+                aig->alloc, (void**)&aig->nodes,
+                capacity * sizeof(*aig->nodes));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        aig->node_capacity = capacity;
+    }
+
+    aig->nodes[aig->node_count].fanin[0] = fanin0;
+    aig->nodes[aig->node_count].fanin[1] = fanin1;
+    aig->nodes[aig->node_count].variable = variable;
+    *node = aig->node_count++;
+
+    return STATUS_SUCCESS;
+}
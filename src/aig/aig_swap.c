@@ -0,0 +1,33 @@
+/**
+ * \file aig/aig_swap.c
+ *
+ * \brief Exchange the contents of two graphs.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "aig_internal.h"
+
+/**
+ * \brief Exchange the nodes, tables, and inputs of two graphs over the same
+ * context.
+ *
+ * \param lhs           The first graph.
+ * \param rhs           The second graph.
+ */
+void
+LIBSAT_SYM(aig_swap)(
+    LIBSAT_SYM(libsat_aig)* lhs, LIBSAT_SYM(libsat_aig)* rhs)
+{
+    RCPR_SYM(resource) lhs_hdr = lhs->hdr;
+    RCPR_SYM(resource) rhs_hdr = rhs->hdr;
+    LIBSAT_SYM(libsat_aig) tmp = *lhs;
+
+    *lhs = *rhs;
+    *rhs = tmp;
+
+    /* each graph keeps its own resource header. */
+    lhs->hdr = lhs_hdr;
+    rhs->hdr = rhs_hdr;
+}
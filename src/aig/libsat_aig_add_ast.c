@@ -0,0 +1,384 @@
+/**
+ * \file aig/libsat_aig_add_ast.c
+ *
+ * \brief Add a parsed AST to a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A node on the walk stack, visited once on entry and once on exit.
+ */
+typedef struct add_frame add_frame;
+struct add_frame
+{
+    const libsat_ast_node* node;
+    bool exit;
+};
+
+/**
+ * \brief The explicit stacks of the walk.
+ */
+typedef struct add_stacks add_stacks;
+struct add_stacks
+{
+    allocator* alloc;
+    add_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    libsat_aig_edge* edges;
+    size_t edge_count;
+    size_t edge_capacity;
+};
+
+/* forward decls. */
+static status push_frame(
+    add_stacks* stacks, const libsat_ast_node* node, bool exit);
+static status push_edge(add_stacks* stacks, libsat_aig_edge edge);
+static status lower_binary(
+    libsat_aig_edge* edge, libsat_aig* aig, int type, libsat_aig_edge lhs,
+    libsat_aig_edge rhs);
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size);
+
+/**
+ * \brief Add a parsed AST to this graph.
+ *
+ * Negations flip edges, disjunctions and implications become complemented
+ * ANDs, and exclusive disjunctions and biconditionals become three ANDs each.
+ * A statement list becomes the AND of its hard statements; soft statements
+ * are skipped.
+ *
+ * \param edge          Pointer to receive the edge for this AST on success.
+ * \param aig           The graph for this operation.
+ * \param node          The AST to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_add_ast)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    const LIBSAT_SYM(libsat_ast_node)* node)
+{
+    status retval, release_retval;
+    add_stacks stacks;
+    const libsat_ast_node* i;
+    libsat_aig_edge value, rhs;
+
+    memset(&stacks, 0, sizeof(stacks));
+    stacks.alloc = aig->alloc;
+
+    retval = push_frame(&stacks, node, false);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stacks;
+    }
+
+    /* walk the tree without recursion, since chains can be long. */
+    while (stacks.frame_count > 0)
+    {
+        add_frame frame = stacks.frames[--stacks.frame_count];
+        node = frame.node;
+
+        if (LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->type)
+        {
+            retval =
+                libsat_aig_input(&value, aig, node->value.variable_index);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = push_edge(&stacks, value);
+            }
+        }
+        else if (LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL == node->type)
+        {
+            retval =
+                push_edge(
+                    &stacks,
+                    node->value.boolean_literal
+                        ? LIBSAT_AIG_EDGE_TRUE : LIBSAT_AIG_EDGE_FALSE);
+        }
+        /* on entry, revisit this node after its children. */
+        else if (!frame.exit)
+        {
+            retval = push_frame(&stacks, node, true);
+
+            switch (node->type)
+            {
+                case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(&stacks, node->value.unary, false);
+                    }
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+                case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                    /* the rhs is pushed first, so the lhs is built first. */
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(
+                                &stacks, node->value.binary.rhs, false);
+                    }
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(
+                                &stacks, node->value.binary.lhs, false);
+                    }
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                    /* soft statements do not constrain the list. */
+                    retval = push_edge(&stacks, LIBSAT_AIG_EDGE_TRUE);
+                    for (
+                        i = node->value.list.head;
+                        NULL != i && STATUS_SUCCESS == retval; i = i->next)
+                    {
+                        if (0 == i->weight)
+                        {
+                            retval = push_frame(&stacks, i, false);
+                        }
+                    }
+                    break;
+
+                default:
+                    retval = ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE;
+                    break;
+            }
+        }
+        /* on exit, the edges of the children are on the edge stack. */
+        else
+        {
+            switch (node->type)
+            {
+                case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+                    stacks.edges[stacks.edge_count - 1] =
+                        LIBSAT_AIG_EDGE_NOT(
+                            stacks.edges[stacks.edge_count - 1]);
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                    /* fold the hard statements into the true pushed first. */
+                    for (
+                        i = node->value.list.head;
+                        NULL != i && STATUS_SUCCESS == retval; i = i->next)
+                    {
+                        if (0 == i->weight)
+                        {
+                            rhs = stacks.edges[--stacks.edge_count];
+                            retval =
+                                libsat_aig_and(
+                                    &stacks.edges[stacks.edge_count - 1],
+                                    aig, stacks.edges[stacks.edge_count - 1],
+                                    rhs);
+                        }
+                    }
+                    break;
+
+                default:
+                    rhs = stacks.edges[--stacks.edge_count];
+                    retval =
+                        lower_binary(
+                            &stacks.edges[stacks.edge_count - 1], aig,
+                            node->type, stacks.edges[stacks.edge_count - 1],
+                            rhs);
+                    break;
+            }
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_stacks;
+        }
+    }
+
+    /* success. */
+    *edge = stacks.edges[0];
+    retval = STATUS_SUCCESS;
+
+cleanup_stacks:
+    if (NULL != stacks.frames)
+    {
+        release_retval = allocator_reclaim(stacks.alloc, stacks.frames);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != stacks.edges)
+    {
+        release_retval = allocator_reclaim(stacks.alloc, stacks.edges);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Lower a binary operator to ANDs.
+ *
+ * \param edge          Pointer to receive the edge of this operation.
+ * \param aig           The graph for this operation.
+ * \param type          The AST node type of the operator.
+ * \param lhs           The edge of the left-hand side.
+ * \param rhs           The edge of the right-hand side.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status lower_binary(
+    libsat_aig_edge* edge, libsat_aig* aig, int type, libsat_aig_edge lhs,
+    libsat_aig_edge rhs)
+{
+    status retval;
+    libsat_aig_edge left, right;
+
+    switch (type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            return libsat_aig_and(edge, aig, lhs, rhs);
+
+        /* a ∨ b is ¬(¬a ∧ ¬b). */
+        case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            retval =
+                libsat_aig_and(
+                    edge, aig, LIBSAT_AIG_EDGE_NOT(lhs),
+                    LIBSAT_AIG_EDGE_NOT(rhs));
+            *edge = LIBSAT_AIG_EDGE_NOT(*edge);
+            return retval;
+
+        /* a → b is ¬(a ∧ ¬b). */
+        case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+            retval = libsat_aig_and(edge, aig, lhs, LIBSAT_AIG_EDGE_NOT(rhs));
+            *edge = LIBSAT_AIG_EDGE_NOT(*edge);
+            return retval;
+
+        /* a ⊻ b is ¬(¬(a ∧ ¬b) ∧ ¬(¬a ∧ b)), and a ↔ b is its complement. */
+        default:
+            retval = libsat_aig_and(&left, aig, lhs, LIBSAT_AIG_EDGE_NOT(rhs));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval = libsat_aig_and(&right, aig, LIBSAT_AIG_EDGE_NOT(lhs), rhs);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            retval =
+                libsat_aig_and(
+                    edge, aig, LIBSAT_AIG_EDGE_NOT(left),
+                    LIBSAT_AIG_EDGE_NOT(right));
+            if (LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION == type)
+            {
+                *edge = LIBSAT_AIG_EDGE_NOT(*edge);
+            }
+
+            return retval;
+    }
+}
+
+/**
+ * \brief Push a frame onto the walk stack, growing it if needed.
+ */
+static status push_frame(
+    add_stacks* stacks, const libsat_ast_node* node, bool exit)
+{
+    status retval;
+
+    retval =
+        reserve(
+            stacks->alloc, (void**)&stacks->frames, &stacks->frame_capacity,
+            stacks->frame_count, sizeof(*stacks->frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    stacks->frames[stacks->frame_count].node = node;
+    stacks->frames[stacks->frame_count].exit = exit;
+    ++stacks->frame_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push an edge onto the edge stack, growing it if needed.
+ */
+static status push_edge(add_stacks* stacks, libsat_aig_edge edge)
+{
+    status retval;
+
+    retval =
+        reserve(
+            stacks->alloc, (void**)&stacks->edges, &stacks->edge_capacity,
+            stacks->edge_count, sizeof(*stacks->edges));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    stacks->edges[stacks->edge_count++] = edge;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make room for one more element in a stack.
+ */
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size)
+{
+    status retval;
+
+    if (count == *capacity)
+    {
+        size_t new_capacity = (0 == *capacity) ? 16 : 2 * *capacity;
+
+        retval = memory_resize(alloc, array, new_capacity * size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *capacity = new_capacity;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,177 @@
+/**
+ * \file aig/libsat_aig_and.c
+ *
+ * \brief Build a structurally hashed AND in a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_aig_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static size_t table_slot(
+    const libsat_aig* aig, libsat_aig_edge fanin0, libsat_aig_edge fanin1);
+static status table_grow(libsat_aig* aig);
+
+/**
+ * \brief Get the edge to the AND of two edges.
+ *
+ * Constants, repeated edges, and complementary edges are folded away, and an
+ * AND that is already in the graph is reused rather than built again.
+ *
+ * \param edge          Pointer to receive the edge to this AND on success.
+ * \param aig           The graph for this operation.
+ * \param lhs           The left-hand side of the AND.
+ * \param rhs           The right-hand side of the AND.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if an edge is not in this graph.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_and)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    LIBSAT_SYM(libsat_aig_edge) lhs, LIBSAT_SYM(libsat_aig_edge) rhs)
+{
+    status retval;
+    size_t slot, node;
+
+    if (
+        LIBSAT_AIG_EDGE_NODE(lhs) >= aig->node_count
+     || LIBSAT_AIG_EDGE_NODE(rhs) >= aig->node_count)
+    {
+        return ERROR_LIBSAT_AIG_BAD_EDGE;
+    }
+
+    /* order the fanins, so that both orders hash alike. */
+    if (lhs > rhs)
+    {
+        libsat_aig_edge tmp = lhs;
+        lhs = rhs;
+        rhs = tmp;
+    }
+
+    /* fold constants, repeats, and complements. */
+    if (LIBSAT_AIG_EDGE_FALSE == lhs || LIBSAT_AIG_EDGE_NOT(lhs) == rhs)
+    {
+        *edge = LIBSAT_AIG_EDGE_FALSE;
+        return STATUS_SUCCESS;
+    }
+    else if (LIBSAT_AIG_EDGE_TRUE == lhs || lhs == rhs)
+    {
+        *edge = rhs;
+        return STATUS_SUCCESS;
+    }
+
+    /* keep the table at most half full. */
+    if (2 * (aig->table_count + 1) > aig->table_capacity)
+    {
+        retval = table_grow(aig);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* reuse an existing AND. */
+    slot = table_slot(aig, lhs, rhs);
+    if (0 != aig->table[slot])
+    {
+        *edge = LIBSAT_AIG_EDGE_MAKE(aig->table[slot], false);
+        return STATUS_SUCCESS;
+    }
+
+    retval = aig_node_append(&node, aig, lhs, rhs, LIBSAT_AIG_NO_VARIABLE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    aig->table[slot] = node;
+    ++aig->table_count;
+    ++aig->and_count;
+
+    *edge = LIBSAT_AIG_EDGE_MAKE(node, false);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Find the slot of an AND in the table, or the empty slot where it
+ * belongs.
+ */
+static size_t table_slot(
+    const libsat_aig* aig, libsat_aig_edge fanin0, libsat_aig_edge fanin1)
+{
+    size_t mask = aig->table_capacity - 1;
+    uint64_t hash =
+        ((uint64_t)fanin0 * 0x9e3779b97f4a7c15ULL)
+      ^ ((uint64_t)fanin1 * 0xbf58476d1ce4e5b9ULL);
+    size_t slot = (size_t)(hash ^ (hash >> 29)) & mask;
+
+    /* linear probing; the table is never full. */
+    while (0 != aig->table[slot])
+    {
+        const aig_node* node = aig->nodes + aig->table[slot];
+
+        if (node->fanin[0] == fanin0 && node->fanin[1] == fanin1)
+        {
+            break;
+        }
+
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+/**
+ * \brief Double the table, and insert every AND into it again.
+ */
+static status table_grow(libsat_aig* aig)
+{
+    status retval;
+    size_t* old_table = aig->table;
+    size_t old_capacity = aig->table_capacity;
+    size_t* table;
+    size_t capacity = (0 == old_capacity) ? 64 : 2 * old_capacity;
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&table, capacity * sizeof(*table));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(table, 0, capacity * sizeof(*table));
+    aig->table = table;
+    aig->table_capacity = capacity;
+
+    for (size_t i = 0; i < old_capacity; ++i)
+    {
+        if (0 != old_table[i])
+        {
+            const aig_node* node = aig->nodes + old_table[i];
+
+            aig->table[table_slot(aig, node->fanin[0], node->fanin[1])] =
+                old_table[i];
+        }
+    }
+
+    if (NULL != old_table)
+    {
+        return allocator_reclaim(aig->alloc, old_table);
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file aig/libsat_aig_and_count.c
+ *
+ * \brief Get the number of AND nodes in a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "aig_internal.h"
+
+/**
+ * \brief Get the number of AND nodes in this graph.
+ *
+ * \param aig           The graph for this operation.
+ *
+ * \returns the number of AND nodes in this graph.
+ */
+size_t
+LIBSAT_SYM(libsat_aig_and_count)(
+    const LIBSAT_SYM(libsat_aig)* aig)
+{
+    return aig->and_count;
+}
@@ -0,0 +1,539 @@
+/**
+ * \file aig/libsat_aig_assert.c
+ *
+ * \brief Assert that an edge of a \ref libsat_aig is true.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_aig_internal;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief The node is used uncomplemented, so it must imply its fanins.
+ */
+#define ASSERT_NEED_POSITIVE                                                0x01
+
+/**
+ * \brief The node is used complemented, so its fanins must imply it.
+ */
+#define ASSERT_NEED_NEGATIVE                                                0x02
+
+/**
+ * \brief The uncomplemented node was already split at the top level.
+ */
+#define ASSERT_SPLIT_POSITIVE                                               0x04
+
+/**
+ * \brief The complemented node was already split at the top level.
+ */
+#define ASSERT_SPLIT_NEGATIVE                                               0x08
+
+/**
+ * \brief The end of a top-level clause in the clause buffer.
+ */
+#define ASSERT_CLAUSE_END                                         ((size_t)-1)
+
+/**
+ * \brief The state of an assertion.
+ */
+typedef struct assert_state assert_state;
+struct assert_state
+{
+    allocator* alloc;
+    const libsat_aig* aig;
+    uint8_t* marks;
+    size_t* stamps;
+    size_t* vars;
+    libsat_aig_edge* stack;
+    size_t stack_count;
+    size_t stack_capacity;
+    libsat_aig_edge* clauses;
+    size_t clause_count;
+    size_t clause_capacity;
+};
+
+/* forward decls. */
+static status split_root(assert_state* state, libsat_aig_edge root);
+static status add_supergate(assert_state* state, size_t node);
+static status push(
+    assert_state* state, libsat_aig_edge** array, size_t* count,
+    size_t* capacity, libsat_aig_edge edge);
+static void need(assert_state* state, libsat_aig_edge edge);
+static libsat_literal edge_literal(
+    const assert_state* state, libsat_aig_edge edge);
+static status emit_clauses(assert_state* state, libsat_context* context);
+
+/**
+ * \brief Assert that an edge of this graph is true in its context.
+ *
+ * A root AND is split into its fanins, and a complemented root AND becomes a
+ * single clause over the fanins of its AND tree. Each AND below that gets a
+ * fresh variable, defined only in the polarities in which it is used. The
+ * clauses are added to the current scope of the context.
+ *
+ * \param aig           The graph for this operation.
+ * \param root          The edge to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if the root is not in this graph.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_assert)(
+    LIBSAT_SYM(libsat_aig)* aig, LIBSAT_SYM(libsat_aig_edge) root)
+{
+    status retval, release_retval;
+    assert_state state;
+    const aig_node* n;
+
+    /* a frozen context can't be changed. */
+    if (aig->context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(aig->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    if (LIBSAT_AIG_EDGE_NODE(root) >= aig->node_count)
+    {
+        retval = ERROR_LIBSAT_AIG_BAD_EDGE;
+        goto done;
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.alloc = aig->alloc;
+    state.aig = aig;
+
+    retval =
+        allocator_allocate(
+            state.alloc, (void**)&state.marks,
+            aig->node_count * sizeof(*state.marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    memset(state.marks, 0, aig->node_count * sizeof(*state.marks));
+
+    retval =
+        allocator_allocate(
+            state.alloc, (void**)&state.stamps,
+            2 * aig->node_count * sizeof(*state.stamps));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_marks;
+    }
+
+    memset(state.stamps, 0, 2 * aig->node_count * sizeof(*state.stamps));
+
+    retval =
+        allocator_allocate(
+            state.alloc, (void**)&state.vars,
+            aig->node_count * sizeof(*state.vars));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stamps;
+    }
+
+    /* break the root into top-level clauses. */
+    retval = split_root(&state, root);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_buffers;
+    }
+
+    /* fanins precede their nodes, so one backward pass spreads the needs. */
+    for (size_t node = aig->node_count; node-- > 1;)
+    {
+        n = aig->nodes + node;
+
+        if (!aig_node_is_and(aig, node))
+        {
+            continue;
+        }
+
+        if (state.marks[node] & ASSERT_NEED_POSITIVE)
+        {
+            need(&state, n->fanin[0]);
+            need(&state, n->fanin[1]);
+        }
+
+        if (state.marks[node] & ASSERT_NEED_NEGATIVE)
+        {
+            need(&state, LIBSAT_AIG_EDGE_NOT(n->fanin[0]));
+            need(&state, LIBSAT_AIG_EDGE_NOT(n->fanin[1]));
+        }
+    }
+
+    /* inputs are their variables, and needed ANDs get fresh ones. */
+    for (size_t node = 1; node < aig->node_count; ++node)
+    {
+        if (0 == (state.marks[node]
+                & (ASSERT_NEED_POSITIVE | ASSERT_NEED_NEGATIVE)))
+        {
+            continue;
+        }
+        else if (!aig_node_is_and(aig, node))
+        {
+            state.vars[node] = aig->nodes[node].variable;
+        }
+        else
+        {
+            retval =
+                libsat_context_variable_get(
+                    &state.vars[node], aig->context, NULL,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_buffers;
+            }
+        }
+    }
+
+    retval = emit_clauses(&state, aig->context);
+    goto cleanup_buffers;
+
+cleanup_buffers:
+    if (NULL != state.stack)
+    {
+        release_retval = allocator_reclaim(state.alloc, state.stack);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != state.clauses)
+    {
+        release_retval = allocator_reclaim(state.alloc, state.clauses);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = allocator_reclaim(state.alloc, state.vars);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_stamps:
+    release_retval = allocator_reclaim(state.alloc, state.stamps);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_marks:
+    release_retval = allocator_reclaim(state.alloc, state.marks);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Split the root into top-level clauses.
+ *
+ * An edge that must be true and is an uncomplemented AND only requires both of
+ * its fanins to be true. Any other edge becomes a clause.
+ */
+static status split_root(assert_state* state, libsat_aig_edge root)
+{
+    status retval;
+    const libsat_aig* aig = state->aig;
+
+    retval =
+        push(
+            state, &state->stack, &state->stack_count, &state->stack_capacity,
+            root);
+
+    while (STATUS_SUCCESS == retval && state->stack_count > 0)
+    {
+        libsat_aig_edge edge = state->stack[--state->stack_count];
+        size_t node = LIBSAT_AIG_EDGE_NODE(edge);
+        uint8_t split =
+            LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge)
+                ? ASSERT_SPLIT_NEGATIVE : ASSERT_SPLIT_POSITIVE;
+
+        /* a shared edge only needs to be asserted once. */
+        if (state->marks[node] & split)
+        {
+            continue;
+        }
+
+        state->marks[node] |= split;
+
+        if (LIBSAT_AIG_EDGE_TRUE == edge)
+        {
+            continue;
+        }
+        else if (LIBSAT_AIG_EDGE_FALSE == edge)
+        {
+            /* the empty clause. */
+            retval =
+                push(
+                    state, &state->clauses, &state->clause_count,
+                    &state->clause_capacity, ASSERT_CLAUSE_END);
+        }
+        else if (!aig_node_is_and(aig, node))
+        {
+            need(state, edge);
+            retval =
+                push(
+                    state, &state->clauses, &state->clause_count,
+                    &state->clause_capacity, edge);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    push(
+                        state, &state->clauses, &state->clause_count,
+                        &state->clause_capacity, ASSERT_CLAUSE_END);
+            }
+        }
+        else if (!LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge))
+        {
+            retval =
+                push(
+                    state, &state->stack, &state->stack_count,
+                    &state->stack_capacity, aig->nodes[node].fanin[0]);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    push(
+                        state, &state->stack, &state->stack_count,
+                        &state->stack_capacity, aig->nodes[node].fanin[1]);
+            }
+        }
+        else
+        {
+            retval = add_supergate(state, node);
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Add the clause that a complemented AND is true, over the leaves of
+ * the tree of uncomplemented ANDs below it.
+ */
+static status add_supergate(assert_state* state, size_t node)
+{
+    status retval;
+    const libsat_aig* aig = state->aig;
+    size_t start = state->clause_count;
+    size_t base = state->stack_count;
+    size_t stamp = node + 1;
+
+    /* stamp each edge with its supergate, so shared edges are seen once. */
+    state->stamps[LIBSAT_AIG_EDGE_MAKE(node, false)] = stamp;
+    retval =
+        push(
+            state, &state->stack, &state->stack_count, &state->stack_capacity,
+            LIBSAT_AIG_EDGE_MAKE(node, false));
+
+    while (STATUS_SUCCESS == retval && state->stack_count > base)
+    {
+        libsat_aig_edge edge = state->stack[--state->stack_count];
+        const aig_node* n = aig->nodes + LIBSAT_AIG_EDGE_NODE(edge);
+
+        for (size_t i = 0; i < 2 && STATUS_SUCCESS == retval; ++i)
+        {
+            libsat_aig_edge fanin = n->fanin[i];
+            size_t fanin_node = LIBSAT_AIG_EDGE_NODE(fanin);
+
+            if (stamp == state->stamps[fanin])
+            {
+                continue;
+            }
+
+            state->stamps[fanin] = stamp;
+
+            if (
+                !LIBSAT_AIG_EDGE_IS_COMPLEMENTED(fanin)
+             && aig_node_is_and(aig, fanin_node))
+            {
+                retval =
+                    push(
+                        state, &state->stack, &state->stack_count,
+                        &state->stack_capacity, fanin);
+            }
+            else
+            {
+                retval =
+                    push(
+                        state, &state->clauses, &state->clause_count,
+                        &state->clause_capacity, LIBSAT_AIG_EDGE_NOT(fanin));
+            }
+        }
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = start; i < state->clause_count; ++i)
+    {
+        need(state, state->clauses[i]);
+    }
+
+    return
+        push(
+            state, &state->clauses, &state->clause_count,
+            &state->clause_capacity, ASSERT_CLAUSE_END);
+}
+
+/**
+ * \brief Record that the literal of an edge is used.
+ */
+static void need(assert_state* state, libsat_aig_edge edge)
+{
+    state->marks[LIBSAT_AIG_EDGE_NODE(edge)] |=
+        LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge)
+            ? ASSERT_NEED_NEGATIVE : ASSERT_NEED_POSITIVE;
+}
+
+/**
+ * \brief Get the literal of a needed edge.
+ */
+static libsat_literal edge_literal(
+    const assert_state* state, libsat_aig_edge edge)
+{
+    return
+        LIBSAT_LITERAL_MAKE(
+            state->vars[LIBSAT_AIG_EDGE_NODE(edge)],
+            LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge));
+}
+
+/**
+ * \brief Add the definitions of the needed ANDs and the top-level clauses.
+ */
+static status emit_clauses(assert_state* state, libsat_context* context)
+{
+    status retval;
+    const libsat_aig* aig = state->aig;
+    libsat_literal lits[3];
+    size_t start;
+
+    for (size_t node = 1; node < aig->node_count; ++node)
+    {
+        const aig_node* n = aig->nodes + node;
+        libsat_literal v = LIBSAT_LITERAL_MAKE(state->vars[node], false);
+
+        if (!aig_node_is_and(aig, node))
+        {
+            continue;
+        }
+
+        /* v → a and v → b. */
+        if (state->marks[node] & ASSERT_NEED_POSITIVE)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                lits[0] = LIBSAT_LITERAL_NEGATE(v);
+                lits[1] = edge_literal(state, n->fanin[i]);
+
+                retval = libsat_cnf_add_clause(context->cnf, lits, 2);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+        }
+
+        /* a ∧ b → v. */
+        if (state->marks[node] & ASSERT_NEED_NEGATIVE)
+        {
+            lits[0] = LIBSAT_LITERAL_NEGATE(edge_literal(state, n->fanin[0]));
+            lits[1] = LIBSAT_LITERAL_NEGATE(edge_literal(state, n->fanin[1]));
+            lits[2] = v;
+
+            retval = libsat_cnf_add_clause(context->cnf, lits, 3);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    /* the edges of the top-level clauses are replaced by their literals. */
+    start = 0;
+    for (size_t i = 0; i < state->clause_count; ++i)
+    {
+        if (ASSERT_CLAUSE_END != state->clauses[i])
+        {
+            state->clauses[i] = edge_literal(state, state->clauses[i]);
+            continue;
+        }
+
+        retval =
+            libsat_cnf_add_clause(
+                context->cnf, state->clauses + start, i - start);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        start = i + 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push an edge onto a buffer, growing it if needed.
+ */
+static status push(
+    assert_state* state, libsat_aig_edge** array, size_t* count,
+    size_t* capacity, libsat_aig_edge edge)
+{
+    status retval;
+
+    if (*count == *capacity)
+    {
+        size_t new_capacity = (0 == *capacity) ? 16 : 2 * *capacity;
+
+        retval =
+            memory_resize(
+                state->alloc, (void**)array,
+                new_capacity * sizeof(**array));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *capacity = new_capacity;
+    }
+
+    (*array)[(*count)++] = edge;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/**
+ * \file aig/libsat_aig_create.c
+ *
+ * \brief Create a \ref libsat_aig instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_aig_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* the vtable entry for the libsat_aig instance. */
+RCPR_VTABLE
+resource_vtable libsat_aig_vtable = {
+    &libsat_aig_resource_release };
+
+/**
+ * \brief Create an empty and-inverter graph.
+ *
+ * The graph starts with its constant node only. Its inputs are variables of
+ * the given context, and it is encoded into the clauses of that context.
+ *
+ * \param aig           Pointer to the graph pointer to be set to this created
+ *                      graph on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_create)(
+    LIBSAT_SYM(libsat_aig)** aig, LIBSAT_SYM(libsat_context)* context)
+{
+    status retval, release_retval;
+    libsat_aig* tmp;
+    size_t node;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(context->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_aig_vtable);
+
+    /* initialize graph. */
+    tmp->alloc = context->alloc;
+    tmp->context = context;
+
+    /* node 0 is the constant false node. */
+    retval = aig_node_append(&node, tmp, 0, 0, LIBSAT_AIG_NO_VARIABLE);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *aig = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,77 @@
+/**
+ * \file aig/libsat_aig_input.c
+ *
+ * \brief Get the input node of a context variable in a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_aig_internal;
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Get the edge to the input node for a context variable, creating the
+ * node if needed.
+ *
+ * \param edge          Pointer to receive the edge to this input on success.
+ * \param aig           The graph for this operation.
+ * \param var_id        The variable of this input.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_input)(
+    LIBSAT_SYM(libsat_aig_edge)* edge, LIBSAT_SYM(libsat_aig)* aig,
+    size_t var_id)
+{
+    status retval;
+    size_t node;
+
+    /* grow the input map if needed; node 0 marks a variable without one. */
+    if (var_id >= aig->input_capacity)
+    {
+        size_t capacity = (0 == aig->input_capacity) ? 64 : aig->input_capacity;
+        while (capacity <= var_id)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                aig->alloc, (void**)&aig->inputs,
+                capacity * sizeof(*aig->inputs));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memset(
+            aig->inputs + aig->input_capacity, 0,
+            (capacity - aig->input_capacity) * sizeof(*aig->inputs));
+        aig->input_capacity = capacity;
+    }
+
+    if (0 == aig->inputs[var_id])
+    {
+        retval = aig_node_append(&node, aig, 0, 0, var_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        aig->inputs[var_id] = node;
+    }
+
+    *edge = LIBSAT_AIG_EDGE_MAKE(aig->inputs[var_id], false);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,983 @@
+/**
+ * \file aig/libsat_aig_read_aiger.c
+ *
+ * \brief Read a circuit in AIGER format into a \ref libsat_aig.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief The kind of an AIGER variable while it is read.
+ */
+enum aiger_kind
+{
+    AIGER_KIND_UNDEFINED,
+    AIGER_KIND_INPUT,
+    AIGER_KIND_AND,
+    AIGER_KIND_NEEDED,
+    AIGER_KIND_VISITING,
+    AIGER_KIND_DONE,
+};
+
+/**
+ * \brief The state of a read.
+ *
+ * The literals of the inputs, the latches, the next states, and the outputs
+ * are kept in that order in one array, and the names of the inputs, the
+ * latches, and the outputs as offsets and lengths into the data.
+ */
+typedef struct aiger_read aiger_read;
+struct aiger_read
+{
+    libsat_aig* aig;
+    const uint8_t* data;
+    size_t size;
+    size_t offset;
+    bool binary;
+    size_t max_var;
+    size_t input_count;
+    size_t latch_count;
+    size_t output_count;
+    size_t and_count;
+    size_t* literals;
+    size_t* names;
+    size_t* fanins;
+    uint8_t* kinds;
+    libsat_aig_edge* edges;
+    size_t* stack;
+    char* name;
+};
+
+/* forward decls. */
+static status read_header(aiger_read* read);
+static status read_sections(aiger_read* read);
+static status read_symbols(aiger_read* read);
+static status read_literal(size_t* literal, aiger_read* read);
+static status read_number(size_t* value, aiger_read* read);
+static status read_delta(size_t* value, aiger_read* read);
+static status expect(aiger_read* read, uint8_t ch);
+static status name_variable(
+    size_t* var_id, aiger_read* read, size_t index, int unnamed_flags);
+static status mark(aiger_read* read, size_t literal);
+static status build(aiger_read* read, size_t var);
+static status allocate(aiger_read* read);
+static status release(aiger_read* read, status retval);
+
+/**
+ * \brief Read a circuit in AIGER format into this graph.
+ *
+ * Both the ASCII (aag) and the binary (aig) formats are read; the binary
+ * format stores its ANDs in order, as two delta-compressed fanins each. An
+ * input or latch named in the symbol table is the context variable of that
+ * name, and any other gets a fresh unnamed variable. A named output names the
+ * context variable of that name. Only the ANDs that an output or a next state
+ * needs are added. Latches must be reset to zero, and the header may not
+ * declare bad state, invariant, justice, or fairness properties.
+ *
+ * \note The arrays of the circuit are owned by this graph, and are
+ * invalidated by the next read or rewrite.
+ *
+ * \param circuit       Pointer to receive the circuit on success.
+ * \param aig           The graph for this operation.
+ * \param data          The AIGER data.
+ * \param size          The size of the AIGER data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_FORMAT if the data is not AIGER that can be
+ *        read.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_read_aiger)(
+    LIBSAT_SYM(libsat_aig_circuit)* circuit, LIBSAT_SYM(libsat_aig)* aig,
+    const uint8_t* data, size_t size)
+{
+    status retval, release_retval;
+    aiger_read read;
+    size_t* variables = NULL;
+    size_t* old_variables;
+    libsat_aig_edge* edges = NULL;
+    libsat_aig_edge* old_edges;
+    size_t latch_base, next_base, symbol_count;
+
+    memset(&read, 0, sizeof(read));
+    read.aig = aig;
+    read.data = data;
+    read.size = size;
+
+    retval = read_header(&read);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval = allocate(&read);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read;
+    }
+
+    retval = read_sections(&read);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read;
+    }
+
+    retval = read_symbols(&read);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read;
+    }
+
+    /* the variables of the inputs, the latches, and the output names. */
+    latch_base = read.input_count;
+    next_base = latch_base + read.latch_count;
+    symbol_count = next_base + read.output_count;
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&variables,
+            (symbol_count + 1) * sizeof(*variables));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read;
+    }
+
+    /* the edges of the next states and the outputs. */
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&edges,
+            (read.latch_count + read.output_count + 1) * sizeof(*edges));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_read;
+    }
+
+    /* inputs and latches become input nodes. */
+    for (size_t i = 0; i < next_base; ++i)
+    {
+        size_t var = read.literals[i] >> 1;
+
+        retval =
+            name_variable(
+                &variables[i], &read, i,
+                LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_read;
+        }
+
+        retval = libsat_aig_input(&read.edges[var], aig, variables[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_read;
+        }
+
+        read.kinds[var] = AIGER_KIND_DONE;
+    }
+
+    /* outputs only have the names that the symbol table gives them. */
+    for (size_t i = 0; i < read.output_count; ++i)
+    {
+        retval =
+            name_variable(
+                &variables[next_base + i], &read, next_base + i,
+                LIBSAT_VARIABLE_GET_DEFAULT);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_read;
+        }
+    }
+
+    /* find the ANDs that the next states and the outputs need. */
+    for (size_t i = 0; i < read.latch_count + read.output_count; ++i)
+    {
+        retval = mark(&read, read.literals[next_base + i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_read;
+        }
+    }
+
+    /* build them in the order of their variables, so that data in that order
+     * is written back unchanged. */
+    for (size_t var = 1; var <= read.max_var; ++var)
+    {
+        if (AIGER_KIND_NEEDED == read.kinds[var])
+        {
+            retval = build(&read, var);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_read;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < read.latch_count + read.output_count; ++i)
+    {
+        size_t literal = read.literals[next_base + i];
+
+        edges[i] = read.edges[literal >> 1] ^ (literal & 1);
+    }
+
+    /* the graph owns the new circuit, and the old one is reclaimed below. */
+    old_variables = aig->circuit_variables;
+    aig->circuit_variables = variables;
+    variables = old_variables;
+    old_edges = aig->circuit_edges;
+    aig->circuit_edges = edges;
+    edges = old_edges;
+
+    circuit->inputs = aig->circuit_variables;
+    circuit->input_count = read.input_count;
+    circuit->latches = aig->circuit_variables + latch_base;
+    circuit->next = aig->circuit_edges;
+    circuit->latch_count = read.latch_count;
+    circuit->outputs = aig->circuit_edges + read.latch_count;
+    circuit->output_names = aig->circuit_variables + next_base;
+    circuit->output_count = read.output_count;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+
+cleanup_read:
+    if (NULL != variables)
+    {
+        release_retval = allocator_reclaim(aig->alloc, variables);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != edges)
+    {
+        release_retval = allocator_reclaim(aig->alloc, edges);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    retval = release(&read, retval);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Read the header line.
+ */
+static status read_header(aiger_read* read)
+{
+    status retval;
+    size_t extra;
+
+    if (
+        read->size < 4 || 'a' != read->data[0]
+     || 0 != memcmp(read->data + 2, "g ", 2))
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+    else if ('a' == read->data[1])
+    {
+        read->binary = false;
+    }
+    else if ('i' == read->data[1])
+    {
+        read->binary = true;
+    }
+    else
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+
+    read->offset = 4;
+
+    retval = read_number(&read->max_var, read);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = expect(read, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = read_number(&read->input_count, read);
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = expect(read, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = read_number(&read->latch_count, read);
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = expect(read, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = read_number(&read->output_count, read);
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = expect(read, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = read_number(&read->and_count, read);
+    }
+
+    /* properties are not read, so they must all be empty. */
+    while (
+        STATUS_SUCCESS == retval && read->offset < read->size
+     && ' ' == read->data[read->offset])
+    {
+        ++read->offset;
+        retval = read_number(&extra, read);
+        if (STATUS_SUCCESS == retval && 0 != extra)
+        {
+            retval = ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = expect(read, '\n');
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* every output takes at least two bytes of data. */
+    if (
+        read->max_var >= SIZE_MAX / (4 * sizeof(size_t))
+     || read->input_count > read->max_var || read->latch_count > read->max_var
+     || read->and_count > read->max_var || read->output_count > read->size
+     || (read->binary
+         && read->max_var
+             != read->input_count + read->latch_count + read->and_count))
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the inputs, latches, outputs, and ANDs.
+ */
+static status read_sections(aiger_read* read)
+{
+    status retval;
+    size_t* literals = read->literals;
+    size_t latch_base = read->input_count;
+    size_t next_base = latch_base + read->latch_count;
+    size_t output_base = next_base + read->latch_count;
+    size_t lhs, reset, delta;
+
+    /* inputs; binary inputs are implicit. */
+    for (size_t i = 0; i < read->input_count; ++i)
+    {
+        if (read->binary)
+        {
+            literals[i] = 2 * (i + 1);
+        }
+        else
+        {
+            retval = read_literal(&literals[i], read);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = expect(read, '\n');
+            }
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    /* latches, with their next state and an optional zero reset. */
+    for (size_t i = 0; i < read->latch_count; ++i)
+    {
+        if (read->binary)
+        {
+            literals[latch_base + i] = 2 * (read->input_count + i + 1);
+        }
+        else
+        {
+            retval = read_literal(&literals[latch_base + i], read);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = expect(read, ' ');
+            }
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        retval = read_literal(&literals[next_base + i], read);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (read->offset < read->size && ' ' == read->data[read->offset])
+        {
+            ++read->offset;
+            retval = read_number(&reset, read);
+            if (STATUS_SUCCESS == retval && 0 != reset)
+            {
+                retval = ERROR_LIBSAT_AIG_BAD_FORMAT;
+            }
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        retval = expect(read, '\n');
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* each input or latch defines a distinct variable. */
+    for (size_t i = 0; i < next_base; ++i)
+    {
+        size_t var = literals[i] >> 1;
+
+        if (
+            0 != (literals[i] & 1) || 0 == var
+         || AIGER_KIND_UNDEFINED != read->kinds[var])
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        read->kinds[var] = AIGER_KIND_INPUT;
+    }
+
+    for (size_t i = 0; i < read->output_count; ++i)
+    {
+        retval = read_literal(&literals[output_base + i], read);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = expect(read, '\n');
+        }
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* ANDs; binary ANDs are in order, with their fanins as deltas. */
+    for (size_t i = 0; i < read->and_count; ++i)
+    {
+        size_t* fanins;
+
+        if (read->binary)
+        {
+            lhs = 2 * (read->input_count + read->latch_count + i + 1);
+            fanins = read->fanins + lhs;
+
+            retval = read_delta(&delta, read);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+            else if (0 == delta || delta > lhs)
+            {
+                return ERROR_LIBSAT_AIG_BAD_FORMAT;
+            }
+
+            fanins[0] = lhs - delta;
+
+            retval = read_delta(&delta, read);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+            else if (delta > fanins[0])
+            {
+                return ERROR_LIBSAT_AIG_BAD_FORMAT;
+            }
+
+            fanins[1] = fanins[0] - delta;
+        }
+        else
+        {
+            retval = read_literal(&lhs, read);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            fanins = read->fanins + (lhs & ~(size_t)1);
+
+            retval = expect(read, ' ');
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = read_literal(&fanins[0], read);
+            }
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = expect(read, ' ');
+            }
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = read_literal(&fanins[1], read);
+            }
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = expect(read, '\n');
+            }
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        if (
+            0 != (lhs & 1) || 0 == lhs
+         || AIGER_KIND_UNDEFINED != read->kinds[lhs >> 1])
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        read->kinds[lhs >> 1] = AIGER_KIND_AND;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read the symbol table, which ends at a comment or at the end of the
+ * data.
+ */
+static status read_symbols(aiger_read* read)
+{
+    status retval;
+    size_t index, base, count, start;
+
+    while (read->offset < read->size && 'c' != read->data[read->offset])
+    {
+        switch (read->data[read->offset])
+        {
+            case 'i':
+                base = 0;
+                count = read->input_count;
+                break;
+
+            case 'l':
+                base = read->input_count;
+                count = read->latch_count;
+                break;
+
+            case 'o':
+                base = read->input_count + read->latch_count;
+                count = read->output_count;
+                break;
+
+            default:
+                return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        ++read->offset;
+
+        retval = read_number(&index, read);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = expect(read, ' ');
+        }
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+        else if (index >= count)
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        start = read->offset;
+        while (
+            read->offset < read->size && '\n' != read->data[read->offset]
+         && 0 != read->data[read->offset])
+        {
+            ++read->offset;
+        }
+
+        if (start == read->offset)
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        read->names[2 * (base + index)] = start;
+        read->names[2 * (base + index) + 1] = read->offset - start;
+
+        retval = expect(read, '\n');
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read a literal, which must be in range.
+ */
+static status read_literal(size_t* literal, aiger_read* read)
+{
+    status retval;
+
+    retval = read_number(literal, read);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+    else if ((*literal >> 1) > read->max_var)
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read an unsigned decimal number.
+ */
+static status read_number(size_t* value, aiger_read* read)
+{
+    size_t start = read->offset;
+
+    *value = 0;
+    while (
+        read->offset < read->size && read->data[read->offset] >= '0'
+     && read->data[read->offset] <= '9')
+    {
+        size_t digit = read->data[read->offset++] - '0';
+
+        if (*value > (SIZE_MAX - digit) / 10)
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        *value = 10 * *value + digit;
+    }
+
+    if (start == read->offset)
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read a delta, stored seven bits at a time with the least significant
+ * bits first, and the high bit set on every byte but the last.
+ */
+static status read_delta(size_t* value, aiger_read* read)
+{
+    unsigned shift = 0;
+    uint8_t byte;
+
+    *value = 0;
+    do
+    {
+        if (read->offset == read->size || shift >= 8 * sizeof(size_t))
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        byte = read->data[read->offset++];
+        if (((size_t)(byte & 0x7F) << shift) >> shift != (byte & 0x7FU))
+        {
+            return ERROR_LIBSAT_AIG_BAD_FORMAT;
+        }
+
+        *value |= (size_t)(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Expect the given character next.
+ */
+static status expect(aiger_read* read, uint8_t ch)
+{
+    if (read->offset == read->size || ch != read->data[read->offset])
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+
+    ++read->offset;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the variable of a symbol, by its name if it has one.
+ *
+ * \param var_id        Pointer to receive the variable.
+ * \param read          The state of the read.
+ * \param index         The index of the symbol.
+ * \param unnamed_flags The flags to create the variable of a symbol without a
+ *                      name, or LIBSAT_VARIABLE_GET_DEFAULT to give it no
+ *                      variable.
+ */
+static status name_variable(
+    size_t* var_id, aiger_read* read, size_t index, int unnamed_flags)
+{
+    size_t length = read->names[2 * index + 1];
+
+    if (0 == length)
+    {
+        if (LIBSAT_VARIABLE_GET_DEFAULT == unnamed_flags)
+        {
+            *var_id = LIBSAT_AIG_NO_VARIABLE;
+            return STATUS_SUCCESS;
+        }
+
+        return
+            libsat_context_variable_get(
+                var_id, read->aig->context, NULL, unnamed_flags);
+    }
+
+    memcpy(read->name, read->data + read->names[2 * index], length);
+    read->name[length] = 0;
+
+    return
+        libsat_context_variable_get(
+            var_id, read->aig->context, read->name,
+            LIBSAT_VARIABLE_GET_DEFAULT);
+}
+
+/**
+ * \brief Mark the ANDs that a literal needs.
+ *
+ * Each AND is pushed at most once, since it is marked as soon as it is pushed.
+ */
+static status mark(aiger_read* read, size_t literal)
+{
+    size_t stack_count = 0;
+    size_t var = literal >> 1;
+
+    if (AIGER_KIND_UNDEFINED == read->kinds[var])
+    {
+        return ERROR_LIBSAT_AIG_BAD_FORMAT;
+    }
+    else if (AIGER_KIND_AND == read->kinds[var])
+    {
+        read->kinds[var] = AIGER_KIND_NEEDED;
+        read->stack[stack_count++] = var;
+    }
+
+    while (stack_count > 0)
+    {
+        const size_t* fanins = read->fanins + 2 * read->stack[--stack_count];
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            var = fanins[i] >> 1;
+
+            if (AIGER_KIND_UNDEFINED == read->kinds[var])
+            {
+                return ERROR_LIBSAT_AIG_BAD_FORMAT;
+            }
+            else if (AIGER_KIND_AND == read->kinds[var])
+            {
+                read->kinds[var] = AIGER_KIND_NEEDED;
+                read->stack[stack_count++] = var;
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Build a needed AND, and the needed ANDs below it.
+ *
+ * ASCII ANDs may be listed in any order, so they are built depth first, with
+ * an explicit stack. Each AND is pushed at most once, since it is visited as
+ * soon as it is pushed.
+ */
+static status build(aiger_read* read, size_t var)
+{
+    status retval;
+    size_t stack_count = 0;
+
+    read->stack[stack_count++] = var;
+
+    while (stack_count > 0)
+    {
+        const size_t* fanins;
+        bool pending = false;
+
+        var = read->stack[stack_count - 1];
+        fanins = read->fanins + 2 * var;
+        read->kinds[var] = AIGER_KIND_VISITING;
+
+        for (size_t i = 0; i < 2 && !pending; ++i)
+        {
+            switch (read->kinds[fanins[i] >> 1])
+            {
+                case AIGER_KIND_DONE:
+                    break;
+
+                case AIGER_KIND_NEEDED:
+                    read->stack[stack_count++] = fanins[i] >> 1;
+                    pending = true;
+                    break;
+
+                /* a fanin that is still being built is a cycle. */
+                default:
+                    return ERROR_LIBSAT_AIG_BAD_FORMAT;
+            }
+        }
+
+        if (!pending)
+        {
+            retval =
+                libsat_aig_and(
+                    &read->edges[var], read->aig,
+                    read->edges[fanins[0] >> 1] ^ (fanins[0] & 1),
+                    read->edges[fanins[1] >> 1] ^ (fanins[1] & 1));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            read->kinds[var] = AIGER_KIND_DONE;
+            --stack_count;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Allocate the arrays of a read, once the header is known.
+ */
+static status allocate(aiger_read* read)
+{
+    status retval;
+    allocator* alloc = read->aig->alloc;
+    size_t vars = read->max_var + 1;
+    size_t symbols =
+        read->input_count + read->latch_count + read->output_count;
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->literals,
+            (symbols + read->latch_count + 1) * sizeof(*read->literals));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->names,
+            2 * (symbols + 1) * sizeof(*read->names));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(read->names, 0, 2 * (symbols + 1) * sizeof(*read->names));
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->fanins, 2 * vars * sizeof(*read->fanins));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->kinds, vars * sizeof(*read->kinds));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(read->kinds, AIGER_KIND_UNDEFINED, vars * sizeof(*read->kinds));
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->edges, vars * sizeof(*read->edges));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* variable 0 is the constant false. */
+    read->kinds[0] = AIGER_KIND_DONE;
+    read->edges[0] = LIBSAT_AIG_EDGE_FALSE;
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&read->stack, vars * sizeof(*read->stack));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* no name is longer than the data. */
+    return allocator_allocate(alloc, (void**)&read->name, read->size + 1);
+}
+
+/**
+ * \brief Release the arrays of a read, updating the status on error.
+ */
+static status release(aiger_read* read, status retval)
+{
+    void* arrays[] = {
+        read->literals, read->names, read->fanins, read->kinds, read->edges,
+        read->stack, read->name };
+    status release_retval;
+
+    for (size_t i = 0; i < sizeof(arrays) / sizeof(arrays[0]); ++i)
+    {
+        if (NULL != arrays[i])
+        {
+            release_retval = allocator_reclaim(read->aig->alloc, arrays[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    read->literals = NULL;
+    read->names = NULL;
+    read->fanins = NULL;
+    read->kinds = NULL;
+    read->edges = NULL;
+    read->stack = NULL;
+    read->name = NULL;
+
+    return retval;
+}
@@ -0,0 +1,26 @@
+/**
+ * \file aig/libsat_aig_resource_handle.c
+ *
+ * \brief Get the resource handle for a given \ref libsat_aig instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "aig_internal.h"
+
+/**
+ * \brief Given a \ref libsat_aig instance, return the resource handle for this
+ * instance.
+ *
+ * \param aig           The \ref libsat_aig instance from which the resource
+ *                      handle is returned.
+ *
+ * \returns the resource handle for this graph.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_aig_resource_handle)(
+    LIBSAT_SYM(libsat_aig)* aig)
+{
+    return &aig->hdr;
+}
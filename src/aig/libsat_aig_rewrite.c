@@ -0,0 +1,895 @@
+/**
+ * \file aig/libsat_aig_rewrite.c
+ *
+ * \brief Rewrite a \ref libsat_aig over 4-input cuts.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_aig_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The most nodes in a cut.
+ */
+#define REWRITE_CUT_SIZE                                                    4
+
+/**
+ * \brief The most cuts kept for each node, including its trivial cut.
+ */
+#define REWRITE_CUT_LIMIT                                                   8
+
+/**
+ * \brief The truth tables of the four cut nodes over sixteen minterms.
+ */
+static const uint16_t rewrite_var_table[REWRITE_CUT_SIZE] = {
+    0xAAAA, 0xCCCC, 0xF0F0, 0xFF00 };
+
+/**
+ * \brief A cut of a node, with the function of the node over the cut.
+ *
+ * The nodes of a cut are sorted. Bit m of the table is the value of the node
+ * when bit j of m is the value of the jth cut node.
+ */
+typedef struct rewrite_cut rewrite_cut;
+struct rewrite_cut
+{
+    size_t leaves[REWRITE_CUT_SIZE];
+    uint8_t size;
+    uint16_t table;
+};
+
+/**
+ * \brief An entry of the functional hash, which maps a function over some
+ * edges of the rewritten graph to an edge that computes it. The function is
+ * kept with its first bit clear, up to complement.
+ */
+typedef struct rewrite_entry rewrite_entry;
+struct rewrite_entry
+{
+    libsat_aig_edge leaves[REWRITE_CUT_SIZE];
+    libsat_aig_edge edge;
+    uint8_t size;
+    uint16_t table;
+    bool used;
+};
+
+/**
+ * \brief The state of a rewrite.
+ */
+typedef struct rewrite_state rewrite_state;
+struct rewrite_state
+{
+    libsat_aig* aig;
+    libsat_aig* fresh;
+    uint8_t* marks;
+    libsat_aig_edge* map;
+    rewrite_cut* cuts;
+    uint8_t* cut_counts;
+    rewrite_entry* entries;
+    size_t entry_count;
+    size_t entry_capacity;
+};
+
+/* forward decls. */
+static void mark_cone(
+    uint8_t* marks, const libsat_aig* aig, const libsat_aig_edge* roots,
+    size_t count);
+static void enumerate_cuts(rewrite_state* state, size_t node);
+static bool cut_subset(const rewrite_cut* lhs, const rewrite_cut* rhs);
+static bool merge_cut(
+    rewrite_cut* cut, const rewrite_cut* lhs, bool lhs_complemented,
+    const rewrite_cut* rhs, bool rhs_complemented);
+static uint16_t expand_table(
+    const rewrite_cut* cut, const size_t* leaves, size_t size);
+static status rewrite_and(rewrite_state* state, size_t node);
+static bool match_wire(
+    libsat_aig_edge* edge, const rewrite_state* state, const rewrite_cut* cut);
+static bool match_gate(
+    libsat_aig_edge* lhs, libsat_aig_edge* rhs, bool* complemented,
+    const rewrite_state* state, const rewrite_cut* cut);
+static rewrite_entry* entry_slot(
+    const rewrite_state* state, const libsat_aig_edge* leaves, uint8_t size,
+    uint16_t table);
+static void entry_key(
+    libsat_aig_edge* leaves, uint16_t* table, bool* complemented,
+    const rewrite_state* state, const rewrite_cut* cut);
+static status entry_insert(
+    rewrite_state* state, const rewrite_cut* cut, libsat_aig_edge edge);
+static status compact(
+    libsat_aig* compacted, const libsat_aig* fresh, libsat_aig_edge* roots,
+    size_t count);
+
+/**
+ * \brief Rewrite this graph over 4-input cuts, keeping only what the given
+ * roots need.
+ *
+ * The function of each AND over each of its cuts of up to four nodes is
+ * computed as a truth table. An AND whose function over a cut is a constant,
+ * a single cut node, or a single AND of two cut nodes is replaced by that,
+ * and an AND whose function over a cut matches one already rebuilt over the
+ * same nodes reuses it. The graph is then rebuilt from the roots, so that the
+ * nodes left unused are dropped.
+ *
+ * \param aig           The graph for this operation.
+ * \param roots         The edges to keep. On success, each is replaced by the
+ *                      equivalent edge in the rewritten graph.
+ * \param count         The number of roots.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if a root is not in this graph.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_rewrite)(
+    LIBSAT_SYM(libsat_aig)* aig, LIBSAT_SYM(libsat_aig_edge)* roots,
+    size_t count)
+{
+    status retval, release_retval;
+    rewrite_state state;
+    libsat_aig* compacted;
+    size_t node;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (LIBSAT_AIG_EDGE_NODE(roots[i]) >= aig->node_count)
+        {
+            retval = ERROR_LIBSAT_AIG_BAD_EDGE;
+            goto done;
+        }
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.aig = aig;
+
+    retval = libsat_aig_create(&state.fresh, aig->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&state.marks,
+            aig->node_count * sizeof(*state.marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_fresh;
+    }
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&state.map,
+            aig->node_count * sizeof(*state.map));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_marks;
+    }
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&state.cuts,
+            aig->node_count * REWRITE_CUT_LIMIT * sizeof(*state.cuts));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_map;
+    }
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&state.cut_counts,
+            aig->node_count * sizeof(*state.cut_counts));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cuts;
+    }
+
+    mark_cone(state.marks, aig, roots, count);
+
+    /* rebuild the cone in order, since fanins precede their nodes. */
+    for (node = 0; node < aig->node_count; ++node)
+    {
+        rewrite_cut* trivial = state.cuts + node * REWRITE_CUT_LIMIT;
+
+        if (!state.marks[node])
+        {
+            continue;
+        }
+
+        if (aig_node_is_and(aig, node))
+        {
+            enumerate_cuts(&state, node);
+
+            retval = rewrite_and(&state, node);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_entries;
+            }
+        }
+        else
+        {
+            state.cut_counts[node] = 1;
+
+            if (0 == node)
+            {
+                state.map[node] = LIBSAT_AIG_EDGE_FALSE;
+            }
+            else
+            {
+                retval =
+                    libsat_aig_input(
+                        &state.map[node], state.fresh,
+                        aig->nodes[node].variable);
+                if (STATUS_SUCCESS != retval)
+                {
+                    goto cleanup_entries;
+                }
+            }
+        }
+
+        /* every node is its own trivial cut. */
+        trivial->leaves[0] = node;
+        trivial->size = 1;
+        trivial->table = rewrite_var_table[0];
+    }
+
+    /* carry the roots over to the rebuilt graph. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        roots[i] =
+            state.map[LIBSAT_AIG_EDGE_NODE(roots[i])]
+          ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(roots[i]);
+    }
+
+    /* drop what the replacements left unused. */
+    retval = libsat_aig_create(&compacted, aig->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_entries;
+    }
+
+    retval = compact(compacted, state.fresh, roots, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_compacted;
+    }
+
+    /* the compacted graph takes the place of the original. */
+    aig_swap(aig, compacted);
+    retval = STATUS_SUCCESS;
+
+cleanup_compacted:
+    release_retval = resource_release(&compacted->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_entries:
+    if (NULL != state.entries)
+    {
+        release_retval = allocator_reclaim(aig->alloc, state.entries);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = allocator_reclaim(aig->alloc, state.cut_counts);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_cuts:
+    release_retval = allocator_reclaim(aig->alloc, state.cuts);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_map:
+    release_retval = allocator_reclaim(aig->alloc, state.map);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_marks:
+    release_retval = allocator_reclaim(aig->alloc, state.marks);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_fresh:
+    release_retval = resource_release(&state.fresh->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Mark the nodes that the given roots depend on.
+ */
+static void mark_cone(
+    uint8_t* marks, const libsat_aig* aig, const libsat_aig_edge* roots,
+    size_t count)
+{
+    memset(marks, 0, aig->node_count * sizeof(*marks));
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        marks[LIBSAT_AIG_EDGE_NODE(roots[i])] = 1;
+    }
+
+    /* fanins precede their nodes, so one backward pass reaches them all. */
+    for (size_t node = aig->node_count; node-- > 1;)
+    {
+        if (marks[node] && aig_node_is_and(aig, node))
+        {
+            marks[LIBSAT_AIG_EDGE_NODE(aig->nodes[node].fanin[0])] = 1;
+            marks[LIBSAT_AIG_EDGE_NODE(aig->nodes[node].fanin[1])] = 1;
+        }
+    }
+}
+
+/**
+ * \brief Enumerate the cuts of an AND from the cuts of its fanins.
+ *
+ * A merged cut that holds all of the nodes of another is dropped, and the
+ * smallest of those left are kept. The trivial cut is left for the caller to
+ * fill in at index 0.
+ */
+static void enumerate_cuts(rewrite_state* state, size_t node)
+{
+    const aig_node* n = state->aig->nodes + node;
+    size_t lhs_node = LIBSAT_AIG_EDGE_NODE(n->fanin[0]);
+    size_t rhs_node = LIBSAT_AIG_EDGE_NODE(n->fanin[1]);
+    const rewrite_cut* lhs_cuts = state->cuts + lhs_node * REWRITE_CUT_LIMIT;
+    const rewrite_cut* rhs_cuts = state->cuts + rhs_node * REWRITE_CUT_LIMIT;
+    rewrite_cut* cuts = state->cuts + node * REWRITE_CUT_LIMIT;
+    rewrite_cut merged[REWRITE_CUT_LIMIT * REWRITE_CUT_LIMIT];
+    size_t count = 0;
+
+    for (size_t i = 0; i < state->cut_counts[lhs_node]; ++i)
+    {
+        for (size_t j = 0; j < state->cut_counts[rhs_node]; ++j)
+        {
+            bool dominated = false;
+
+            if (
+                !merge_cut(
+                    merged + count, lhs_cuts + i,
+                    LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[0]), rhs_cuts + j,
+                    LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[1])))
+            {
+                continue;
+            }
+
+            for (size_t k = 0; k < count && !dominated; ++k)
+            {
+                dominated = cut_subset(merged + k, merged + count);
+            }
+
+            if (dominated)
+            {
+                continue;
+            }
+
+            /* drop the cuts that the new cut dominates. */
+            for (size_t k = 0; k < count;)
+            {
+                if (cut_subset(merged + count, merged + k))
+                {
+                    merged[k] = merged[--count];
+                    merged[count] = merged[count + 1];
+                }
+                else
+                {
+                    ++k;
+                }
+            }
+
+            ++count;
+        }
+    }
+
+    /* keep the smallest cuts, in order of size. */
+    for (size_t i = 1; i < count; ++i)
+    {
+        rewrite_cut cut = merged[i];
+        size_t k = i;
+
+        for (; k > 0 && merged[k - 1].size > cut.size; --k)
+        {
+            merged[k] = merged[k - 1];
+        }
+
+        merged[k] = cut;
+    }
+
+    if (count > REWRITE_CUT_LIMIT - 1)
+    {
+        count = REWRITE_CUT_LIMIT - 1;
+    }
+
+    memcpy(cuts + 1, merged, count * sizeof(*cuts));
+    state->cut_counts[node] = (uint8_t)(count + 1);
+}
+
+/**
+ * \brief Return true if every node of the first cut is in the second.
+ */
+static bool cut_subset(const rewrite_cut* lhs, const rewrite_cut* rhs)
+{
+    size_t j = 0;
+
+    for (size_t i = 0; i < lhs->size; ++i)
+    {
+        while (j < rhs->size && rhs->leaves[j] < lhs->leaves[i])
+        {
+            ++j;
+        }
+
+        if (j == rhs->size || rhs->leaves[j] != lhs->leaves[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Merge the cuts of two fanins into a cut of their AND, if the merged
+ * cut is small enough.
+ */
+static bool merge_cut(
+    rewrite_cut* cut, const rewrite_cut* lhs, bool lhs_complemented,
+    const rewrite_cut* rhs, bool rhs_complemented)
+{
+    size_t i = 0, j = 0;
+    uint16_t lhs_table, rhs_table;
+
+    cut->size = 0;
+
+    /* merge the sorted leaves. */
+    while (i < lhs->size || j < rhs->size)
+    {
+        size_t leaf;
+
+        if (cut->size == REWRITE_CUT_SIZE)
+        {
+            return false;
+        }
+
+        if (
+            j == rhs->size
+         || (i < lhs->size && lhs->leaves[i] < rhs->leaves[j]))
+        {
+            leaf = lhs->leaves[i++];
+        }
+        else if (i == lhs->size || rhs->leaves[j] < lhs->leaves[i])
+        {
+            leaf = rhs->leaves[j++];
+        }
+        else
+        {
+            leaf = lhs->leaves[i++];
+            ++j;
+        }
+
+        cut->leaves[cut->size++] = leaf;
+    }
+
+    lhs_table = expand_table(lhs, cut->leaves, cut->size);
+    rhs_table = expand_table(rhs, cut->leaves, cut->size);
+    cut->table =
+        (lhs_table ^ (lhs_complemented ? 0xFFFF : 0))
+      & (rhs_table ^ (rhs_complemented ? 0xFFFF : 0));
+
+    return true;
+}
+
+/**
+ * \brief Express the table of a cut over a superset of its leaves.
+ */
+static uint16_t expand_table(
+    const rewrite_cut* cut, const size_t* leaves, size_t size)
+{
+    size_t position[REWRITE_CUT_SIZE];
+    uint16_t table = 0;
+
+    for (size_t j = 0, k = 0; j < cut->size; ++j)
+    {
+        while (leaves[k] != cut->leaves[j])
+        {
+            ++k;
+        }
+
+        position[j] = k;
+    }
+
+    (void)size;
+
+    for (unsigned m = 0; m < 16; ++m)
+    {
+        unsigned index = 0;
+
+        for (size_t j = 0; j < cut->size; ++j)
+        {
+            index |= ((m >> position[j]) & 1) << j;
+        }
+
+        table |= (uint16_t)(((cut->table >> index) & 1) << m);
+    }
+
+    return table;
+}
+
+/**
+ * \brief Rebuild an AND in the fresh graph, replacing it with a smaller
+ * implementation over one of its cuts when there is one.
+ */
+static status rewrite_and(rewrite_state* state, size_t node)
+{
+    status retval;
+    const aig_node* n = state->aig->nodes + node;
+    const rewrite_cut* cuts = state->cuts + node * REWRITE_CUT_LIMIT;
+    size_t count = state->cut_counts[node];
+    libsat_aig_edge edge, lhs, rhs;
+    libsat_aig_edge leaves[REWRITE_CUT_SIZE];
+    const rewrite_entry* entry;
+    uint16_t table;
+    bool found = false, complemented;
+
+    /* a constant or a single cut node costs nothing. */
+    for (size_t i = 1; i < count && !found; ++i)
+    {
+        found = match_wire(&edge, state, cuts + i);
+    }
+
+    /* neither does a function already built over the same nodes. */
+    for (size_t i = 1; i < count && !found && NULL != state->entries; ++i)
+    {
+        entry_key(leaves, &table, &complemented, state, cuts + i);
+        entry = entry_slot(state, leaves, cuts[i].size, table);
+        if (entry->used)
+        {
+            edge = entry->edge ^ complemented;
+            found = true;
+        }
+    }
+
+    /* a single AND of two cut nodes costs at most one node. */
+    for (size_t i = 1; i < count && !found; ++i)
+    {
+        if (match_gate(&lhs, &rhs, &complemented, state, cuts + i))
+        {
+            retval = libsat_aig_and(&edge, state->fresh, lhs, rhs);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            edge ^= complemented;
+            found = true;
+        }
+    }
+
+    /* otherwise, keep the AND as it is. */
+    if (!found)
+    {
+        lhs =
+            state->map[LIBSAT_AIG_EDGE_NODE(n->fanin[0])]
+          ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[0]);
+        rhs =
+            state->map[LIBSAT_AIG_EDGE_NODE(n->fanin[1])]
+          ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[1]);
+
+        retval = libsat_aig_and(&edge, state->fresh, lhs, rhs);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    state->map[node] = edge;
+
+    /* later nodes with the same function over the same nodes reuse this. */
+    for (size_t i = 1; i < count; ++i)
+    {
+        retval = entry_insert(state, cuts + i, edge);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Match a cut whose function is a constant or a single cut node.
+ */
+static bool match_wire(
+    libsat_aig_edge* edge, const rewrite_state* state, const rewrite_cut* cut)
+{
+    if (0x0000 == cut->table || 0xFFFF == cut->table)
+    {
+        *edge = (0x0000 == cut->table)
+            ? LIBSAT_AIG_EDGE_FALSE : LIBSAT_AIG_EDGE_TRUE;
+        return true;
+    }
+
+    for (size_t j = 0; j < cut->size; ++j)
+    {
+        uint16_t complement = rewrite_var_table[j] ^ 0xFFFF;
+
+        if (rewrite_var_table[j] == cut->table)
+        {
+            *edge = state->map[cut->leaves[j]];
+            return true;
+        }
+        else if (complement == cut->table)
+        {
+            *edge = LIBSAT_AIG_EDGE_NOT(state->map[cut->leaves[j]]);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Match a cut whose function is a single AND of two cut nodes, in any
+ * polarity.
+ */
+static bool match_gate(
+    libsat_aig_edge* lhs, libsat_aig_edge* rhs, bool* complemented,
+    const rewrite_state* state, const rewrite_cut* cut)
+{
+    for (size_t j = 0; j < cut->size; ++j)
+    {
+        for (size_t k = j + 1; k < cut->size; ++k)
+        {
+            for (unsigned polarity = 0; polarity < 8; ++polarity)
+            {
+                uint16_t table =
+                    (rewrite_var_table[j] ^ ((polarity & 1) ? 0xFFFF : 0))
+                  & (rewrite_var_table[k] ^ ((polarity & 2) ? 0xFFFF : 0));
+
+                table ^= (polarity & 4) ? 0xFFFF : 0;
+                if (table == cut->table)
+                {
+                    *lhs = state->map[cut->leaves[j]] ^ (polarity & 1);
+                    *rhs = state->map[cut->leaves[k]] ^ ((polarity >> 1) & 1);
+                    *complemented = (polarity >> 2) & 1;
+                    return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Get the key of a cut in the functional hash.
+ */
+static void entry_key(
+    libsat_aig_edge* leaves, uint16_t* table, bool* complemented,
+    const rewrite_state* state, const rewrite_cut* cut)
+{
+    for (size_t j = 0; j < cut->size; ++j)
+    {
+        leaves[j] = state->map[cut->leaves[j]];
+    }
+
+    *complemented = cut->table & 1;
+    *table = *complemented ? (uint16_t)~cut->table : cut->table;
+}
+
+/**
+ * \brief Find the entry of a key in the functional hash, or the empty entry
+ * where it belongs.
+ */
+static rewrite_entry* entry_slot(
+    const rewrite_state* state, const libsat_aig_edge* leaves, uint8_t size,
+    uint16_t table)
+{
+    size_t mask = state->entry_capacity - 1;
+    uint64_t hash = table;
+    size_t slot;
+
+    for (size_t j = 0; j < size; ++j)
+    {
+        hash = (hash ^ leaves[j]) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    /* linear probing; the table is never full. */
+    for (slot = (size_t)(hash ^ (hash >> 29)) & mask;
+         state->entries[slot].used; slot = (slot + 1) & mask)
+    {
+        const rewrite_entry* entry = state->entries + slot;
+
+        if (
+            entry->size == size && entry->table == table
+         && 0 == memcmp(entry->leaves, leaves, size * sizeof(*leaves)))
+        {
+            break;
+        }
+    }
+
+    return state->entries + slot;
+}
+
+/**
+ * \brief Record the edge that computes the function of a cut, unless one is
+ * already recorded.
+ */
+static status entry_insert(
+    rewrite_state* state, const rewrite_cut* cut, libsat_aig_edge edge)
+{
+    status retval;
+    libsat_aig_edge leaves[REWRITE_CUT_SIZE];
+    rewrite_entry* entry;
+    uint16_t table;
+    bool complemented;
+
+    /* keep the table at most half full. */
+    if (2 * (state->entry_count + 1) > state->entry_capacity)
+    {
+        rewrite_entry* old_entries = state->entries;
+        size_t old_capacity = state->entry_capacity;
+        size_t capacity = (0 == old_capacity) ? 256 : 2 * old_capacity;
+
+        retval =
+            allocator_allocate(
+                state->aig->alloc, (void**)&state->entries,
+                capacity * sizeof(*state->entries));
+        if (STATUS_SUCCESS != retval)
+        {
+            state->entries = old_entries;
+            return retval;
+        }
+
+        memset(state->entries, 0, capacity * sizeof(*state->entries));
+        state->entry_capacity = capacity;
+
+        for (size_t i = 0; i < old_capacity; ++i)
+        {
+            if (old_entries[i].used)
+            {
+                *entry_slot(
+                    state, old_entries[i].leaves, old_entries[i].size,
+                    old_entries[i].table) = old_entries[i];
+            }
+        }
+
+        if (NULL != old_entries)
+        {
+            retval = allocator_reclaim(state->aig->alloc, old_entries);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    entry_key(leaves, &table, &complemented, state, cut);
+    entry = entry_slot(state, leaves, cut->size, table);
+    if (!entry->used)
+    {
+        memcpy(entry->leaves, leaves, cut->size * sizeof(*leaves));
+        entry->size = cut->size;
+        entry->table = table;
+        entry->edge = edge ^ complemented;
+        entry->used = true;
+        ++state->entry_count;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Copy the cone of the roots from the fresh graph, updating the roots.
+ */
+static status compact(
+    libsat_aig* compacted, const libsat_aig* fresh, libsat_aig_edge* roots,
+    size_t count)
+{
+    status retval, release_retval;
+    uint8_t* marks;
+    libsat_aig_edge* map;
+    const aig_node* n;
+
+    retval =
+        allocator_allocate(
+            fresh->alloc, (void**)&marks, fresh->node_count * sizeof(*marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            fresh->alloc, (void**)&map, fresh->node_count * sizeof(*map));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_marks;
+    }
+
+    mark_cone(marks, fresh, roots, count);
+    map[0] = LIBSAT_AIG_EDGE_FALSE;
+
+    for (size_t node = 1; node < fresh->node_count; ++node)
+    {
+        n = fresh->nodes + node;
+
+        if (!marks[node])
+        {
+            continue;
+        }
+        else if (LIBSAT_AIG_NO_VARIABLE != n->variable)
+        {
+            retval = libsat_aig_input(&map[node], compacted, n->variable);
+        }
+        else
+        {
+            retval =
+                libsat_aig_and(
+                    &map[node], compacted,
+                    map[LIBSAT_AIG_EDGE_NODE(n->fanin[0])]
+                  ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[0]),
+                    map[LIBSAT_AIG_EDGE_NODE(n->fanin[1])]
+                  ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(n->fanin[1]));
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_map;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        roots[i] =
+            map[LIBSAT_AIG_EDGE_NODE(roots[i])]
+          ^ LIBSAT_AIG_EDGE_IS_COMPLEMENTED(roots[i]);
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+
+cleanup_map:
+    release_retval = allocator_reclaim(fresh->alloc, map);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_marks:
+    release_retval = allocator_reclaim(fresh->alloc, marks);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,479 @@
+/**
+ * \file aig/libsat_aig_write_aiger.c
+ *
+ * \brief Write a circuit over a \ref libsat_aig in AIGER format.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "aig_internal.h"
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief A node that has no AIGER literal.
+ */
+#define AIGER_NO_LITERAL                                          ((size_t)-1)
+
+/* forward decls. */
+static status number_nodes(
+    size_t* and_count, size_t* literals, const libsat_aig* aig,
+    const libsat_aig_circuit* circuit);
+static status write_body(
+    size_t* size, libsat_aig* aig, const libsat_aig_circuit* circuit,
+    const size_t* literals, size_t and_count, bool binary);
+static status write_symbol(
+    size_t* size, libsat_aig* aig, char kind, size_t index, size_t var_id);
+static size_t edge_literal(const size_t* literals, libsat_aig_edge edge);
+static status append(
+    size_t* size, libsat_aig* aig, const void* bytes, size_t count);
+static status append_number(
+    size_t* size, libsat_aig* aig, size_t value, char separator);
+static status append_delta(size_t* size, libsat_aig* aig, size_t value);
+
+/**
+ * \brief Write a circuit over this graph in AIGER format.
+ *
+ * Inputs and then latches take the first AIGER variables, in order, and the
+ * ANDs that the outputs and next states need follow them in the order of the
+ * graph, which is the order that the binary format requires. Inputs, latches,
+ * and outputs whose variables have names in the context are written to the
+ * symbol table.
+ *
+ * \note The data is owned by this graph, and is invalidated by the next
+ * write.
+ *
+ * \param data          Pointer to receive the AIGER data on success.
+ * \param size          Pointer to receive the size of the data, in bytes.
+ * \param aig           The graph for this operation.
+ * \param circuit       The circuit to write.
+ * \param binary        true for the binary format, false for ASCII.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_AIG_BAD_EDGE if an edge is not in this graph.
+ *      - ERROR_LIBSAT_AIG_UNBOUND_INPUT if an output or next state needs an
+ *        input node whose variable is neither an input nor a latch.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_aig_write_aiger)(
+    const uint8_t** data, size_t* size, LIBSAT_SYM(libsat_aig)* aig,
+    const LIBSAT_SYM(libsat_aig_circuit)* circuit, bool binary)
+{
+    status retval, release_retval;
+    size_t* literals;
+    size_t and_count;
+
+    for (size_t i = 0; i < circuit->latch_count; ++i)
+    {
+        if (LIBSAT_AIG_EDGE_NODE(circuit->next[i]) >= aig->node_count)
+        {
+            retval = ERROR_LIBSAT_AIG_BAD_EDGE;
+            goto done;
+        }
+    }
+
+    for (size_t i = 0; i < circuit->output_count; ++i)
+    {
+        if (LIBSAT_AIG_EDGE_NODE(circuit->outputs[i]) >= aig->node_count)
+        {
+            retval = ERROR_LIBSAT_AIG_BAD_EDGE;
+            goto done;
+        }
+    }
+
+    retval =
+        allocator_allocate(
+            aig->alloc, (void**)&literals,
+            aig->node_count * sizeof(*literals));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval = number_nodes(&and_count, literals, aig, circuit);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_literals;
+    }
+
+    retval =
+        write_body(size, aig, circuit, literals, and_count, binary);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_literals;
+    }
+
+    /* success. */
+    *data = aig->buffer;
+    retval = STATUS_SUCCESS;
+
+cleanup_literals:
+    release_retval = allocator_reclaim(aig->alloc, literals);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Give each node that the circuit needs its AIGER literal.
+ *
+ * \param and_count     Pointer to receive the number of ANDs needed.
+ * \param literals      The literal of each node, or AIGER_NO_LITERAL.
+ * \param aig           The graph for this operation.
+ * \param circuit       The circuit to write.
+ */
+static status number_nodes(
+    size_t* and_count, size_t* literals, const libsat_aig* aig,
+    const libsat_aig_circuit* circuit)
+{
+    size_t bound = circuit->input_count + circuit->latch_count;
+
+    /* the nodes in the cone of the circuit start with literal 0. */
+    for (size_t node = 0; node < aig->node_count; ++node)
+    {
+        literals[node] = AIGER_NO_LITERAL;
+    }
+
+    for (size_t i = 0; i < circuit->latch_count; ++i)
+    {
+        literals[LIBSAT_AIG_EDGE_NODE(circuit->next[i])] = 0;
+    }
+
+    for (size_t i = 0; i < circuit->output_count; ++i)
+    {
+        literals[LIBSAT_AIG_EDGE_NODE(circuit->outputs[i])] = 0;
+    }
+
+    /* fanins precede their nodes, so one backward pass reaches them all. */
+    for (size_t node = aig->node_count; node-- > 1;)
+    {
+        if (AIGER_NO_LITERAL != literals[node] && aig_node_is_and(aig, node))
+        {
+            literals[LIBSAT_AIG_EDGE_NODE(aig->nodes[node].fanin[0])] = 0;
+            literals[LIBSAT_AIG_EDGE_NODE(aig->nodes[node].fanin[1])] = 0;
+        }
+    }
+
+    /* inputs and then latches take the first variables. */
+    for (size_t i = 0; i < bound; ++i)
+    {
+        size_t var_id =
+            (i < circuit->input_count)
+                ? circuit->inputs[i]
+                : circuit->latches[i - circuit->input_count];
+
+        if (var_id < aig->input_capacity && 0 != aig->inputs[var_id])
+        {
+            literals[aig->inputs[var_id]] = 2 * (i + 1);
+        }
+    }
+
+    /* the ANDs follow, in the order of the graph. */
+    *and_count = 0;
+    literals[0] = 0;
+    for (size_t node = 1; node < aig->node_count; ++node)
+    {
+        /* skip the nodes outside of the cone, and the bound inputs. */
+        if (0 != literals[node])
+        {
+            continue;
+        }
+        else if (!aig_node_is_and(aig, node))
+        {
+            return ERROR_LIBSAT_AIG_UNBOUND_INPUT;
+        }
+
+        literals[node] = 2 * (bound + ++*and_count);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Write the header, the sections, and the symbol table.
+ */
+static status write_body(
+    size_t* size, libsat_aig* aig, const libsat_aig_circuit* circuit,
+    const size_t* literals, size_t and_count, bool binary)
+{
+    status retval;
+    size_t bound = circuit->input_count + circuit->latch_count;
+
+    *size = 0;
+
+    /* header. */
+    retval = append(size, aig, binary ? "aig " : "aag ", 4);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, bound + and_count, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, circuit->input_count, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, circuit->latch_count, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, circuit->output_count, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, and_count, '\n');
+    }
+
+    /* binary inputs are implicit. */
+    for (
+        size_t i = 0;
+        !binary && i < circuit->input_count && STATUS_SUCCESS == retval; ++i)
+    {
+        retval = append_number(size, aig, 2 * (i + 1), '\n');
+    }
+
+    for (
+        size_t i = 0; i < circuit->latch_count && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        if (!binary)
+        {
+            retval =
+                append_number(
+                    size, aig, 2 * (circuit->input_count + i + 1), ' ');
+        }
+        if (STATUS_SUCCESS == retval)
+        {
+            retval =
+                append_number(
+                    size, aig, edge_literal(literals, circuit->next[i]), '\n');
+        }
+    }
+
+    for (
+        size_t i = 0; i < circuit->output_count && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        retval =
+            append_number(
+                size, aig, edge_literal(literals, circuit->outputs[i]), '\n');
+    }
+
+    /* each AND comes after its fanins, with the larger fanin first. */
+    for (
+        size_t node = 1; node < aig->node_count && STATUS_SUCCESS == retval;
+        ++node)
+    {
+        size_t lhs = literals[node];
+        size_t rhs0, rhs1;
+
+        if (!aig_node_is_and(aig, node) || AIGER_NO_LITERAL == lhs)
+        {
+            continue;
+        }
+
+        rhs0 = edge_literal(literals, aig->nodes[node].fanin[0]);
+        rhs1 = edge_literal(literals, aig->nodes[node].fanin[1]);
+        if (rhs0 < rhs1)
+        {
+            size_t tmp = rhs0;
+            rhs0 = rhs1;
+            rhs1 = tmp;
+        }
+
+        if (binary)
+        {
+            retval = append_delta(size, aig, lhs - rhs0);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = append_delta(size, aig, rhs0 - rhs1);
+            }
+        }
+        else
+        {
+            retval = append_number(size, aig, lhs, ' ');
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = append_number(size, aig, rhs0, ' ');
+            }
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = append_number(size, aig, rhs1, '\n');
+            }
+        }
+    }
+
+    /* symbol table. */
+    for (
+        size_t i = 0; i < circuit->input_count && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        retval = write_symbol(size, aig, 'i', i, circuit->inputs[i]);
+    }
+
+    for (
+        size_t i = 0; i < circuit->latch_count && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        retval = write_symbol(size, aig, 'l', i, circuit->latches[i]);
+    }
+
+    for (
+        size_t i = 0;
+        NULL != circuit->output_names && i < circuit->output_count
+     && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        retval = write_symbol(size, aig, 'o', i, circuit->output_names[i]);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Write a symbol for a variable, if the variable has a name.
+ *
+ * The names of an overlay's base are in the base's table.
+ */
+static status write_symbol(
+    size_t* size, libsat_aig* aig, char kind, size_t index, size_t var_id)
+{
+    status retval;
+    const libsat_context* context = aig->context;
+    intern_entry* entry;
+
+    if (LIBSAT_AIG_NO_VARIABLE == var_id)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (NULL != context->base && var_id < context->base_variable_count)
+    {
+        context = context->base;
+    }
+
+    retval =
+        rbtree_find((resource**)&entry, context->intern_to_string, &var_id);
+    if (ERROR_RBTREE_NOT_FOUND == retval)
+    {
+        return STATUS_SUCCESS;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = append(size, aig, &kind, 1);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append_number(size, aig, index, ' ');
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append(size, aig, entry->string, strlen(entry->string));
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = append(size, aig, "\n", 1);
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Get the AIGER literal of an edge.
+ */
+static size_t edge_literal(const size_t* literals, libsat_aig_edge edge)
+{
+    return
+        literals[LIBSAT_AIG_EDGE_NODE(edge)]
+      | (LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge) ? 1 : 0);
+}
+
+/**
+ * \brief Append bytes to the buffer of the graph, growing it if needed.
+ */
+static status append(
+    size_t* size, libsat_aig* aig, const void* bytes, size_t count)
+{
+    status retval;
+
+    if (*size + count > aig->buffer_capacity)
+    {
+        size_t capacity =
+            (0 == aig->buffer_capacity) ? 256 : aig->buffer_capacity;
+        while (capacity < *size + count)
+        {
+            capacity *= 2;
+        }
+
+        retval = memory_resize(aig->alloc, (void**)&aig->buffer, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        aig->buffer_capacity = capacity;
+    }
+
+    memcpy(aig->buffer + *size, bytes, count);
+    *size += count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Append a decimal number, followed by a separator.
+ */
+static status append_number(
+    size_t* size, libsat_aig* aig, size_t value, char separator)
+{
+    char digits[24];
+    size_t start = sizeof(digits);
+
+    digits[--start] = separator;
+    do
+    {
+        digits[--start] = (char)('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+
+    return append(size, aig, digits + start, sizeof(digits) - start);
+}
+
+/**
+ * \brief Append a delta, seven bits at a time with the least significant bits
+ * first, and the high bit set on every byte but the last.
+ */
+static status append_delta(size_t* size, libsat_aig* aig, size_t value)
+{
+    uint8_t bytes[10];
+    size_t count = 0;
+
+    while (value >= 0x80)
+    {
+        bytes[count++] = (uint8_t)(0x80 | (value & 0x7F));
+        value >>= 7;
+    }
+
+    bytes[count++] = (uint8_t)value;
+
+    return append(size, aig, bytes, count);
+}
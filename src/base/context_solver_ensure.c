@@ -0,0 +1,92 @@
+/**
+ * \file base/context_solver_ensure.c
+ *
+ * \brief Create the solver state of a \ref libsat_context on first use.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "../solver/solver_internal.h"
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Create the clause database, xor matrix, and solver of a context if
+ * they have not been created yet.
+ *
+ * Overlays are created without this state, so that an overlay which is only
+ * used for parsing never pays for it.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(context_solver_ensure)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval, release_retval;
+
+    if (NULL != context->solver)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* create the clause database. */
+    retval = libsat_cnf_create(&context->cnf, context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the native xor matrix. */
+    retval = libsat_xor_matrix_create(&context->xor_matrix, context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_cnf;
+    }
+
+    /* create the solver. */
+    retval = solver_create(&context->solver, context->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_xor_matrix;
+    }
+
+    context->solver->terminate = &context->terminate;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_xor_matrix:
+    release_retval =
+        resource_release(
+            libsat_xor_matrix_resource_handle(context->xor_matrix));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    context->xor_matrix = NULL;
+
+cleanup_cnf:
+    release_retval = resource_release(libsat_cnf_resource_handle(context->cnf));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    context->cnf = NULL;
+
+done:
+    return retval;
+}
@@ -9,18 +9,41 @@
 
 #pragma once
 
+#include <libsat/cnf.h>
 #include <libsat/function_decl.h>
+#include <libsat/xor.h>
 #include <rcpr/allocator.h>
 #include <rcpr/compare.h>
 #include <rcpr/rbtree.h>
 #include <rcpr/resource.h>
 #include <rcpr/resource/protected.h>
+#include <stdatomic.h>
 
 /* C++ compatibility. */
 # ifdef   __cplusplus
 extern "C" {
 # endif /*__cplusplus*/
 
+/**
+ * \brief Forward declaration for the solver owned by a context.
+ */
+typedef struct LIBSAT_SYM(libsat_solver) LIBSAT_SYM(libsat_solver);
+
+/**
+ * \brief A scope opened by libsat_context_push, recording what to restore when
+ * it is popped.
+ */
+typedef struct LIBSAT_SYM(libsat_context_scope) LIBSAT_SYM(libsat_context_scope);
+struct LIBSAT_SYM(libsat_context_scope)
+{
+    size_t variable_count;
+    size_t clause_count;
+    size_t native_count;
+    size_t soft_count;
+    bool has_true_variable;
+    LIBSAT_SYM(libsat_literal) activation;
+};
+
 /**
  * \brief Implementation of the libsat_context structure.
  */
@@ -31,6 +54,28 @@ struct LIBSAT_SYM(libsat_context)
     RCPR_SYM(rbtree)* string_to_intern;
     RCPR_SYM(rbtree)* intern_to_string;
     size_t variable_count;
+    LIBSAT_SYM(libsat_cnf)* cnf;
+    LIBSAT_SYM(libsat_xor_matrix)* xor_matrix;
+    LIBSAT_SYM(libsat_solver)* solver;
+    bool has_true_variable;
+    size_t true_variable;
+    LIBSAT_SYM(libsat_context_scope)* scopes;
+    size_t scope_count;
+    size_t scope_capacity;
+    LIBSAT_SYM(libsat_literal)* assumptions;
+    size_t assumption_capacity;
+    bool frozen;
+    LIBSAT_SYM(libsat_context)* base;
+    size_t base_variable_count;
+    bool merged;
+    size_t* translation;
+    LIBSAT_SYM(libsat_literal)* alias;
+    size_t alias_capacity;
+    LIBSAT_SYM(libsat_literal)* soft_literals;
+    uint64_t* soft_weights;
+    size_t soft_count;
+    size_t soft_capacity;
+    atomic_bool terminate;
 };
 
 /**
@@ -98,6 +143,54 @@ LIBSAT_SYM(libsat_context_resource_release)(
 /* Start of private methods.                                                  */
 /******************************************************************************/
 
+/**
+ * \brief Allocate a context with its intern trees, but without a clause
+ * database, xor matrix, or solver.
+ *
+ * \param context       Pointer to the context pointer to be set to this created
+ *                      context instance on success.
+ * \param alloc         The allocator to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(context_allocate)(
+    LIBSAT_SYM(libsat_context)** context, RCPR_SYM(allocator)* alloc);
+
+/**
+ * \brief Create the clause database, xor matrix, and solver of a context if
+ * they have not been created yet.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(context_solver_ensure)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Resize a block of memory, allocating it if it has not yet been
+ * allocated.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        Pointer to the memory pointer to resize. If this is
+ *                      NULL, then a new block is allocated. On success, this
+ *                      is updated to point to the resized block.
+ * \param size          The new size of the block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(memory_resize)(
+    RCPR_SYM(allocator)* alloc, void** memory, size_t size);
+
 /**
  * \brief Compare two opaque \ref intern_entry values for sorting in an
  * intern-to-string tree mapping.
@@ -164,6 +257,15 @@ LIBSAT_SYM(string_to_intern_tree_key)(
 #define __INTERNAL_LIBSAT_IMPORT_base_internal_sym(sym) \
     LIBSAT_BEGIN_EXPORT \
     typedef LIBSAT_SYM(intern_entry) sym ## intern_entry; \
+    typedef LIBSAT_SYM(libsat_context_scope) sym ## libsat_context_scope; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## context_allocate( \
+        LIBSAT_SYM(libsat_context)** x, RCPR_SYM(allocator)* y) { \
+            return LIBSAT_SYM(context_allocate)(x,y); }  \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## context_solver_ensure( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            return LIBSAT_SYM(context_solver_ensure)(x); }  \
     static inline status FN_DECL_MUST_CHECK \
     sym ## intern_entry_create( \
         LIBSAT_SYM(intern_entry)** w, RCPR_SYM(allocator)* x, const char* y, \
@@ -177,6 +279,10 @@ LIBSAT_SYM(string_to_intern_tree_key)(
     sym ## libsat_context_resource_release( \
         RCPR_SYM(resource)* x) { \
             return LIBSAT_SYM(libsat_context_resource_release)(x); }  \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## memory_resize( \
+        RCPR_SYM(allocator)* x, void** y, size_t z) { \
+            return LIBSAT_SYM(memory_resize)(x,y,z); } \
     static inline RCPR_SYM(rcpr_comparison_result) \
     sym ## intern_to_string_tree_compare( \
         void* x, const void* y, const void* z) { \
@@ -8,22 +8,13 @@
  */
 
 #include <libsat/libsat.h>
-#include <rcpr/vtable.h>
-#include <string.h>
 
 #include "libsat_base_internal.h"
 
 LIBSAT_IMPORT_base;
 LIBSAT_IMPORT_base_internal;
-RCPR_IMPORT_allocator;
-RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
 
-/* the vtable entry for the libsat_context instance. */
-RCPR_VTABLE
-resource_vtable libsat_context_vtable = {
-    &libsat_context_resource_release };
-
 /**
  * \brief Create a context instance.
  *
@@ -42,35 +33,15 @@ LIBSAT_SYM(libsat_context_create)(
     status retval, release_retval;
     libsat_context* tmp;
 
-    /* attempt to allocate memory for this libsat_context. */
-    retval = allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    /* allocate the context and its intern trees. */
+    retval = context_allocate(&tmp, alloc);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* initialize the context. */
-    memset(tmp, 0, sizeof(*tmp));
-    tmp->alloc = alloc;
-
-    /* initialize the resource. */
-    resource_init(&tmp->hdr, &libsat_context_vtable);
-
-    /* create the string to intern tree. */
-    retval =
-        rbtree_create(
-            &tmp->string_to_intern, alloc, &string_to_intern_tree_compare,
-            &string_to_intern_tree_key, NULL);
-    if (STATUS_SUCCESS != retval)
-    {
-        goto cleanup_tmp;
-    }
-
-    /* create the intern to string tree. */
-    retval =
-        rbtree_create(
-            &tmp->intern_to_string, alloc, &intern_to_string_tree_compare,
-            &intern_to_string_tree_key, NULL);
+    /* create the clause database, xor matrix, and solver. */
+    retval = context_solver_ensure(tmp);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_tmp;
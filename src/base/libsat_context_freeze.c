@@ -0,0 +1,30 @@
+/**
+ * \file base/libsat_context_freeze.c
+ *
+ * \brief Freeze the variable table of a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Freeze the variable table of a context.
+ *
+ * A frozen context never changes its variable table, so any number of threads
+ * may look up its variables, or parse against it, at the same time. Names that
+ * are not yet known can be created in an overlay of the frozen context.
+ *
+ * \param context       The context to freeze.
+ */
+void
+LIBSAT_SYM(libsat_context_freeze)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    context->frozen = true;
+}
@@ -0,0 +1,76 @@
+/**
+ * \file base/libsat_context_overlay_create.c
+ *
+ * \brief Create an overlay over a frozen \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Create an overlay over a frozen context.
+ *
+ * The overlay is a context of its own that sees every variable of its base.
+ * Names that the base does not know are created in the overlay, with ids that
+ * follow those of the base, and are given their final ids in the base by
+ * \ref libsat_context_overlay_merge. Each thread should parse against its own
+ * overlay; overlays of the same base can be created and used concurrently.
+ *
+ * The overlay starts with its intern trees only; its clause database, xor
+ * matrix, and solver are created the first time something needs them.
+ *
+ * The base must outlive the overlay, and must stay frozen while the overlay
+ * is in use.
+ *
+ * \param overlay       Pointer to the context pointer to be set to the created
+ *                      overlay on success.
+ * \param base          The frozen context to overlay.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_FROZEN if the base is not frozen.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_IS_OVERLAY if the base is itself an
+ *        overlay.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_create)(
+    LIBSAT_SYM(libsat_context)** overlay, LIBSAT_SYM(libsat_context)* base)
+{
+    status retval;
+    libsat_context* tmp;
+
+    if (!base->frozen)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_NOT_FROZEN;
+    }
+
+    if (NULL != base->base)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_IS_OVERLAY;
+    }
+
+    /* create the overlay context, without solver state. */
+    retval = context_allocate(&tmp, base->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* new variables are numbered after those of the base. */
+    tmp->base = base;
+    tmp->base_variable_count = base->variable_count;
+    tmp->variable_count = base->variable_count;
+
+    /* success. */
+    *overlay = tmp;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,125 @@
+/**
+ * \file base/libsat_context_overlay_merge.c
+ *
+ * \brief Merge the variables of an overlay into its base.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Merge the variables created in an overlay into its base.
+ *
+ * The variables of the overlay are visited in the order in which the overlay
+ * created them. A name already known to the base, perhaps because an earlier
+ * overlay was merged with it, keeps its id in the base; any other variable is
+ * given the next id of the base. Merging the overlays of a set of inputs in
+ * input order therefore numbers every variable exactly as parsing the same
+ * inputs in order against the base would, however the parsing was scheduled.
+ *
+ * Afterward, the overlay is frozen, and \ref libsat_context_overlay_translate
+ * maps its ids to those of the base. The base stays frozen, but is changed by
+ * this call, so no overlay of the base may be in use while it runs.
+ *
+ * \param base          The base of the overlay.
+ * \param overlay       The overlay to merge.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the overlay is not an
+ *        overlay of this base.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_MERGED if the overlay was already merged.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_merge)(
+    LIBSAT_SYM(libsat_context)* base, LIBSAT_SYM(libsat_context)* overlay)
+{
+    status retval, release_retval;
+    size_t* translation;
+    intern_entry* entry;
+    size_t count, id;
+    bool frozen = base->frozen;
+
+    if (overlay->base != base)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY;
+    }
+
+    if (overlay->merged)
+    {
+        return ERROR_LIBSAT_BASE_OVERLAY_MERGED;
+    }
+
+    /* allocate the translation table. */
+    count = overlay->variable_count - overlay->base_variable_count;
+    retval =
+        allocator_allocate(
+            base->alloc, (void**)&translation,
+            (count + 1) * sizeof(*translation));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the base takes the new names even though it is frozen. */
+    base->frozen = false;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        id = overlay->base_variable_count + i;
+
+        retval =
+            rbtree_find((resource**)&entry, overlay->intern_to_string, &id);
+        if (ERROR_RBTREE_NOT_FOUND == retval)
+        {
+            /* unique variables have no name. */
+            retval =
+                libsat_context_variable_get(
+                    &translation[i], base, NULL,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+        }
+        else if (STATUS_SUCCESS == retval)
+        {
+            retval =
+                libsat_context_variable_get(
+                    &translation[i], base, entry->string,
+                    LIBSAT_VARIABLE_GET_DEFAULT);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_translation;
+        }
+    }
+
+    /* success. */
+    overlay->translation = translation;
+    overlay->merged = true;
+    overlay->frozen = true;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_translation:
+    release_retval = allocator_reclaim(base->alloc, translation);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    base->frozen = frozen;
+
+    return retval;
+}
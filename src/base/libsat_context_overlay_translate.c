@@ -0,0 +1,64 @@
+/**
+ * \file base/libsat_context_overlay_translate.c
+ *
+ * \brief Translate a variable id of a merged overlay to its id in the base.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Translate a variable id of a merged overlay to its id in the base.
+ *
+ * \param var_id        Pointer to the variable id to be set to the id in the
+ *                      base on success.
+ * \param overlay       The merged overlay.
+ * \param overlay_id    The variable id in the overlay.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the context is not an
+ *        overlay.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED if the overlay has not been
+ *        merged.
+ *      - ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND if the overlay has no
+ *        such variable.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_overlay_translate)(
+    size_t* var_id, const LIBSAT_SYM(libsat_context)* overlay,
+    size_t overlay_id)
+{
+    if (NULL == overlay->base)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY;
+    }
+
+    if (!overlay->merged)
+    {
+        return ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED;
+    }
+
+    /* the variables of the base keep their ids. */
+    if (overlay_id < overlay->base_variable_count)
+    {
+        *var_id = overlay_id;
+        return STATUS_SUCCESS;
+    }
+
+    if (overlay_id >= overlay->variable_count)
+    {
+        return ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND;
+    }
+
+    *var_id = overlay->translation[overlay_id - overlay->base_variable_count];
+    return STATUS_SUCCESS;
+}
@@ -9,10 +9,13 @@
 
 #include <libsat/libsat.h>
 
+#include "../solver/solver_internal.h"
 #include "libsat_base_internal.h"
 
 LIBSAT_IMPORT_base;
 LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_xor;
 RCPR_IMPORT_allocator;
 RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
@@ -37,6 +40,39 @@ LIBSAT_SYM(libsat_context_resource_release)(
     /* cache allocator. */
     allocator* alloc = ctx->alloc;
 
+    /* release solver if set. */
+    if (NULL != ctx->solver)
+    {
+        release_retval = resource_release(&ctx->solver->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* release xor matrix if set. */
+    if (NULL != ctx->xor_matrix)
+    {
+        release_retval =
+            resource_release(
+                libsat_xor_matrix_resource_handle(ctx->xor_matrix));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* release clause database if set. */
+    if (NULL != ctx->cnf)
+    {
+        release_retval =
+            resource_release(libsat_cnf_resource_handle(ctx->cnf));
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
     /* release string_to_intern tree if set. */
     if (NULL != ctx->string_to_intern)
     {
@@ -59,6 +95,65 @@ LIBSAT_SYM(libsat_context_resource_release)(
         }
     }
 
+    /* reclaim scopes if set. */
+    if (NULL != ctx->scopes)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->scopes);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* reclaim assumptions if set. */
+    if (NULL != ctx->assumptions)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->assumptions);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* reclaim the overlay translation table if set. */
+    if (NULL != ctx->translation)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->translation);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* reclaim the alias table if set. */
+    if (NULL != ctx->alias)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->alias);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    /* reclaim the soft statements if set. */
+    if (NULL != ctx->soft_literals)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->soft_literals);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != ctx->soft_weights)
+    {
+        release_retval = allocator_reclaim(alloc, ctx->soft_weights);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
     /* reclaim structure. */
     release_retval = allocator_reclaim(alloc, ctx);
     if (STATUS_SUCCESS != release_retval)
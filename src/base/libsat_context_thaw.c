@@ -0,0 +1,43 @@
+/**
+ * \file base/libsat_context_thaw.c
+ *
+ * \brief Thaw the variable table of a frozen \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Thaw a frozen context, so that it can be changed again.
+ *
+ * No overlay of this context may be in use while it is thawed, since the
+ * overlays read its variable table without synchronization.
+ *
+ * \param context       The context to thaw.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_MERGED if the context is an overlay that
+ *        has been merged, since its variables now belong to its base.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_thaw)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    if (context->merged)
+    {
+        return ERROR_LIBSAT_BASE_OVERLAY_MERGED;
+    }
+
+    context->frozen = false;
+
+    return STATUS_SUCCESS;
+}
@@ -12,16 +12,23 @@
 
 #include "libsat_base_internal.h"
 
+LIBSAT_IMPORT_base;
 LIBSAT_IMPORT_base_internal;
 RCPR_IMPORT_rbtree;
 RCPR_IMPORT_resource;
 
 /* forward decls. */
 static status check_flags(int flags);
+static status find_name(
+    intern_entry** entry, const libsat_context* context, const char* var_name);
 
 /**
  * \brief Get or create a variable by name.
  *
+ * A frozen context only returns variables that already exist. An overlay
+ * returns the variables of its base, and creates new variables in its own
+ * table, numbered after those of its base.
+ *
  * \param var_id        Pointer to the variable id to be set on success.
  * \param context       The context for this operation.
  * \param var_name      The name of the variable.
@@ -30,6 +37,8 @@ static status check_flags(int flags);
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the variable would be created in
+ *        a frozen context.
  *      - a non-zero error code on failure.
  */
 status FN_DECL_MUST_CHECK
@@ -51,6 +60,12 @@ LIBSAT_SYM(libsat_context_variable_get)(
      * the id. */
     if (flags & LIBSAT_VARIABLE_GET_UNIQUE)
     {
+        if (context->frozen)
+        {
+            retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+            goto done;
+        }
+
         *var_id = context->variable_count;
         context->variable_count += 1;
 
@@ -59,7 +74,7 @@ LIBSAT_SYM(libsat_context_variable_get)(
     }
 
     /* look up the variable by name. */
-    retval = rbtree_find((resource**)&tmp, context->string_to_intern, var_name);
+    retval = find_name(&tmp, context, var_name);
 
     /* decode the returned value. */
     switch (retval)
@@ -86,6 +101,13 @@ LIBSAT_SYM(libsat_context_variable_get)(
                 goto done;
             }
 
+            /* a frozen context can't create it. */
+            if (context->frozen)
+            {
+                retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+                goto done;
+            }
+
             /* fall into the base case at the end of the function. */
             break;
 
@@ -165,3 +187,36 @@ static status check_flags(int flags)
 
     return STATUS_SUCCESS;
 }
+
+/**
+ * \brief Look up a name, first in the base of an overlay, and then in the
+ * context itself.
+ *
+ * The base of an overlay is frozen, so reading its table is safe while other
+ * overlays of the same base read it too. Names that merges added to the base
+ * after the overlay was created belong to the overlay's own table instead.
+ */
+static status find_name(
+    intern_entry** entry, const libsat_context* context, const char* var_name)
+{
+    status retval;
+
+    if (NULL != context->base)
+    {
+        retval =
+            rbtree_find(
+                (resource**)entry, context->base->string_to_intern, var_name);
+        if (STATUS_SUCCESS != retval && ERROR_RBTREE_NOT_FOUND != retval)
+        {
+            return retval;
+        }
+
+        if (   STATUS_SUCCESS == retval
+            && (*entry)->string_index < context->base_variable_count)
+        {
+            return STATUS_SUCCESS;
+        }
+    }
+
+    return rbtree_find((resource**)entry, context->string_to_intern, var_name);
+}
@@ -0,0 +1,40 @@
+/**
+ * \file base/memory_resize.c
+ *
+ * \brief Resize a block of memory.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief Resize a block of memory, allocating it if it has not yet been
+ * allocated.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        Pointer to the memory pointer to resize. If this is
+ *                      NULL, then a new block is allocated. On success, this
+ *                      is updated to point to the resized block.
+ * \param size          The new size of the block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(memory_resize)(
+    RCPR_SYM(allocator)* alloc, void** memory, size_t size)
+{
+    /* not every allocator accepts NULL for reallocation. */
+    if (NULL == *memory)
+    {
+        return allocator_allocate(alloc, memory, size);
+    }
+
+    return allocator_reallocate(alloc, memory, size);
+}
@@ -0,0 +1,153 @@
+/**
+ * \file cnf/cnf_add_at_most.c
+ *
+ * \brief Normalize and encode an at-most constraint.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief Add sum(weights[i] * lits[i]) <= bound using the given encoding.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal, or NULL for all ones.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_add_at_most)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound, int encoding)
+{
+    status retval, release_retval;
+    libsat_literal* kept_lits;
+    uint64_t* kept_weights;
+    size_t kept = 0;
+    uint64_t kept_total = 0;
+
+    /* a constraint without literals always holds. */
+    if (0 == count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* allocate the normalized constraint. */
+    retval =
+        allocator_allocate(
+            cnf->alloc, (void**)&kept_lits, count * sizeof(*kept_lits));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            cnf->alloc, (void**)&kept_weights, count * sizeof(*kept_weights));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_kept_lits;
+    }
+
+    /* drop zero weights, and fix literals that overshoot the bound alone. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t weight = (NULL == weights) ? 1 : weights[i];
+
+        if (0 == weight)
+        {
+            continue;
+        }
+
+        if (weight > bound)
+        {
+            libsat_literal unit = LIBSAT_LITERAL_NEGATE(lits[i]);
+
+            retval = libsat_cnf_add_clause(cnf, &unit, 1);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_kept_weights;
+            }
+
+            continue;
+        }
+
+        kept_lits[kept] = lits[i];
+        kept_weights[kept] = weight;
+        kept_total += weight;
+        kept += 1;
+    }
+
+    /* if every remaining literal fits under the bound, there is nothing
+     * left to encode. */
+    if (kept_total <= bound)
+    {
+        retval = STATUS_SUCCESS;
+        goto cleanup_kept_weights;
+    }
+
+    /* encode the remainder. */
+    switch (encoding)
+    {
+        case LIBSAT_CNF_ENCODING_SEQUENTIAL_COUNTER:
+            retval =
+                cnf_encode_sequential_counter(
+                    cnf, kept_lits, kept_weights, kept, bound);
+            break;
+
+        case LIBSAT_CNF_ENCODING_TOTALIZER:
+            retval =
+                cnf_encode_totalizer(
+                    cnf, kept_lits, kept_weights, kept, bound);
+            break;
+
+        case LIBSAT_CNF_ENCODING_SORTING_NETWORK:
+            retval =
+                cnf_encode_sorting_network(
+                    cnf, kept_lits, kept_weights, kept, bound);
+            break;
+
+        case LIBSAT_CNF_ENCODING_NATIVE:
+            retval =
+                cnf_add_native(cnf, kept_lits, kept_weights, kept, bound);
+            break;
+
+        default:
+            retval = ERROR_LIBSAT_CNF_BAD_ENCODING;
+            break;
+    }
+
+    goto cleanup_kept_weights;
+
+cleanup_kept_weights:
+    release_retval = allocator_reclaim(cnf->alloc, kept_weights);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_kept_lits:
+    release_retval = allocator_reclaim(cnf->alloc, kept_lits);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
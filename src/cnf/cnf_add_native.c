@@ -0,0 +1,139 @@
+/**
+ * \file cnf/cnf_add_native.c
+ *
+ * \brief Store a native at-most constraint in a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+
+/**
+ * \brief Store sum(weights[i] * lits[i]) <= bound as a native constraint.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_add_native)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound)
+{
+    status retval;
+    size_t stored = cnf->guarded ? count + 1 : count;
+
+    /* grow the literal and weight storage if needed. */
+    if (cnf->native_literal_count + stored > cnf->native_literal_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->native_literal_capacity)
+                ? 64 : 2 * cnf->native_literal_capacity;
+        while (capacity < cnf->native_literal_count + stored)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->native_literals,
+                capacity * sizeof(*cnf->native_literals));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->native_weights,
+                capacity * sizeof(*cnf->native_weights));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->native_literal_capacity = capacity;
+    }
+
+    /* grow the constraint index if needed. */
+    if (cnf->native_count == cnf->native_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->native_capacity) ? 16 : 2 * cnf->native_capacity;
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->native_end,
+                capacity * sizeof(*cnf->native_end));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->native_bound,
+                capacity * sizeof(*cnf->native_bound));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->native_capacity = capacity;
+    }
+
+    /* mark the variables of this constraint. */
+    retval = cnf_mention(cnf, lits, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* append the constraint. */
+    memcpy(
+        cnf->native_literals + cnf->native_literal_count, lits,
+        count * sizeof(*lits));
+    memcpy(
+        cnf->native_weights + cnf->native_literal_count, weights,
+        count * sizeof(*weights));
+
+    cnf->native_literal_count += count;
+
+    /* a guarded constraint is relaxed by the negation of its guard, weighted
+     * so that it covers every other literal. */
+    if (cnf->guarded)
+    {
+        uint64_t total = 0;
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            total += weights[i];
+        }
+
+        cnf->native_literals[cnf->native_literal_count] =
+            LIBSAT_LITERAL_NEGATE(cnf->guard);
+        cnf->native_weights[cnf->native_literal_count] = total - bound;
+        cnf->native_literal_count += 1;
+        bound = total;
+    }
+
+    cnf->native_end[cnf->native_count] = cnf->native_literal_count;
+    cnf->native_bound[cnf->native_count] = bound;
+    cnf->native_count += 1;
+
+    return STATUS_SUCCESS;
+}
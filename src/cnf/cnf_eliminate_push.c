@@ -0,0 +1,131 @@
+/**
+ * \file cnf/cnf_eliminate_push.c
+ *
+ * \brief Push a clause removed by variable elimination onto the elimination
+ * stack.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Push a clause removed by eliminating a variable onto the elimination
+ * stack, and mark the variable as eliminated.
+ *
+ * \param cnf           The database for this operation.
+ * \param pivot         The literal of the eliminated variable in this clause.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals in this clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_eliminate_push)(
+    LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_literal) pivot,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count)
+{
+    status retval;
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(pivot);
+
+    /* grow the variable states if needed. */
+    if (var_id >= cnf->eliminated_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->eliminated_capacity) ? 64 : 2 * cnf->eliminated_capacity;
+        while (capacity <= var_id)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(cnf->alloc, (void**)&cnf->eliminated, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memset(
+            cnf->eliminated + cnf->eliminated_capacity, CNF_VARIABLE_ACTIVE,
+            capacity - cnf->eliminated_capacity);
+        cnf->eliminated_capacity = capacity;
+    }
+
+    /* grow the removed literals if needed. */
+    if (cnf->removed_literal_count + count > cnf->removed_literal_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->removed_literal_capacity)
+                ? 256 : 2 * cnf->removed_literal_capacity;
+        while (capacity < cnf->removed_literal_count + count)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->removed_literals,
+                capacity * sizeof(*cnf->removed_literals));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->removed_literal_capacity = capacity;
+    }
+
+    /* grow the removed clause index if needed. */
+    if (cnf->removed_count == cnf->removed_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->removed_capacity) ? 64 : 2 * cnf->removed_capacity;
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->removed_end,
+                capacity * sizeof(*cnf->removed_end));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->removed_pivot,
+                capacity * sizeof(*cnf->removed_pivot));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->removed_capacity = capacity;
+    }
+
+    /* push the clause. */
+    memcpy(
+        cnf->removed_literals + cnf->removed_literal_count, lits,
+        count * sizeof(*lits));
+    cnf->removed_literal_count += count;
+    cnf->removed_end[cnf->removed_count] = cnf->removed_literal_count;
+    cnf->removed_pivot[cnf->removed_count] = pivot;
+    cnf->removed_count += 1;
+
+    /* the variable is now eliminated. */
+    if (CNF_VARIABLE_ELIMINATED != cnf->eliminated[var_id])
+    {
+        cnf->eliminated[var_id] = CNF_VARIABLE_ELIMINATED;
+        cnf->eliminated_count += 1;
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
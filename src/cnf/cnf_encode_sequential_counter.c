@@ -0,0 +1,156 @@
+/**
+ * \file cnf/cnf_encode_sequential_counter.c
+ *
+ * \brief Encode an at-most constraint as a sequential weight counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as a sequential weight
+ * counter.
+ *
+ * Register variable s(i, j) holds when the weights of the true literals among
+ * lits[0..i] sum to at least j, for 1 <= j <= bound. With unit weights, this
+ * is the sequential counter of Sinz.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE if the register does not fit in
+ *        memory.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_sequential_counter)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound)
+{
+    status retval, release_retval;
+    libsat_literal* reg;
+    size_t k = (size_t)bound;
+    size_t rows = count - 1;
+
+/* register literal s(i, j), for 1 <= j <= k. */
+#define S(i, j) reg[(i) * k + (j) - 1]
+
+    /* the register holds (count - 1) * bound variables. */
+    if (bound > SIZE_MAX / sizeof(*reg) / rows)
+    {
+        retval = ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE;
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            cnf->alloc, (void**)&reg, rows * k * sizeof(*reg));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < rows * k; ++i)
+    {
+        size_t var_id;
+
+        retval = cnf_fresh_variable(&var_id, cnf);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_reg;
+        }
+
+        reg[i] = LIBSAT_LITERAL_MAKE(var_id, false);
+    }
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        libsat_literal not_x = LIBSAT_LITERAL_NEGATE(lits[i]);
+        size_t w = (size_t)weights[i];
+
+        /* x_i sets the first w_i bits of its register. */
+        for (size_t j = 1; j <= w; ++j)
+        {
+            retval = cnf_add_binary(cnf, not_x, S(i, j));
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_reg;
+            }
+        }
+
+        if (0 == i)
+        {
+            continue;
+        }
+
+        for (size_t j = 1; j <= k; ++j)
+        {
+            /* the register carries over from the previous row. */
+            retval =
+                cnf_add_binary(
+                    cnf, LIBSAT_LITERAL_NEGATE(S(i - 1, j)), S(i, j));
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_reg;
+            }
+
+            /* x_i adds w_i to the previous row. */
+            if (j + w <= k)
+            {
+                retval =
+                    cnf_add_ternary(
+                        cnf, not_x, LIBSAT_LITERAL_NEGATE(S(i - 1, j)),
+                        S(i, j + w));
+                if (STATUS_SUCCESS != retval)
+                {
+                    goto cleanup_reg;
+                }
+            }
+        }
+    }
+
+    /* x_i may not push the previous row over the bound. */
+    for (size_t i = 1; i < count; ++i)
+    {
+        size_t w = (size_t)weights[i];
+
+        retval =
+            cnf_add_binary(
+                cnf, LIBSAT_LITERAL_NEGATE(lits[i]),
+                LIBSAT_LITERAL_NEGATE(S(i - 1, k + 1 - w)));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_reg;
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_reg;
+
+#undef S
+
+cleanup_reg:
+    release_retval = allocator_reclaim(cnf->alloc, reg);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,213 @@
+/**
+ * \file cnf/cnf_encode_sorting_network.c
+ *
+ * \brief Encode an at-most constraint as an odd-even merge sorting network.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A wire that is constantly false. Padding wires start out this way,
+ * and comparators against them need no clauses.
+ */
+#define WIRE_FALSE                                              ((size_t)-1)
+
+/* forward decls. */
+static status compare(
+    libsat_cnf* cnf, libsat_literal* wires, size_t hi, size_t lo);
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as an odd-even merge
+ * sorting network.
+ *
+ * Each literal is repeated once per unit of weight, and the resulting wires
+ * are sorted in descending order by Batcher's network. Only the half of each
+ * comparator needed for the at-most direction is encoded. The constraint then
+ * forbids sorted output number bound + 1.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE if the unary expansion of the
+ *        weights does not fit in memory.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_sorting_network)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound)
+{
+    status retval, release_retval;
+    libsat_literal* wires;
+    libsat_literal unit;
+    uint64_t total = 0;
+    size_t n = 1;
+    size_t w = 0;
+
+    /* size the network: the unary expansion, padded to a power of two. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        total += weights[i];
+    }
+
+    while (n < total)
+    {
+        if (n > SIZE_MAX / sizeof(*wires) / 2)
+        {
+            retval = ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE;
+            goto done;
+        }
+
+        n *= 2;
+    }
+
+    retval =
+        allocator_allocate(cnf->alloc, (void**)&wires, n * sizeof(*wires));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* lay out the wires. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (uint64_t j = 0; j < weights[i]; ++j)
+        {
+            wires[w++] = lits[i];
+        }
+    }
+
+    while (w < n)
+    {
+        wires[w++] = WIRE_FALSE;
+    }
+
+    /* Batcher's odd-even merge sort. */
+    for (size_t p = 1; p < n; p *= 2)
+    {
+        for (size_t k = p; k >= 1; k /= 2)
+        {
+            for (size_t j = k % p; j + k < n; j += 2 * k)
+            {
+                for (size_t i = 0; i < k && i + j + k < n; ++i)
+                {
+                    if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                    {
+                        retval = compare(cnf, wires, i + j, i + j + k);
+                        if (STATUS_SUCCESS != retval)
+                        {
+                            goto cleanup_wires;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /* output bound + 1 may not be set. It exists, since the weights sum past
+     * the bound. */
+    unit = LIBSAT_LITERAL_NEGATE(wires[bound]);
+    retval = libsat_cnf_add_clause(cnf, &unit, 1);
+    goto cleanup_wires;
+
+cleanup_wires:
+    release_retval = allocator_reclaim(cnf->alloc, wires);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Add a comparator that moves the maximum of two wires to hi and the
+ * minimum to lo.
+ *
+ * \param cnf           The database for this operation.
+ * \param wires         The wires of the network.
+ * \param hi            The wire receiving the maximum.
+ * \param lo            The wire receiving the minimum.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static status compare(
+    libsat_cnf* cnf, libsat_literal* wires, size_t hi, size_t lo)
+{
+    status retval;
+    libsat_literal a = wires[hi];
+    libsat_literal b = wires[lo];
+    size_t max_id, min_id;
+    libsat_literal max, min;
+
+    /* comparing against a false wire just routes the other wire up. */
+    if (WIRE_FALSE == b)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (WIRE_FALSE == a)
+    {
+        wires[hi] = b;
+        wires[lo] = WIRE_FALSE;
+        return STATUS_SUCCESS;
+    }
+
+    /* create the outputs. */
+    retval = cnf_fresh_variable(&max_id, cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = cnf_fresh_variable(&min_id, cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    max = LIBSAT_LITERAL_MAKE(max_id, false);
+    min = LIBSAT_LITERAL_MAKE(min_id, false);
+
+    /* a -> max, b -> max, a ∧ b -> min. */
+    retval = cnf_add_binary(cnf, LIBSAT_LITERAL_NEGATE(a), max);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = cnf_add_binary(cnf, LIBSAT_LITERAL_NEGATE(b), max);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        cnf_add_ternary(
+            cnf, LIBSAT_LITERAL_NEGATE(a), LIBSAT_LITERAL_NEGATE(b), min);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    wires[hi] = max;
+    wires[lo] = min;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,392 @@
+/**
+ * \file cnf/cnf_encode_totalizer.c
+ *
+ * \brief Encode an at-most constraint as a generalized totalizer.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <stdlib.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A totalizer node. Output lits[i] holds when the weights of the true
+ * inputs below this node sum to at least values[i]. Values are sorted, and
+ * saturate at bound + 1.
+ */
+typedef struct totalizer_node
+{
+    uint64_t* values;
+    libsat_literal* lits;
+    size_t count;
+} totalizer_node;
+
+/* forward decls. */
+static status build(
+    totalizer_node* node, libsat_cnf* cnf, const libsat_literal* lits,
+    const uint64_t* weights, size_t count, uint64_t limit);
+static status merge(
+    totalizer_node* node, libsat_cnf* cnf, const totalizer_node* lhs,
+    const totalizer_node* rhs, uint64_t limit);
+static status node_alloc(totalizer_node* node, allocator* alloc, size_t count);
+static status node_release(totalizer_node* node, allocator* alloc);
+static libsat_literal node_find(const totalizer_node* node, uint64_t value);
+static int compare_values(const void* lhs, const void* rhs);
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as a generalized
+ * totalizer.
+ *
+ * Inputs are summed pairwise up a balanced tree of unary counters. With unit
+ * weights, this is the totalizer of Bailleux and Boufkhad, and only the
+ * clauses needed for the at-most direction are added.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE if a node has too many outputs
+ *        to fit in memory.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_totalizer)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound)
+{
+    status retval, release_retval;
+    totalizer_node root;
+
+    /* build the tree. */
+    retval = build(&root, cnf, lits, weights, count, bound + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* the root may not reach past the bound. */
+    for (size_t i = 0; i < root.count; ++i)
+    {
+        if (root.values[i] > bound)
+        {
+            libsat_literal unit = LIBSAT_LITERAL_NEGATE(root.lits[i]);
+
+            retval = libsat_cnf_add_clause(cnf, &unit, 1);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_root;
+            }
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_root;
+
+cleanup_root:
+    release_retval = node_release(&root, cnf->alloc);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Build the totalizer node for a range of inputs.
+ *
+ * \param node          The node to build.
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this range.
+ * \param weights       The weights in this range.
+ * \param count         The number of inputs in this range.
+ * \param limit         The saturation value.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static status build(
+    totalizer_node* node, libsat_cnf* cnf, const libsat_literal* lits,
+    const uint64_t* weights, size_t count, uint64_t limit)
+{
+    status retval, release_retval;
+    totalizer_node lhs, rhs;
+    size_t half = count / 2;
+
+    /* a leaf is its own input literal. */
+    if (1 == count)
+    {
+        retval = node_alloc(node, cnf->alloc, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        node->values[0] = weights[0];
+        node->lits[0] = lits[0];
+        node->count = 1;
+
+        return STATUS_SUCCESS;
+    }
+
+    /* build the children. */
+    retval = build(&lhs, cnf, lits, weights, half, limit);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        build(&rhs, cnf, lits + half, weights + half, count - half, limit);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_lhs;
+    }
+
+    /* sum them. */
+    retval = merge(node, cnf, &lhs, &rhs, limit);
+    goto cleanup_rhs;
+
+cleanup_rhs:
+    release_retval = node_release(&rhs, cnf->alloc);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_lhs:
+    release_retval = node_release(&lhs, cnf->alloc);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Create the outputs of a node from the outputs of its children.
+ *
+ * \param node          The node to create.
+ * \param cnf           The database for this operation.
+ * \param lhs           The left child.
+ * \param rhs           The right child.
+ * \param limit         The saturation value.
+ *
+ * \returns a status code indicating success or failure.
+ */
+static status merge(
+    totalizer_node* node, libsat_cnf* cnf, const totalizer_node* lhs,
+    const totalizer_node* rhs, uint64_t limit)
+{
+    status retval, release_retval;
+    size_t max;
+    size_t count = 0;
+
+    /* there are at most (|lhs| + 1) * (|rhs| + 1) - 1 distinct sums. */
+    if (lhs->count + 1 > SIZE_MAX / sizeof(uint64_t) / (rhs->count + 1))
+    {
+        retval = ERROR_LIBSAT_CNF_ENCODING_TOO_LARGE;
+        goto done;
+    }
+
+    max = (lhs->count + 1) * (rhs->count + 1) - 1;
+    retval = node_alloc(node, cnf->alloc, max);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* collect every reachable sum. */
+    for (size_t i = 0; i < lhs->count; ++i)
+    {
+        node->values[count++] = lhs->values[i];
+    }
+
+    for (size_t j = 0; j < rhs->count; ++j)
+    {
+        node->values[count++] = rhs->values[j];
+
+        for (size_t i = 0; i < lhs->count; ++i)
+        {
+            uint64_t sum = lhs->values[i] + rhs->values[j];
+            node->values[count++] = (sum > limit) ? limit : sum;
+        }
+    }
+
+    /* sort them and drop duplicates. */
+    qsort(node->values, count, sizeof(*node->values), &compare_values);
+    node->count = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (0 == node->count
+         || node->values[node->count - 1] != node->values[i])
+        {
+            node->values[node->count++] = node->values[i];
+        }
+    }
+
+    /* give each sum an output. */
+    for (size_t i = 0; i < node->count; ++i)
+    {
+        size_t var_id;
+
+        retval = cnf_fresh_variable(&var_id, cnf);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_node;
+        }
+
+        node->lits[i] = LIBSAT_LITERAL_MAKE(var_id, false);
+    }
+
+    /* each child output carries up on its own. */
+    for (size_t i = 0; i < lhs->count; ++i)
+    {
+        retval =
+            cnf_add_binary(
+                cnf, LIBSAT_LITERAL_NEGATE(lhs->lits[i]),
+                node_find(node, lhs->values[i]));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_node;
+        }
+    }
+
+    for (size_t j = 0; j < rhs->count; ++j)
+    {
+        retval =
+            cnf_add_binary(
+                cnf, LIBSAT_LITERAL_NEGATE(rhs->lits[j]),
+                node_find(node, rhs->values[j]));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_node;
+        }
+
+        /* and each pair of child outputs carries up their sum. */
+        for (size_t i = 0; i < lhs->count; ++i)
+        {
+            uint64_t sum = lhs->values[i] + rhs->values[j];
+
+            retval =
+                cnf_add_ternary(
+                    cnf, LIBSAT_LITERAL_NEGATE(lhs->lits[i]),
+                    LIBSAT_LITERAL_NEGATE(rhs->lits[j]),
+                    node_find(node, (sum > limit) ? limit : sum));
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_node;
+            }
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_node:
+    release_retval = node_release(node, cnf->alloc);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Allocate the arrays for a node.
+ */
+static status node_alloc(totalizer_node* node, allocator* alloc, size_t count)
+{
+    status retval;
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&node->values, count * sizeof(*node->values));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&node->lits, count * sizeof(*node->lits));
+    if (STATUS_SUCCESS != retval)
+    {
+        status release_retval = allocator_reclaim(alloc, node->values);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+
+        return retval;
+    }
+
+    node->count = 0;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the arrays for a node.
+ */
+static status node_release(totalizer_node* node, allocator* alloc)
+{
+    status values_retval = allocator_reclaim(alloc, node->values);
+    status lits_retval = allocator_reclaim(alloc, node->lits);
+
+    return (STATUS_SUCCESS != values_retval) ? values_retval : lits_retval;
+}
+
+/**
+ * \brief Find the output for a value that is known to be present.
+ */
+static libsat_literal node_find(const totalizer_node* node, uint64_t value)
+{
+    size_t lo = 0;
+    size_t hi = node->count;
+
+    while (hi - lo > 1)
+    {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (node->values[mid] <= value)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return node->lits[lo];
+}
+
+/**
+ * \brief Compare two values for qsort.
+ */
+static int compare_values(const void* lhs, const void* rhs)
+{
+    uint64_t l = *(const uint64_t*)lhs;
+    uint64_t r = *(const uint64_t*)rhs;
+
+    return (l > r) - (l < r);
+}
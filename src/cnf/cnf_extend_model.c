@@ -0,0 +1,55 @@
+/**
+ * \file cnf/cnf_extend_model.c
+ *
+ * \brief Extend a model to the variables eliminated from a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Extend a model to the eliminated variables.
+ *
+ * The elimination stack is walked from the most recent clause back; the pivot
+ * of any clause that the model does not satisfy is flipped to satisfy it.
+ * Since every resolvent on a variable was kept when it was eliminated, this
+ * satisfies all of the removed clauses.
+ *
+ * \param cnf           The database for this operation.
+ * \param model         The model to extend.
+ * \param count         The number of variables in the model.
+ */
+void
+LIBSAT_SYM(cnf_extend_model)(
+    const LIBSAT_SYM(libsat_cnf)* cnf, uint8_t* model, size_t count)
+{
+    size_t end, begin, pivot;
+
+    for (size_t i = cnf->removed_count; i > 0; --i)
+    {
+        bool satisfied = false;
+
+        end = cnf->removed_end[i - 1];
+        begin = (1 == i) ? 0 : cnf->removed_end[i - 2];
+
+        for (size_t j = begin; j < end && !satisfied; ++j)
+        {
+            satisfied =
+                LIBSAT_VALUE_TRUE
+                    == cnf_literal_value(
+                            model, count, cnf->removed_literals[j]);
+        }
+
+        pivot = LIBSAT_LITERAL_VARIABLE(cnf->removed_pivot[i - 1]);
+        if (!satisfied && pivot < count)
+        {
+            model[pivot] =
+                LIBSAT_LITERAL_IS_NEGATED(cnf->removed_pivot[i - 1])
+                    ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+        }
+    }
+}
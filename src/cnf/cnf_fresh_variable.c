@@ -0,0 +1,34 @@
+/**
+ * \file cnf/cnf_fresh_variable.c
+ *
+ * \brief Create a fresh auxiliary variable for a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_base;
+
+/**
+ * \brief Create a fresh auxiliary variable.
+ *
+ * \param var_id        Pointer to receive the new variable id on success.
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_fresh_variable)(
+    size_t* var_id, LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    return
+        libsat_context_variable_get(
+            var_id, cnf->context, NULL,
+            LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+}
@@ -0,0 +1,485 @@
+/**
+ * \file cnf/cnf_internal.h
+ *
+ * \brief Internal details for the clause database.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/cnf.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/resource/protected.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief libsat_cnf implementation.
+ *
+ * Clauses are stored back to back in literals; clause i ends at clause_end[i]
+ * and starts where clause i - 1 ends. Native constraints are stored the same
+ * way, with one weight per literal and one bound per constraint.
+ *
+ * While guarded, the guard literal is added to every clause and relaxes every
+ * native constraint, so that they only hold while the guard is false.
+ *
+ * The clauses removed by variable elimination are kept on the elimination
+ * stack, stored the same way, each with the literal of the variable it was
+ * removed for. They extend models to the eliminated variables, and are added
+ * back if an eliminated variable is used again. Clauses and native
+ * constraints before the checked counts are known not to mention an
+ * eliminated variable.
+ *
+ * Every variable that a clause or native constraint has used is marked as
+ * mentioned, and the mark is kept even if the clause is dropped again.
+ */
+struct LIBSAT_SYM(libsat_cnf)
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    LIBSAT_SYM(libsat_context)* context;
+    LIBSAT_SYM(libsat_literal)* literals;
+    size_t literal_count;
+    size_t literal_capacity;
+    size_t* clause_end;
+    size_t clause_count;
+    size_t clause_capacity;
+    LIBSAT_SYM(libsat_literal)* native_literals;
+    uint64_t* native_weights;
+    size_t native_literal_count;
+    size_t native_literal_capacity;
+    size_t* native_end;
+    uint64_t* native_bound;
+    size_t native_count;
+    size_t native_capacity;
+    bool guarded;
+    LIBSAT_SYM(libsat_literal) guard;
+    uint8_t* eliminated;
+    size_t eliminated_capacity;
+    size_t eliminated_count;
+    LIBSAT_SYM(libsat_literal)* removed_literals;
+    size_t removed_literal_count;
+    size_t removed_literal_capacity;
+    size_t* removed_end;
+    LIBSAT_SYM(libsat_literal)* removed_pivot;
+    size_t removed_count;
+    size_t removed_capacity;
+    size_t checked_clauses;
+    size_t checked_natives;
+    uint8_t* mentioned;
+    size_t mentioned_capacity;
+};
+
+/**
+ * \brief The elimination state of a variable.
+ */
+enum LIBSAT_SYM(cnf_variable_state)
+{
+    /** \brief The variable is in the database. */
+    CNF_VARIABLE_ACTIVE = 0,
+
+    /** \brief The variable was eliminated. */
+    CNF_VARIABLE_ELIMINATED = 1,
+
+    /** \brief The variable is being added back to the database. */
+    CNF_VARIABLE_RESTORING = 2,
+};
+
+/******************************************************************************/
+/* Start of clause and literal helpers.                                       */
+/******************************************************************************/
+
+/**
+ * \brief Get the value of a literal under a partial assignment.
+ */
+static inline uint8_t cnf_literal_value(
+    const uint8_t* values, size_t value_count, LIBSAT_SYM(libsat_literal) lit)
+{
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+    uint8_t value =
+        (var_id < value_count) ? values[var_id] : LIBSAT_VALUE_UNASSIGNED;
+
+    if (LIBSAT_VALUE_UNASSIGNED == value || !LIBSAT_LITERAL_IS_NEGATED(lit))
+    {
+        return value;
+    }
+
+    return
+        (LIBSAT_VALUE_TRUE == value) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+}
+
+/**
+ * \brief Get the elimination state of a variable.
+ */
+static inline uint8_t cnf_variable_state(
+    const LIBSAT_SYM(libsat_cnf)* cnf, size_t var_id)
+{
+    return
+        (var_id < cnf->eliminated_capacity)
+            ? cnf->eliminated[var_id] : CNF_VARIABLE_ACTIVE;
+}
+
+/**
+ * \brief Check whether a clause or native constraint has used a variable.
+ */
+static inline bool cnf_variable_mentioned(
+    const LIBSAT_SYM(libsat_cnf)* cnf, size_t var_id)
+{
+    return var_id < cnf->mentioned_capacity && cnf->mentioned[var_id];
+}
+
+/**
+ * \brief Add a binary clause.
+ */
+static inline status FN_DECL_MUST_CHECK cnf_add_binary(
+    LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_literal) a,
+    LIBSAT_SYM(libsat_literal) b)
+{
+    LIBSAT_SYM(libsat_literal) clause[2] = { a, b };
+
+    return LIBSAT_SYM(libsat_cnf_add_clause)(cnf, clause, 2);
+}
+
+/**
+ * \brief Add a ternary clause.
+ */
+static inline status FN_DECL_MUST_CHECK cnf_add_ternary(
+    LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_literal) a,
+    LIBSAT_SYM(libsat_literal) b, LIBSAT_SYM(libsat_literal) c)
+{
+    LIBSAT_SYM(libsat_literal) clause[3] = { a, b, c };
+
+    return LIBSAT_SYM(libsat_cnf_add_clause)(cnf, clause, 3);
+}
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Release a \ref libsat_cnf resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_resource_release)(
+    RCPR_SYM(resource)* r);
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Create a fresh auxiliary variable.
+ *
+ * \param var_id        Pointer to receive the new variable id on success.
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_fresh_variable)(
+    size_t* var_id, LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Add sum(weights[i] * lits[i]) <= bound using the given encoding.
+ *
+ * Zero weights are dropped, literals that cannot be true on their own are
+ * fixed false, and constraints that always hold are skipped before the
+ * remainder is handed to the encoder.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal, or NULL for all ones.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_add_at_most)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound, int encoding);
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as a sequential weight
+ * counter.
+ *
+ * \note Every weight must be between one and the bound.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_sequential_counter)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound);
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as a generalized
+ * totalizer.
+ *
+ * \note Every weight must be between one and the bound.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_totalizer)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound);
+
+/**
+ * \brief Encode sum(weights[i] * lits[i]) <= bound as an odd-even merge
+ * sorting network.
+ *
+ * \note Every weight must be between one and the bound.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_encode_sorting_network)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound);
+
+/**
+ * \brief Store sum(weights[i] * lits[i]) <= bound as a native constraint.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal.
+ * \param count         The number of literals.
+ * \param bound         The bound of this constraint.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_add_native)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, uint64_t bound);
+
+/**
+ * \brief Mark the variables of the given literals as mentioned.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals to mark.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_mention)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count);
+
+/**
+ * \brief Drop every clause and native constraint past the given counts.
+ *
+ * \param cnf           The database for this operation.
+ * \param clause_count  The number of clauses to keep.
+ * \param native_count  The number of native constraints to keep.
+ */
+void
+LIBSAT_SYM(cnf_truncate)(
+    LIBSAT_SYM(libsat_cnf)* cnf, size_t clause_count, size_t native_count);
+
+/**
+ * \brief Push a clause removed by eliminating a variable onto the elimination
+ * stack, and mark the variable as eliminated.
+ *
+ * \param cnf           The database for this operation.
+ * \param pivot         The literal of the eliminated variable in this clause.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals in this clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_eliminate_push)(
+    LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_literal) pivot,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count);
+
+/**
+ * \brief Add an eliminated variable back to the database.
+ *
+ * \param cnf           The database for this operation.
+ * \param var_id        The variable to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore)(
+    LIBSAT_SYM(libsat_cnf)* cnf, size_t var_id);
+
+/**
+ * \brief Add every eliminated variable back to the database.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore_all)(
+    LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Add the variables marked as restoring back to the database.
+ *
+ * Every eliminated variable mentioned by a clause that is added back is
+ * restored as well. The restored clauses are appended to the database, and
+ * dropped from the elimination stack.
+ *
+ * \note The database must not be guarded.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore_marked)(
+    LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Extend a model to the eliminated variables.
+ *
+ * The elimination stack is walked from the most recent clause back; the pivot
+ * of any clause that the model does not satisfy is flipped to satisfy it.
+ *
+ * \param cnf           The database for this operation.
+ * \param model         The model to extend.
+ * \param count         The number of variables in the model.
+ */
+void
+LIBSAT_SYM(cnf_extend_model)(
+    const LIBSAT_SYM(libsat_cnf)* cnf, uint8_t* model, size_t count);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_cnf_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_cnf_resource_release( \
+        RCPR_SYM(resource)* x) { \
+            return LIBSAT_SYM(libsat_cnf_resource_release)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_fresh_variable( \
+        size_t* x, LIBSAT_SYM(libsat_cnf)* y) { \
+            return LIBSAT_SYM(cnf_fresh_variable)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_add_at_most( \
+        LIBSAT_SYM(libsat_cnf)* u, const LIBSAT_SYM(libsat_literal)* v, \
+        const uint64_t* w, size_t x, uint64_t y, int z) { \
+            return LIBSAT_SYM(cnf_add_at_most)(u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_encode_sequential_counter( \
+        LIBSAT_SYM(libsat_cnf)* v, const LIBSAT_SYM(libsat_literal)* w, \
+        const uint64_t* x, size_t y, uint64_t z) { \
+            return LIBSAT_SYM(cnf_encode_sequential_counter)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_encode_totalizer( \
+        LIBSAT_SYM(libsat_cnf)* v, const LIBSAT_SYM(libsat_literal)* w, \
+        const uint64_t* x, size_t y, uint64_t z) { \
+            return LIBSAT_SYM(cnf_encode_totalizer)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_encode_sorting_network( \
+        LIBSAT_SYM(libsat_cnf)* v, const LIBSAT_SYM(libsat_literal)* w, \
+        const uint64_t* x, size_t y, uint64_t z) { \
+            return LIBSAT_SYM(cnf_encode_sorting_network)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_add_native( \
+        LIBSAT_SYM(libsat_cnf)* v, const LIBSAT_SYM(libsat_literal)* w, \
+        const uint64_t* x, size_t y, uint64_t z) { \
+            return LIBSAT_SYM(cnf_add_native)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_mention( \
+        LIBSAT_SYM(libsat_cnf)* x, const LIBSAT_SYM(libsat_literal)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(cnf_mention)(x,y,z); } \
+    static inline void \
+    sym ## cnf_truncate( \
+        LIBSAT_SYM(libsat_cnf)* x, size_t y, size_t z) { \
+            LIBSAT_SYM(cnf_truncate)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_eliminate_push( \
+        LIBSAT_SYM(libsat_cnf)* w, LIBSAT_SYM(libsat_literal) x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(cnf_eliminate_push)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_restore( \
+        LIBSAT_SYM(libsat_cnf)* x, size_t y) { \
+            return LIBSAT_SYM(cnf_restore)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_restore_all( \
+        LIBSAT_SYM(libsat_cnf)* x) { \
+            return LIBSAT_SYM(cnf_restore_all)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## cnf_restore_marked( \
+        LIBSAT_SYM(libsat_cnf)* x) { \
+            return LIBSAT_SYM(cnf_restore_marked)(x); } \
+    static inline void \
+    sym ## cnf_extend_model( \
+        const LIBSAT_SYM(libsat_cnf)* x, uint8_t* y, size_t z) { \
+            LIBSAT_SYM(cnf_extend_model)(x,y,z); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_cnf_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_cnf_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_cnf_internal \
+    __INTERNAL_LIBSAT_IMPORT_cnf_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
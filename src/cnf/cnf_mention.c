@@ -0,0 +1,68 @@
+/**
+ * \file cnf/cnf_mention.c
+ *
+ * \brief Mark the variables that a clause or native constraint uses.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Mark the variables of the given literals as mentioned.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals to mark.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_mention)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count)
+{
+    status retval;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[i]);
+
+        /* grow the marks if needed. */
+        if (var_id >= cnf->mentioned_capacity)
+        {
+            size_t capacity =
+                (0 == cnf->mentioned_capacity)
+                    ? 64 : 2 * cnf->mentioned_capacity;
+            while (capacity <= var_id)
+            {
+                capacity *= 2;
+            }
+
+            retval =
+                memory_resize(cnf->alloc, (void**)&cnf->mentioned, capacity);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            memset(
+                cnf->mentioned + cnf->mentioned_capacity, 0,
+                capacity - cnf->mentioned_capacity);
+            cnf->mentioned_capacity = capacity;
+        }
+
+        cnf->mentioned[var_id] = 1;
+    }
+
+    return STATUS_SUCCESS;
+}
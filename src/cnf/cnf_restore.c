@@ -0,0 +1,36 @@
+/**
+ * \file cnf/cnf_restore.c
+ *
+ * \brief Add an eliminated variable back to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf_internal;
+
+/**
+ * \brief Add an eliminated variable back to the database.
+ *
+ * \param cnf           The database for this operation.
+ * \param var_id        The variable to restore.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore)(
+    LIBSAT_SYM(libsat_cnf)* cnf, size_t var_id)
+{
+    if (CNF_VARIABLE_ELIMINATED != cnf_variable_state(cnf, var_id))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    cnf->eliminated[var_id] = CNF_VARIABLE_RESTORING;
+
+    return cnf_restore_marked(cnf);
+}
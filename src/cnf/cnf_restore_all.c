@@ -0,0 +1,41 @@
+/**
+ * \file cnf/cnf_restore_all.c
+ *
+ * \brief Add every eliminated variable back to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf_internal;
+
+/**
+ * \brief Add every eliminated variable back to the database.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore_all)(
+    LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    if (0 == cnf->eliminated_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < cnf->eliminated_capacity; ++i)
+    {
+        if (CNF_VARIABLE_ELIMINATED == cnf->eliminated[i])
+        {
+            cnf->eliminated[i] = CNF_VARIABLE_RESTORING;
+        }
+    }
+
+    return cnf_restore_marked(cnf);
+}
@@ -0,0 +1,129 @@
+/**
+ * \file cnf/cnf_restore_marked.c
+ *
+ * \brief Add the variables marked as restoring back to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static bool mark_closure(LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Add the variables marked as restoring back to the database.
+ *
+ * Every eliminated variable mentioned by a clause that is added back is
+ * restored as well, since an eliminated variable may not occur in the
+ * database. The restored clauses are appended to the database, and dropped
+ * from the elimination stack.
+ *
+ * \note The database must not be guarded.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(cnf_restore_marked)(
+    LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    status retval = STATUS_SUCCESS;
+    size_t kept = 0, kept_literals = 0, begin = 0;
+
+    /* restore every eliminated variable that a restored clause mentions. */
+    while (mark_closure(cnf))
+    {
+    }
+
+    /* add the restored clauses back, and compact the rest of the stack. */
+    for (size_t i = 0; i < cnf->removed_count; ++i)
+    {
+        size_t end = cnf->removed_end[i];
+        size_t size = end - begin;
+        size_t pivot = LIBSAT_LITERAL_VARIABLE(cnf->removed_pivot[i]);
+
+        if (CNF_VARIABLE_RESTORING == cnf->eliminated[pivot])
+        {
+            if (STATUS_SUCCESS == retval)
+            {
+                retval =
+                    libsat_cnf_add_clause(
+                        cnf, cnf->removed_literals + begin, size);
+            }
+        }
+        else
+        {
+            memmove(
+                cnf->removed_literals + kept_literals,
+                cnf->removed_literals + begin,
+                size * sizeof(*cnf->removed_literals));
+            kept_literals += size;
+            cnf->removed_end[kept] = kept_literals;
+            cnf->removed_pivot[kept] = cnf->removed_pivot[i];
+            kept += 1;
+        }
+
+        begin = end;
+    }
+
+    cnf->removed_count = kept;
+    cnf->removed_literal_count = kept_literals;
+
+    /* the restored variables are active again. */
+    for (size_t i = 0; i < cnf->eliminated_capacity; ++i)
+    {
+        if (CNF_VARIABLE_RESTORING == cnf->eliminated[i])
+        {
+            cnf->eliminated[i] = CNF_VARIABLE_ACTIVE;
+            cnf->eliminated_count -= 1;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Mark the eliminated variables in the clauses of restoring variables
+ * as restoring too.
+ *
+ * \returns true if any variable was newly marked.
+ */
+static bool mark_closure(LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    bool changed = false;
+    size_t begin = 0;
+
+    for (size_t i = 0; i < cnf->removed_count; ++i)
+    {
+        size_t pivot = LIBSAT_LITERAL_VARIABLE(cnf->removed_pivot[i]);
+
+        if (CNF_VARIABLE_RESTORING == cnf->eliminated[pivot])
+        {
+            for (size_t j = begin; j < cnf->removed_end[i]; ++j)
+            {
+                size_t var_id =
+                    LIBSAT_LITERAL_VARIABLE(cnf->removed_literals[j]);
+
+                if (CNF_VARIABLE_ELIMINATED == cnf->eliminated[var_id])
+                {
+                    cnf->eliminated[var_id] = CNF_VARIABLE_RESTORING;
+                    changed = true;
+                }
+            }
+        }
+
+        begin = cnf->removed_end[i];
+    }
+
+    return changed;
+}
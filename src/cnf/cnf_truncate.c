@@ -0,0 +1,48 @@
+/**
+ * \file cnf/cnf_truncate.c
+ *
+ * \brief Drop the most recent clauses and native constraints.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "cnf_internal.h"
+
+/**
+ * \brief Drop every clause and native constraint past the given counts.
+ *
+ * \param cnf           The database for this operation.
+ * \param clause_count  The number of clauses to keep.
+ * \param native_count  The number of native constraints to keep.
+ */
+void
+LIBSAT_SYM(cnf_truncate)(
+    LIBSAT_SYM(libsat_cnf)* cnf, size_t clause_count, size_t native_count)
+{
+    if (clause_count < cnf->clause_count)
+    {
+        cnf->clause_count = clause_count;
+        cnf->literal_count =
+            (0 == clause_count) ? 0 : cnf->clause_end[clause_count - 1];
+    }
+
+    if (clause_count < cnf->checked_clauses)
+    {
+        cnf->checked_clauses = clause_count;
+    }
+
+    if (native_count < cnf->native_count)
+    {
+        cnf->native_count = native_count;
+        cnf->native_literal_count =
+            (0 == native_count) ? 0 : cnf->native_end[native_count - 1];
+    }
+
+    if (native_count < cnf->checked_natives)
+    {
+        cnf->checked_natives = native_count;
+    }
+}
@@ -0,0 +1,40 @@
+/**
+ * \file cnf/libsat_cnf_add_cardinality.c
+ *
+ * \brief Add a cardinality constraint to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+
+/**
+ * \brief Add a cardinality constraint over the given literals.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals to count.
+ * \param count         The number of literals.
+ * \param relation      The \ref libsat_cnf_relation of this constraint.
+ * \param k             The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_BAD_RELATION if the relation is not recognized.
+ *      - ERROR_LIBSAT_CNF_BAD_ENCODING if the encoding is not recognized.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_cardinality)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count, int relation, size_t k, int encoding)
+{
+    /* a cardinality constraint is a pseudo-Boolean constraint with unit
+     * weights. */
+    return
+        libsat_cnf_add_pseudo_boolean(
+            cnf, lits, NULL, count, relation, k, encoding);
+}
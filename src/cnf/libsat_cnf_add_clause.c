@@ -0,0 +1,103 @@
+/**
+ * \file cnf/libsat_cnf_add_clause.c
+ *
+ * \brief Add a clause to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+
+/**
+ * \brief Add a clause to the database.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals in this clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_clause)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count)
+{
+    status retval;
+    size_t stored = cnf->guarded ? count + 1 : count;
+
+    /* grow the literal storage if needed. */
+    if (cnf->literal_count + stored > cnf->literal_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->literal_capacity) ? 256 : 2 * cnf->literal_capacity;
+        while (capacity < cnf->literal_count + stored)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->literals,
+                capacity * sizeof(*cnf->literals));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->literal_capacity = capacity;
+    }
+
+    /* grow the clause index if needed. */
+    if (cnf->clause_count == cnf->clause_capacity)
+    {
+        size_t capacity =
+            (0 == cnf->clause_capacity) ? 64 : 2 * cnf->clause_capacity;
+
+        retval =
+            memory_resize(
+                cnf->alloc, (void**)&cnf->clause_end,
+                capacity * sizeof(*cnf->clause_end));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cnf->clause_capacity = capacity;
+    }
+
+    /* mark the variables of this clause. */
+    retval = cnf_mention(cnf, lits, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* append the clause. */
+    if (count > 0)
+    {
+        memcpy(
+            cnf->literals + cnf->literal_count, lits, count * sizeof(*lits));
+    }
+
+    cnf->literal_count += count;
+
+    /* a guarded clause is satisfied by its guard. */
+    if (cnf->guarded)
+    {
+        cnf->literals[cnf->literal_count++] = cnf->guard;
+    }
+
+    cnf->clause_end[cnf->clause_count++] = cnf->literal_count;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,170 @@
+/**
+ * \file cnf/libsat_cnf_add_pseudo_boolean.c
+ *
+ * \brief Add a linear pseudo-Boolean constraint to a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status add_at_least(
+    libsat_cnf* cnf, const libsat_literal* lits, const uint64_t* weights,
+    size_t count, uint64_t total, uint64_t bound, int encoding);
+
+/**
+ * \brief Add a linear pseudo-Boolean constraint over the given literals.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal, or NULL if every weight is
+ *                      one.
+ * \param count         The number of literals.
+ * \param relation      The \ref libsat_cnf_relation of this constraint.
+ * \param bound         The bound of this constraint.
+ * \param encoding      The \ref libsat_cnf_encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_BAD_RELATION if the relation is not recognized.
+ *      - ERROR_LIBSAT_CNF_BAD_ENCODING if the encoding is not recognized.
+ *      - ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW if the weights sum past 64 bits.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_add_pseudo_boolean)(
+    LIBSAT_SYM(libsat_cnf)* cnf, const LIBSAT_SYM(libsat_literal)* lits,
+    const uint64_t* weights, size_t count, int relation, uint64_t bound,
+    int encoding)
+{
+    status retval;
+    uint64_t total = 0;
+
+    /* verify the encoding. */
+    switch (encoding)
+    {
+        case LIBSAT_CNF_ENCODING_SEQUENTIAL_COUNTER:
+        case LIBSAT_CNF_ENCODING_TOTALIZER:
+        case LIBSAT_CNF_ENCODING_SORTING_NETWORK:
+        case LIBSAT_CNF_ENCODING_NATIVE:
+            break;
+
+        default:
+            return ERROR_LIBSAT_CNF_BAD_ENCODING;
+    }
+
+    /* sum the weights. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        uint64_t weight = (NULL == weights) ? 1 : weights[i];
+
+        if (weight > UINT64_MAX - total)
+        {
+            return ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW;
+        }
+
+        total += weight;
+    }
+
+    switch (relation)
+    {
+        case LIBSAT_CNF_RELATION_AT_MOST:
+            return cnf_add_at_most(cnf, lits, weights, count, bound, encoding);
+
+        case LIBSAT_CNF_RELATION_AT_LEAST:
+            return
+                add_at_least(
+                    cnf, lits, weights, count, total, bound, encoding);
+
+        case LIBSAT_CNF_RELATION_EXACTLY:
+            retval =
+                cnf_add_at_most(cnf, lits, weights, count, bound, encoding);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            return
+                add_at_least(
+                    cnf, lits, weights, count, total, bound, encoding);
+
+        default:
+            return ERROR_LIBSAT_CNF_BAD_RELATION;
+    }
+}
+
+/**
+ * \brief Add sum(weights[i] * lits[i]) >= bound.
+ *
+ * This is rewritten as sum(weights[i] * ¬lits[i]) <= total - bound.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals in this constraint.
+ * \param weights       The weight of each literal, or NULL for all ones.
+ * \param count         The number of literals.
+ * \param total         The sum of all weights.
+ * \param bound         The bound of this constraint.
+ * \param encoding      The encoding to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status add_at_least(
+    libsat_cnf* cnf, const libsat_literal* lits, const uint64_t* weights,
+    size_t count, uint64_t total, uint64_t bound, int encoding)
+{
+    status retval, release_retval;
+    libsat_literal* negated;
+
+    /* if the bound can't be reached, the constraint is unsatisfiable. */
+    if (bound > total)
+    {
+        return libsat_cnf_add_clause(cnf, NULL, 0);
+    }
+
+    /* a zero bound always holds. */
+    if (0 == bound)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* negate the literals. */
+    retval =
+        allocator_allocate(
+            cnf->alloc, (void**)&negated, count * sizeof(*negated));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        negated[i] = LIBSAT_LITERAL_NEGATE(lits[i]);
+    }
+
+    /* add the complementary at-most constraint. */
+    retval =
+        cnf_add_at_most(
+            cnf, negated, weights, count, total - bound, encoding);
+    goto cleanup_negated;
+
+cleanup_negated:
+    release_retval = allocator_reclaim(cnf->alloc, negated);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
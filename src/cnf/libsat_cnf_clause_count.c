@@ -0,0 +1,24 @@
+/**
+ * \file cnf/libsat_cnf_clause_count.c
+ *
+ * \brief Get the number of clauses in a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+/**
+ * \brief Get the number of clauses in the database.
+ *
+ * \param cnf           The database for this operation.
+ *
+ * \returns the number of clauses in this database.
+ */
+size_t
+LIBSAT_SYM(libsat_cnf_clause_count)(
+    const LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    return cnf->clause_count;
+}
@@ -0,0 +1,45 @@
+/**
+ * \file cnf/libsat_cnf_clause_get.c
+ *
+ * \brief Get a clause from a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+/**
+ * \brief Get a clause from the database.
+ *
+ * \param lits          Pointer to receive the literals of this clause.
+ * \param count         Pointer to receive the number of literals.
+ * \param cnf           The database for this operation.
+ * \param index         The index of the clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_INDEX_OUT_OF_RANGE if there is no such clause.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_clause_get)(
+    const LIBSAT_SYM(libsat_literal)** lits, size_t* count,
+    const LIBSAT_SYM(libsat_cnf)* cnf, size_t index)
+{
+    size_t start;
+
+    if (index >= cnf->clause_count)
+    {
+        return ERROR_LIBSAT_CNF_INDEX_OUT_OF_RANGE;
+    }
+
+    /* each clause starts where the previous one ends. */
+    start = (0 == index) ? 0 : cnf->clause_end[index - 1];
+
+    *lits = cnf->literals + start;
+    *count = cnf->clause_end[index] - start;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,68 @@
+/**
+ * \file cnf/libsat_cnf_create.c
+ *
+ * \brief Create a \ref libsat_cnf instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* the vtable entry for the libsat_cnf instance. */
+RCPR_VTABLE
+resource_vtable libsat_cnf_vtable = {
+    &libsat_cnf_resource_release };
+
+/**
+ * \brief Create an empty clause database.
+ *
+ * \param cnf           Pointer to the cnf pointer to be set to this created
+ *                      instance on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_create)(
+    LIBSAT_SYM(libsat_cnf)** cnf, LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_cnf* tmp;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(context->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_cnf_vtable);
+
+    /* initialize database. */
+    tmp->alloc = context->alloc;
+    tmp->context = context;
+
+    /* success. */
+    *cnf = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
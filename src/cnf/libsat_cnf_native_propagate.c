@@ -0,0 +1,92 @@
+/**
+ * \file cnf/libsat_cnf_native_propagate.c
+ *
+ * \brief Propagate the native constraints of a \ref libsat_cnf.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "cnf_internal.h"
+
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Propagate the native constraints under a partial assignment.
+ *
+ * \param implied_count Pointer to receive the number of implied literals.
+ * \param cnf           The database for this operation.
+ * \param values        The current assignment, indexed by variable id.
+ * \param value_count   The number of entries in \p values.
+ * \param implied       Array to receive the implied literals.
+ * \param implied_max   The capacity of \p implied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_CONFLICT if the assignment violates a constraint.
+ *      - ERROR_LIBSAT_CNF_IMPLIED_BUFFER_TOO_SMALL if more than
+ *        \p implied_max literals are implied.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_cnf_native_propagate)(
+    size_t* implied_count, const LIBSAT_SYM(libsat_cnf)* cnf,
+    const uint8_t* values, size_t value_count,
+    LIBSAT_SYM(libsat_literal)* implied, size_t implied_max)
+{
+    size_t count = 0;
+    size_t start = 0;
+
+    for (size_t c = 0; c < cnf->native_count; ++c)
+    {
+        size_t end = cnf->native_end[c];
+        uint64_t bound = cnf->native_bound[c];
+        uint64_t used = 0;
+        uint64_t slack;
+
+        /* sum the weights of the true literals. */
+        for (size_t i = start; i < end; ++i)
+        {
+            uint8_t value =
+                cnf_literal_value(
+                    values, value_count, cnf->native_literals[i]);
+
+            if (LIBSAT_VALUE_TRUE == value)
+            {
+                used += cnf->native_weights[i];
+            }
+        }
+
+        if (used > bound)
+        {
+            return ERROR_LIBSAT_CNF_CONFLICT;
+        }
+
+        /* any unassigned literal heavier than the slack must be false. */
+        slack = bound - used;
+        for (size_t i = start; i < end; ++i)
+        {
+            libsat_literal lit = cnf->native_literals[i];
+
+            if (
+                cnf->native_weights[i] > slack
+             && LIBSAT_VALUE_UNASSIGNED
+                    == cnf_literal_value(values, value_count, lit))
+            {
+                if (count >= implied_max)
+                {
+                    return ERROR_LIBSAT_CNF_IMPLIED_BUFFER_TOO_SMALL;
+                }
+
+                implied[count++] = LIBSAT_LITERAL_NEGATE(lit);
+            }
+        }
+
+        start = end;
+    }
+
+    /* success. */
+    *implied_count = count;
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,26 @@
+/**
+ * \file cnf/libsat_cnf_resource_handle.c
+ *
+ * \brief Get the resource handle for a given \ref libsat_cnf instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "cnf_internal.h"
+
+/**
+ * \brief Given a \ref libsat_cnf instance, return the resource handle for this
+ * instance.
+ *
+ * \param cnf           The \ref libsat_cnf instance from which the resource
+ *                      handle is returned.
+ *
+ * \returns the resource handle for this cnf instance.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_cnf_resource_handle)(
+    LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    return &cnf->hdr;
+}
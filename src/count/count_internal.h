@@ -0,0 +1,596 @@
+/**
+ * \file count/count_internal.h
+ *
+ * \brief Internal details for the exact model counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/libsat.h>
+#include <rcpr/allocator.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Sentinel for a frame without a branch variable.
+ */
+#define COUNTER_NONE                                             ((size_t)-1)
+
+/**
+ * \brief The cache is cleared once its keys hold more than this many words.
+ */
+#define COUNTER_CACHE_LIMIT                                  ((size_t)1 << 24)
+
+/**
+ * \brief The kinds of constraints known to the counter.
+ */
+enum LIBSAT_SYM(counter_constraint_kind)
+{
+    /** \brief At least one literal is true. */
+    COUNTER_CONSTRAINT_CLAUSE = 0,
+
+    /** \brief The weights of the true literals add up to at most the bound. */
+    COUNTER_CONSTRAINT_NATIVE = 1,
+
+    /** \brief The number of true literals has the parity of the bound. */
+    COUNTER_CONSTRAINT_XOR = 2,
+};
+
+/**
+ * \brief The state of a constraint under the current assignment.
+ */
+enum LIBSAT_SYM(counter_constraint_state)
+{
+    /** \brief The constraint still restricts its unassigned variables. */
+    COUNTER_OPEN = 0,
+
+    /** \brief The constraint holds whatever its unassigned variables are. */
+    COUNTER_SATISFIED = 1,
+
+    /** \brief The constraint is violated. */
+    COUNTER_CONFLICT = 2,
+
+    /** \brief The constraint implies a literal. */
+    COUNTER_UNIT = 3,
+};
+
+/**
+ * \brief A constraint. Its literals live in the literal arena, starting at
+ * start; a native constraint keeps the weights of its literals at the same
+ * offsets of the weight arena.
+ */
+typedef struct LIBSAT_SYM(counter_constraint) LIBSAT_SYM(counter_constraint);
+struct LIBSAT_SYM(counter_constraint)
+{
+    uint8_t kind;
+    size_t start;
+    size_t size;
+    uint64_t bound;
+};
+
+/**
+ * \brief An unsigned number of any size, as 32-bit words with the least
+ * significant word first. Zero has no words.
+ */
+typedef struct LIBSAT_SYM(counter_number) LIBSAT_SYM(counter_number);
+struct LIBSAT_SYM(counter_number)
+{
+    uint32_t* words;
+    size_t count;
+    size_t capacity;
+};
+
+/**
+ * \brief A component: variables that are connected by open constraints. Its
+ * variables live in the component variable stack, starting at start.
+ */
+typedef struct LIBSAT_SYM(counter_component) LIBSAT_SYM(counter_component);
+struct LIBSAT_SYM(counter_component)
+{
+    size_t start;
+    size_t size;
+};
+
+/**
+ * \brief A cached count. The key and value live in the key and value arenas
+ * of the cache; an empty slot has no key.
+ */
+typedef struct LIBSAT_SYM(counter_entry) LIBSAT_SYM(counter_entry);
+struct LIBSAT_SYM(counter_entry)
+{
+    uint64_t hash;
+    size_t key_start;
+    size_t key_size;
+    size_t value_start;
+    size_t value_size;
+};
+
+/**
+ * \brief A component being counted.
+ *
+ * The root frame counts every variable, without a branch variable. Every
+ * other frame counts a component, first with its branch variable true and
+ * then false. Each branch splits what is left of the component into the
+ * components above component_mark, which are counted as children and
+ * multiplied into prod.
+ */
+typedef struct LIBSAT_SYM(counter_frame) LIBSAT_SYM(counter_frame);
+struct LIBSAT_SYM(counter_frame)
+{
+    size_t component;
+    size_t var;
+    int branch;
+    bool projected;
+    size_t trail_mark;
+    size_t component_mark;
+    size_t var_mark;
+    size_t child;
+    size_t key_start;
+    size_t key_size;
+    uint64_t hash;
+    LIBSAT_SYM(counter_number) total;
+    LIBSAT_SYM(counter_number) prod;
+};
+
+/**
+ * \brief An exact model counter over the constraints of a context.
+ *
+ * The clauses of the database, the clauses on its elimination stack, its
+ * native constraints, and the rows of the native xor matrix are loaded as
+ * constraints, along with a unit clause for the activation of each open
+ * scope. Per-variable arrays hold var_count entries. The constraints of a
+ * variable are listed in occurs, from occur_start[var] to
+ * occur_start[var + 1].
+ *
+ * Marks are compared against the current epoch, so that they never need to
+ * be cleared.
+ */
+typedef struct LIBSAT_SYM(counter) LIBSAT_SYM(counter);
+struct LIBSAT_SYM(counter)
+{
+    RCPR_SYM(allocator)* alloc;
+    size_t var_count;
+    uint8_t* projected;
+    const atomic_bool* terminate;
+
+    /* constraints. */
+    LIBSAT_SYM(libsat_literal)* lits;
+    uint64_t* weights;
+    size_t lit_count;
+    LIBSAT_SYM(counter_constraint)* constraints;
+    size_t constraint_count;
+    size_t* occur_start;
+    size_t* occurs;
+
+    /* assignments. */
+    uint8_t* values;
+    size_t* trail;
+    size_t trail_count;
+    size_t trail_head;
+
+    /* components. */
+    size_t* component_vars;
+    size_t component_var_count;
+    size_t component_var_capacity;
+    LIBSAT_SYM(counter_component)* components;
+    size_t component_count;
+    size_t component_capacity;
+    uint32_t* var_marks;
+    uint32_t* constraint_marks;
+    uint32_t epoch;
+
+    /* search. */
+    LIBSAT_SYM(counter_frame)* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    uint64_t* keys;
+    size_t key_count;
+    size_t key_capacity;
+    LIBSAT_SYM(counter_number) scratch;
+
+    /* cache. */
+    LIBSAT_SYM(counter_entry)* entries;
+    size_t entry_count;
+    size_t entry_capacity;
+    uint64_t* cache_keys;
+    size_t cache_key_count;
+    size_t cache_key_capacity;
+    uint32_t* cache_values;
+    size_t cache_value_count;
+    size_t cache_value_capacity;
+};
+
+/******************************************************************************/
+/* Start of inline helpers.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the value of a literal.
+ */
+static inline uint8_t counter_lit_value(
+    const LIBSAT_SYM(counter)* counter, LIBSAT_SYM(libsat_literal) lit)
+{
+    uint8_t value = counter->values[LIBSAT_LITERAL_VARIABLE(lit)];
+
+    if (LIBSAT_VALUE_UNASSIGNED == value || !LIBSAT_LITERAL_IS_NEGATED(lit))
+    {
+        return value;
+    }
+
+    return
+        (LIBSAT_VALUE_TRUE == value) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+}
+
+/**
+ * \brief Make an unassigned literal true, and queue it to be propagated.
+ */
+static inline void counter_assign(
+    LIBSAT_SYM(counter)* counter, LIBSAT_SYM(libsat_literal) lit)
+{
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+    counter->values[var_id] =
+        LIBSAT_LITERAL_IS_NEGATED(lit) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+    counter->trail[counter->trail_count++] = var_id;
+}
+
+/**
+ * \brief Unassign every variable assigned since the given trail mark.
+ */
+static inline void counter_undo(LIBSAT_SYM(counter)* counter, size_t mark)
+{
+    while (counter->trail_count > mark)
+    {
+        counter->values[counter->trail[--counter->trail_count]] =
+            LIBSAT_VALUE_UNASSIGNED;
+    }
+
+    counter->trail_head = mark;
+}
+
+/**
+ * \brief Check whether a number is zero.
+ */
+static inline bool counter_number_is_zero(
+    const LIBSAT_SYM(counter_number)* number)
+{
+    return 0 == number->count;
+}
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Load the constraints of a context into a counter.
+ *
+ * \param counter       The counter to initialize.
+ * \param context       The context to count.
+ * \param projection    The ids of the variables to count over.
+ * \param projection_count The number of projection variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_init)(
+    LIBSAT_SYM(counter)* counter, LIBSAT_SYM(libsat_context)* context,
+    const size_t* projection, size_t projection_count);
+
+/**
+ * \brief Reclaim the memory held by a counter, leaving it empty.
+ *
+ * \param counter       The counter to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_dispose)(
+    LIBSAT_SYM(counter)* counter);
+
+/**
+ * \brief Make room for a number of items in an array.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param items         Pointer to the array, which may be NULL.
+ * \param capacity      Pointer to the number of items the array holds.
+ * \param needed        The number of items needed.
+ * \param item_size     The size of each item.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_reserve)(
+    RCPR_SYM(allocator)* alloc, void** items, size_t* capacity,
+    size_t needed, size_t item_size);
+
+/**
+ * \brief Check a constraint under the current assignment.
+ *
+ * \param lit           Pointer to receive the implied literal of a unit
+ *                      constraint.
+ * \param state         Pointer to receive what is left of the constraint:
+ *                      the bound left over for a native constraint, the parity
+ *                      left over for a parity constraint, and zero for a
+ *                      clause.
+ * \param counter       The counter for this operation.
+ * \param constraint    The constraint to check.
+ *
+ * \returns the \ref counter_constraint_state of the constraint.
+ */
+int
+LIBSAT_SYM(counter_check)(
+    LIBSAT_SYM(libsat_literal)* lit, uint64_t* state,
+    const LIBSAT_SYM(counter)* counter, size_t constraint);
+
+/**
+ * \brief Propagate the queued assignments.
+ *
+ * \param counter       The counter for this operation.
+ * \param all           If true, every constraint is checked first, so that
+ *                      empty and unit constraints are found.
+ *
+ * \returns false on a conflict, and true otherwise.
+ */
+bool
+LIBSAT_SYM(counter_propagate)(
+    LIBSAT_SYM(counter)* counter, bool all);
+
+/**
+ * \brief Split the unassigned variables of a component into the components of
+ * the open constraints, pushing them onto the component stack.
+ *
+ * The variables of each new component are sorted.
+ *
+ * \param free          Pointer to receive the number of projection variables
+ *                      that no open constraint uses.
+ * \param counter       The counter for this operation.
+ * \param component     The component to split.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_split)(
+    size_t* free, LIBSAT_SYM(counter)* counter, size_t component);
+
+/**
+ * \brief Push the cache key of a component onto the key stack: its variables,
+ * followed by each of its open constraints and what is left of it.
+ *
+ * \param hash          Pointer to receive the hash of the key.
+ * \param counter       The counter for this operation.
+ * \param component     The component to describe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_key_push)(
+    uint64_t* hash, LIBSAT_SYM(counter)* counter, size_t component);
+
+/**
+ * \brief Find the cached count of a key.
+ *
+ * \param entry         Pointer to receive the entry, or NULL if the key is not
+ *                      cached.
+ * \param counter       The counter for this operation.
+ * \param key           The key to find.
+ * \param key_size      The number of words in the key.
+ * \param hash          The hash of the key.
+ */
+void
+LIBSAT_SYM(counter_cache_find)(
+    const LIBSAT_SYM(counter_entry)** entry,
+    const LIBSAT_SYM(counter)* counter, const uint64_t* key, size_t key_size,
+    uint64_t hash);
+
+/**
+ * \brief Cache the count of a key.
+ *
+ * The cache is cleared first if it has grown past its limit.
+ *
+ * \param counter       The counter for this operation.
+ * \param key_start     The start of the key on the key stack.
+ * \param key_size      The number of words in the key.
+ * \param hash          The hash of the key.
+ * \param value         The count to cache.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_cache_insert)(
+    LIBSAT_SYM(counter)* counter, size_t key_start, size_t key_size,
+    uint64_t hash, const LIBSAT_SYM(counter_number)* value);
+
+/**
+ * \brief Count the models of the loaded constraints over the projection.
+ *
+ * \param count         Pointer to receive the count, which is owned by the
+ *                      counter.
+ * \param stopped       Pointer to a flag that is set if the count was stopped
+ *                      by a request to terminate.
+ * \param counter       The counter for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_run)(
+    const LIBSAT_SYM(counter_number)** count, bool* stopped,
+    LIBSAT_SYM(counter)* counter);
+
+/**
+ * \brief Set a number to a small value.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to set.
+ * \param value         The value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_set)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    uint32_t value);
+
+/**
+ * \brief Add to a number.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to add to.
+ * \param words         The words of the number to add.
+ * \param count         The number of words.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_add)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    const uint32_t* words, size_t count);
+
+/**
+ * \brief Multiply a number.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to multiply.
+ * \param words         The words of the number to multiply by.
+ * \param count         The number of words.
+ * \param scratch       Scratch space for the product.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_multiply)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    const uint32_t* words, size_t count, LIBSAT_SYM(counter_number)* scratch);
+
+/**
+ * \brief Multiply a number by a power of two.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to shift.
+ * \param bits          The power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_shift)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    size_t bits);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_count_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(counter) sym ## counter; \
+    typedef LIBSAT_SYM(counter_constraint) sym ## counter_constraint; \
+    typedef LIBSAT_SYM(counter_number) sym ## counter_number; \
+    typedef LIBSAT_SYM(counter_component) sym ## counter_component; \
+    typedef LIBSAT_SYM(counter_entry) sym ## counter_entry; \
+    typedef LIBSAT_SYM(counter_frame) sym ## counter_frame; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_init( \
+        LIBSAT_SYM(counter)* w, LIBSAT_SYM(libsat_context)* x, \
+        const size_t* y, size_t z) { \
+            return LIBSAT_SYM(counter_init)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_dispose( \
+        LIBSAT_SYM(counter)* x) { \
+            return LIBSAT_SYM(counter_dispose)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_reserve( \
+        RCPR_SYM(allocator)* v, void** w, size_t* x, size_t y, size_t z) { \
+            return LIBSAT_SYM(counter_reserve)(v,w,x,y,z); } \
+    static inline int \
+    sym ## counter_check( \
+        LIBSAT_SYM(libsat_literal)* w, uint64_t* x, \
+        const LIBSAT_SYM(counter)* y, size_t z) { \
+            return LIBSAT_SYM(counter_check)(w,x,y,z); } \
+    static inline bool \
+    sym ## counter_propagate( \
+        LIBSAT_SYM(counter)* x, bool y) { \
+            return LIBSAT_SYM(counter_propagate)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_split( \
+        size_t* x, LIBSAT_SYM(counter)* y, size_t z) { \
+            return LIBSAT_SYM(counter_split)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_key_push( \
+        uint64_t* x, LIBSAT_SYM(counter)* y, size_t z) { \
+            return LIBSAT_SYM(counter_key_push)(x,y,z); } \
+    static inline void \
+    sym ## counter_cache_find( \
+        const LIBSAT_SYM(counter_entry)** v, \
+        const LIBSAT_SYM(counter)* w, const uint64_t* x, size_t y, \
+        uint64_t z) { \
+            LIBSAT_SYM(counter_cache_find)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_cache_insert( \
+        LIBSAT_SYM(counter)* v, size_t w, size_t x, uint64_t y, \
+        const LIBSAT_SYM(counter_number)* z) { \
+            return LIBSAT_SYM(counter_cache_insert)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_run( \
+        const LIBSAT_SYM(counter_number)** x, bool* y, \
+        LIBSAT_SYM(counter)* z) { \
+            return LIBSAT_SYM(counter_run)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_number_set( \
+        RCPR_SYM(allocator)* x, LIBSAT_SYM(counter_number)* y, \
+        uint32_t z) { \
+            return LIBSAT_SYM(counter_number_set)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_number_add( \
+        RCPR_SYM(allocator)* w, LIBSAT_SYM(counter_number)* x, \
+        const uint32_t* y, size_t z) { \
+            return LIBSAT_SYM(counter_number_add)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_number_multiply( \
+        RCPR_SYM(allocator)* v, LIBSAT_SYM(counter_number)* w, \
+        const uint32_t* x, size_t y, LIBSAT_SYM(counter_number)* z) { \
+            return LIBSAT_SYM(counter_number_multiply)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## counter_number_shift( \
+        RCPR_SYM(allocator)* x, LIBSAT_SYM(counter_number)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(counter_number_shift)(x,y,z); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_count_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_count_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_count_internal \
+    __INTERNAL_LIBSAT_IMPORT_count_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,63 @@
+/**
+ * \file count/counter_cache_find.c
+ *
+ * \brief Find a cached component count in a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Find the cached count of a key.
+ *
+ * The cache is an open addressed table with linear probing, so the search
+ * stops at the first empty slot.
+ *
+ * \param entry         Pointer to receive the entry, or NULL if the key is not
+ *                      cached.
+ * \param counter       The counter for this operation.
+ * \param key           The key to find.
+ * \param key_size      The number of words in the key.
+ * \param hash          The hash of the key.
+ */
+void
+LIBSAT_SYM(counter_cache_find)(
+    const LIBSAT_SYM(counter_entry)** entry,
+    const LIBSAT_SYM(counter)* counter, const uint64_t* key, size_t key_size,
+    uint64_t hash)
+{
+    size_t mask = counter->entry_capacity - 1;
+
+    *entry = NULL;
+    if (0 == counter->entry_capacity)
+    {
+        return;
+    }
+
+    for (size_t i = hash & mask; ; i = (i + 1) & mask)
+    {
+        const counter_entry* slot = &counter->entries[i];
+
+        if (0 == slot->key_size)
+        {
+            return;
+        }
+
+        if (
+            slot->hash == hash && slot->key_size == key_size
+         && 0
+                == memcmp(
+                        counter->cache_keys + slot->key_start, key,
+                        key_size * sizeof(*key)))
+        {
+            *entry = slot;
+            return;
+        }
+    }
+}
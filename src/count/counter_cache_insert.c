@@ -0,0 +1,178 @@
+/**
+ * \file count/counter_cache_insert.c
+ *
+ * \brief Cache a component count in a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status grow_table(counter* counter);
+static void place(
+    counter_entry* entries, size_t capacity, const counter_entry* entry);
+
+/**
+ * \brief Cache the count of a key.
+ *
+ * The cache is cleared first if it has grown past its limit, so that a long
+ * count holds a bounded amount of memory.
+ *
+ * \param counter       The counter for this operation.
+ * \param key_start     The start of the key on the key stack.
+ * \param key_size      The number of words in the key.
+ * \param hash          The hash of the key.
+ * \param value         The count to cache.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_cache_insert)(
+    LIBSAT_SYM(counter)* counter, size_t key_start, size_t key_size,
+    uint64_t hash, const LIBSAT_SYM(counter_number)* value)
+{
+    status retval;
+    counter_entry entry;
+
+    if (counter->cache_key_count + key_size > COUNTER_CACHE_LIMIT)
+    {
+        memset(
+            counter->entries, 0,
+            counter->entry_capacity * sizeof(*counter->entries));
+        counter->entry_count = 0;
+        counter->cache_key_count = 0;
+        counter->cache_value_count = 0;
+    }
+
+    if (2 * (counter->entry_count + 1) > counter->entry_capacity)
+    {
+        retval = grow_table(counter);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* copy the key and the value. */
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->cache_keys,
+            &counter->cache_key_capacity, counter->cache_key_count + key_size,
+            sizeof(*counter->cache_keys));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->cache_values,
+            &counter->cache_value_capacity,
+            counter->cache_value_count + value->count,
+            sizeof(*counter->cache_values));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    entry.hash = hash;
+    entry.key_start = counter->cache_key_count;
+    entry.key_size = key_size;
+    entry.value_start = counter->cache_value_count;
+    entry.value_size = value->count;
+
+    memcpy(
+        counter->cache_keys + entry.key_start, counter->keys + key_start,
+        key_size * sizeof(*counter->keys));
+    if (0 != value->count)
+    {
+        memcpy(
+            counter->cache_values + entry.value_start, value->words,
+            value->count * sizeof(*value->words));
+    }
+
+    counter->cache_key_count += key_size;
+    counter->cache_value_count += value->count;
+
+    place(counter->entries, counter->entry_capacity, &entry);
+    counter->entry_count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the table, and place every entry again.
+ *
+ * \param counter       The counter for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status grow_table(counter* counter)
+{
+    status retval, release_retval;
+    counter_entry* entries;
+    size_t capacity =
+        (0 == counter->entry_capacity) ? 1024 : 2 * counter->entry_capacity;
+
+    retval =
+        allocator_allocate(
+            counter->alloc, (void**)&entries, capacity * sizeof(*entries));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(entries, 0, capacity * sizeof(*entries));
+    for (size_t i = 0; i < counter->entry_capacity; ++i)
+    {
+        if (0 != counter->entries[i].key_size)
+        {
+            place(entries, capacity, &counter->entries[i]);
+        }
+    }
+
+    if (NULL != counter->entries)
+    {
+        retval = allocator_reclaim(counter->alloc, counter->entries);
+        if (STATUS_SUCCESS != retval)
+        {
+            release_retval = allocator_reclaim(counter->alloc, entries);
+            (void)release_retval;
+
+            return retval;
+        }
+    }
+
+    counter->entries = entries;
+    counter->entry_capacity = capacity;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Place an entry in the first empty slot from its hash on.
+ */
+static void place(
+    counter_entry* entries, size_t capacity, const counter_entry* entry)
+{
+    size_t mask = capacity - 1;
+    size_t i = entry->hash & mask;
+
+    while (0 != entries[i].key_size)
+    {
+        i = (i + 1) & mask;
+    }
+
+    entries[i] = *entry;
+}
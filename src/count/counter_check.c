@@ -0,0 +1,195 @@
+/**
+ * \file count/counter_check.c
+ *
+ * \brief Check a constraint of a \ref counter under its assignment.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static int check_clause(
+    libsat_literal* lit, const counter* counter,
+    const counter_constraint* constraint);
+static int check_native(
+    libsat_literal* lit, uint64_t* state, const counter* counter,
+    const counter_constraint* constraint);
+static int check_xor(
+    libsat_literal* lit, uint64_t* state, const counter* counter,
+    const counter_constraint* constraint);
+
+/**
+ * \brief Check a constraint under the current assignment.
+ *
+ * \param lit           Pointer to receive the implied literal of a unit
+ *                      constraint.
+ * \param state         Pointer to receive what is left of the constraint:
+ *                      the bound left over for a native constraint, the parity
+ *                      left over for a parity constraint, and zero for a
+ *                      clause.
+ * \param counter       The counter for this operation.
+ * \param constraint    The constraint to check.
+ *
+ * \returns the \ref counter_constraint_state of the constraint.
+ */
+int
+LIBSAT_SYM(counter_check)(
+    LIBSAT_SYM(libsat_literal)* lit, uint64_t* state,
+    const LIBSAT_SYM(counter)* counter, size_t constraint)
+{
+    const counter_constraint* c = &counter->constraints[constraint];
+
+    *state = 0;
+
+    switch (c->kind)
+    {
+        case COUNTER_CONSTRAINT_NATIVE:
+            return check_native(lit, state, counter, c);
+
+        case COUNTER_CONSTRAINT_XOR:
+            return check_xor(lit, state, counter, c);
+
+        default:
+            return check_clause(lit, counter, c);
+    }
+}
+
+/**
+ * \brief Check a clause, which holds once a literal is true.
+ */
+static int check_clause(
+    libsat_literal* lit, const counter* counter,
+    const counter_constraint* constraint)
+{
+    const libsat_literal* lits = counter->lits + constraint->start;
+    size_t unassigned = 0;
+
+    for (size_t i = 0; i < constraint->size; ++i)
+    {
+        switch (counter_lit_value(counter, lits[i]))
+        {
+            case LIBSAT_VALUE_TRUE:
+                return COUNTER_SATISFIED;
+
+            case LIBSAT_VALUE_UNASSIGNED:
+                if (0 == unassigned++)
+                {
+                    *lit = lits[i];
+                }
+                break;
+        }
+    }
+
+    switch (unassigned)
+    {
+        case 0:
+            return COUNTER_CONFLICT;
+
+        case 1:
+            return COUNTER_UNIT;
+
+        default:
+            return COUNTER_OPEN;
+    }
+}
+
+/**
+ * \brief Check a native constraint, which holds once the unassigned literals
+ * can no longer go over the bound. A literal that would go over the bound on
+ * its own is implied false.
+ */
+static int check_native(
+    libsat_literal* lit, uint64_t* state, const counter* counter,
+    const counter_constraint* constraint)
+{
+    const libsat_literal* lits = counter->lits + constraint->start;
+    const uint64_t* weights = counter->weights + constraint->start;
+    uint64_t used = 0, open = 0;
+
+    for (size_t i = 0; i < constraint->size; ++i)
+    {
+        switch (counter_lit_value(counter, lits[i]))
+        {
+            case LIBSAT_VALUE_TRUE:
+                used += weights[i];
+                if (used < weights[i] || used > constraint->bound)
+                {
+                    return COUNTER_CONFLICT;
+                }
+                break;
+
+            case LIBSAT_VALUE_UNASSIGNED:
+                open += weights[i];
+                if (open < weights[i])
+                {
+                    open = UINT64_MAX;
+                }
+                break;
+        }
+    }
+
+    *state = constraint->bound - used;
+    if (open <= *state)
+    {
+        return COUNTER_SATISFIED;
+    }
+
+    for (size_t i = 0; i < constraint->size; ++i)
+    {
+        if (
+            LIBSAT_VALUE_UNASSIGNED == counter_lit_value(counter, lits[i])
+         && weights[i] > *state)
+        {
+            *lit = LIBSAT_LITERAL_NEGATE(lits[i]);
+            return COUNTER_UNIT;
+        }
+    }
+
+    return COUNTER_OPEN;
+}
+
+/**
+ * \brief Check a parity constraint, whose last unassigned variable is implied.
+ */
+static int check_xor(
+    libsat_literal* lit, uint64_t* state, const counter* counter,
+    const counter_constraint* constraint)
+{
+    const libsat_literal* lits = counter->lits + constraint->start;
+    size_t unassigned = 0;
+    size_t var_id = 0;
+
+    *state = constraint->bound;
+    for (size_t i = 0; i < constraint->size; ++i)
+    {
+        switch (counter_lit_value(counter, lits[i]))
+        {
+            case LIBSAT_VALUE_TRUE:
+                *state ^= 1;
+                break;
+
+            case LIBSAT_VALUE_UNASSIGNED:
+                unassigned += 1;
+                var_id = LIBSAT_LITERAL_VARIABLE(lits[i]);
+                break;
+        }
+    }
+
+    switch (unassigned)
+    {
+        case 0:
+            return (0 == *state) ? COUNTER_SATISFIED : COUNTER_CONFLICT;
+
+        case 1:
+            *lit = LIBSAT_LITERAL_MAKE(var_id, 0 == *state);
+            return COUNTER_UNIT;
+
+        default:
+            return COUNTER_OPEN;
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * \file count/counter_dispose.c
+ *
+ * \brief Reclaim the memory held by a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Reclaim the memory held by a counter, leaving it empty.
+ *
+ * \param counter       The counter to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_dispose)(
+    LIBSAT_SYM(counter)* counter)
+{
+    status retval = STATUS_SUCCESS;
+    allocator* alloc = counter->alloc;
+
+    /* reclaim the numbers of every frame that was ever used. */
+    if (NULL != counter->frames)
+    {
+        for (size_t i = 0; i < counter->frame_capacity; ++i)
+        {
+            retval =
+                reclaim_if_set(alloc, counter->frames[i].total.words, retval);
+            retval =
+                reclaim_if_set(alloc, counter->frames[i].prod.words, retval);
+        }
+    }
+
+    /* reclaim arrays. */
+    retval = reclaim_if_set(alloc, counter->projected, retval);
+    retval = reclaim_if_set(alloc, counter->lits, retval);
+    retval = reclaim_if_set(alloc, counter->weights, retval);
+    retval = reclaim_if_set(alloc, counter->constraints, retval);
+    retval = reclaim_if_set(alloc, counter->occur_start, retval);
+    retval = reclaim_if_set(alloc, counter->occurs, retval);
+    retval = reclaim_if_set(alloc, counter->values, retval);
+    retval = reclaim_if_set(alloc, counter->trail, retval);
+    retval = reclaim_if_set(alloc, counter->component_vars, retval);
+    retval = reclaim_if_set(alloc, counter->components, retval);
+    retval = reclaim_if_set(alloc, counter->var_marks, retval);
+    retval = reclaim_if_set(alloc, counter->constraint_marks, retval);
+    retval = reclaim_if_set(alloc, counter->frames, retval);
+    retval = reclaim_if_set(alloc, counter->keys, retval);
+    retval = reclaim_if_set(alloc, counter->scratch.words, retval);
+    retval = reclaim_if_set(alloc, counter->entries, retval);
+    retval = reclaim_if_set(alloc, counter->cache_keys, retval);
+    retval = reclaim_if_set(alloc, counter->cache_values, retval);
+
+    memset(counter, 0, sizeof(*counter));
+
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
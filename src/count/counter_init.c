@@ -0,0 +1,372 @@
+/**
+ * \file count/counter_init.c
+ *
+ * \brief Load the constraints of a \ref libsat_context into a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "count_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status allocate_zeroed(allocator* alloc, void** memory, size_t size);
+static void add_constraint(
+    counter* counter, uint8_t kind, const libsat_literal* lits,
+    const uint64_t* weights, size_t size, uint64_t bound);
+static size_t row_size(const libsat_xor_matrix* matrix, size_t row);
+static void add_row(
+    counter* counter, const libsat_xor_matrix* matrix, size_t row);
+static status index_occurrences(counter* counter);
+
+/**
+ * \brief Load the constraints of a context into a counter.
+ *
+ * \param counter       The counter to initialize.
+ * \param context       The context to count.
+ * \param projection    The ids of the variables to count over.
+ * \param projection_count The number of projection variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_init)(
+    LIBSAT_SYM(counter)* counter, LIBSAT_SYM(libsat_context)* context,
+    const size_t* projection, size_t projection_count)
+{
+    status retval;
+    const libsat_cnf* cnf = context->cnf;
+    const libsat_xor_matrix* matrix = context->xor_matrix;
+    size_t slots = (0 == context->variable_count) ? 1 : context->variable_count;
+    size_t lit_count, constraint_count, start;
+    libsat_literal lit;
+
+    memset(counter, 0, sizeof(*counter));
+    counter->alloc = context->alloc;
+    counter->var_count = context->variable_count;
+    counter->terminate = &context->terminate;
+
+    /* count the constraints and their literals. */
+    lit_count =
+        cnf->literal_count + cnf->removed_literal_count
+      + cnf->native_literal_count + context->scope_count;
+    constraint_count =
+        cnf->clause_count + cnf->removed_count + cnf->native_count
+      + matrix->row_count + context->scope_count;
+    for (size_t i = 0; i < matrix->row_count; ++i)
+    {
+        lit_count += row_size(matrix, i);
+    }
+
+    /* per-variable arrays. */
+    retval = allocate_zeroed(counter->alloc, (void**)&counter->values, slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(counter->alloc, (void**)&counter->projected, slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->trail,
+            slots * sizeof(*counter->trail));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->var_marks,
+            slots * sizeof(*counter->var_marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < projection_count; ++i)
+    {
+        counter->projected[projection[i]] = 1;
+    }
+
+    /* per-constraint arrays. */
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->lits,
+            (lit_count + 1) * sizeof(*counter->lits));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->weights,
+            (lit_count + 1) * sizeof(*counter->weights));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->constraints,
+            (constraint_count + 1) * sizeof(*counter->constraints));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->constraint_marks,
+            (constraint_count + 1) * sizeof(*counter->constraint_marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the clauses of the database, and those removed by elimination. */
+    start = 0;
+    for (size_t i = 0; i < cnf->clause_count; ++i)
+    {
+        add_constraint(
+            counter, COUNTER_CONSTRAINT_CLAUSE, cnf->literals + start, NULL,
+            cnf->clause_end[i] - start, 0);
+        start = cnf->clause_end[i];
+    }
+
+    start = 0;
+    for (size_t i = 0; i < cnf->removed_count; ++i)
+    {
+        add_constraint(
+            counter, COUNTER_CONSTRAINT_CLAUSE, cnf->removed_literals + start,
+            NULL, cnf->removed_end[i] - start, 0);
+        start = cnf->removed_end[i];
+    }
+
+    /* native constraints and parity rows. */
+    start = 0;
+    for (size_t i = 0; i < cnf->native_count; ++i)
+    {
+        add_constraint(
+            counter, COUNTER_CONSTRAINT_NATIVE, cnf->native_literals + start,
+            cnf->native_weights + start, cnf->native_end[i] - start,
+            cnf->native_bound[i]);
+        start = cnf->native_end[i];
+    }
+
+    for (size_t i = 0; i < matrix->row_count; ++i)
+    {
+        add_row(counter, matrix, i);
+    }
+
+    /* the clauses of each open scope hold. */
+    for (size_t i = 0; i < context->scope_count; ++i)
+    {
+        lit = context->scopes[i].activation;
+        add_constraint(counter, COUNTER_CONSTRAINT_CLAUSE, &lit, NULL, 1, 0);
+    }
+
+    return index_occurrences(counter);
+}
+
+/**
+ * \brief Allocate a block of memory, and clear it.
+ */
+static status allocate_zeroed(allocator* alloc, void** memory, size_t size)
+{
+    status retval;
+
+    retval = memory_resize(alloc, memory, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(*memory, 0, size);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Append a constraint.
+ *
+ * \param counter       The counter for this operation.
+ * \param kind          The \ref counter_constraint_kind of the constraint.
+ * \param lits          The literals of the constraint.
+ * \param weights       The weights of a native constraint, or NULL.
+ * \param size          The number of literals.
+ * \param bound         The bound of a native constraint, or the parity of a
+ *                      parity constraint.
+ */
+static void add_constraint(
+    counter* counter, uint8_t kind, const libsat_literal* lits,
+    const uint64_t* weights, size_t size, uint64_t bound)
+{
+    counter_constraint* constraint =
+        &counter->constraints[counter->constraint_count++];
+
+    constraint->kind = kind;
+    constraint->start = counter->lit_count;
+    constraint->size = size;
+    constraint->bound = bound;
+
+    if (size > 0)
+    {
+        memcpy(counter->lits + counter->lit_count, lits, size * sizeof(*lits));
+    }
+    if (NULL != weights && size > 0)
+    {
+        memcpy(
+            counter->weights + counter->lit_count, weights,
+            size * sizeof(*weights));
+    }
+
+    counter->lit_count += size;
+}
+
+/**
+ * \brief Count the variables of a parity row.
+ */
+static size_t row_size(const libsat_xor_matrix* matrix, size_t row)
+{
+    const uint64_t* bits = matrix->rows + row * matrix->row_words;
+    size_t size = 0;
+
+    for (size_t c = 0; c < matrix->column_count; ++c)
+    {
+        size += xor_row_test(bits, c + 1);
+    }
+
+    return size;
+}
+
+/**
+ * \brief Append a parity row as a constraint over its variables.
+ */
+static void add_row(
+    counter* counter, const libsat_xor_matrix* matrix, size_t row)
+{
+    const uint64_t* bits = matrix->rows + row * matrix->row_words;
+    counter_constraint* constraint =
+        &counter->constraints[counter->constraint_count++];
+
+    constraint->kind = COUNTER_CONSTRAINT_XOR;
+    constraint->start = counter->lit_count;
+    constraint->bound = xor_row_test(bits, LIBSAT_XOR_PARITY_BIT);
+
+    for (size_t c = 0; c < matrix->column_count; ++c)
+    {
+        if (xor_row_test(bits, c + 1))
+        {
+            counter->lits[counter->lit_count++] =
+                LIBSAT_LITERAL_MAKE(matrix->column_variable[c], false);
+        }
+    }
+
+    constraint->size = counter->lit_count - constraint->start;
+}
+
+/**
+ * \brief List the constraints of each variable, once each.
+ *
+ * \param counter       The counter, with its constraints loaded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status index_occurrences(counter* counter)
+{
+    status retval;
+    size_t var_id, total = 0;
+
+    retval =
+        allocate_zeroed(
+            counter->alloc, (void**)&counter->occur_start,
+            (counter->var_count + 1) * sizeof(*counter->occur_start));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* count, marking each variable once per constraint. */
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < counter->constraint_count; ++i)
+        {
+            const counter_constraint* constraint = &counter->constraints[i];
+
+            counter->epoch += 1;
+            for (size_t j = 0; j < constraint->size; ++j)
+            {
+                var_id =
+                    LIBSAT_LITERAL_VARIABLE(
+                        counter->lits[constraint->start + j]);
+                if (counter->var_marks[var_id] == counter->epoch)
+                {
+                    continue;
+                }
+
+                counter->var_marks[var_id] = counter->epoch;
+                if (0 == pass)
+                {
+                    counter->occur_start[var_id + 1] += 1;
+                }
+                else
+                {
+                    counter->occurs[counter->occur_start[var_id]++] = i;
+                }
+            }
+        }
+
+        if (0 == pass)
+        {
+            for (size_t v = 0; v < counter->var_count; ++v)
+            {
+                counter->occur_start[v + 1] += counter->occur_start[v];
+            }
+
+            total = counter->occur_start[counter->var_count];
+            retval =
+                allocate_zeroed(
+                    counter->alloc, (void**)&counter->occurs,
+                    (total + 1) * sizeof(*counter->occurs));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    /* the second pass moved each start to the next one. */
+    for (size_t v = counter->var_count; v > 0; --v)
+    {
+        counter->occur_start[v] = counter->occur_start[v - 1];
+    }
+
+    counter->occur_start[0] = 0;
+
+    return STATUS_SUCCESS;
+}
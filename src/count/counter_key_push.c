@@ -0,0 +1,147 @@
+/**
+ * \file count/counter_key_push.c
+ *
+ * \brief Describe a component of a \ref counter for its cache.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static status push_word(counter* counter, uint64_t word);
+static int pair_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Push the cache key of a component onto the key stack: its variables,
+ * followed by each of its open constraints and what is left of it.
+ *
+ * Two components with the same key have the same count: the variables are
+ * unassigned, the clauses that are left only keep their unassigned literals,
+ * and what is left of a native or parity constraint is fixed by its state.
+ *
+ * \param hash          Pointer to receive the hash of the key.
+ * \param counter       The counter for this operation.
+ * \param component     The component to describe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_key_push)(
+    uint64_t* hash, LIBSAT_SYM(counter)* counter, size_t component)
+{
+    status retval;
+    counter_component desc = counter->components[component];
+    size_t key_start = counter->key_count;
+    size_t pairs;
+    libsat_literal lit;
+    uint64_t state, h;
+
+    retval = push_word(counter, desc.size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < desc.size; ++i)
+    {
+        retval = push_word(counter, counter->component_vars[desc.start + i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* each open constraint, once, with its state. */
+    counter->epoch += 1;
+    pairs = counter->key_count;
+    for (size_t i = 0; i < desc.size; ++i)
+    {
+        size_t var_id = counter->component_vars[desc.start + i];
+
+        for (
+            size_t j = counter->occur_start[var_id];
+            j < counter->occur_start[var_id + 1]; ++j)
+        {
+            size_t c = counter->occurs[j];
+
+            if (counter->constraint_marks[c] == counter->epoch)
+            {
+                continue;
+            }
+
+            counter->constraint_marks[c] = counter->epoch;
+            if (COUNTER_OPEN != counter_check(&lit, &state, counter, c))
+            {
+                continue;
+            }
+
+            retval = push_word(counter, c);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = push_word(counter, state);
+            }
+
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    qsort(
+        counter->keys + pairs, (counter->key_count - pairs) / 2,
+        2 * sizeof(*counter->keys), &pair_compare);
+
+    /* hash the whole key. */
+    h = 0xcbf29ce484222325ULL;
+    for (size_t i = key_start; i < counter->key_count; ++i)
+    {
+        h ^= counter->keys[i];
+        h *= 0x100000001b3ULL;
+        h ^= h >> 29;
+    }
+
+    *hash = h;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a word onto the key stack.
+ */
+static status push_word(counter* counter, uint64_t word)
+{
+    status retval;
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->keys, &counter->key_capacity,
+            counter->key_count + 1, sizeof(*counter->keys));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    counter->keys[counter->key_count++] = word;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order constraint and state pairs by constraint.
+ */
+static int pair_compare(const void* lhs, const void* rhs)
+{
+    uint64_t l = *(const uint64_t*)lhs;
+    uint64_t r = *(const uint64_t*)rhs;
+
+    return (l > r) - (l < r);
+}
@@ -0,0 +1,57 @@
+/**
+ * \file count/counter_number_add.c
+ *
+ * \brief Add to a \ref counter_number.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Add to a number.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to add to.
+ * \param words         The words of the number to add.
+ * \param count         The number of words.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_add)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    const uint32_t* words, size_t count)
+{
+    status retval;
+    size_t size = (count > number->count) ? count : number->count;
+    uint64_t carry = 0;
+
+    retval =
+        counter_reserve(
+            alloc, (void**)&number->words, &number->capacity, size + 1,
+            sizeof(*number->words));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        carry +=
+            (uint64_t)(i < number->count ? number->words[i] : 0)
+          + (i < count ? words[i] : 0);
+        number->words[i] = (uint32_t)carry;
+        carry >>= 32;
+    }
+
+    number->words[size] = (uint32_t)carry;
+    number->count = size + (0 != carry);
+
+    return STATUS_SUCCESS;
+}
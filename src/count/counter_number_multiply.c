@@ -0,0 +1,93 @@
+/**
+ * \file count/counter_number_multiply.c
+ *
+ * \brief Multiply a \ref counter_number.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Multiply a number.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to multiply.
+ * \param words         The words of the number to multiply by.
+ * \param count         The number of words.
+ * \param scratch       Scratch space for the product.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_multiply)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    const uint32_t* words, size_t count, LIBSAT_SYM(counter_number)* scratch)
+{
+    status retval;
+    size_t size = number->count + count;
+
+    if (0 == number->count || 0 == count)
+    {
+        number->count = 0;
+        return STATUS_SUCCESS;
+    }
+
+    /* multiplying by one changes nothing. */
+    if (1 == count && 1 == words[0])
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        counter_reserve(
+            alloc, (void**)&scratch->words, &scratch->capacity, size,
+            sizeof(*scratch->words));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(scratch->words, 0, size * sizeof(*scratch->words));
+    for (size_t i = 0; i < number->count; ++i)
+    {
+        uint64_t carry = 0;
+
+        for (size_t j = 0; j < count; ++j)
+        {
+            carry +=
+                (uint64_t)number->words[i] * words[j]
+              + scratch->words[i + j];
+            scratch->words[i + j] = (uint32_t)carry;
+            carry >>= 32;
+        }
+
+        scratch->words[i + count] = (uint32_t)carry;
+    }
+
+    while (size > 0 && 0 == scratch->words[size - 1])
+    {
+        --size;
+    }
+
+    retval =
+        counter_reserve(
+            alloc, (void**)&number->words, &number->capacity, size,
+            sizeof(*number->words));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(number->words, scratch->words, size * sizeof(*number->words));
+    number->count = size;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,51 @@
+/**
+ * \file count/counter_number_set.c
+ *
+ * \brief Set a \ref counter_number to a small value.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Set a number to a small value.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to set.
+ * \param value         The value.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_set)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    uint32_t value)
+{
+    status retval;
+
+    number->count = 0;
+    if (0 == value)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        counter_reserve(
+            alloc, (void**)&number->words, &number->capacity, 1,
+            sizeof(*number->words));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    number->words[0] = value;
+    number->count = 1;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,67 @@
+/**
+ * \file count/counter_number_shift.c
+ *
+ * \brief Multiply a \ref counter_number by a power of two.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Multiply a number by a power of two.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param number        The number to shift.
+ * \param bits          The power of two.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_number_shift)(
+    RCPR_SYM(allocator)* alloc, LIBSAT_SYM(counter_number)* number,
+    size_t bits)
+{
+    status retval;
+    size_t whole = bits / 32;
+    unsigned part = bits % 32;
+    size_t size = number->count + whole + 1;
+
+    if (0 == number->count || 0 == bits)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        counter_reserve(
+            alloc, (void**)&number->words, &number->capacity, size,
+            sizeof(*number->words));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* move each word up, from the top down, carrying the bits shifted out. */
+    number->words[size - 1] = 0;
+    for (size_t i = number->count; i > 0; --i)
+    {
+        uint64_t word = (uint64_t)number->words[i - 1] << part;
+
+        number->words[i - 1 + whole + 1] |= (uint32_t)(word >> 32);
+        number->words[i - 1 + whole] = (uint32_t)word;
+    }
+
+    for (size_t i = 0; i < whole; ++i)
+    {
+        number->words[i] = 0;
+    }
+
+    number->count = (0 == number->words[size - 1]) ? size - 1 : size;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,88 @@
+/**
+ * \file count/counter_propagate.c
+ *
+ * \brief Propagate the assignments of a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static bool visit(counter* counter, size_t constraint);
+
+/**
+ * \brief Propagate the queued assignments.
+ *
+ * Every constraint of an assigned variable is checked again, which is enough
+ * for constraints this small; a unit constraint assigns its literal, which is
+ * queued in turn.
+ *
+ * \param counter       The counter for this operation.
+ * \param all           If true, every constraint is checked first, so that
+ *                      empty and unit constraints are found.
+ *
+ * \returns false on a conflict, and true otherwise.
+ */
+bool
+LIBSAT_SYM(counter_propagate)(
+    LIBSAT_SYM(counter)* counter, bool all)
+{
+    size_t var_id;
+
+    if (all)
+    {
+        for (size_t i = 0; i < counter->constraint_count; ++i)
+        {
+            if (!visit(counter, i))
+            {
+                return false;
+            }
+        }
+    }
+
+    while (counter->trail_head < counter->trail_count)
+    {
+        var_id = counter->trail[counter->trail_head++];
+
+        for (
+            size_t i = counter->occur_start[var_id];
+            i < counter->occur_start[var_id + 1]; ++i)
+        {
+            if (!visit(counter, counter->occurs[i]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Check a constraint, assigning its literal if it is unit.
+ *
+ * \returns false on a conflict, and true otherwise.
+ */
+static bool visit(counter* counter, size_t constraint)
+{
+    libsat_literal lit;
+    uint64_t state;
+
+    switch (counter_check(&lit, &state, counter, constraint))
+    {
+        case COUNTER_CONFLICT:
+            return false;
+
+        case COUNTER_UNIT:
+            counter_assign(counter, lit);
+            return true;
+
+        default:
+            return true;
+    }
+}
@@ -0,0 +1,63 @@
+/**
+ * \file count/counter_reserve.c
+ *
+ * \brief Make room in an array of the \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "count_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_count_internal;
+
+/**
+ * \brief Make room for a number of items in an array.
+ *
+ * The array at least doubles when it grows, and the new items are cleared.
+ *
+ * \param alloc         The allocator for this operation.
+ * \param items         Pointer to the array, which may be NULL.
+ * \param capacity      Pointer to the number of items the array holds.
+ * \param needed        The number of items needed.
+ * \param item_size     The size of each item.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_reserve)(
+    RCPR_SYM(allocator)* alloc, void** items, size_t* capacity,
+    size_t needed, size_t item_size)
+{
+    status retval;
+    size_t grown = (0 == *capacity) ? 16 : 2 * *capacity;
+
+    if (needed <= *capacity)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    while (grown < needed)
+    {
+        grown *= 2;
+    }
+
+    retval = memory_resize(alloc, items, grown * item_size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(
+        (uint8_t*)*items + *capacity * item_size, 0,
+        (grown - *capacity) * item_size);
+    *capacity = grown;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,413 @@
+/**
+ * \file count/counter_run.c
+ *
+ * \brief Count the models of a \ref counter.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static status push_root(counter* counter);
+static status next_child(counter* counter, counter_frame* frame);
+static status close_branch(counter* counter, counter_frame* frame);
+static status open_branch(counter* counter, counter_frame* frame);
+static status finish(counter* counter);
+static void pick_var(counter_frame* frame, const counter* counter);
+
+/**
+ * \brief Count the models of the loaded constraints over the projection.
+ *
+ * The search keeps an explicit stack of frames, one per component being
+ * counted. Each branch of a frame splits what is left of its component into
+ * independent components, whose counts are multiplied; the count of each
+ * component is cached by its key, so that a component seen again is not
+ * counted again. A component without projection variables only needs to be
+ * satisfied, so its count is zero or one, and its second branch is skipped
+ * once the first one is satisfiable.
+ *
+ * \param count         Pointer to receive the count, which is owned by the
+ *                      counter.
+ * \param stopped       Pointer to a flag that is set if the count was stopped
+ *                      by a request to terminate.
+ * \param counter       The counter for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_run)(
+    const LIBSAT_SYM(counter_number)** count, bool* stopped,
+    LIBSAT_SYM(counter)* counter)
+{
+    status retval;
+    counter_frame* frame;
+    int branches;
+
+    *stopped = false;
+
+    retval = push_root(counter);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (;;)
+    {
+        if (atomic_load(counter->terminate))
+        {
+            *stopped = true;
+            *count = &counter->frames[0].total;
+            return STATUS_SUCCESS;
+        }
+
+        frame = &counter->frames[counter->frame_count - 1];
+
+        /* count the next child of the open branch. */
+        if (
+            frame->branch > 0 && frame->child < counter->component_count
+         && !counter_number_is_zero(&frame->prod))
+        {
+            retval = next_child(counter, frame);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            continue;
+        }
+
+        if (frame->branch > 0)
+        {
+            retval = close_branch(counter, frame);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        /* the root has a single branch; satisfying one branch is enough when
+         * no projection variable is left. */
+        branches = (COUNTER_NONE == frame->var) ? 1 : 2;
+        if (!frame->projected && !counter_number_is_zero(&frame->total))
+        {
+            branches = frame->branch;
+        }
+
+        if (frame->branch < branches)
+        {
+            retval = open_branch(counter, frame);
+        }
+        else if (1 == counter->frame_count)
+        {
+            *count = &frame->total;
+            return STATUS_SUCCESS;
+        }
+        else
+        {
+            retval = finish(counter);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+}
+
+/**
+ * \brief Push the root frame, which counts a component of every variable.
+ *
+ * \param counter       The counter for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status push_root(counter* counter)
+{
+    status retval;
+    counter_frame* frame;
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->component_vars,
+            &counter->component_var_capacity, counter->var_count,
+            sizeof(*counter->component_vars));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->components,
+            &counter->component_capacity, 1, sizeof(*counter->components));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->frames,
+            &counter->frame_capacity, 1, sizeof(*counter->frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < counter->var_count; ++i)
+    {
+        counter->component_vars[i] = i;
+    }
+
+    counter->component_var_count = counter->var_count;
+    counter->components[0].start = 0;
+    counter->components[0].size = counter->var_count;
+    counter->component_count = 1;
+
+    frame = &counter->frames[0];
+    frame->component = 0;
+    frame->var = COUNTER_NONE;
+    frame->branch = 0;
+    frame->projected = true;
+    frame->total.count = 0;
+    frame->prod.count = 0;
+    counter->frame_count = 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Count the next child of the open branch of a frame: from the cache if
+ * it is there, or else by pushing a frame for it.
+ *
+ * \param counter       The counter for this operation.
+ * \param frame         The top frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status next_child(counter* counter, counter_frame* frame)
+{
+    status retval;
+    const counter_entry* entry;
+    counter_frame* child;
+    size_t component = frame->child++;
+    size_t key_start = counter->key_count;
+    uint64_t hash;
+
+    retval = counter_key_push(&hash, counter, component);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    counter_cache_find(
+        &entry, counter, counter->keys + key_start,
+        counter->key_count - key_start, hash);
+    if (NULL != entry)
+    {
+        counter->key_count = key_start;
+
+        return
+            counter_number_multiply(
+                counter->alloc, &frame->prod,
+                counter->cache_values + entry->value_start, entry->value_size,
+                &counter->scratch);
+    }
+
+    /* this may move the frames. */
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->frames,
+            &counter->frame_capacity, counter->frame_count + 1,
+            sizeof(*counter->frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    child = &counter->frames[counter->frame_count++];
+    child->component = component;
+    child->branch = 0;
+    child->key_start = key_start;
+    child->key_size = counter->key_count - key_start;
+    child->hash = hash;
+    child->total.count = 0;
+    child->prod.count = 0;
+    pick_var(child, counter);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Add the count of the open branch of a frame to its total, and undo
+ * the branch.
+ *
+ * \param counter       The counter for this operation.
+ * \param frame         The top frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status close_branch(counter* counter, counter_frame* frame)
+{
+    status retval = STATUS_SUCCESS;
+    counter_number swap;
+
+    if (!counter_number_is_zero(&frame->prod))
+    {
+        if (counter_number_is_zero(&frame->total))
+        {
+            /* the first count is taken over rather than added. */
+            swap = frame->total;
+            frame->total = frame->prod;
+            frame->prod = swap;
+        }
+        else if (frame->projected)
+        {
+            retval =
+                counter_number_add(
+                    counter->alloc, &frame->total, frame->prod.words,
+                    frame->prod.count);
+        }
+    }
+
+    counter_undo(counter, frame->trail_mark);
+    counter->component_count = frame->component_mark;
+    counter->component_var_count = frame->var_mark;
+
+    return retval;
+}
+
+/**
+ * \brief Open the next branch of a frame: assign its branch variable, and split
+ * what is left of its component into children.
+ *
+ * \param counter       The counter for this operation.
+ * \param frame         The top frame.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status open_branch(counter* counter, counter_frame* frame)
+{
+    status retval;
+    size_t free;
+    bool satisfiable;
+
+    frame->trail_mark = counter->trail_count;
+    frame->component_mark = counter->component_count;
+    frame->var_mark = counter->component_var_count;
+
+    if (COUNTER_NONE == frame->var)
+    {
+        satisfiable = counter_propagate(counter, true);
+    }
+    else
+    {
+        counter_assign(
+            counter, LIBSAT_LITERAL_MAKE(frame->var, 0 != frame->branch));
+        satisfiable = counter_propagate(counter, false);
+    }
+
+    frame->branch += 1;
+    frame->child = counter->component_count;
+    frame->prod.count = 0;
+    if (!satisfiable)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval = counter_split(&free, counter, frame->component);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = counter_number_set(counter->alloc, &frame->prod, 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return counter_number_shift(counter->alloc, &frame->prod, free);
+}
+
+/**
+ * \brief Cache the total of the top frame, pop it, and multiply it into the
+ * open branch of its parent.
+ *
+ * \param counter       The counter for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status finish(counter* counter)
+{
+    status retval;
+    counter_frame* frame = &counter->frames[counter->frame_count - 1];
+    counter_frame* parent = frame - 1;
+
+    retval =
+        counter_cache_insert(
+            counter, frame->key_start, frame->key_size, frame->hash,
+            &frame->total);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    counter->key_count = frame->key_start;
+    counter->frame_count -= 1;
+
+    return
+        counter_number_multiply(
+            counter->alloc, &parent->prod, frame->total.words,
+            frame->total.count, &counter->scratch);
+}
+
+/**
+ * \brief Pick the branch variable of a frame: the projection variable of its
+ * component with the most constraints, or else any variable with the most
+ * constraints.
+ *
+ * \param frame         The frame.
+ * \param counter       The counter for this operation.
+ */
+static void pick_var(counter_frame* frame, const counter* counter)
+{
+    const counter_component* component =
+        &counter->components[frame->component];
+    size_t best = 0, var_id, score;
+
+    frame->var = COUNTER_NONE;
+    frame->projected = false;
+    for (size_t i = 0; i < component->size; ++i)
+    {
+        var_id = counter->component_vars[component->start + i];
+        score =
+            counter->occur_start[var_id + 1] - counter->occur_start[var_id];
+        if (
+            COUNTER_NONE == frame->var
+         || (counter->projected[var_id] && !frame->projected)
+         || (counter->projected[var_id] == frame->projected && score > best))
+        {
+            frame->var = var_id;
+            frame->projected = counter->projected[var_id];
+            best = score;
+        }
+    }
+}
@@ -0,0 +1,179 @@
+/**
+ * \file count/counter_split.c
+ *
+ * \brief Split a component of a \ref counter into independent components.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "count_internal.h"
+
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static status push_var(counter* counter, size_t var_id);
+static int var_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Split the unassigned variables of a component into the components of
+ * the open constraints, pushing them onto the component stack.
+ *
+ * Each new component is grown breadth first from one of its variables, through
+ * the open constraints of the variables found so far. A variable with no open
+ * constraint is free, and is not pushed. The variables of each new component
+ * are sorted.
+ *
+ * \param free          Pointer to receive the number of projection variables
+ *                      that no open constraint uses.
+ * \param counter       The counter for this operation.
+ * \param component     The component to split.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(counter_split)(
+    size_t* free, LIBSAT_SYM(counter)* counter, size_t component)
+{
+    status retval;
+    counter_component parent = counter->components[component];
+    counter_component* child;
+    const counter_constraint* constraint;
+    libsat_literal lit;
+    uint64_t state;
+    size_t var_id, start, other;
+    bool open;
+
+    *free = 0;
+    counter->epoch += 1;
+
+    for (size_t i = 0; i < parent.size; ++i)
+    {
+        var_id = counter->component_vars[parent.start + i];
+        if (
+            LIBSAT_VALUE_UNASSIGNED != counter->values[var_id]
+         || counter->var_marks[var_id] == counter->epoch)
+        {
+            continue;
+        }
+
+        start = counter->component_var_count;
+        retval = push_var(counter, var_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        open = false;
+        for (size_t head = start; head < counter->component_var_count; ++head)
+        {
+            other = counter->component_vars[head];
+            for (
+                size_t j = counter->occur_start[other];
+                j < counter->occur_start[other + 1]; ++j)
+            {
+                size_t c = counter->occurs[j];
+
+                if (counter->constraint_marks[c] == counter->epoch)
+                {
+                    continue;
+                }
+
+                counter->constraint_marks[c] = counter->epoch;
+                if (COUNTER_OPEN != counter_check(&lit, &state, counter, c))
+                {
+                    continue;
+                }
+
+                open = true;
+                constraint = &counter->constraints[c];
+                for (size_t k = 0; k < constraint->size; ++k)
+                {
+                    size_t next =
+                        LIBSAT_LITERAL_VARIABLE(
+                            counter->lits[constraint->start + k]);
+
+                    if (
+                        LIBSAT_VALUE_UNASSIGNED == counter->values[next]
+                     && counter->var_marks[next] != counter->epoch)
+                    {
+                        retval = push_var(counter, next);
+                        if (STATUS_SUCCESS != retval)
+                        {
+                            return retval;
+                        }
+                    }
+                }
+            }
+        }
+
+        /* a variable without open constraints can take either value. */
+        if (!open)
+        {
+            counter->component_var_count = start;
+            *free += counter->projected[var_id];
+            continue;
+        }
+
+        qsort(
+            counter->component_vars + start,
+            counter->component_var_count - start,
+            sizeof(*counter->component_vars), &var_compare);
+
+        retval =
+            counter_reserve(
+                counter->alloc, (void**)&counter->components,
+                &counter->component_capacity, counter->component_count + 1,
+                sizeof(*counter->components));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        child = &counter->components[counter->component_count++];
+        child->start = start;
+        child->size = counter->component_var_count - start;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Mark a variable, and push it onto the component variable stack.
+ */
+static status push_var(counter* counter, size_t var_id)
+{
+    status retval;
+
+    retval =
+        counter_reserve(
+            counter->alloc, (void**)&counter->component_vars,
+            &counter->component_var_capacity,
+            counter->component_var_count + 1,
+            sizeof(*counter->component_vars));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    counter->var_marks[var_id] = counter->epoch;
+    counter->component_vars[counter->component_var_count++] = var_id;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order variable ids.
+ */
+static int var_compare(const void* lhs, const void* rhs)
+{
+    size_t l = *(const size_t*)lhs;
+    size_t r = *(const size_t*)rhs;
+
+    return (l > r) - (l < r);
+}
@@ -0,0 +1,56 @@
+/**
+ * \file parser/libsat_ast_evaluate.c
+ *
+ * \brief Evaluate an AST under a single assignment.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+
+/**
+ * \brief Evaluate an AST under a single assignment.
+ *
+ * A statement list is true when all of its hard statements are; soft
+ * statements are skipped, since they do not have to hold in a model.
+ *
+ * \param result        Pointer to receive the value of the AST on success.
+ * \param node          The AST to evaluate.
+ * \param assignment    The bit-packed assignment, in which bit v % 64 of
+ *                      assignment[v / 64] is the value of variable v.
+ * \param variable_count The number of variables in the assignment.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if the AST refers to a variable
+ *        that is not in the assignment.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_evaluate)(
+    bool* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* assignment, size_t variable_count)
+{
+    status retval;
+    uint64_t word;
+
+    /* each variable is broadcast to a full word, so any bit is the value. */
+    retval =
+        libsat_ast_node_evaluate_words(
+            &word, node, assignment, variable_count, 1, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *result = (word & 1);
+
+    return STATUS_SUCCESS;
+}
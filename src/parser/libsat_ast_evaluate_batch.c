@@ -0,0 +1,45 @@
+/**
+ * \file parser/libsat_ast_evaluate_batch.c
+ *
+ * \brief Evaluate an AST under 64 assignments at once.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+
+/**
+ * \brief Evaluate an AST under 64 assignments at once.
+ *
+ * This evaluates the AST as \ref libsat_ast_evaluate does, with one bitwise
+ * operation per node covering all 64 assignments.
+ *
+ * \param result        Pointer to receive the value of the AST on success;
+ *                      bit i is its value under assignment i.
+ * \param node          The AST to evaluate.
+ * \param lanes         The assignments, in which bit i of lanes[v] is the
+ *                      value of variable v in assignment i.
+ * \param variable_count The number of variables in the lanes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if the AST refers to a variable
+ *        that is not in the lanes.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_evaluate_batch)(
+    uint64_t* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* lanes, size_t variable_count)
+{
+    return
+        libsat_ast_node_evaluate_words(
+            result, node, lanes, variable_count, 1, false);
+}
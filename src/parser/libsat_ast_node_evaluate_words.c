@@ -0,0 +1,406 @@
+/**
+ * \file parser/libsat_ast_node_evaluate_words.c
+ *
+ * \brief Evaluate an AST one 64-bit word at a time.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A node on the walk stack, visited once on entry and once on exit.
+ */
+typedef struct evaluate_frame evaluate_frame;
+struct evaluate_frame
+{
+    const libsat_ast_node* node;
+    bool exit;
+};
+
+/**
+ * \brief The explicit stacks of the walk. Each value on the value stack is
+ * width words long.
+ */
+typedef struct evaluate_stacks evaluate_stacks;
+struct evaluate_stacks
+{
+    allocator* alloc;
+    size_t width;
+    evaluate_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    uint64_t* values;
+    size_t value_count;
+    size_t value_capacity;
+};
+
+/* forward decls. */
+static status push_frame(
+    evaluate_stacks* stacks, const libsat_ast_node* node, bool exit);
+static status push_value(uint64_t** value, evaluate_stacks* stacks);
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size);
+
+/**
+ * \brief Evaluate an AST over width * 64 assignments at once.
+ *
+ * Each node reduces to width words, bit i of which is the value of the node
+ * under assignment i, so that every operator is a bitwise operation over a
+ * short run of words that the compiler can vectorize. The walk is iterative,
+ * since chains of binary operators can be long.
+ *
+ * \param result        Pointer to receive the width words for this AST on
+ *                      success.
+ * \param node          The AST to evaluate.
+ * \param words         The assignment words.
+ * \param variable_count The number of variables covered by the words.
+ * \param width         The number of words per variable.
+ * \param packed        If true, bit v % 64 of words[v / 64] is the value of
+ *                      variable v, and it is broadcast to all of its words.
+ *                      If false, words[v * width] through
+ *                      words[v * width + width - 1] hold variable v across
+ *                      all assignments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if a variable is not covered by the
+ *        words.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_node_evaluate_words)(
+    uint64_t* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* words, size_t variable_count, size_t width, bool packed)
+{
+    status retval, release_retval;
+    evaluate_stacks stacks;
+    const libsat_ast_node* i;
+    size_t index, hard;
+    uint64_t broadcast;
+    uint64_t* value;
+    uint64_t* rhs;
+
+    memset(&stacks, 0, sizeof(stacks));
+    stacks.alloc = node->alloc;
+    stacks.width = width;
+
+    retval = push_frame(&stacks, node, false);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stacks;
+    }
+
+    while (stacks.frame_count > 0)
+    {
+        evaluate_frame frame = stacks.frames[--stacks.frame_count];
+        node = frame.node;
+
+        /* leaves reduce to a value directly. */
+        if (LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->type)
+        {
+            index = node->value.variable_index;
+            if (index >= variable_count)
+            {
+                retval = ERROR_LIBSAT_PARSER_BAD_VARIABLE;
+                goto cleanup_stacks;
+            }
+
+            retval = push_value(&value, &stacks);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_stacks;
+            }
+
+            if (packed)
+            {
+                broadcast = -((words[index >> 6] >> (index & 63)) & 1);
+                for (size_t w = 0; w < width; ++w)
+                {
+                    value[w] = broadcast;
+                }
+            }
+            else
+            {
+                memcpy(value, words + index * width, width * sizeof(*value));
+            }
+        }
+        else if (LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL == node->type)
+        {
+            retval = push_value(&value, &stacks);
+            if (STATUS_SUCCESS != retval)
+            {
+                goto cleanup_stacks;
+            }
+
+            broadcast = -(uint64_t)node->value.boolean_literal;
+            for (size_t w = 0; w < width; ++w)
+            {
+                value[w] = broadcast;
+            }
+        }
+        /* on entry, revisit this node after its children. */
+        else if (!frame.exit)
+        {
+            retval = push_frame(&stacks, node, true);
+
+            switch (node->type)
+            {
+                case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(&stacks, node->value.unary, false);
+                    }
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+                case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+                case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                    /* the rhs is pushed first, so the lhs is reduced first. */
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(
+                                &stacks, node->value.binary.rhs, false);
+                    }
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval =
+                            push_frame(
+                                &stacks, node->value.binary.lhs, false);
+                    }
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                    /* soft statements do not constrain the list. */
+                    for (
+                        i = node->value.list.head;
+                        NULL != i && STATUS_SUCCESS == retval; i = i->next)
+                    {
+                        if (0 == i->weight)
+                        {
+                            retval = push_frame(&stacks, i, false);
+                        }
+                    }
+                    break;
+
+                default:
+                    retval = ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE;
+                    break;
+            }
+        }
+        /* on exit, the values of the children are on the value stack. */
+        else
+        {
+            switch (node->type)
+            {
+                case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+                    value = stacks.values + (stacks.value_count - 1) * width;
+                    for (size_t w = 0; w < width; ++w)
+                    {
+                        value[w] = ~value[w];
+                    }
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                    break;
+
+                case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                    hard = 0;
+                    for (
+                        i = node->value.list.head; NULL != i; i = i->next)
+                    {
+                        hard += (0 == i->weight);
+                    }
+
+                    /* a list of soft statements holds everywhere. */
+                    if (0 == hard)
+                    {
+                        retval = push_value(&value, &stacks);
+                        if (STATUS_SUCCESS == retval)
+                        {
+                            memset(value, 0xff, width * sizeof(*value));
+                        }
+                        break;
+                    }
+
+                    /* fold the hard statements into the lowest of them. */
+                    stacks.value_count -= hard - 1;
+                    value = stacks.values + (stacks.value_count - 1) * width;
+                    for (size_t j = 1; j < hard; ++j)
+                    {
+                        rhs = value + j * width;
+                        for (size_t w = 0; w < width; ++w)
+                        {
+                            value[w] &= rhs[w];
+                        }
+                    }
+                    break;
+
+                default:
+                    --stacks.value_count;
+                    rhs = stacks.values + stacks.value_count * width;
+                    value = rhs - width;
+
+                    switch (node->type)
+                    {
+                        case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+                            for (size_t w = 0; w < width; ++w)
+                            {
+                                value[w] &= rhs[w];
+                            }
+                            break;
+
+                        case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+                            for (size_t w = 0; w < width; ++w)
+                            {
+                                value[w] |= rhs[w];
+                            }
+                            break;
+
+                        case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+                            for (size_t w = 0; w < width; ++w)
+                            {
+                                value[w] ^= rhs[w];
+                            }
+                            break;
+
+                        case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+                            for (size_t w = 0; w < width; ++w)
+                            {
+                                value[w] = ~value[w] | rhs[w];
+                            }
+                            break;
+
+                        default:
+                            for (size_t w = 0; w < width; ++w)
+                            {
+                                value[w] = ~(value[w] ^ rhs[w]);
+                            }
+                            break;
+                    }
+                    break;
+            }
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_stacks;
+        }
+    }
+
+    /* success. */
+    memcpy(result, stacks.values, width * sizeof(*result));
+    retval = STATUS_SUCCESS;
+
+cleanup_stacks:
+    if (NULL != stacks.frames)
+    {
+        release_retval = allocator_reclaim(stacks.alloc, stacks.frames);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != stacks.values)
+    {
+        release_retval = allocator_reclaim(stacks.alloc, stacks.values);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Push a frame onto the walk stack, growing it if needed.
+ */
+static status push_frame(
+    evaluate_stacks* stacks, const libsat_ast_node* node, bool exit)
+{
+    status retval;
+
+    retval =
+        reserve(
+            stacks->alloc, (void**)&stacks->frames, &stacks->frame_capacity,
+            stacks->frame_count, sizeof(*stacks->frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    stacks->frames[stacks->frame_count].node = node;
+    stacks->frames[stacks->frame_count].exit = exit;
+    ++stacks->frame_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push an uninitialized value onto the value stack, growing it if
+ * needed.
+ */
+static status push_value(uint64_t** value, evaluate_stacks* stacks)
+{
+    status retval;
+
+    retval =
+        reserve(
+            stacks->alloc, (void**)&stacks->values, &stacks->value_capacity,
+            stacks->value_count, stacks->width * sizeof(*stacks->values));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *value = stacks->values + stacks->value_count++ * stacks->width;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make room for one more element in a stack.
+ */
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size)
+{
+    status retval;
+
+    if (count == *capacity)
+    {
+        size_t new_capacity = (0 == *capacity) ? 16 : 2 * *capacity;
+
+        retval = memory_resize(alloc, array, new_capacity * size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *capacity = new_capacity;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,159 @@
+/**
+ * \file parser/libsat_ast_node_rebase.c
+ *
+ * \brief Rebase the variables of an AST parsed against a merged overlay.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "../base/libsat_base_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status push_node(
+    libsat_ast_node*** stack, size_t* count, size_t* capacity,
+    allocator* alloc, libsat_ast_node* node);
+
+/**
+ * \brief Rewrite the variables of an AST parsed against an overlay to their
+ * ids in the base, once the overlay has been merged.
+ *
+ * \param node          The AST to rebase.
+ * \param overlay       The merged overlay that the AST was parsed against.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY if the context is not an
+ *        overlay.
+ *      - ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED if the overlay has not been
+ *        merged.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_node_rebase)(
+    LIBSAT_SYM(libsat_ast_node)* node,
+    const LIBSAT_SYM(libsat_context)* overlay)
+{
+    status retval, release_retval;
+    libsat_ast_node** stack = NULL;
+    size_t count = 0, capacity = 0;
+    allocator* alloc = overlay->alloc;
+
+    retval = push_node(&stack, &count, &capacity, alloc, node);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* walk the tree without recursion, since chains can be long. */
+    while (count > 0)
+    {
+        node = stack[--count];
+
+        switch (node->type)
+        {
+            case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+                retval =
+                    libsat_context_overlay_translate(
+                        &node->value.variable_index, overlay,
+                        node->value.variable_index);
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                retval =
+                    push_node(
+                        &stack, &count, &capacity, alloc, node->value.unary);
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+            case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                retval =
+                    push_node(
+                        &stack, &count, &capacity, alloc,
+                        node->value.binary.lhs);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval =
+                        push_node(
+                            &stack, &count, &capacity, alloc,
+                            node->value.binary.rhs);
+                }
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                for (
+                    libsat_ast_node* i = node->value.list.head;
+                    NULL != i && STATUS_SUCCESS == retval; i = i->next)
+                {
+                    retval = push_node(&stack, &count, &capacity, alloc, i);
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_stack;
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+
+cleanup_stack:
+    if (NULL != stack)
+    {
+        release_retval = allocator_reclaim(alloc, stack);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Push a node onto the walk stack, growing it if needed.
+ */
+static status push_node(
+    libsat_ast_node*** stack, size_t* count, size_t* capacity,
+    allocator* alloc, libsat_ast_node* node)
+{
+    status retval;
+
+    if (*count == *capacity)
+    {
+        size_t new_capacity = (0 == *capacity) ? 16 : 2 * *capacity;
+
+        retval =
+            memory_resize(
+                alloc, (void**)stack, new_capacity * sizeof(**stack));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *capacity = new_capacity;
+    }
+
+    (*stack)[(*count)++] = node;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,582 @@
+/**
+ * \file parser/libsat_ast_print.c
+ *
+ * \brief Print an AST as text that parses back to the same AST.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <ctype.h>
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/* the longest variable name that the parser accepts. */
+#define PRINT_MAX_NAME_LENGTH                                           1023
+
+/**
+ * \brief An entry of the print stack: a node to print, or text to append.
+ */
+typedef struct print_frame
+{
+    const libsat_ast_node* node;
+    const char* text;
+} print_frame;
+
+/**
+ * \brief The state of a print.
+ */
+typedef struct ast_print
+{
+    allocator* alloc;
+    const libsat_context* context;
+    char** text;
+    size_t* capacity;
+    size_t size;
+    print_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+} ast_print;
+
+/* forward decls. */
+static status print_node(ast_print* print, const libsat_ast_node* node);
+static status print_variable(ast_print* print, size_t var_id);
+static status print_weight(ast_print* print, uint64_t weight);
+static int node_operator(const libsat_ast_node* node);
+static const char* operator_text(int token);
+static bool name_scans_as_variable(const char* name);
+static status push_node(ast_print* print, const libsat_ast_node* node);
+static status push_text(ast_print* print, const char* text);
+static status append(ast_print* print, const char* text, size_t length);
+
+/**
+ * \brief Print an AST in the syntax that the parser accepts.
+ *
+ * Operators are written with the same UTF-8 symbols that the scanner reads,
+ * with only the parentheses needed to keep the shape of the AST under the
+ * operator precedence of the parser. Statements end with a semicolon and are
+ * separated by newlines, and soft statements are prefixed with their weight.
+ * Parsing the text of a statement list gives the same statements, weights,
+ * variables, and shape; only the source spans differ.
+ *
+ * The text is written to a buffer that the caller keeps between prints, so
+ * that a print only allocates when the buffer has to grow.
+ *
+ * \param text          Pointer to the buffer, allocated from alloc, or NULL.
+ *                      On success, this holds the zero-terminated text. The
+ *                      caller reclaims the buffer with alloc.
+ * \param capacity      Pointer to the capacity of the buffer, or zero.
+ * \param size          Pointer to receive the length of the text, without its
+ *                      terminating zero, on success.
+ * \param alloc         The allocator for the buffer.
+ * \param context       The context that holds the names of the variables.
+ * \param node          The AST to print.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if a variable has no name, or a name
+ *        that would not be read back as that variable.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_print)(
+    char** text, size_t* capacity, size_t* size, RCPR_SYM(allocator)* alloc,
+    const LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node)
+{
+    status retval, release_retval;
+    ast_print print;
+    print_frame frame;
+
+    memset(&print, 0, sizeof(print));
+    print.alloc = alloc;
+    print.context = context;
+    print.text = text;
+    print.capacity = capacity;
+
+    /* nodes are printed from an explicit stack, so deep ASTs are fine. */
+    retval = push_node(&print, node);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_frames;
+    }
+
+    while (print.frame_count > 0)
+    {
+        frame = print.frames[--print.frame_count];
+
+        if (NULL != frame.text)
+        {
+            retval = append(&print, frame.text, strlen(frame.text));
+        }
+        else
+        {
+            retval = print_node(&print, frame.node);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_frames;
+        }
+    }
+
+    /* terminate the text; this also allocates the buffer for an empty AST. */
+    retval = append(&print, "", 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_frames;
+    }
+
+    /* success. */
+    (*text)[print.size] = 0;
+    *size = print.size;
+    retval = STATUS_SUCCESS;
+
+cleanup_frames:
+    if (NULL != print.frames)
+    {
+        release_retval = allocator_reclaim(alloc, print.frames);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Print the part of a node that comes before its children, and push its
+ * children and the text between them.
+ *
+ * \param print         The print state.
+ * \param node          The node to print.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status print_node(ast_print* print, const libsat_ast_node* node)
+{
+    status retval;
+    const libsat_ast_node* child;
+    int op, child_op;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            /* the head is the last statement, so it is pushed first. */
+            for (child = node->value.list.head; NULL != child;
+                 child = child->next)
+            {
+                retval = push_node(print, child);
+                if (STATUS_SUCCESS == retval && NULL != child->next)
+                {
+                    retval = push_text(print, "\n");
+                }
+
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+            return STATUS_SUCCESS;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            if (0 != node->weight)
+            {
+                retval = print_weight(print, node->weight);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+
+            retval = push_text(print, ";");
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            return push_node(print, node->value.unary);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            return print_variable(print, node->value.variable_index);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+            return
+                node->value.boolean_literal
+                    ? append(print, "true", 4) : append(print, "false", 5);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            retval = append(print, "¬", strlen("¬"));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            /* negation binds tighter than any binary operator. */
+            child = node->value.unary;
+            if (LIBSAT_SCANNER_TOKEN_TYPE_NOP != node_operator(child))
+            {
+                retval = append(print, "(", 1);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = push_text(print, ")");
+                }
+
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+
+            return push_node(print, child);
+
+        default:
+            break;
+    }
+
+    op = node_operator(node);
+    if (LIBSAT_SCANNER_TOKEN_TYPE_NOP == op)
+    {
+        return ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE;
+    }
+
+    /* the right-hand side needs parentheses if the parser would otherwise
+     * end this operation before the right-hand operator. */
+    child = node->value.binary.rhs;
+    child_op = node_operator(child);
+    if (
+        LIBSAT_SCANNER_TOKEN_TYPE_NOP != child_op
+     && should_combine_left(op, child_op))
+    {
+        retval = push_text(print, ")");
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = push_node(print, child);
+        }
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = push_text(print, "(");
+        }
+    }
+    else
+    {
+        retval = push_node(print, child);
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = push_text(print, operator_text(op));
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the left-hand side needs parentheses if the parser would otherwise
+     * fold this operator into it. */
+    child = node->value.binary.lhs;
+    child_op = node_operator(child);
+    if (
+        LIBSAT_SCANNER_TOKEN_TYPE_NOP != child_op
+     && !should_combine_left(child_op, op))
+    {
+        retval = append(print, "(", 1);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = push_text(print, ")");
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return push_node(print, child);
+}
+
+/**
+ * \brief Print the name of a variable.
+ *
+ * \param print         The print state.
+ * \param var_id        The variable to print.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if the variable has no name, or a
+ *        name that would not be read back as this variable.
+ *      - a non-zero error code on failure.
+ */
+static status print_variable(ast_print* print, size_t var_id)
+{
+    status retval;
+    intern_entry* entry;
+    const libsat_context* context = print->context;
+
+    /* the names of a base are not copied to its overlays. */
+    if (NULL != context->base && var_id < context->base_variable_count)
+    {
+        context = context->base;
+    }
+
+    retval =
+        rbtree_find((resource**)&entry, context->intern_to_string, &var_id);
+    if (ERROR_RBTREE_NOT_FOUND == retval)
+    {
+        return ERROR_LIBSAT_PARSER_BAD_VARIABLE;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (!name_scans_as_variable(entry->string))
+    {
+        return ERROR_LIBSAT_PARSER_BAD_VARIABLE;
+    }
+
+    return append(print, entry->string, strlen(entry->string));
+}
+
+/**
+ * \brief Print the weight prefix of a soft statement.
+ *
+ * \param print         The print state.
+ * \param weight        The weight to print.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status print_weight(ast_print* print, uint64_t weight)
+{
+    /* "[" + 20 digits + "] " */
+    char digits[24];
+    size_t offset = sizeof(digits);
+
+    digits[--offset] = ' ';
+    digits[--offset] = ']';
+    do
+    {
+        digits[--offset] = (char)('0' + weight % 10);
+        weight /= 10;
+    } while (weight > 0);
+    digits[--offset] = '[';
+
+    return append(print, digits + offset, sizeof(digits) - offset);
+}
+
+/**
+ * \brief Get the operator token of a binary node.
+ *
+ * \param node          The node to check.
+ *
+ * \returns the operator token of this node, or LIBSAT_SCANNER_TOKEN_TYPE_NOP
+ * if it is not a binary node.
+ */
+static int node_operator(const libsat_ast_node* node)
+{
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            return LIBSAT_SCANNER_TOKEN_TYPE_CONJUNCTION;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            return LIBSAT_SCANNER_TOKEN_TYPE_DISJUNCTION;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+            return LIBSAT_SCANNER_TOKEN_TYPE_EXCLUSIVE_DISJUNCTION;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+            return LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+            return LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+            return LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT;
+
+        default:
+            return LIBSAT_SCANNER_TOKEN_TYPE_NOP;
+    }
+}
+
+/**
+ * \brief Get the text of a binary operator token, with the spaces around it.
+ *
+ * \param token         The operator token.
+ *
+ * \returns the text of this operator.
+ */
+static const char* operator_text(int token)
+{
+    switch (token)
+    {
+        case LIBSAT_SCANNER_TOKEN_TYPE_CONJUNCTION:
+            return " ∧ ";
+
+        case LIBSAT_SCANNER_TOKEN_TYPE_DISJUNCTION:
+            return " ∨ ";
+
+        case LIBSAT_SCANNER_TOKEN_TYPE_EXCLUSIVE_DISJUNCTION:
+            return " ⊻ ";
+
+        case LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION:
+            return " → ";
+
+        case LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL:
+            return " ↔ ";
+
+        default:
+            return " := ";
+    }
+}
+
+/**
+ * \brief Returns true if the scanner reads this name as a single variable.
+ *
+ * \param name          The name to check.
+ *
+ * \returns true if this name is read back as a variable, and false otherwise.
+ */
+static bool name_scans_as_variable(const char* name)
+{
+    size_t length;
+
+    if (!isalpha((unsigned char)name[0]) && '_' != name[0])
+    {
+        return false;
+    }
+
+    for (length = 1; 0 != name[length]; ++length)
+    {
+        if (!isalnum((unsigned char)name[length]) && '_' != name[length])
+        {
+            return false;
+        }
+    }
+
+    return
+        length <= PRINT_MAX_NAME_LENGTH
+     && 0 != strcmp(name, "true") && 0 != strcmp(name, "false");
+}
+
+/**
+ * \brief Push a node to print onto the stack.
+ *
+ * \param print         The print state.
+ * \param node          The node to push.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status push_node(ast_print* print, const libsat_ast_node* node)
+{
+    status retval;
+
+    if (print->frame_count == print->frame_capacity)
+    {
+        size_t capacity =
+            (0 == print->frame_capacity) ? 64 : 2 * print->frame_capacity;
+
+        retval =
+            memory_resize(
+                print->alloc, (void**)&print->frames,
+                capacity * sizeof(print_frame));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        print->frame_capacity = capacity;
+    }
+
+    print->frames[print->frame_count].node = node;
+    print->frames[print->frame_count].text = NULL;
+    ++print->frame_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push text to append onto the stack.
+ *
+ * \param print         The print state.
+ * \param text          The text to push.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status push_text(ast_print* print, const char* text)
+{
+    status retval;
+
+    retval = push_node(print, NULL);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    print->frames[print->frame_count - 1].text = text;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Append text to the buffer, growing it as needed and leaving room for
+ * the terminating zero.
+ *
+ * \param print         The print state.
+ * \param text          The text to append.
+ * \param length        The length of the text.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status append(ast_print* print, const char* text, size_t length)
+{
+    status retval;
+
+    if (print->size + length + 1 > *print->capacity)
+    {
+        size_t capacity = (0 == *print->capacity) ? 256 : *print->capacity;
+        while (capacity < print->size + length + 1)
+        {
+            capacity *= 2;
+        }
+
+        retval = memory_resize(print->alloc, (void**)print->text, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *print->capacity = capacity;
+    }
+
+    memcpy(*print->text + print->size, text, length);
+    print->size += length;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,268 @@
+/**
+ * \file parser/libsat_ast_simulate.c
+ *
+ * \brief Cluster ASTs into candidate equivalence classes by random simulation.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A node, keyed by a hash of its signature.
+ */
+typedef struct simulate_record simulate_record;
+struct simulate_record
+{
+    uint64_t hash;
+    size_t index;
+};
+
+/* forward decls. */
+static uint64_t next_random(uint64_t* state);
+static int compare_records(const void* lhs, const void* rhs);
+
+/**
+ * \brief Cluster ASTs into candidate equivalence classes by random
+ * simulation.
+ *
+ * Each AST is evaluated under the same width * 64 random assignments, and its
+ * values form its signature. ASTs with different signatures differ under some
+ * assignment, so they cannot be equivalent; only ASTs that share a class need
+ * to be checked with the solver. Each variable is simulated as width words, so
+ * every operator works on a short run of words that vectorizes well.
+ *
+ * \param classes       Array of count entries to receive, for each AST, the
+ *                      lowest index of an AST with the same signature.
+ * \param negated       Optional array of count entries. If set, ASTs whose
+ *                      signatures are complements share a class, and this
+ *                      receives true for each AST that is a candidate for the
+ *                      negation of the AST that represents its class.
+ * \param nodes         The ASTs to cluster.
+ * \param count         The number of ASTs to cluster.
+ * \param variable_count The number of variables that the ASTs may refer to.
+ * \param width         The number of 64-bit words of assignments to simulate
+ *                      at once; 4 gives 256 assignments.
+ * \param seed          The seed of the random assignments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_WIDTH if width is zero.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if an AST refers to a variable at or
+ *        beyond variable_count.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_simulate)(
+    size_t* classes, bool* negated,
+    const LIBSAT_SYM(libsat_ast_node)* const* nodes, size_t count,
+    size_t variable_count, size_t width, uint64_t seed)
+{
+    status retval, release_retval;
+    allocator* alloc;
+    uint64_t* patterns = NULL;
+    uint64_t* signatures = NULL;
+    simulate_record* records = NULL;
+    uint64_t random = (0 == seed) ? 1 : seed;
+    uint64_t* signature;
+    size_t begin, end;
+
+    if (0 == width)
+    {
+        retval = ERROR_LIBSAT_PARSER_BAD_WIDTH;
+        goto done;
+    }
+
+    if (0 == count)
+    {
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+
+    alloc = nodes[0]->alloc;
+
+    /* every variable gets its own run of random words. */
+    if (variable_count > 0)
+    {
+        retval =
+            allocator_allocate(
+                alloc, (void**)&patterns,
+                variable_count * width * sizeof(*patterns));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* warm the generator up, since nearby seeds start out alike. */
+    for (int i = 0; i < 4; ++i)
+    {
+        (void)next_random(&random);
+    }
+
+    for (size_t i = 0; i < variable_count * width; ++i)
+    {
+        patterns[i] = next_random(&random);
+    }
+
+    retval =
+        allocator_allocate(
+            alloc, (void**)&signatures, count * width * sizeof(*signatures));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_patterns;
+    }
+
+    retval =
+        allocator_allocate(alloc, (void**)&records, count * sizeof(*records));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_signatures;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        signature = signatures + i * width;
+
+        retval =
+            libsat_ast_node_evaluate_words(
+                signature, nodes[i], patterns, variable_count, width, false);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_records;
+        }
+
+        /* up to complement, a signature is kept with its first bit clear. */
+        if (NULL != negated)
+        {
+            negated[i] = (signature[0] & 1);
+            for (size_t w = 0; w < width; ++w)
+            {
+                signature[w] ^= -(uint64_t)negated[i];
+            }
+        }
+
+        records[i].hash = 0;
+        for (size_t w = 0; w < width; ++w)
+        {
+            records[i].hash =
+                (records[i].hash ^ signature[w]) * 0x9e3779b97f4a7c15ULL;
+        }
+
+        records[i].index = i;
+    }
+
+    /* equal signatures hash alike, so they end up next to each other. */
+    qsort(records, count, sizeof(*records), &compare_records);
+
+    for (begin = 0; begin < count; begin = end)
+    {
+        end = begin;
+        while (end < count && records[end].hash == records[begin].hash)
+        {
+            size_t index = records[end].index;
+
+            /* join the first earlier class in this run with this signature. */
+            classes[index] = index;
+            for (size_t j = begin; j < end; ++j)
+            {
+                size_t other = records[j].index;
+
+                if (
+                    classes[other] == other
+                 && 0
+                        == memcmp(
+                            signatures + other * width,
+                            signatures + index * width,
+                            width * sizeof(*signatures)))
+                {
+                    classes[index] = other;
+                    break;
+                }
+            }
+
+            ++end;
+        }
+    }
+
+    /* make each polarity relative to the representative of its class, which
+     * has a lower index, and so is visited after the members it leads. */
+    if (NULL != negated)
+    {
+        for (size_t i = count; i-- > 0;)
+        {
+            negated[i] ^= negated[classes[i]];
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+
+cleanup_records:
+    release_retval = allocator_reclaim(alloc, records);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_signatures:
+    release_retval = allocator_reclaim(alloc, signatures);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_patterns:
+    if (NULL != patterns)
+    {
+        release_retval = allocator_reclaim(alloc, patterns);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Step a xorshift64* generator.
+ */
+static uint64_t next_random(uint64_t* state)
+{
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+
+    return x * 0x2545f4914f6cdd1dULL;
+}
+
+/**
+ * \brief Compare two records for qsort, by hash and then by index.
+ */
+static int compare_records(const void* lhs, const void* rhs)
+{
+    const simulate_record* l = (const simulate_record*)lhs;
+    const simulate_record* r = (const simulate_record*)rhs;
+
+    if (l->hash != r->hash)
+    {
+        return (l->hash < r->hash) ? -1 : 1;
+    }
+
+    return (l->index < r->index) ? -1 : (l->index > r->index);
+}
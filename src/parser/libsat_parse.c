@@ -31,32 +31,52 @@ typedef struct parser_context
     const char* input;
 } parser_context;
 
+static void record_span(
+    libsat_ast_node* statement, parser_context* context,
+    const libsat_scanner_token* first);
 static bool token_is_binary_operator(int token);
 static bool next_operation_binds_tighter(parser_context* context, int token);
 static status parse_statement(libsat_ast_node** node, parser_context* context);
+static status parse_statement_from_token(
+    libsat_ast_node** node, parser_context* context, int token);
+static status parse_soft_statement(
+    libsat_ast_node** node, parser_context* context);
 static status parse_expression(
     libsat_ast_node** node, parser_context* context, int left_operator);
+static status parse_expression_from_token(
+    libsat_ast_node** node, parser_context* context, int token,
+    int left_operator);
 static status parse_operation(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 static status create_variable(libsat_ast_node** node, parser_context* context);
-static status parse_statement_from_variable(
-    libsat_ast_node** node, parser_context* context);
 static status parse_expression_from_variable(
     libsat_ast_node** node, parser_context* context, int left_operator);
-static status parse_statement_from_negation(
-    libsat_ast_node** node, parser_context* context);
+static status parse_expression_from_literal(
+    libsat_ast_node** node, parser_context* context, bool value,
+    int left_operator);
+static status parse_expression_from_group(
+    libsat_ast_node** node, parser_context* context, int left_operator);
 static status parse_expression_from_negation(
     libsat_ast_node** node, parser_context* context, int left_operator);
 static status parse_expression_from_conjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 static status parse_expression_from_disjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 static status parse_expression_from_exclusive_disjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 static status parse_expression_from_implication(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 static status parse_expression_from_biconditional(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs);
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
+static status parse_expression_from_assignment(
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator);
 
 /**
  * \brief Parse an input string.
@@ -178,10 +198,12 @@ static status parse_statement(libsat_ast_node** node, parser_context* context)
 {
     status retval;
     libsat_ast_node* tmp;
+    libsat_scanner_token first;
     int token;
 
     /* read the first token of the statement. */
     token = libsat_scanner_read_token(&context->details, context->scanner);
+    first = context->details;
 
     switch (token)
     {
@@ -190,11 +212,24 @@ static status parse_statement(libsat_ast_node** node, parser_context* context)
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_VARIABLE:
-            retval = parse_statement_from_variable(&tmp, context);
+        case LIBSAT_SCANNER_TOKEN_TYPE_NEGATION:
+        case LIBSAT_SCANNER_TOKEN_TYPE_OPEN_PAREN:
+        case LIBSAT_SCANNER_TOKEN_TYPE_LITERAL_TRUE:
+        case LIBSAT_SCANNER_TOKEN_TYPE_LITERAL_FALSE:
+            retval = parse_statement_from_token(&tmp, context, token);
+            if (STATUS_SUCCESS == retval)
+            {
+                record_span(tmp, context, &first);
+            }
             break;
 
-        case LIBSAT_SCANNER_TOKEN_TYPE_NEGATION:
-            retval = parse_statement_from_negation(&tmp, context);
+        case LIBSAT_SCANNER_TOKEN_TYPE_WEIGHT:
+            retval = parse_soft_statement(&tmp, context);
+            if (STATUS_SUCCESS == retval)
+            {
+                tmp->weight = first.value.u64;
+                record_span(tmp, context, &first);
+            }
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_SEMICOLON:
@@ -221,6 +256,107 @@ done:
     return retval;
 }
 
+/**
+ * \brief Parse the statement that follows the weight of a soft statement.
+ *
+ * \param node              Pointer to the node pointer set to the parsed
+ *                          statement on success.
+ * \param context           The parser context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_soft_statement(
+    libsat_ast_node** node, parser_context* context)
+{
+    int token =
+        libsat_scanner_read_token(&context->details, context->scanner);
+
+    return parse_statement_from_token(node, context, token);
+}
+
+/**
+ * \brief Parse a statement starting with the given token.
+ *
+ * \param node              Pointer to the node pointer set to the parsed
+ *                          statement on success.
+ * \param context           The parser context for this operation.
+ * \param token             The first token of the statement.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_statement_from_token(
+    libsat_ast_node** node, parser_context* context, int token)
+{
+    status retval, release_retval;
+    libsat_ast_node* expr;
+    libsat_ast_node* stmt;
+
+    /* parse an expression from this token. */
+    retval =
+        parse_expression_from_token(
+            &expr, context, token, LIBSAT_SCANNER_TOKEN_TYPE_NOP);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create a statement from this expression. */
+    retval = libsat_ast_node_create_as_statement(&stmt, context->context, expr);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_expr;
+    }
+
+    /* success. */
+    *node = stmt;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_expr:
+    release_retval = resource_release(&expr->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Record the source span of a statement.
+ *
+ * The semicolon that ends the statement is left for the next statement, so it
+ * is only peeked at here.
+ *
+ * \param statement         The parsed statement.
+ * \param context           The parser context for this operation.
+ * \param first             The first token of the statement.
+ */
+static void record_span(
+    libsat_ast_node* statement, parser_context* context,
+    const libsat_scanner_token* first)
+{
+    libsat_scanner_token details;
+    const libsat_scanner_token* last = &context->details;
+
+    if (
+        LIBSAT_SCANNER_TOKEN_TYPE_SEMICOLON
+            == libsat_scanner_peek_token(&details, context->scanner))
+    {
+        last = &details;
+    }
+
+    statement->span.begin_line = first->begin_line;
+    statement->span.begin_col = first->begin_col;
+    statement->span.end_line = last->end_line;
+    statement->span.end_col = last->end_col;
+}
+
 /**
  * \brief Returns true if the token is a binary operator.
  *
@@ -237,6 +373,7 @@ static bool token_is_binary_operator(int token)
         case LIBSAT_SCANNER_TOKEN_TYPE_DISJUNCTION:
         case LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION:
         case LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL:
+        case LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT:
             return true;
 
         default:
@@ -279,63 +416,79 @@ static bool next_operation_binds_tighter(parser_context* context, int token)
 static status parse_expression(
     libsat_ast_node** node, parser_context* context, int left_operator)
 {
-    status retval;
-    libsat_ast_node* tmp;
-    int next_token;
-
     /* read the next token from the scanner. */
-    next_token = libsat_scanner_read_token(&context->details, context->scanner);
+    int token = libsat_scanner_read_token(&context->details, context->scanner);
 
-    switch (next_token)
+    return parse_expression_from_token(node, context, token, left_operator);
+}
+
+/**
+ * \brief Parse an expression starting with the given token.
+ *
+ * \param node              Pointer to the node pointer to hold this expression
+ *                          node on success.
+ * \param context           The parser context for this operation.
+ * \param token             The first token of the expression.
+ * \param left_operator     The left-hand operator for lookahead.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_expression_from_token(
+    libsat_ast_node** node, parser_context* context, int token,
+    int left_operator)
+{
+    switch (token)
     {
         case LIBSAT_SCANNER_TOKEN_TYPE_EOF:
-            retval = ERROR_LIBSAT_PARSER_INCOMPLETE_EXPRESSION;
-            break;
+            return ERROR_LIBSAT_PARSER_INCOMPLETE_EXPRESSION;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_VARIABLE:
-            retval =
-                parse_expression_from_variable(&tmp, context, left_operator);
-            break;
+            return parse_expression_from_variable(node, context, left_operator);
 
         case LIBSAT_SCANNER_TOKEN_TYPE_NEGATION:
-            retval =
-                parse_expression_from_negation(&tmp, context, left_operator);
-            break;
+            return parse_expression_from_negation(node, context, left_operator);
 
-        default:
-            retval = ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN;
-            break;
-    }
+        case LIBSAT_SCANNER_TOKEN_TYPE_OPEN_PAREN:
+            return parse_expression_from_group(node, context, left_operator);
 
-    /* decode response. */
-    if (STATUS_SUCCESS != retval)
-    {
-        goto done;
-    }
+        case LIBSAT_SCANNER_TOKEN_TYPE_LITERAL_TRUE:
+            return
+                parse_expression_from_literal(
+                    node, context, true, left_operator);
 
-    /* success. */
-    *node = tmp;
-    retval = STATUS_SUCCESS;
-    goto done;
+        case LIBSAT_SCANNER_TOKEN_TYPE_LITERAL_FALSE:
+            return
+                parse_expression_from_literal(
+                    node, context, false, left_operator);
 
-done:
-    return retval;
+        default:
+            return ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN;
+    }
 }
 
 /**
- * \brief Parse an optional operation involving the left-hand side.
+ * \brief Parse an operation involving the left-hand side.
+ *
+ * This is only called when the next token is a binary operator that binds
+ * tighter than the left-hand operator. The operation, and any that follow it
+ * and also bind tighter than the left-hand operator, are folded into the
+ * left-hand side.
  *
  * \param node              Pointer to the node pointer to hold this expression
  *                          node on success.
  * \param context           The parser context for this operation.
  * \param lhs               The left-hand side of the operation.
+ * \param left_operator     The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_operation(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval;
     int next_token;
@@ -345,37 +498,46 @@ static status parse_operation(
 
     switch (next_token)
     {
-        case LIBSAT_SCANNER_TOKEN_TYPE_SEMICOLON:
-        case LIBSAT_SCANNER_TOKEN_TYPE_EOF:
-            /* the left-hand side expression ends this scan. */
-            *node = lhs;
-            retval = STATUS_SUCCESS;
-            break;
-
         case LIBSAT_SCANNER_TOKEN_TYPE_CONJUNCTION:
             /* create a conjunction expression. */
-            retval = parse_expression_from_conjunction(node, context, lhs);
+            retval =
+                parse_expression_from_conjunction(
+                    node, context, lhs, left_operator);
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_DISJUNCTION:
             /* create a disjunction expression. */
-            retval = parse_expression_from_disjunction(node, context, lhs);
+            retval =
+                parse_expression_from_disjunction(
+                    node, context, lhs, left_operator);
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_EXCLUSIVE_DISJUNCTION:
             /* create an exclusive disjunction expression. */
             retval =
-                parse_expression_from_exclusive_disjunction(node, context, lhs);
+                parse_expression_from_exclusive_disjunction(
+                    node, context, lhs, left_operator);
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION:
             /* create an implication expression. */
-            retval = parse_expression_from_implication(node, context, lhs);
+            retval =
+                parse_expression_from_implication(
+                    node, context, lhs, left_operator);
             break;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL:
             /* create a biconditional expression. */
-            retval = parse_expression_from_biconditional(node, context, lhs);
+            retval =
+                parse_expression_from_biconditional(
+                    node, context, lhs, left_operator);
+            break;
+
+        case LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT:
+            /* create an assignment expression. */
+            retval =
+                parse_expression_from_assignment(
+                    node, context, lhs, left_operator);
             break;
 
         default:
@@ -431,44 +593,50 @@ done:
 }
 
 /**
- * \brief Parse a statement starting with a variable.
+ * \brief Parse an expression starting with a variable.
  *
+ * \param node              Pointer to the node pointer to store the parsed node
+ *                          on success.
  * \param context           The parser context for this operation.
+ * \param left_operator     The left-hand-side operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static status parse_statement_from_variable(
-    libsat_ast_node** node, parser_context* context)
+static status parse_expression_from_variable(
+    libsat_ast_node** node, parser_context* context, int left_operator)
 {
     status retval, release_retval;
-    libsat_ast_node* expr;
-    libsat_ast_node* stmt;
+    libsat_ast_node* tmp;
 
-    /* parse an expression from this variable. */
-    retval =
-        parse_expression_from_variable(
-            &expr, context, LIBSAT_SCANNER_TOKEN_TYPE_NOP);
+    /* shift this variable. */
+    retval = create_variable(&tmp, context);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* create a statement from this expression. */
-    retval = libsat_ast_node_create_as_statement(&stmt, context->context, expr);
-    if (STATUS_SUCCESS != retval)
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        goto cleanup_expr;
+        /* fold this variable into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
-    *node = stmt;
-    retval = STATUS_SUCCESS;
     goto done;
 
-cleanup_expr:
-    release_retval = resource_release(&expr->hdr);
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
     if (STATUS_SUCCESS != release_retval)
     {
         retval = release_retval;
@@ -479,25 +647,29 @@ done:
 }
 
 /**
- * \brief Parse an expression starting with a variable.
+ * \brief Parse an expression starting with a boolean literal.
  *
  * \param node              Pointer to the node pointer to store the parsed node
  *                          on success.
  * \param context           The parser context for this operation.
- * \param left_operator     The left-hand-side operator for lookahead.
+ * \param value             The value of the scanned literal.
+ * \param left_operator     The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static status parse_expression_from_variable(
-    libsat_ast_node** node, parser_context* context, int left_operator)
+static status parse_expression_from_literal(
+    libsat_ast_node** node, parser_context* context, bool value,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
 
-    /* shift this variable. */
-    retval = create_variable(&tmp, context);
+    /* shift this literal. */
+    retval =
+        libsat_ast_node_create_from_boolean_literal(
+            &tmp, context->context, value);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -506,8 +678,8 @@ static status parse_expression_from_variable(
     /* is the next operator tighter binding than the previous one? */
     if (next_operation_binds_tighter(context, left_operator))
     {
-        /* fold this variable into the next operation. */
-        retval = parse_operation(node, context, tmp);
+        /* fold this literal into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
         if (STATUS_SUCCESS != retval)
         {
             goto cleanup_tmp;
@@ -533,44 +705,62 @@ done:
 }
 
 /**
- * \brief Parse a statement starting with a negation.
+ * \brief Parse an expression starting with an open parenthesis.
  *
+ * The group is parsed as a complete expression up to its close parenthesis,
+ * and then treated like a variable by the operators around it.
+ *
+ * \param node              Pointer to the node pointer to store the parsed node
+ *                          on success.
  * \param context           The parser context for this operation.
+ * \param left_operator     The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
-static status parse_statement_from_negation(
-    libsat_ast_node** node, parser_context* context)
+static status parse_expression_from_group(
+    libsat_ast_node** node, parser_context* context, int left_operator)
 {
     status retval, release_retval;
-    libsat_ast_node* expr;
-    libsat_ast_node* stmt;
+    libsat_ast_node* tmp;
+    int token;
 
-    /* parse an expression from this negation. */
-    retval =
-        parse_expression_from_negation(
-            &expr, context, LIBSAT_SCANNER_TOKEN_TYPE_NOP);
+    /* parse the grouped expression. */
+    retval = parse_expression(&tmp, context, LIBSAT_SCANNER_TOKEN_TYPE_NOP);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
     }
 
-    /* create a statement from this expression. */
-    retval = libsat_ast_node_create_as_statement(&stmt, context->context, expr);
-    if (STATUS_SUCCESS != retval)
+    /* the group must be closed. */
+    token = libsat_scanner_read_token(&context->details, context->scanner);
+    if (LIBSAT_SCANNER_TOKEN_TYPE_CLOSE_PAREN != token)
     {
-        goto cleanup_expr;
+        retval = ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN;
+        goto cleanup_tmp;
+    }
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
+    {
+        /* fold this group into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
-    *node = stmt;
-    retval = STATUS_SUCCESS;
     goto done;
 
-cleanup_expr:
-    release_retval = resource_release(&expr->hdr);
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
     if (STATUS_SUCCESS != release_retval)
     {
         retval = release_retval;
@@ -599,8 +789,10 @@ static status parse_expression_from_negation(
     libsat_ast_node* tmp;
     libsat_ast_node* subexpr;
 
-    /* read the next expression. */
-    retval = parse_expression(&subexpr, context, left_operator);
+    /* read the next expression; negation binds tighter than any operator. */
+    retval =
+        parse_expression(
+            &subexpr, context, LIBSAT_SCANNER_TOKEN_TYPE_NEGATION);
     if (STATUS_SUCCESS != retval)
     {
         goto done;
@@ -614,11 +806,33 @@ static status parse_expression_from_negation(
         goto cleanup_subexpr;
     }
 
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
+    {
+        /* fold this negation into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
+    }
+
     /* success. */
-    *node = tmp;
     retval = STATUS_SUCCESS;
     goto done;
 
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+    goto done;
+
 cleanup_subexpr:
     release_retval = resource_release(&subexpr->hdr);
     if (STATUS_SUCCESS != release_retval)
@@ -638,13 +852,15 @@ done:
  *                      on success.
  * \param context       The context for this operation.
  * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_expression_from_conjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
@@ -658,19 +874,6 @@ static status parse_expression_from_conjunction(
         goto done;
     }
 
-    /* fold this right-hand-side into the more tightly binding operation. */
-    if (
-        next_operation_binds_tighter(
-            context, LIBSAT_SCANNER_TOKEN_TYPE_CONJUNCTION))
-    {
-        /* fold this next expression into this operation. */
-        retval = parse_operation(&rhs, context, rhs);
-        if (STATUS_SUCCESS != retval)
-        {
-            goto cleanup_rhs;
-        }
-    }
-
     /* create the conjunction. */
     retval =
         libsat_ast_node_create_as_conjunction(
@@ -683,13 +886,21 @@ static status parse_expression_from_conjunction(
     /* rhs is now owned by tmp. */
     rhs = NULL;
 
-    /* fold this conjunction into the next operation. */
-    retval = parse_operation(node, context, tmp);
-    if (STATUS_SUCCESS != retval)
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* the caller maintains ownership of lhs. */
-        tmp->value.binary.lhs = NULL;
-        goto cleanup_tmp;
+        /* fold this conjunction into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
@@ -724,13 +935,15 @@ done:
  *                      on success.
  * \param context       The context for this operation.
  * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_expression_from_disjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
@@ -744,19 +957,6 @@ static status parse_expression_from_disjunction(
         goto done;
     }
 
-    /* fold this right-hand-side into the more tightly binding operation. */
-    if (
-        next_operation_binds_tighter(
-            context, LIBSAT_SCANNER_TOKEN_TYPE_DISJUNCTION))
-    {
-        /* fold this next expression into this operation. */
-        retval = parse_operation(&rhs, context, rhs);
-        if (STATUS_SUCCESS != retval)
-        {
-            goto cleanup_rhs;
-        }
-    }
-
     /* create the disjunction. */
     retval =
         libsat_ast_node_create_as_disjunction(
@@ -766,13 +966,24 @@ static status parse_expression_from_disjunction(
         goto cleanup_rhs;
     }
 
-    /* fold this disjunction into the next operation. */
-    retval = parse_operation(node, context, tmp);
-    if (STATUS_SUCCESS != retval)
+    /* rhs is now owned by tmp. */
+    rhs = NULL;
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* the caller maintains ownership of lhs. */
-        tmp->value.binary.lhs = NULL;
-        goto cleanup_tmp;
+        /* fold this disjunction into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
@@ -786,10 +997,13 @@ cleanup_tmp:
     }
 
 cleanup_rhs:
-    release_retval = resource_release(&rhs->hdr);
-    if (STATUS_SUCCESS != release_retval)
+    if (NULL != rhs)
     {
-        retval = release_retval;
+        release_retval = resource_release(&rhs->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
     }
 
 done:
@@ -804,13 +1018,15 @@ done:
  *                      on success.
  * \param context       The context for this operation.
  * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_expression_from_exclusive_disjunction(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
@@ -825,19 +1041,6 @@ static status parse_expression_from_exclusive_disjunction(
         goto done;
     }
 
-    /* fold this right-hand-side into the more tightly binding operation. */
-    if (
-        next_operation_binds_tighter(
-            context, LIBSAT_SCANNER_TOKEN_TYPE_EXCLUSIVE_DISJUNCTION))
-    {
-        /* fold this next expression into this operation. */
-        retval = parse_operation(&rhs, context, rhs);
-        if (STATUS_SUCCESS != retval)
-        {
-            goto cleanup_rhs;
-        }
-    }
-
     /* create the exclusive disjunction. */
     retval =
         libsat_ast_node_create_as_exclusive_disjunction(
@@ -847,13 +1050,24 @@ static status parse_expression_from_exclusive_disjunction(
         goto cleanup_rhs;
     }
 
-    /* fold this exclusive disjunction into the next operation. */
-    retval = parse_operation(node, context, tmp);
-    if (STATUS_SUCCESS != retval)
+    /* rhs is now owned by tmp. */
+    rhs = NULL;
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* the caller maintains ownership of lhs. */
-        tmp->value.binary.lhs = NULL;
-        goto cleanup_tmp;
+        /* fold this exclusive disjunction into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
@@ -867,10 +1081,13 @@ cleanup_tmp:
     }
 
 cleanup_rhs:
-    release_retval = resource_release(&rhs->hdr);
-    if (STATUS_SUCCESS != release_retval)
+    if (NULL != rhs)
     {
-        retval = release_retval;
+        release_retval = resource_release(&rhs->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
     }
 
 done:
@@ -885,13 +1102,15 @@ done:
  *                      on success.
  * \param context       The context for this operation.
  * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_expression_from_implication(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
@@ -905,19 +1124,6 @@ static status parse_expression_from_implication(
         goto done;
     }
 
-    /* fold this right-hand-side into the more tightly binding operation. */
-    if (
-        next_operation_binds_tighter(
-            context, LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION))
-    {
-        /* fold this next expression into this operation. */
-        retval = parse_operation(&rhs, context, rhs);
-        if (STATUS_SUCCESS != retval)
-        {
-            goto cleanup_rhs;
-        }
-    }
-
     /* create the implication. */
     retval =
         libsat_ast_node_create_as_implication(
@@ -927,13 +1133,24 @@ static status parse_expression_from_implication(
         goto cleanup_rhs;
     }
 
-    /* fold this implication into the next operation. */
-    retval = parse_operation(node, context, tmp);
-    if (STATUS_SUCCESS != retval)
+    /* rhs is now owned by tmp. */
+    rhs = NULL;
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* the caller maintains ownership of lhs. */
-        tmp->value.binary.lhs = NULL;
-        goto cleanup_tmp;
+        /* fold this implication into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
@@ -947,10 +1164,13 @@ cleanup_tmp:
     }
 
 cleanup_rhs:
-    release_retval = resource_release(&rhs->hdr);
-    if (STATUS_SUCCESS != release_retval)
+    if (NULL != rhs)
     {
-        retval = release_retval;
+        release_retval = resource_release(&rhs->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
     }
 
 done:
@@ -965,13 +1185,15 @@ done:
  *                      on success.
  * \param context       The context for this operation.
  * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
  *
  * \returns a status code indicating success or failure.
  *      - STATUS_SUCCESS on success.
  *      - a non-zero error code on failure.
  */
 static status parse_expression_from_biconditional(
-    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs)
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
 {
     status retval, release_retval;
     libsat_ast_node* tmp;
@@ -986,35 +1208,117 @@ static status parse_expression_from_biconditional(
         goto done;
     }
 
-    /* fold this right-hand-side into the more tightly binding operation. */
-    if (
-        next_operation_binds_tighter(
-            context, LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL))
+    /* create the biconditional. */
+    retval =
+        libsat_ast_node_create_as_biconditional(
+            &tmp, context->context, lhs, rhs);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_rhs;
+    }
+
+    /* rhs is now owned by tmp. */
+    rhs = NULL;
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* fold this next expression into this operation. */
-        retval = parse_operation(&rhs, context, rhs);
+        /* fold this biconditional into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
         if (STATUS_SUCCESS != retval)
         {
-            goto cleanup_rhs;
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
         }
     }
+    else
+    {
+        *node = tmp;
+    }
 
-    /* create the biconditional. */
+    /* success. */
+    goto done;
+
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_rhs:
+    if (NULL != rhs)
+    {
+        release_retval = resource_release(&rhs->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Attempt to parse an expression from an assignment operator and a
+ * left-hand-side expression.
+ *
+ * \param node          Pointer to the node pointer to receive this expression
+ *                      on success.
+ * \param context       The context for this operation.
+ * \param lhs           The left-hand-side expression for this operation.
+ * \param left_operator The left-hand operator for lookahead.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_expression_from_assignment(
+    libsat_ast_node** node, parser_context* context, libsat_ast_node* lhs,
+    int left_operator)
+{
+    status retval, release_retval;
+    libsat_ast_node* tmp;
+    libsat_ast_node* rhs;
+
+    /* parse the next expression. */
     retval =
-        libsat_ast_node_create_as_biconditional(
+        parse_expression(
+            &rhs, context, LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* create the assignment; the left-hand side must be a variable. */
+    retval =
+        libsat_ast_node_create_as_assignment(
             &tmp, context->context, lhs, rhs);
     if (STATUS_SUCCESS != retval)
     {
         goto cleanup_rhs;
     }
 
-    /* fold this biconditional into the next operation. */
-    retval = parse_operation(node, context, tmp);
-    if (STATUS_SUCCESS != retval)
+    /* rhs is now owned by tmp. */
+    rhs = NULL;
+
+    /* is the next operator tighter binding than the previous one? */
+    if (next_operation_binds_tighter(context, left_operator))
     {
-        /* the caller maintains ownership of lhs. */
-        tmp->value.binary.lhs = NULL;
-        goto cleanup_tmp;
+        /* fold this assignment into the next operation. */
+        retval = parse_operation(node, context, tmp, left_operator);
+        if (STATUS_SUCCESS != retval)
+        {
+            /* the caller maintains ownership of lhs. */
+            tmp->value.binary.lhs = NULL;
+            goto cleanup_tmp;
+        }
+    }
+    else
+    {
+        *node = tmp;
     }
 
     /* success. */
@@ -1028,10 +1332,13 @@ cleanup_tmp:
     }
 
 cleanup_rhs:
-    release_retval = resource_release(&rhs->hdr);
-    if (STATUS_SUCCESS != release_retval)
+    if (NULL != rhs)
     {
-        retval = release_retval;
+        release_retval = resource_release(&rhs->hdr);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
     }
 
 done:
@@ -0,0 +1,576 @@
+/**
+ * \file parser/libsat_parse_parallel.c
+ *
+ * \brief Parse an input string in chunks on several threads.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/parser.h>
+#include <libsat/status.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "parser_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_parser_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief The number of chunks to split the input into for each thread, so
+ * that threads which finish early can take more work.
+ */
+#define PARSE_CHUNKS_PER_THREAD                                             4
+
+/**
+ * \brief The smallest chunk worth handing to a thread, in bytes.
+ */
+#define PARSE_MIN_CHUNK_SIZE                                             4096
+
+/**
+ * \brief A chunk of the input, ending just after a statement.
+ */
+typedef struct parse_chunk parse_chunk;
+struct parse_chunk
+{
+    const char* begin;
+    size_t size;
+    size_t line;
+    size_t col;
+    libsat_context* overlay;
+    libsat_ast_node* list;
+    status retval;
+};
+
+/**
+ * \brief State shared by all of the threads of a parallel parse.
+ */
+typedef struct parse_pool parse_pool;
+struct parse_pool
+{
+    allocator* alloc;
+    libsat_context* context;
+    bool overlays;
+    parse_chunk* chunks;
+    size_t chunk_count;
+    pthread_t* threads;
+    size_t started;
+    atomic_size_t next;
+    atomic_bool failed;
+};
+
+/* forward decls. */
+static status parse_pool_init(
+    parse_pool* pool, libsat_context* context, const char* input,
+    size_t length, size_t chunk_count);
+static status parse_pool_merge(
+    libsat_ast_node** node, parse_pool* pool);
+static status parse_pool_cleanup(parse_pool* pool, status retval);
+static status parse_chunk_run(parse_pool* pool, parse_chunk* chunk);
+static void parse_run(parse_pool* pool);
+static void advance_position(
+    size_t* line, size_t* col, const char* begin, const char* end);
+static void shift_spans(parse_chunk* chunk);
+static void* parse_thread(void* arg);
+
+/**
+ * \brief Parse an input string in chunks on several threads.
+ *
+ * The input is split after a semicolon into chunks of similar size, which are
+ * parsed concurrently. If the context is not frozen, it is frozen for the
+ * duration of the parse, each chunk is parsed against its own overlay of the
+ * context, and the overlays are merged in input order; otherwise, every chunk
+ * is parsed against the frozen context directly. Either way, the resulting
+ * statement list and variable ids are the same as those of
+ * \ref libsat_parse.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param node          The AST node created on success.
+ * \param context       The context for this operation.
+ * \param input         The input string to parse.
+ * \param thread_count  The number of threads to parse with. With one thread
+ *                      or fewer, a short input, or an overlay context, this
+ *                      is the same as \ref libsat_parse.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_parse_parallel)(
+    LIBSAT_SYM(libsat_ast_node)** node, LIBSAT_SYM(libsat_context)* context,
+    const char* input, size_t thread_count)
+{
+    status retval;
+    parse_pool pool;
+    size_t length = strlen(input);
+    size_t chunk_count = thread_count * PARSE_CHUNKS_PER_THREAD;
+
+    if (chunk_count > length / PARSE_MIN_CHUNK_SIZE)
+    {
+        chunk_count = length / PARSE_MIN_CHUNK_SIZE;
+    }
+
+    if (thread_count <= 1 || chunk_count <= 1 || NULL != context->base)
+    {
+        return libsat_parse(node, context, input);
+    }
+
+    retval = parse_pool_init(&pool, context, input, length, chunk_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    /* start the other threads; this thread parses too. */
+    if (thread_count > pool.chunk_count)
+    {
+        thread_count = pool.chunk_count;
+    }
+
+    for (size_t i = 1; i < thread_count; ++i)
+    {
+        if (
+            0 != pthread_create(
+                    &pool.threads[pool.started], NULL, &parse_thread, &pool))
+        {
+            atomic_store(&pool.failed, true);
+            retval = ERROR_LIBSAT_PARSER_THREAD_CREATE;
+            break;
+        }
+
+        pool.started += 1;
+    }
+
+    parse_run(&pool);
+
+    for (size_t i = 0; i < pool.started; ++i)
+    {
+        pthread_join(pool.threads[i], NULL);
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_pool;
+    }
+
+    retval = parse_pool_merge(node, &pool);
+
+cleanup_pool:
+    return parse_pool_cleanup(&pool, retval);
+}
+
+/**
+ * \brief Split the input into chunks, and allocate the threads to parse them.
+ *
+ * On failure, whatever was created is left for \ref parse_pool_cleanup.
+ *
+ * \param pool          The pool to initialize.
+ * \param context       The context for this operation.
+ * \param input         The input string to parse.
+ * \param length        The length of the input string.
+ * \param chunk_count   The largest number of chunks to split the input into.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_pool_init(
+    parse_pool* pool, libsat_context* context, const char* input,
+    size_t length, size_t chunk_count)
+{
+    status retval;
+    const char* cursor = input;
+    const char* end = input + length;
+    size_t target_size = (length + chunk_count - 1) / chunk_count;
+    size_t line = 1;
+    size_t col = 1;
+
+    memset(pool, 0, sizeof(*pool));
+    pool->alloc = context->alloc;
+    pool->context = context;
+    atomic_init(&pool->next, 0);
+    atomic_init(&pool->failed, false);
+
+    /* allocate the chunks and threads. */
+    retval =
+        allocator_allocate(
+            pool->alloc, (void**)&pool->chunks,
+            chunk_count * sizeof(*pool->chunks));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(pool->chunks, 0, chunk_count * sizeof(*pool->chunks));
+
+    retval =
+        allocator_allocate(
+            pool->alloc, (void**)&pool->threads,
+            chunk_count * sizeof(*pool->threads));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* every chunk but the last ends just after the first semicolon past its
+     * target size, so no statement is split. */
+    while (cursor < end)
+    {
+        parse_chunk* chunk = &pool->chunks[pool->chunk_count++];
+        const char* stop = end;
+
+        if (target_size < (size_t)(end - cursor))
+        {
+            stop =
+                memchr(
+                    cursor + target_size, ';', end - cursor - target_size);
+            stop = (NULL == stop) ? end : stop + 1;
+        }
+
+        chunk->begin = cursor;
+        chunk->size = stop - cursor;
+        chunk->line = line;
+        chunk->col = col;
+        chunk->retval = STATUS_SUCCESS;
+        advance_position(&line, &col, cursor, stop);
+        cursor = stop;
+    }
+
+    /* new names go to overlays, unless the context is already frozen. */
+    if (!context->frozen)
+    {
+        pool->overlays = true;
+        libsat_context_freeze(context);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Merge the parsed chunks, in input order, into a single statement
+ * list.
+ *
+ * \param node          The AST node created on success.
+ * \param pool          The pool for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_pool_merge(
+    libsat_ast_node** node, parse_pool* pool)
+{
+    status retval;
+    libsat_ast_node* list;
+    libsat_ast_node* head;
+    libsat_ast_node* tail;
+    bool empty = true;
+
+    /* report the first failure in input order. */
+    for (size_t i = 0; i < pool->chunk_count; ++i)
+    {
+        if (STATUS_SUCCESS != pool->chunks[i].retval)
+        {
+            return pool->chunks[i].retval;
+        }
+
+        if (NULL != pool->chunks[i].list)
+        {
+            empty = false;
+        }
+    }
+
+    if (empty)
+    {
+        return ERROR_LIBSAT_PARSER_EMPTY_INPUT;
+    }
+
+    /* number the new names as a sequential parse would have. */
+    if (pool->overlays)
+    {
+        for (size_t i = 0; i < pool->chunk_count; ++i)
+        {
+            retval =
+                libsat_context_overlay_merge(
+                    pool->context, pool->chunks[i].overlay);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            if (NULL == pool->chunks[i].list)
+            {
+                continue;
+            }
+
+            retval =
+                libsat_ast_node_rebase(
+                    pool->chunks[i].list, pool->chunks[i].overlay);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    retval = libsat_ast_node_create_as_list(&list, pool->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* statements are pushed onto the head of a list, so the statements of
+     * later chunks come first. */
+    for (size_t i = 0; i < pool->chunk_count; ++i)
+    {
+        if (NULL == pool->chunks[i].list)
+        {
+            continue;
+        }
+
+        head = pool->chunks[i].list->value.list.head;
+        tail = head;
+        while (NULL != tail->next)
+        {
+            tail = tail->next;
+        }
+
+        tail->next = list->value.list.head;
+        list->value.list.head = head;
+        pool->chunks[i].list->value.list.head = NULL;
+    }
+
+    /* success. */
+    *node = list;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the chunks and overlays of a pool, and thaw the context if
+ * the parse froze it.
+ *
+ * \param pool          The pool to clean up.
+ * \param retval        The status of the parse so far.
+ *
+ * \returns the status of the parse, or the first error from cleaning up.
+ */
+static status parse_pool_cleanup(parse_pool* pool, status retval)
+{
+    status release_retval;
+
+    for (size_t i = 0; NULL != pool->chunks && i < pool->chunk_count; ++i)
+    {
+        if (NULL != pool->chunks[i].list)
+        {
+            release_retval = resource_release(&pool->chunks[i].list->hdr);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        if (NULL != pool->chunks[i].overlay)
+        {
+            release_retval =
+                resource_release(
+                    libsat_context_resource_handle(pool->chunks[i].overlay));
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    if (NULL != pool->chunks)
+    {
+        release_retval = allocator_reclaim(pool->alloc, pool->chunks);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != pool->threads)
+    {
+        release_retval = allocator_reclaim(pool->alloc, pool->threads);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (pool->overlays)
+    {
+        release_retval = libsat_context_thaw(pool->context);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Parse a single chunk.
+ *
+ * \param pool          The pool for this operation.
+ * \param chunk         The chunk to parse.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status parse_chunk_run(parse_pool* pool, parse_chunk* chunk)
+{
+    status retval, release_retval;
+    libsat_context* context = pool->context;
+    char* text;
+
+    /* the scanner reads up to a terminating zero. */
+    retval = allocator_allocate(pool->alloc, (void**)&text, chunk->size + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    memcpy(text, chunk->begin, chunk->size);
+    text[chunk->size] = 0;
+
+    if (pool->overlays)
+    {
+        retval = libsat_context_overlay_create(&chunk->overlay, context);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_text;
+        }
+
+        context = chunk->overlay;
+    }
+
+    /* a chunk with no statements contributes nothing. */
+    retval = libsat_parse(&chunk->list, context, text);
+    if (ERROR_LIBSAT_PARSER_EMPTY_INPUT == retval)
+    {
+        chunk->list = NULL;
+        retval = STATUS_SUCCESS;
+    }
+    else if (STATUS_SUCCESS == retval)
+    {
+        shift_spans(chunk);
+    }
+
+cleanup_text:
+    release_retval = allocator_reclaim(pool->alloc, text);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Parse chunks until none are left, or until a chunk fails.
+ *
+ * Chunks are taken in input order, so every chunk before one that fails has
+ * already been taken when the others stop.
+ */
+static void parse_run(parse_pool* pool)
+{
+    size_t index;
+
+    while (!atomic_load(&pool->failed))
+    {
+        index = atomic_fetch_add(&pool->next, 1);
+        if (index >= pool->chunk_count)
+        {
+            break;
+        }
+
+        pool->chunks[index].retval =
+            parse_chunk_run(pool, &pool->chunks[index]);
+        if (STATUS_SUCCESS != pool->chunks[index].retval)
+        {
+            atomic_store(&pool->failed, true);
+        }
+    }
+}
+
+/**
+ * \brief Entry point for a parser thread.
+ */
+static void* parse_thread(void* arg)
+{
+    parse_run((parse_pool*)arg);
+
+    return NULL;
+}
+
+/**
+ * \brief Advance a line and column over a stretch of input, in the same way
+ * as the scanner.
+ *
+ * \param line          The line to advance.
+ * \param col           The column to advance.
+ * \param begin         The start of the input to pass over.
+ * \param end           The end of the input to pass over.
+ */
+static void advance_position(
+    size_t* line, size_t* col, const char* begin, const char* end)
+{
+    for (const char* i = begin; i < end; ++i)
+    {
+        if ('\n' == *i)
+        {
+            *line += 1;
+            *col = 1;
+        }
+        else if (0 == (*i & 0x80))
+        {
+            *col += 1;
+        }
+    }
+}
+
+/**
+ * \brief Move the spans of the statements of a chunk from the start of the
+ * chunk to its place in the whole input.
+ *
+ * \param chunk         The parsed chunk.
+ */
+static void shift_spans(parse_chunk* chunk)
+{
+    for (
+        libsat_ast_node* statement = chunk->list->value.list.head;
+        NULL != statement; statement = statement->next)
+    {
+        libsat_source_span* span = &statement->span;
+
+        if (1 == span->begin_line)
+        {
+            span->begin_col += chunk->col - 1;
+        }
+
+        if (1 == span->end_line)
+        {
+            span->end_col += chunk->col - 1;
+        }
+
+        span->begin_line += chunk->line - 1;
+        span->end_line += chunk->line - 1;
+    }
+}
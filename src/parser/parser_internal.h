@@ -29,6 +29,7 @@ enum LIBSAT_SYM(libsat_operator_priority)
     LIBSAT_OPERATOR_PRIORITY_DISJUNCITON                                = 4,
     LIBSAT_OPERATOR_PRIORITY_IMPLICATION                                = 5,
     LIBSAT_OPERATOR_PRIORITY_BICONDITIONAL                              = 6,
+    LIBSAT_OPERATOR_PRIORITY_ASSIGNMENT                                 = 7,
 };
 
 /**
@@ -297,6 +298,32 @@ LIBSAT_SYM(libsat_ast_list_node_push)(
  */
 bool LIBSAT_SYM(should_combine_left)(int left, int right);
 
+/**
+ * \brief Evaluate an AST over width * 64 assignments at once.
+ *
+ * \param result        Pointer to receive the width words for this AST on
+ *                      success; bit i is the value of the AST under
+ *                      assignment i.
+ * \param node          The AST to evaluate.
+ * \param words         The assignment words.
+ * \param variable_count The number of variables covered by the words.
+ * \param width         The number of words per variable.
+ * \param packed        If true, bit v % 64 of words[v / 64] is the value of
+ *                      variable v in every assignment. If false, the width
+ *                      words starting at words[v * width] hold variable v
+ *                      across all assignments.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_BAD_VARIABLE if a variable is not covered by the
+ *        words.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_ast_node_evaluate_words)(
+    uint64_t* result, const LIBSAT_SYM(libsat_ast_node)* node,
+    const uint64_t* words, size_t variable_count, size_t width, bool packed);
+
 /******************************************************************************/
 /* Start of private exports.                                                  */
 /******************************************************************************/
@@ -378,6 +405,12 @@ bool LIBSAT_SYM(should_combine_left)(int left, int right);
             return LIBSAT_SYM(libsat_ast_list_node_push)(x,y); } \
     static inline bool sym ## should_combine_left(int x, int y) { \
         return LIBSAT_SYM(should_combine_left)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_ast_node_evaluate_words( \
+        uint64_t* u, const LIBSAT_SYM(libsat_ast_node)* v, \
+        const uint64_t* w, size_t x, size_t y, bool z) { \
+            return \
+                LIBSAT_SYM(libsat_ast_node_evaluate_words)(u,v,w,x,y,z); } \
     LIBSAT_END_EXPORT \
     REQUIRE_SEMICOLON_HERE
 #define LIBSAT_IMPORT_parser_internal_as(sym) \
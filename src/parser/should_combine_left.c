@@ -63,6 +63,7 @@ static int get_associativity(int token)
     {
         case LIBSAT_SCANNER_TOKEN_TYPE_NEGATION:
         case LIBSAT_SCANNER_TOKEN_TYPE_IMPLICATION:
+        case LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT:
             return LIBSAT_ASSOC_RIGHT;
 
         case LIBSAT_SCANNER_TOKEN_TYPE_CONJUNCTION:
@@ -106,6 +107,9 @@ static int get_priority(int token)
         case LIBSAT_SCANNER_TOKEN_TYPE_BICONDITIONAL:
             return LIBSAT_OPERATOR_PRIORITY_BICONDITIONAL;
 
+        case LIBSAT_SCANNER_TOKEN_TYPE_ASSIGNMENT:
+            return LIBSAT_OPERATOR_PRIORITY_ASSIGNMENT;
+
         default:
             /* TODO - this should trigger an assertion failure. */
             return 100;
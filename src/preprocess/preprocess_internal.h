@@ -0,0 +1,431 @@
+/**
+ * \file preprocess/preprocess_internal.h
+ *
+ * \brief Internal details for the clause database preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/cnf.h>
+#include <libsat/literal.h>
+#include <rcpr/allocator.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Resolvents longer than this are not added, so a variable that would
+ * need one is not eliminated.
+ */
+#define PREPROCESS_RESOLVENT_LIMIT                                         20
+
+/**
+ * \brief Subsumption only checks clauses in occurrence lists up to this long.
+ */
+#define PREPROCESS_OCCURRENCE_LIMIT                                      1000
+
+/**
+ * \brief A clause in the preprocessor. Its literals live in the arena,
+ * starting at start, sorted and without duplicates. The signature has bit
+ * (var_id & 63) set for every variable in the clause.
+ */
+typedef struct LIBSAT_SYM(preprocessor_clause)
+    LIBSAT_SYM(preprocessor_clause);
+struct LIBSAT_SYM(preprocessor_clause)
+{
+    size_t start;
+    size_t size;
+    uint64_t signature;
+    bool deleted;
+    bool queued;
+};
+
+/**
+ * \brief The clauses in which a single literal occurs.
+ */
+typedef struct LIBSAT_SYM(preprocessor_occurrences)
+    LIBSAT_SYM(preprocessor_occurrences);
+struct LIBSAT_SYM(preprocessor_occurrences)
+{
+    size_t* items;
+    size_t count;
+    size_t capacity;
+};
+
+/**
+ * \brief A preprocessor for the clauses of a \ref libsat_cnf.
+ *
+ * The clauses of the database are loaded into a form that is cheap to change,
+ * simplified, and written back. Per-variable arrays hold var_count entries,
+ * and per-literal arrays hold twice that. Units are assigned in values and
+ * kept in order in units; those past unit_head have not been propagated yet.
+ *
+ * A variable that is found equivalent to a literal of another variable maps to
+ * that literal in substitute; every other variable maps to itself.
+ *
+ * The clauses removed by eliminating a variable are staged on the elimination
+ * stack, stored back to back like the clauses of a database, and only pushed
+ * to the database once every other change is written back.
+ */
+typedef struct LIBSAT_SYM(preprocessor) LIBSAT_SYM(preprocessor);
+struct LIBSAT_SYM(preprocessor)
+{
+    RCPR_SYM(allocator)* alloc;
+    LIBSAT_SYM(libsat_cnf)* cnf;
+    size_t var_count;
+    const uint8_t* frozen;
+
+    /* clauses. */
+    LIBSAT_SYM(libsat_literal)* arena;
+    size_t arena_count;
+    size_t arena_capacity;
+    LIBSAT_SYM(preprocessor_clause)* clauses;
+    size_t clause_count;
+    size_t clause_capacity;
+    LIBSAT_SYM(preprocessor_occurrences)* occurs;
+
+    /* assignments. */
+    uint8_t* values;
+    LIBSAT_SYM(libsat_literal)* units;
+    size_t unit_count;
+    size_t unit_head;
+    bool inconsistent;
+
+    /* clauses that may subsume or strengthen others. */
+    size_t* queue;
+    size_t queue_count;
+    size_t queue_capacity;
+
+    /* scratch space. */
+    uint8_t* marks;
+    uint8_t* eliminated;
+    LIBSAT_SYM(libsat_literal)* substitute;
+    LIBSAT_SYM(libsat_literal)* resolvent;
+    size_t* candidates;
+    size_t candidate_capacity;
+
+    /* elimination stack. */
+    LIBSAT_SYM(libsat_literal)* stack_lits;
+    size_t stack_lit_count;
+    size_t stack_lit_capacity;
+    size_t* stack_end;
+    LIBSAT_SYM(libsat_literal)* stack_pivot;
+    size_t stack_count;
+    size_t stack_capacity;
+};
+
+/******************************************************************************/
+/* Start of inline helpers.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the value of a literal.
+ */
+static inline uint8_t preprocessor_lit_value(
+    const LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal) lit)
+{
+    uint8_t value = pre->values[LIBSAT_LITERAL_VARIABLE(lit)];
+
+    if (LIBSAT_VALUE_UNASSIGNED == value || !LIBSAT_LITERAL_IS_NEGATED(lit))
+    {
+        return value;
+    }
+
+    return
+        (LIBSAT_VALUE_TRUE == value) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+}
+
+/**
+ * \brief Get the literals of a clause.
+ */
+static inline LIBSAT_SYM(libsat_literal)* preprocessor_clause_lits(
+    const LIBSAT_SYM(preprocessor)* pre, size_t clause)
+{
+    return pre->arena + pre->clauses[clause].start;
+}
+
+/**
+ * \brief Get the number of clauses in which a variable occurs.
+ */
+static inline size_t preprocessor_occurrence_count(
+    const LIBSAT_SYM(preprocessor)* pre, size_t var_id)
+{
+    return
+        pre->occurs[LIBSAT_LITERAL_MAKE(var_id, false)].count
+      + pre->occurs[LIBSAT_LITERAL_MAKE(var_id, true)].count;
+}
+
+/**
+ * \brief Make a literal true, and queue it to be propagated.
+ */
+static inline void preprocessor_assign(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal) lit)
+{
+    switch (preprocessor_lit_value(pre, lit))
+    {
+        case LIBSAT_VALUE_TRUE:
+            return;
+
+        case LIBSAT_VALUE_FALSE:
+            pre->inconsistent = true;
+            return;
+
+        default:
+            pre->values[LIBSAT_LITERAL_VARIABLE(lit)] =
+                LIBSAT_LITERAL_IS_NEGATED(lit)
+                    ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+            pre->units[pre->unit_count++] = lit;
+            return;
+    }
+}
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Load the clauses of a database into a preprocessor.
+ *
+ * Literals are sorted and duplicates dropped, tautologies are skipped, and
+ * unit clauses are assigned.
+ *
+ * \param pre           The preprocessor to initialize.
+ * \param cnf           The database to preprocess.
+ * \param var_count     The number of variables.
+ * \param frozen        One flag per variable; variables that are used outside
+ *                      of the clauses of the database are set, and are never
+ *                      eliminated.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_init)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_cnf)* cnf,
+    size_t var_count, const uint8_t* frozen);
+
+/**
+ * \brief Reclaim the memory held by a preprocessor, leaving it empty.
+ *
+ * \param pre           The preprocessor to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_dispose)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/**
+ * \brief Add a clause, and queue it for subsumption.
+ *
+ * The literals must be distinct, and must not hold a literal and its negation.
+ * An empty clause makes the preprocessor inconsistent, and a unit clause is
+ * assigned instead. The literals may already sit at the end of the arena, as
+ * long as it has room for them.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param lits          The literals of this clause. These are sorted.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_clause_add)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal)* lits,
+    size_t count);
+
+/**
+ * \brief Delete a clause, and drop it from its occurrence lists.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The clause to delete.
+ */
+void
+LIBSAT_SYM(preprocessor_clause_remove)(
+    LIBSAT_SYM(preprocessor)* pre, size_t clause);
+
+/**
+ * \brief Remove a literal from a clause, and queue it for subsumption.
+ *
+ * A clause left with one literal is assigned and deleted.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The clause to strengthen.
+ * \param lit           The literal to remove.
+ */
+void
+LIBSAT_SYM(preprocessor_clause_strengthen)(
+    LIBSAT_SYM(preprocessor)* pre, size_t clause,
+    LIBSAT_SYM(libsat_literal) lit);
+
+/**
+ * \brief Propagate the queued units, deleting satisfied clauses and removing
+ * false literals.
+ *
+ * \param pre           The preprocessor for this operation.
+ */
+void
+LIBSAT_SYM(preprocessor_propagate)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/**
+ * \brief Stage a clause on the elimination stack.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param pivot         The literal of the eliminated variable in this clause.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_stack_push)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal) pivot,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count);
+
+/**
+ * \brief Replace each set of equivalent literals with a single literal.
+ *
+ * Equivalences are the strongly connected components of the implication graph
+ * of the binary clauses. Every other variable of a component is substituted
+ * by its representative in all clauses, and eliminated with the two binary
+ * clauses that define it. A component that holds a literal and its negation
+ * makes the preprocessor inconsistent.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_substitute)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/**
+ * \brief Run backward subsumption and self-subsuming resolution over the
+ * queued clauses until the queue is empty.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_subsume)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/**
+ * \brief Eliminate every variable whose clauses can be replaced by no more
+ * resolvents than there are clauses.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_eliminate)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/**
+ * \brief Write the simplified clauses and the elimination stack back to the
+ * database.
+ *
+ * If the preprocessor is inconsistent, the database is left as it is, so that
+ * the solver finds the conflict on its own.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_emit)(
+    LIBSAT_SYM(preprocessor)* pre);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_preprocess_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(preprocessor) sym ## preprocessor; \
+    typedef LIBSAT_SYM(preprocessor_clause) sym ## preprocessor_clause; \
+    typedef LIBSAT_SYM(preprocessor_occurrences) \
+        sym ## preprocessor_occurrences; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_init( \
+        LIBSAT_SYM(preprocessor)* w, LIBSAT_SYM(libsat_cnf)* x, size_t y, \
+        const uint8_t* z) { \
+            return LIBSAT_SYM(preprocessor_init)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_dispose( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            return LIBSAT_SYM(preprocessor_dispose)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_clause_add( \
+        LIBSAT_SYM(preprocessor)* x, LIBSAT_SYM(libsat_literal)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(preprocessor_clause_add)(x,y,z); } \
+    static inline void \
+    sym ## preprocessor_clause_remove( \
+        LIBSAT_SYM(preprocessor)* x, size_t y) { \
+            LIBSAT_SYM(preprocessor_clause_remove)(x,y); } \
+    static inline void \
+    sym ## preprocessor_clause_strengthen( \
+        LIBSAT_SYM(preprocessor)* x, size_t y, \
+        LIBSAT_SYM(libsat_literal) z) { \
+            LIBSAT_SYM(preprocessor_clause_strengthen)(x,y,z); } \
+    static inline void \
+    sym ## preprocessor_propagate( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            LIBSAT_SYM(preprocessor_propagate)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_stack_push( \
+        LIBSAT_SYM(preprocessor)* w, LIBSAT_SYM(libsat_literal) x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(preprocessor_stack_push)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_substitute( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            return LIBSAT_SYM(preprocessor_substitute)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_subsume( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            return LIBSAT_SYM(preprocessor_subsume)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_eliminate( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            return LIBSAT_SYM(preprocessor_eliminate)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## preprocessor_emit( \
+        LIBSAT_SYM(preprocessor)* x) { \
+            return LIBSAT_SYM(preprocessor_emit)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_preprocess_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_preprocess_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_preprocess_internal \
+    __INTERNAL_LIBSAT_IMPORT_preprocess_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
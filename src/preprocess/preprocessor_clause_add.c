@@ -0,0 +1,192 @@
+/**
+ * \file preprocess/preprocessor_clause_add.c
+ *
+ * \brief Add a clause to a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/* forward decls. */
+static status occurrence_add(
+    preprocessor* pre, libsat_literal lit, size_t clause);
+static int literal_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Add a clause, and queue it for subsumption.
+ *
+ * The literals must be distinct, and must not hold a literal and its negation.
+ * An empty clause makes the preprocessor inconsistent, and a unit clause is
+ * assigned instead. The literals may already sit at the end of the arena, as
+ * long as it has room for them.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param lits          The literals of this clause. These are sorted.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_clause_add)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal)* lits,
+    size_t count)
+{
+    status retval;
+    preprocessor_clause* clause;
+    size_t index = pre->clause_count;
+
+    if (0 == count)
+    {
+        pre->inconsistent = true;
+        return STATUS_SUCCESS;
+    }
+
+    if (1 == count)
+    {
+        preprocessor_assign(pre, lits[0]);
+        return STATUS_SUCCESS;
+    }
+
+    qsort(lits, count, sizeof(*lits), &literal_compare);
+
+    /* grow the arena if needed. */
+    if (pre->arena_count + count > pre->arena_capacity)
+    {
+        size_t capacity =
+            (0 == pre->arena_capacity) ? 256 : 2 * pre->arena_capacity;
+        while (capacity < pre->arena_count + count)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->arena,
+                capacity * sizeof(*pre->arena));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->arena_capacity = capacity;
+    }
+
+    /* grow the clause index and the queue if needed. */
+    if (pre->clause_count == pre->clause_capacity)
+    {
+        size_t capacity =
+            (0 == pre->clause_capacity) ? 64 : 2 * pre->clause_capacity;
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->clauses,
+                capacity * sizeof(*pre->clauses));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->queue,
+                capacity * sizeof(*pre->queue));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->clause_capacity = capacity;
+        pre->queue_capacity = capacity;
+    }
+
+    /* store the clause. */
+    clause = pre->clauses + index;
+    memmove(pre->arena + pre->arena_count, lits, count * sizeof(*lits));
+    clause->start = pre->arena_count;
+    clause->size = count;
+    clause->signature = 0;
+    clause->deleted = false;
+    clause->queued = true;
+    pre->arena_count += count;
+    pre->clause_count += 1;
+    pre->queue[pre->queue_count++] = index;
+
+    /* index its literals. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        libsat_literal lit = pre->arena[clause->start + i];
+
+        clause->signature |=
+            (uint64_t)1 << (LIBSAT_LITERAL_VARIABLE(lit) & 63);
+
+        retval = occurrence_add(pre, lit, index);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Add a clause to the occurrence list of a literal.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param lit           The literal.
+ * \param clause        The clause in which it occurs.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status occurrence_add(
+    preprocessor* pre, libsat_literal lit, size_t clause)
+{
+    status retval;
+    preprocessor_occurrences* list = pre->occurs + lit;
+
+    if (list->count == list->capacity)
+    {
+        size_t capacity = (0 == list->capacity) ? 4 : 2 * list->capacity;
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&list->items,
+                capacity * sizeof(*list->items));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        list->capacity = capacity;
+    }
+
+    list->items[list->count++] = clause;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order literals by value.
+ */
+static int literal_compare(const void* lhs, const void* rhs)
+{
+    libsat_literal l = *(const libsat_literal*)lhs;
+    libsat_literal r = *(const libsat_literal*)rhs;
+
+    return (l > r) - (l < r);
+}
@@ -0,0 +1,64 @@
+/**
+ * \file preprocess/preprocessor_clause_remove.c
+ *
+ * \brief Delete a clause from a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/* forward decls. */
+static void occurrence_remove(
+    preprocessor* pre, libsat_literal lit, size_t clause);
+
+/**
+ * \brief Delete a clause, and drop it from its occurrence lists.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The clause to delete.
+ */
+void
+LIBSAT_SYM(preprocessor_clause_remove)(
+    LIBSAT_SYM(preprocessor)* pre, size_t clause)
+{
+    const libsat_literal* lits = preprocessor_clause_lits(pre, clause);
+
+    if (pre->clauses[clause].deleted)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < pre->clauses[clause].size; ++i)
+    {
+        occurrence_remove(pre, lits[i], clause);
+    }
+
+    pre->clauses[clause].deleted = true;
+}
+
+/**
+ * \brief Drop a clause from the occurrence list of a literal.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param lit           The literal.
+ * \param clause        The clause to drop.
+ */
+static void occurrence_remove(
+    preprocessor* pre, libsat_literal lit, size_t clause)
+{
+    preprocessor_occurrences* list = pre->occurs + lit;
+
+    for (size_t i = 0; i < list->count; ++i)
+    {
+        if (list->items[i] == clause)
+        {
+            list->items[i] = list->items[--list->count];
+            return;
+        }
+    }
+}
@@ -0,0 +1,72 @@
+/**
+ * \file preprocess/preprocessor_clause_strengthen.c
+ *
+ * \brief Remove a literal from a clause in a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/**
+ * \brief Remove a literal from a clause, and queue it for subsumption.
+ *
+ * A clause left with one literal is assigned and deleted.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The clause to strengthen.
+ * \param lit           The literal to remove.
+ */
+void
+LIBSAT_SYM(preprocessor_clause_strengthen)(
+    LIBSAT_SYM(preprocessor)* pre, size_t clause,
+    LIBSAT_SYM(libsat_literal) lit)
+{
+    preprocessor_clause* entry = pre->clauses + clause;
+    libsat_literal* lits = preprocessor_clause_lits(pre, clause);
+    preprocessor_occurrences* list = pre->occurs + lit;
+    size_t kept = 0;
+
+    /* drop the clause from the occurrences of the literal. */
+    for (size_t i = 0; i < list->count; ++i)
+    {
+        if (list->items[i] == clause)
+        {
+            list->items[i] = list->items[--list->count];
+            break;
+        }
+    }
+
+    /* remove the literal, keeping the others in order. */
+    entry->signature = 0;
+    for (size_t i = 0; i < entry->size; ++i)
+    {
+        if (lits[i] != lit)
+        {
+            lits[kept++] = lits[i];
+            entry->signature |=
+                (uint64_t)1 << (LIBSAT_LITERAL_VARIABLE(lits[i]) & 63);
+        }
+    }
+
+    entry->size = kept;
+
+    /* a unit is a fact. */
+    if (1 == kept)
+    {
+        preprocessor_assign(pre, lits[0]);
+        preprocessor_clause_remove(pre, clause);
+        return;
+    }
+
+    /* a shorter clause may subsume more. */
+    if (!entry->queued)
+    {
+        entry->queued = true;
+        pre->queue[pre->queue_count++] = clause;
+    }
+}
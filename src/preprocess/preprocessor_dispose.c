@@ -0,0 +1,92 @@
+/**
+ * \file preprocess/preprocessor_dispose.c
+ *
+ * \brief Reclaim the memory held by a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_preprocess_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Reclaim the memory held by a preprocessor, leaving it empty.
+ *
+ * \param pre           The preprocessor to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_dispose)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    status retval = STATUS_SUCCESS;
+    allocator* alloc = pre->alloc;
+    size_t slots = (0 == pre->var_count) ? 1 : pre->var_count;
+
+    /* reclaim the occurrence lists. */
+    if (NULL != pre->occurs)
+    {
+        for (size_t i = 0; i < 2 * slots; ++i)
+        {
+            retval = reclaim_if_set(alloc, pre->occurs[i].items, retval);
+        }
+    }
+
+    /* reclaim arrays. */
+    retval = reclaim_if_set(alloc, pre->occurs, retval);
+    retval = reclaim_if_set(alloc, pre->arena, retval);
+    retval = reclaim_if_set(alloc, pre->clauses, retval);
+    retval = reclaim_if_set(alloc, pre->values, retval);
+    retval = reclaim_if_set(alloc, pre->units, retval);
+    retval = reclaim_if_set(alloc, pre->queue, retval);
+    retval = reclaim_if_set(alloc, pre->marks, retval);
+    retval = reclaim_if_set(alloc, pre->eliminated, retval);
+    retval = reclaim_if_set(alloc, pre->substitute, retval);
+    retval = reclaim_if_set(alloc, pre->resolvent, retval);
+    retval = reclaim_if_set(alloc, pre->candidates, retval);
+    retval = reclaim_if_set(alloc, pre->stack_lits, retval);
+    retval = reclaim_if_set(alloc, pre->stack_end, retval);
+    retval = reclaim_if_set(alloc, pre->stack_pivot, retval);
+
+    memset(pre, 0, sizeof(*pre));
+
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
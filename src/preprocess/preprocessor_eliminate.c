@@ -0,0 +1,361 @@
+/**
+ * \file preprocess/preprocessor_eliminate.c
+ *
+ * \brief Bounded variable elimination for a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "../base/libsat_base_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief The outcome of resolving two clauses.
+ */
+enum resolve_result
+{
+    RESOLVE_OK,
+    RESOLVE_TAUTOLOGY,
+    RESOLVE_TOO_LONG,
+};
+
+/**
+ * \brief A variable to try, with the number of resolvents it could make.
+ */
+typedef struct elimination_candidate elimination_candidate;
+struct elimination_candidate
+{
+    size_t cost;
+    size_t var_id;
+};
+
+/* forward decls. */
+static bool is_candidate(const preprocessor* pre, size_t var_id);
+static int candidate_compare(const void* lhs, const void* rhs);
+static bool can_eliminate(preprocessor* pre, size_t var_id);
+static status eliminate(preprocessor* pre, size_t var_id);
+static int resolve(
+    size_t* size, preprocessor* pre, size_t pos, size_t neg, size_t var_id);
+
+/**
+ * \brief Eliminate every variable whose clauses can be replaced by no more
+ * resolvents than there are clauses.
+ *
+ * Variables are tried cheapest first, by the number of pairs of clauses to
+ * resolve. A variable is eliminated if none of its non-tautological
+ * resolvents is longer than PREPROCESS_RESOLVENT_LIMIT, and there are no more
+ * of them than clauses it occurs in; its clauses are then replaced by its
+ * resolvents, which are checked for subsumption before the next variable is
+ * tried. A pure variable has no resolvents, so it is always eliminated.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_eliminate)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    status retval, release_retval;
+    elimination_candidate* order = NULL;
+    size_t count = 0;
+
+    preprocessor_propagate(pre);
+    if (pre->inconsistent || 0 == pre->var_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        allocator_allocate(
+            pre->alloc, (void**)&order, pre->var_count * sizeof(*order));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* order the candidates by cost. */
+    for (size_t i = 0; i < pre->var_count; ++i)
+    {
+        if (is_candidate(pre, i))
+        {
+            order[count].cost =
+                pre->occurs[LIBSAT_LITERAL_MAKE(i, false)].count
+              * pre->occurs[LIBSAT_LITERAL_MAKE(i, true)].count;
+            order[count].var_id = i;
+            count += 1;
+        }
+    }
+
+    qsort(order, count, sizeof(*order), &candidate_compare);
+
+    /* try each one in turn. */
+    for (size_t i = 0; i < count && !pre->inconsistent; ++i)
+    {
+        size_t var_id = order[i].var_id;
+
+        if (!is_candidate(pre, var_id) || !can_eliminate(pre, var_id))
+        {
+            continue;
+        }
+
+        retval = eliminate(pre, var_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_order;
+        }
+
+        retval = preprocessor_subsume(pre);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_order;
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_order;
+
+cleanup_order:
+    release_retval = allocator_reclaim(pre->alloc, order);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Return true if a variable may be eliminated.
+ */
+static bool is_candidate(const preprocessor* pre, size_t var_id)
+{
+    return
+        !pre->frozen[var_id]
+     && !pre->eliminated[var_id]
+     && LIBSAT_VALUE_UNASSIGNED == pre->values[var_id]
+     && preprocessor_occurrence_count(pre, var_id) > 0;
+}
+
+/**
+ * \brief Order candidates by cost, then by variable id.
+ */
+static int candidate_compare(const void* lhs, const void* rhs)
+{
+    const elimination_candidate* l = (const elimination_candidate*)lhs;
+    const elimination_candidate* r = (const elimination_candidate*)rhs;
+
+    if (l->cost != r->cost)
+    {
+        return (l->cost > r->cost) - (l->cost < r->cost);
+    }
+
+    return (l->var_id > r->var_id) - (l->var_id < r->var_id);
+}
+
+/**
+ * \brief Return true if eliminating a variable keeps the database as small.
+ */
+static bool can_eliminate(preprocessor* pre, size_t var_id)
+{
+    const preprocessor_occurrences* pos =
+        pre->occurs + LIBSAT_LITERAL_MAKE(var_id, false);
+    const preprocessor_occurrences* neg =
+        pre->occurs + LIBSAT_LITERAL_MAKE(var_id, true);
+    size_t limit = pos->count + neg->count, resolvents = 0, size;
+
+    for (size_t i = 0; i < pos->count; ++i)
+    {
+        for (size_t j = 0; j < neg->count; ++j)
+        {
+            switch (
+                resolve(&size, pre, pos->items[i], neg->items[j], var_id))
+            {
+                case RESOLVE_TAUTOLOGY:
+                    break;
+
+                case RESOLVE_TOO_LONG:
+                    return false;
+
+                default:
+                    if (++resolvents > limit)
+                    {
+                        return false;
+                    }
+                    break;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Replace the clauses of a variable with its resolvents, staging the
+ * clauses on the elimination stack.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param var_id        The variable to eliminate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status eliminate(preprocessor* pre, size_t var_id)
+{
+    status retval;
+    libsat_literal pos_lit = LIBSAT_LITERAL_MAKE(var_id, false);
+    libsat_literal neg_lit = LIBSAT_LITERAL_MAKE(var_id, true);
+    const preprocessor_occurrences* pos = pre->occurs + pos_lit;
+    const preprocessor_occurrences* neg = pre->occurs + neg_lit;
+    size_t size;
+
+    /* keep the clauses for model reconstruction. */
+    for (size_t i = 0; i < pos->count; ++i)
+    {
+        retval =
+            preprocessor_stack_push(
+                pre, pos_lit, preprocessor_clause_lits(pre, pos->items[i]),
+                pre->clauses[pos->items[i]].size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    for (size_t i = 0; i < neg->count; ++i)
+    {
+        retval =
+            preprocessor_stack_push(
+                pre, neg_lit, preprocessor_clause_lits(pre, neg->items[i]),
+                pre->clauses[neg->items[i]].size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* add the resolvents. None mentions the variable, so the lists of its
+     * occurrences stay as they are. */
+    for (size_t i = 0; i < pos->count; ++i)
+    {
+        for (size_t j = 0; j < neg->count; ++j)
+        {
+            if (
+                RESOLVE_OK
+                    == resolve(&size, pre, pos->items[i], neg->items[j], var_id))
+            {
+                retval = preprocessor_clause_add(pre, pre->resolvent, size);
+                if (STATUS_SUCCESS != retval)
+                {
+                    return retval;
+                }
+            }
+        }
+    }
+
+    /* drop the clauses of the variable. */
+    while (pos->count > 0)
+    {
+        preprocessor_clause_remove(pre, pos->items[0]);
+    }
+
+    while (neg->count > 0)
+    {
+        preprocessor_clause_remove(pre, neg->items[0]);
+    }
+
+    pre->eliminated[var_id] = 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Resolve two clauses on a variable into the resolvent buffer.
+ *
+ * \param size          Pointer to receive the size of the resolvent.
+ * \param pre           The preprocessor for this operation.
+ * \param pos           The clause holding the variable.
+ * \param neg           The clause holding its negation.
+ * \param var_id        The variable to resolve on.
+ *
+ * \returns a \ref resolve_result.
+ */
+static int resolve(
+    size_t* size, preprocessor* pre, size_t pos, size_t neg, size_t var_id)
+{
+    const libsat_literal* lits = preprocessor_clause_lits(pre, pos);
+    const libsat_literal* others = preprocessor_clause_lits(pre, neg);
+    size_t count = 0;
+    int result = RESOLVE_OK;
+
+    for (size_t i = 0; i < pre->clauses[pos].size; ++i)
+    {
+        if (LIBSAT_LITERAL_VARIABLE(lits[i]) != var_id)
+        {
+            pre->marks[lits[i]] = 1;
+            count += 1;
+        }
+    }
+
+    if (count > PREPROCESS_RESOLVENT_LIMIT)
+    {
+        result = RESOLVE_TOO_LONG;
+        goto clear_marks;
+    }
+
+    /* copy the first clause, then add what the second one brings. */
+    count = 0;
+    for (size_t i = 0; i < pre->clauses[pos].size; ++i)
+    {
+        if (LIBSAT_LITERAL_VARIABLE(lits[i]) != var_id)
+        {
+            pre->resolvent[count++] = lits[i];
+        }
+    }
+
+    for (size_t i = 0; i < pre->clauses[neg].size; ++i)
+    {
+        if (
+            LIBSAT_LITERAL_VARIABLE(others[i]) == var_id
+         || pre->marks[others[i]])
+        {
+            continue;
+        }
+
+        if (pre->marks[LIBSAT_LITERAL_NEGATE(others[i])])
+        {
+            result = RESOLVE_TAUTOLOGY;
+            goto clear_marks;
+        }
+
+        if (PREPROCESS_RESOLVENT_LIMIT == count)
+        {
+            result = RESOLVE_TOO_LONG;
+            goto clear_marks;
+        }
+
+        pre->resolvent[count++] = others[i];
+    }
+
+    *size = count;
+
+clear_marks:
+    for (size_t i = 0; i < pre->clauses[pos].size; ++i)
+    {
+        pre->marks[lits[i]] = 0;
+    }
+
+    return result;
+}
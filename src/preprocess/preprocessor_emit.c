@@ -0,0 +1,94 @@
+/**
+ * \file preprocess/preprocessor_emit.c
+ *
+ * \brief Write the clauses of a \ref preprocessor back to its database.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "../cnf/cnf_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/**
+ * \brief Write the simplified clauses and the elimination stack back to the
+ * database.
+ *
+ * The clauses of the database are replaced by the clauses that remain,
+ * followed by one unit clause per assigned variable. Native constraints are
+ * kept as they are. If the preprocessor is inconsistent, the database is left
+ * as it is, so that the solver finds the conflict on its own.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_emit)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    status retval;
+    libsat_cnf* cnf = pre->cnf;
+    size_t begin = 0;
+
+    if (pre->inconsistent)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    cnf_truncate(cnf, 0, libsat_cnf_native_count(cnf));
+
+    /* the clauses that remain. */
+    for (size_t i = 0; i < pre->clause_count; ++i)
+    {
+        if (pre->clauses[i].deleted)
+        {
+            continue;
+        }
+
+        retval =
+            libsat_cnf_add_clause(
+                cnf, preprocessor_clause_lits(pre, i), pre->clauses[i].size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the facts. */
+    for (size_t i = 0; i < pre->unit_count; ++i)
+    {
+        retval = libsat_cnf_add_clause(cnf, pre->units + i, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the clauses of the eliminated variables. */
+    for (size_t i = 0; i < pre->stack_count; ++i)
+    {
+        retval =
+            cnf_eliminate_push(
+                cnf, pre->stack_pivot[i], pre->stack_lits + begin,
+                pre->stack_end[i] - begin);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        begin = pre->stack_end[i];
+    }
+
+    /* no clause left mentions an eliminated variable. */
+    cnf->checked_clauses = libsat_cnf_clause_count(cnf);
+
+    return STATUS_SUCCESS;
+}
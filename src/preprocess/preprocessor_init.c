@@ -0,0 +1,242 @@
+/**
+ * \file preprocess/preprocessor_init.c
+ *
+ * \brief Load the clauses of a \ref libsat_cnf into a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "../cnf/cnf_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status allocate_zeroed(allocator* alloc, void** memory, size_t size);
+static int literal_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Load the clauses of a database into a preprocessor.
+ *
+ * Literals are sorted and duplicates dropped, tautologies are skipped, and
+ * unit clauses are assigned.
+ *
+ * \param pre           The preprocessor to initialize.
+ * \param cnf           The database to preprocess.
+ * \param var_count     The number of variables.
+ * \param frozen        One flag per variable; variables that are used outside
+ *                      of the clauses of the database are set, and are never
+ *                      eliminated.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_init)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_cnf)* cnf,
+    size_t var_count, const uint8_t* frozen)
+{
+    status retval;
+    size_t clause_count = libsat_cnf_clause_count(cnf);
+    size_t slots = (0 == var_count) ? 1 : var_count;
+
+    memset(pre, 0, sizeof(*pre));
+    pre->alloc = cnf->alloc;
+    pre->cnf = cnf;
+    pre->var_count = var_count;
+    pre->frozen = frozen;
+
+    /* per-variable and per-literal arrays. */
+    retval =
+        allocate_zeroed(
+            pre->alloc, (void**)&pre->occurs, 2 * slots * sizeof(*pre->occurs));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = allocate_zeroed(pre->alloc, (void**)&pre->values, slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = allocate_zeroed(pre->alloc, (void**)&pre->eliminated, slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        memory_resize(
+            pre->alloc, (void**)&pre->substitute,
+            slots * sizeof(*pre->substitute));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < slots; ++i)
+    {
+        pre->substitute[i] = LIBSAT_LITERAL_MAKE(i, false);
+    }
+
+    retval = allocate_zeroed(pre->alloc, (void**)&pre->marks, 2 * slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            pre->alloc, (void**)&pre->units, slots * sizeof(*pre->units));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        allocate_zeroed(
+            pre->alloc, (void**)&pre->resolvent,
+            PREPROCESS_RESOLVENT_LIMIT * sizeof(*pre->resolvent));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* load the clauses. */
+    for (size_t i = 0; i < clause_count && !pre->inconsistent; ++i)
+    {
+        const libsat_literal* lits;
+        libsat_literal* clause;
+        size_t size, kept = 0;
+        bool satisfied = false;
+
+        retval = libsat_cnf_clause_get(&lits, &size, cnf, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* the clause is built at the end of the arena, then added in place. */
+        if (pre->arena_count + size > pre->arena_capacity)
+        {
+            size_t capacity =
+                (0 == pre->arena_capacity) ? 256 : 2 * pre->arena_capacity;
+            while (capacity < pre->arena_count + size)
+            {
+                capacity *= 2;
+            }
+
+            retval =
+                memory_resize(
+                    pre->alloc, (void**)&pre->arena,
+                    capacity * sizeof(*pre->arena));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            pre->arena_capacity = capacity;
+        }
+
+        clause = pre->arena + pre->arena_count;
+        if (size > 0)
+        {
+            memcpy(clause, lits, size * sizeof(*lits));
+            qsort(clause, size, sizeof(*clause), &literal_compare);
+        }
+
+        /* drop duplicates and false literals; skip tautologies. */
+        for (size_t j = 0; j < size && !satisfied; ++j)
+        {
+            if (kept > 0 && clause[kept - 1] == clause[j])
+            {
+                continue;
+            }
+
+            if (
+                kept > 0
+             && clause[kept - 1] == LIBSAT_LITERAL_NEGATE(clause[j]))
+            {
+                satisfied = true;
+                continue;
+            }
+
+            switch (preprocessor_lit_value(pre, clause[j]))
+            {
+                case LIBSAT_VALUE_TRUE:
+                    satisfied = true;
+                    break;
+
+                case LIBSAT_VALUE_FALSE:
+                    break;
+
+                default:
+                    clause[kept++] = clause[j];
+                    break;
+            }
+        }
+
+        if (satisfied)
+        {
+            continue;
+        }
+
+        retval = preprocessor_clause_add(pre, clause, kept);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Allocate a block of memory and clear it.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        Pointer to the memory pointer to set on success.
+ * \param size          The size of the block.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status allocate_zeroed(allocator* alloc, void** memory, size_t size)
+{
+    status retval;
+
+    retval = memory_resize(alloc, memory, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(*memory, 0, size);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order literals by value.
+ */
+static int literal_compare(const void* lhs, const void* rhs)
+{
+    libsat_literal l = *(const libsat_literal*)lhs;
+    libsat_literal r = *(const libsat_literal*)rhs;
+
+    return (l > r) - (l < r);
+}
@@ -0,0 +1,45 @@
+/**
+ * \file preprocess/preprocessor_propagate.c
+ *
+ * \brief Propagate the units of a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/**
+ * \brief Propagate the queued units, deleting satisfied clauses and removing
+ * false literals.
+ *
+ * \param pre           The preprocessor for this operation.
+ */
+void
+LIBSAT_SYM(preprocessor_propagate)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    while (!pre->inconsistent && pre->unit_head < pre->unit_count)
+    {
+        libsat_literal lit = pre->units[pre->unit_head++];
+        preprocessor_occurrences* satisfied = pre->occurs + lit;
+        preprocessor_occurrences* falsified =
+            pre->occurs + LIBSAT_LITERAL_NEGATE(lit);
+
+        /* each removal drops the clause from this list. */
+        while (satisfied->count > 0)
+        {
+            preprocessor_clause_remove(pre, satisfied->items[0]);
+        }
+
+        /* as does each strengthening. */
+        while (falsified->count > 0 && !pre->inconsistent)
+        {
+            preprocessor_clause_strengthen(
+                pre, falsified->items[0], LIBSAT_LITERAL_NEGATE(lit));
+        }
+    }
+}
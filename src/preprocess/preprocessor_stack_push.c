@@ -0,0 +1,95 @@
+/**
+ * \file preprocess/preprocessor_stack_push.c
+ *
+ * \brief Stage a clause on the elimination stack of a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/**
+ * \brief Stage a clause on the elimination stack.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param pivot         The literal of the eliminated variable in this clause.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_stack_push)(
+    LIBSAT_SYM(preprocessor)* pre, LIBSAT_SYM(libsat_literal) pivot,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count)
+{
+    status retval;
+
+    /* grow the literal storage if needed. */
+    if (pre->stack_lit_count + count > pre->stack_lit_capacity)
+    {
+        size_t capacity =
+            (0 == pre->stack_lit_capacity) ? 256 : 2 * pre->stack_lit_capacity;
+        while (capacity < pre->stack_lit_count + count)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->stack_lits,
+                capacity * sizeof(*pre->stack_lits));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->stack_lit_capacity = capacity;
+    }
+
+    /* grow the clause index if needed. */
+    if (pre->stack_count == pre->stack_capacity)
+    {
+        size_t capacity =
+            (0 == pre->stack_capacity) ? 64 : 2 * pre->stack_capacity;
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->stack_end,
+                capacity * sizeof(*pre->stack_end));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->stack_pivot,
+                capacity * sizeof(*pre->stack_pivot));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->stack_capacity = capacity;
+    }
+
+    memcpy(
+        pre->stack_lits + pre->stack_lit_count, lits,
+        count * sizeof(*pre->stack_lits));
+    pre->stack_lit_count += count;
+    pre->stack_end[pre->stack_count] = pre->stack_lit_count;
+    pre->stack_pivot[pre->stack_count] = pivot;
+    pre->stack_count += 1;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,546 @@
+/**
+ * \file preprocess/preprocessor_substitute.c
+ *
+ * \brief Equivalent literal substitution for a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A literal that has not been visited yet.
+ */
+#define NOT_VISITED                                              ((size_t)-1)
+
+/**
+ * \brief A literal being visited, with the next occurrence to follow.
+ */
+typedef struct scc_frame scc_frame;
+struct scc_frame
+{
+    libsat_literal lit;
+    size_t next;
+};
+
+/**
+ * \brief Scratch space for finding strongly connected components.
+ */
+typedef struct scc_search scc_search;
+struct scc_search
+{
+    size_t* index;
+    size_t* low;
+    libsat_literal* stack;
+    size_t stack_count;
+    scc_frame* frames;
+    size_t frame_count;
+    size_t counter;
+};
+
+/* forward decls. */
+static void search_from(
+    scc_search* search, preprocessor* pre, libsat_literal root);
+static bool successor(
+    libsat_literal* next, const preprocessor* pre, scc_frame* frame);
+static void visit(scc_search* search, libsat_literal lit);
+static void component(
+    scc_search* search, preprocessor* pre, libsat_literal root);
+static status rewrite(preprocessor* pre, bool* changed);
+static status stage(preprocessor* pre);
+static int literal_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Replace each set of equivalent literals with a single literal.
+ *
+ * Equivalences are the strongly connected components of the implication graph
+ * of the binary clauses, found with Tarjan's algorithm over an explicit stack.
+ * The representative of a component is its smallest frozen variable, or its
+ * smallest variable if none is frozen; the dual component of the negated
+ * literals then picks the same variable, so it adds nothing new. Every other
+ * variable of a component is substituted by its representative in all
+ * clauses, and eliminated with the two binary clauses that define it. A
+ * component that holds a literal and its negation makes the preprocessor
+ * inconsistent.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_substitute)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    status retval, release_retval;
+    scc_search search;
+    size_t lit_count = 2 * pre->var_count;
+    bool changed = false;
+
+    /* the graph only holds binary clauses over unassigned variables. */
+    preprocessor_propagate(pre);
+    if (pre->inconsistent || 0 == lit_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    memset(&search, 0, sizeof(search));
+
+    retval =
+        allocator_allocate(
+            pre->alloc, (void**)&search.index,
+            lit_count * sizeof(*search.index));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            pre->alloc, (void**)&search.low, lit_count * sizeof(*search.low));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_index;
+    }
+
+    retval =
+        allocator_allocate(
+            pre->alloc, (void**)&search.stack,
+            lit_count * sizeof(*search.stack));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_low;
+    }
+
+    retval =
+        allocator_allocate(
+            pre->alloc, (void**)&search.frames,
+            lit_count * sizeof(*search.frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_stack;
+    }
+
+    for (size_t i = 0; i < lit_count; ++i)
+    {
+        search.index[i] = NOT_VISITED;
+    }
+
+    /* find the components, and pick the substitutes. */
+    for (size_t i = 0; i < lit_count && !pre->inconsistent; ++i)
+    {
+        if (NOT_VISITED == search.index[i])
+        {
+            search_from(&search, pre, (libsat_literal)i);
+        }
+    }
+
+    /* rewrite the clauses, and stage the definitions. */
+    if (!pre->inconsistent)
+    {
+        retval = rewrite(pre, &changed);
+    }
+
+    if (STATUS_SUCCESS == retval && changed && !pre->inconsistent)
+    {
+        retval = stage(pre);
+    }
+
+    goto cleanup_frames;
+
+cleanup_frames:
+    release_retval = allocator_reclaim(pre->alloc, search.frames);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_stack:
+    release_retval = allocator_reclaim(pre->alloc, search.stack);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_low:
+    release_retval = allocator_reclaim(pre->alloc, search.low);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_index:
+    release_retval = allocator_reclaim(pre->alloc, search.index);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Find every component reachable from a literal.
+ *
+ * \param search        The search state.
+ * \param pre           The preprocessor for this operation.
+ * \param root          The literal to start from.
+ */
+static void search_from(
+    scc_search* search, preprocessor* pre, libsat_literal root)
+{
+    libsat_literal next;
+
+    visit(search, root);
+
+    while (search->frame_count > 0)
+    {
+        scc_frame* frame = search->frames + search->frame_count - 1;
+        libsat_literal lit = frame->lit;
+
+        /* follow the next implication of this literal. */
+        if (successor(&next, pre, frame))
+        {
+            if (NOT_VISITED == search->index[next])
+            {
+                visit(search, next);
+            }
+            else if (search->index[next] < search->low[lit])
+            {
+                /* a finished literal has its index cleared to the top. */
+                search->low[lit] = search->index[next];
+            }
+
+            continue;
+        }
+
+        /* every implication is followed; close this literal. */
+        search->frame_count -= 1;
+        if (search->frame_count > 0)
+        {
+            libsat_literal parent = search->frames[search->frame_count - 1].lit;
+
+            if (search->low[lit] < search->low[parent])
+            {
+                search->low[parent] = search->low[lit];
+            }
+        }
+
+        if (search->low[lit] == search->index[lit])
+        {
+            component(search, pre, lit);
+        }
+    }
+}
+
+/**
+ * \brief Get the next literal that the literal of a frame implies.
+ *
+ * \param next          Pointer to receive the implied literal.
+ * \param pre           The preprocessor for this operation.
+ * \param frame         The frame to advance.
+ *
+ * \returns true if there is an implied literal, and false otherwise.
+ */
+static bool successor(
+    libsat_literal* next, const preprocessor* pre, scc_frame* frame)
+{
+    /* l implies m for every binary clause ¬l ∨ m. */
+    const preprocessor_occurrences* occurs =
+        pre->occurs + LIBSAT_LITERAL_NEGATE(frame->lit);
+
+    while (frame->next < occurs->count)
+    {
+        size_t clause = occurs->items[frame->next++];
+        const libsat_literal* lits = preprocessor_clause_lits(pre, clause);
+
+        if (2 == pre->clauses[clause].size)
+        {
+            *next =
+                (lits[0] == LIBSAT_LITERAL_NEGATE(frame->lit))
+                    ? lits[1] : lits[0];
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * \brief Number a literal, and push it onto both stacks.
+ */
+static void visit(scc_search* search, libsat_literal lit)
+{
+    search->index[lit] = search->counter;
+    search->low[lit] = search->counter;
+    search->counter += 1;
+    search->stack[search->stack_count++] = lit;
+    search->frames[search->frame_count].lit = lit;
+    search->frames[search->frame_count].next = 0;
+    search->frame_count += 1;
+}
+
+/**
+ * \brief Pop the component rooted at a literal, and pick the substitutes of
+ * its variables.
+ *
+ * \param search        The search state.
+ * \param pre           The preprocessor for this operation.
+ * \param root          The root of the component.
+ */
+static void component(
+    scc_search* search, preprocessor* pre, libsat_literal root)
+{
+    size_t base = search->stack_count;
+    libsat_literal representative;
+    bool frozen = false;
+
+    /* find the bottom of the component. */
+    do
+    {
+        base -= 1;
+    } while (search->stack[base] != root);
+
+    /* popped literals are closed; no later literal may lower its link
+     * through them. */
+    representative = root;
+    for (size_t i = base; i < search->stack_count; ++i)
+    {
+        libsat_literal lit = search->stack[i];
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+        bool lit_frozen = pre->frozen[var_id];
+
+        search->index[lit] = NOT_VISITED - 1;
+
+        /* a literal and its negation in one component can't both hold. */
+        if (pre->marks[LIBSAT_LITERAL_NEGATE(lit)])
+        {
+            pre->inconsistent = true;
+        }
+
+        pre->marks[lit] = 1;
+
+        if (   (lit_frozen && !frozen)
+            || (   lit_frozen == frozen
+                && var_id < LIBSAT_LITERAL_VARIABLE(representative)))
+        {
+            representative = lit;
+            frozen = lit_frozen;
+        }
+    }
+
+    /* map every other unfrozen variable to the representative. */
+    for (size_t i = base; i < search->stack_count; ++i)
+    {
+        libsat_literal lit = search->stack[i];
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+        pre->marks[lit] = 0;
+
+        if (   pre->inconsistent
+            || var_id == LIBSAT_LITERAL_VARIABLE(representative)
+            || pre->frozen[var_id]
+            || pre->substitute[var_id] != LIBSAT_LITERAL_MAKE(var_id, false))
+        {
+            continue;
+        }
+
+        pre->substitute[var_id] =
+            LIBSAT_LITERAL_IS_NEGATED(lit)
+                ? LIBSAT_LITERAL_NEGATE(representative) : representative;
+    }
+
+    search->stack_count = base;
+}
+
+/**
+ * \brief Rewrite every clause that mentions a substituted variable.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param changed       Set to true if any variable is substituted.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status rewrite(preprocessor* pre, bool* changed)
+{
+    status retval, release_retval;
+    libsat_literal* mapped = NULL;
+    size_t mapped_capacity = 0;
+    size_t clause_count = pre->clause_count;
+
+    for (size_t i = 0; i < pre->var_count && !*changed; ++i)
+    {
+        *changed = pre->substitute[i] != LIBSAT_LITERAL_MAKE(i, false);
+    }
+
+    if (!*changed)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* rewritten clauses are appended, and already use the substitutes. */
+    retval = STATUS_SUCCESS;
+    for (
+        size_t i = 0;
+        i < clause_count && !pre->inconsistent && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        const libsat_literal* lits;
+        size_t size = pre->clauses[i].size;
+        size_t kept = 0;
+        bool touched = false, tautology = false;
+
+        if (pre->clauses[i].deleted)
+        {
+            continue;
+        }
+
+        lits = preprocessor_clause_lits(pre, i);
+        for (size_t j = 0; j < size && !touched; ++j)
+        {
+            size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[j]);
+
+            touched =
+                pre->substitute[var_id] != LIBSAT_LITERAL_MAKE(var_id, false);
+        }
+
+        if (!touched)
+        {
+            continue;
+        }
+
+        /* the clause is copied out, since adding may move the arena. */
+        if (size > mapped_capacity)
+        {
+            retval =
+                memory_resize(
+                    pre->alloc, (void**)&mapped, size * sizeof(*mapped));
+            if (STATUS_SUCCESS != retval)
+            {
+                break;
+            }
+
+            mapped_capacity = size;
+        }
+
+        for (size_t j = 0; j < size; ++j)
+        {
+            libsat_literal lit =
+                pre->substitute[LIBSAT_LITERAL_VARIABLE(lits[j])];
+
+            mapped[j] =
+                LIBSAT_LITERAL_IS_NEGATED(lits[j])
+                    ? LIBSAT_LITERAL_NEGATE(lit) : lit;
+        }
+
+        /* drop duplicates; skip tautologies. */
+        qsort(mapped, size, sizeof(*mapped), &literal_compare);
+        for (size_t j = 0; j < size && !tautology; ++j)
+        {
+            if (kept > 0 && mapped[kept - 1] == mapped[j])
+            {
+                continue;
+            }
+
+            if (
+                kept > 0
+             && mapped[kept - 1] == LIBSAT_LITERAL_NEGATE(mapped[j]))
+            {
+                tautology = true;
+                continue;
+            }
+
+            mapped[kept++] = mapped[j];
+        }
+
+        preprocessor_clause_remove(pre, i);
+        if (!tautology)
+        {
+            retval = preprocessor_clause_add(pre, mapped, kept);
+        }
+    }
+
+    if (NULL != mapped)
+    {
+        release_retval = allocator_reclaim(pre->alloc, mapped);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Stage the definition of every substituted variable, and mark it as
+ * eliminated.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status stage(preprocessor* pre)
+{
+    status retval;
+    libsat_literal clause[2];
+
+    for (size_t i = 0; i < pre->var_count; ++i)
+    {
+        libsat_literal pos = LIBSAT_LITERAL_MAKE(i, false);
+        libsat_literal lit = pre->substitute[i];
+
+        if (lit == pos)
+        {
+            continue;
+        }
+
+        /* v ∨ ¬r, and ¬v ∨ r. */
+        clause[0] = pos;
+        clause[1] = LIBSAT_LITERAL_NEGATE(lit);
+        retval = preprocessor_stack_push(pre, clause[0], clause, 2);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        clause[0] = LIBSAT_LITERAL_NEGATE(pos);
+        clause[1] = lit;
+        retval = preprocessor_stack_push(pre, clause[0], clause, 2);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->eliminated[i] = 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Order literals by value.
+ */
+static int literal_compare(const void* lhs, const void* rhs)
+{
+    libsat_literal l = *(const libsat_literal*)lhs;
+    libsat_literal r = *(const libsat_literal*)rhs;
+
+    return (l > r) - (l < r);
+}
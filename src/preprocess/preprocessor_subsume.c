@@ -0,0 +1,232 @@
+/**
+ * \file preprocess/preprocessor_subsume.c
+ *
+ * \brief Subsumption and self-subsuming resolution for a \ref preprocessor.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "preprocess_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+
+/**
+ * \brief No literal of the other clause is negated in this one.
+ */
+#define NO_FLIP                                                  ((size_t)-1)
+
+/* forward decls. */
+static status collect_candidates(
+    size_t* count, preprocessor* pre, size_t clause);
+static void check_candidate(preprocessor* pre, size_t clause, size_t other);
+
+/**
+ * \brief Run backward subsumption and self-subsuming resolution over the
+ * queued clauses until the queue is empty.
+ *
+ * Each queued clause C is checked against every clause D that shares its
+ * least frequent variable. If C is a subset of D, then D is deleted. If C is
+ * a subset of D except for one literal that D holds negated, then resolving
+ * the two on that literal gives D without it, so the literal is removed from
+ * D. Clause signatures rule out most candidates without looking at their
+ * literals.
+ *
+ * \param pre           The preprocessor for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(preprocessor_subsume)(
+    LIBSAT_SYM(preprocessor)* pre)
+{
+    status retval;
+
+    for (;;)
+    {
+        size_t clause, count;
+        const libsat_literal* lits;
+
+        preprocessor_propagate(pre);
+        if (pre->inconsistent || 0 == pre->queue_count)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        clause = pre->queue[--pre->queue_count];
+        pre->clauses[clause].queued = false;
+        if (pre->clauses[clause].deleted)
+        {
+            continue;
+        }
+
+        retval = collect_candidates(&count, pre, clause);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* mark the literals of this clause while checking the others. */
+        lits = preprocessor_clause_lits(pre, clause);
+        for (size_t i = 0; i < pre->clauses[clause].size; ++i)
+        {
+            pre->marks[lits[i]] = 1;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            check_candidate(pre, clause, pre->candidates[i]);
+        }
+
+        for (size_t i = 0; i < pre->clauses[clause].size; ++i)
+        {
+            pre->marks[lits[i]] = 0;
+        }
+    }
+}
+
+/**
+ * \brief Copy the clauses that share the least frequent variable of a clause
+ * into the candidate list.
+ *
+ * \param count         Pointer to receive the number of candidates.
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The clause to check against the candidates.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status collect_candidates(
+    size_t* count, preprocessor* pre, size_t clause)
+{
+    status retval;
+    const libsat_literal* lits = preprocessor_clause_lits(pre, clause);
+    size_t best = LIBSAT_LITERAL_VARIABLE(lits[0]);
+    size_t total;
+    preprocessor_occurrences* pos;
+    preprocessor_occurrences* neg;
+
+    for (size_t i = 1; i < pre->clauses[clause].size; ++i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[i]);
+
+        if (
+            preprocessor_occurrence_count(pre, var_id)
+                < preprocessor_occurrence_count(pre, best))
+        {
+            best = var_id;
+        }
+    }
+
+    *count = 0;
+    total = preprocessor_occurrence_count(pre, best);
+    if (total > PREPROCESS_OCCURRENCE_LIMIT)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* grow the candidate list if needed. */
+    if (total > pre->candidate_capacity)
+    {
+        size_t capacity =
+            (0 == pre->candidate_capacity) ? 64 : 2 * pre->candidate_capacity;
+        while (capacity < total)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                pre->alloc, (void**)&pre->candidates,
+                capacity * sizeof(*pre->candidates));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        pre->candidate_capacity = capacity;
+    }
+
+    pos = pre->occurs + LIBSAT_LITERAL_MAKE(best, false);
+    neg = pre->occurs + LIBSAT_LITERAL_MAKE(best, true);
+    if (pos->count > 0)
+    {
+        memcpy(
+            pre->candidates, pos->items, pos->count * sizeof(*pos->items));
+    }
+    if (neg->count > 0)
+    {
+        memcpy(
+            pre->candidates + pos->count, neg->items,
+            neg->count * sizeof(*neg->items));
+    }
+    *count = total;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Delete or strengthen another clause if the marked clause subsumes or
+ * self-subsumes it.
+ *
+ * \param pre           The preprocessor for this operation.
+ * \param clause        The marked clause.
+ * \param other         The clause to check.
+ */
+static void check_candidate(preprocessor* pre, size_t clause, size_t other)
+{
+    const preprocessor_clause* c = pre->clauses + clause;
+    const preprocessor_clause* d = pre->clauses + other;
+    const libsat_literal* lits;
+    size_t matched = 0, flip = NO_FLIP;
+
+    if (
+        other == clause
+     || d->deleted
+     || d->size < c->size
+     || 0 != (c->signature & ~d->signature))
+    {
+        return;
+    }
+
+    lits = preprocessor_clause_lits(pre, other);
+    for (size_t i = 0; i < d->size; ++i)
+    {
+        if (pre->marks[lits[i]])
+        {
+            matched += 1;
+        }
+        else if (pre->marks[LIBSAT_LITERAL_NEGATE(lits[i])])
+        {
+            if (NO_FLIP != flip)
+            {
+                return;
+            }
+
+            flip = lits[i];
+            matched += 1;
+        }
+    }
+
+    if (matched < c->size)
+    {
+        return;
+    }
+
+    if (NO_FLIP == flip)
+    {
+        preprocessor_clause_remove(pre, other);
+    }
+    else
+    {
+        preprocessor_clause_strengthen(pre, other, flip);
+    }
+}
@@ -34,6 +34,8 @@ static int scan_negation(
     libsat_scanner_token* details, libsat_scanner* scanner);
 static int scan_assignment(
     libsat_scanner_token* details, libsat_scanner* scanner);
+static int scan_weight(
+    libsat_scanner_token* details, libsat_scanner* scanner);
 
 /**
  * \brief Read a token from the scanner instance, populating the provided token
@@ -75,6 +77,10 @@ LIBSAT_SYM(libsat_scanner_read_token)(
             retval = scan_assignment(details, scanner);
             goto done;
 
+        case '[':
+            retval = scan_weight(details, scanner);
+            goto done;
+
         case '(':
             retval =
                 end_details(
@@ -246,7 +252,7 @@ static int scan_true_or_variable(
     next_character(scanner);
     peek = peek_character(scanner);
 
-    if (isalnum(peek))
+    if (isalnum(peek) || '_' == peek)
     {
         return scan_variable(details, scanner);
     }
@@ -307,7 +313,7 @@ static int scan_false_or_variable(
     next_character(scanner);
     peek = peek_character(scanner);
 
-    if (isalnum(peek))
+    if (isalnum(peek) || '_' == peek)
     {
         return scan_variable(details, scanner);
     }
@@ -557,3 +563,68 @@ static int scan_assignment(
             end_details(details, scanner, LIBSAT_SCANNER_TOKEN_TYPE_BAD_INPUT);
     }
 }
+
+/**
+ * \brief Scan the weight of a soft statement, such as [5].
+ *
+ * The weight must be a positive decimal number that fits in 64 bits.
+ *
+ * \param details       The token details for this operation.
+ * \param scanner       The scanner for this operation.
+ *
+ * \returns the scanned token.
+ */
+static int scan_weight(
+    libsat_scanner_token* details, libsat_scanner* scanner)
+{
+    /* cache position in case of failure. */
+    const char* input = scanner->input;
+    size_t index = scanner->index;
+    size_t line = scanner->line;
+    size_t col = scanner->col;
+
+    uint64_t weight = 0, digit;
+    bool overflow = false;
+    int peek = peek_character(scanner);
+
+    if (!isdigit(peek))
+    {
+        goto bad_input;
+    }
+
+    while (isdigit(peek))
+    {
+        next_character(scanner);
+
+        digit = (uint64_t)(peek - '0');
+        if (weight > (UINT64_MAX - digit) / 10)
+        {
+            overflow = true;
+        }
+
+        weight = 10 * weight + digit;
+        peek = peek_character(scanner);
+    }
+
+    if (']' != peek || overflow || 0 == weight)
+    {
+        goto bad_input;
+    }
+
+    next_character(scanner);
+    peek = end_details(details, scanner, LIBSAT_SCANNER_TOKEN_TYPE_WEIGHT);
+    details->value.u64 = weight;
+
+    next_character(scanner);
+
+    return peek;
+
+bad_input:
+    /* reset scanner. */
+    scanner->input = input;
+    scanner->index = index;
+    scanner->line = line;
+    scanner->col = col;
+
+    return end_details(details, scanner, LIBSAT_SCANNER_TOKEN_TYPE_BAD_INPUT);
+}
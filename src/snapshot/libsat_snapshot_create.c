@@ -0,0 +1,66 @@
+/**
+ * \file snapshot/libsat_snapshot_create.c
+ *
+ * \brief Create a \ref libsat_snapshot instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "snapshot_internal.h"
+
+LIBSAT_IMPORT_snapshot;
+LIBSAT_IMPORT_snapshot_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* the vtable entry for the libsat_snapshot instance. */
+RCPR_VTABLE
+resource_vtable libsat_snapshot_vtable = {
+    &libsat_snapshot_resource_release };
+
+/**
+ * \brief Create a snapshot writer and loader over a context.
+ *
+ * \param snapshot      Pointer to the snapshot pointer to be set to this
+ *                      created instance on success.
+ * \param context       The context whose variables are written and loaded.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_create)(
+    LIBSAT_SYM(libsat_snapshot)** snapshot,
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_snapshot* tmp;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(context->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_snapshot_vtable);
+
+    /* initialize snapshot. */
+    tmp->alloc = context->alloc;
+    tmp->context = context;
+
+    /* success. */
+    *snapshot = tmp;
+
+    return STATUS_SUCCESS;
+}
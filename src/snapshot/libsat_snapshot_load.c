@@ -0,0 +1,414 @@
+/**
+ * \file snapshot/libsat_snapshot_load.c
+ *
+ * \brief Load a snapshot into a context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "snapshot_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_snapshot;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief The counts of a snapshot, from its header.
+ */
+typedef struct snapshot_header snapshot_header;
+struct snapshot_header
+{
+    size_t variable_count;
+    size_t name_count;
+    size_t node_count;
+    size_t string_size;
+    size_t root;
+};
+
+/* forward decls. */
+static status read_header(
+    snapshot_header* header, const uint8_t* data, size_t size);
+static status check_names(
+    const snapshot_header* header, const uint8_t* names,
+    const uint8_t* strings);
+static status load_variables(
+    size_t* translation, libsat_snapshot* snapshot,
+    const snapshot_header* header, const uint8_t* names,
+    const uint8_t* strings);
+static status relocate(
+    libsat_ast_node* nodes, const snapshot_header* header,
+    const uint8_t* records);
+static bool read_size(size_t* value, const uint8_t* data);
+
+/**
+ * \brief Load a snapshot into the context.
+ *
+ * The nodes are built first, in a single pass which checks each record and
+ * relocates each reference to an earlier node into a pointer, so that a
+ * malformed snapshot leaves the context as it was. Then each named variable
+ * of the snapshot becomes the context variable of that name, and each unnamed
+ * one gets a fresh unnamed variable. Loading a snapshot into an empty context
+ * therefore gives every variable its id in the snapshot.
+ *
+ * \note The AST is owned by this snapshot, must not be released, and is
+ * invalidated by the next load. Nothing refers to the data once this returns,
+ * so the data can be unmapped right away.
+ *
+ * \param node          Pointer to receive the AST on success, or NULL if the
+ *                      snapshot has none.
+ * \param snapshot      The snapshot for this operation.
+ * \param data          The snapshot data.
+ * \param size          The size of the snapshot data, in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT if the data is not a snapshot.
+ *      - ERROR_LIBSAT_SNAPSHOT_BAD_VERSION if the snapshot is of another
+ *        version.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_load)(
+    const LIBSAT_SYM(libsat_ast_node)** node,
+    LIBSAT_SYM(libsat_snapshot)* snapshot, const uint8_t* data, size_t size)
+{
+    status retval, release_retval;
+    snapshot_header header;
+    const uint8_t* names;
+    const uint8_t* records;
+    const uint8_t* strings;
+    size_t* translation = NULL;
+    libsat_ast_node* nodes = NULL;
+    libsat_ast_node* n;
+    libsat_ast_node* old_nodes;
+
+    retval = read_header(&header, data, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    names = data + SNAPSHOT_HEADER_SIZE;
+    records = names + header.name_count * SNAPSHOT_NAME_SIZE;
+    strings = records + header.node_count * SNAPSHOT_NODE_SIZE;
+
+    /* check the names before the context is changed. */
+    retval = check_names(&header, names, strings);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            snapshot->alloc, (void**)&translation,
+            (header.variable_count + 1) * sizeof(*translation));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            snapshot->alloc, (void**)&nodes,
+            (header.node_count + 1) * sizeof(*nodes));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_arrays;
+    }
+
+    /* check the nodes before the context is changed. */
+    retval = relocate(nodes, &header, records);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_arrays;
+    }
+
+    retval =
+        load_variables(translation, snapshot, &header, names, strings);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_arrays;
+    }
+
+    /* the nodes hold snapshot variables until now. */
+    for (n = nodes; n < nodes + header.node_count; ++n)
+    {
+        if (LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == n->type)
+        {
+            n->value.variable_index = translation[n->value.variable_index];
+        }
+    }
+
+    /* the snapshot owns the new nodes, and the old ones are reclaimed below. */
+    old_nodes = snapshot->nodes;
+    snapshot->nodes = nodes;
+    nodes = old_nodes;
+
+    /* success. */
+    *node = (0 == header.root) ? NULL : snapshot->nodes + header.root - 1;
+    retval = STATUS_SUCCESS;
+
+cleanup_arrays:
+    if (NULL != nodes)
+    {
+        release_retval = allocator_reclaim(snapshot->alloc, nodes);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    release_retval = allocator_reclaim(snapshot->alloc, translation);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Read and check the header, which must account for every byte of the
+ * data.
+ */
+static status read_header(
+    snapshot_header* header, const uint8_t* data, size_t size)
+{
+    size_t remaining;
+
+    if (size < SNAPSHOT_HEADER_SIZE || 0 != memcmp(data, SNAPSHOT_MAGIC, 8))
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+    }
+    else if (LIBSAT_SNAPSHOT_VERSION != snapshot_word_get(data + 8))
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_VERSION;
+    }
+
+    if (
+        !read_size(&header->variable_count, data + 16)
+     || !read_size(&header->name_count, data + 24)
+     || !read_size(&header->node_count, data + 32)
+     || !read_size(&header->string_size, data + 40)
+     || !read_size(&header->root, data + 48))
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+    }
+
+    /* each table must fit in what is left of the data. */
+    remaining = size - SNAPSHOT_HEADER_SIZE;
+    if (header->name_count > remaining / SNAPSHOT_NAME_SIZE)
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+    }
+
+    remaining -= header->name_count * SNAPSHOT_NAME_SIZE;
+    if (header->node_count > remaining / SNAPSHOT_NODE_SIZE)
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+    }
+
+    remaining -= header->node_count * SNAPSHOT_NODE_SIZE;
+    if (
+        header->string_size != remaining
+     || (0 != remaining && 0 != data[size - 1])
+     || header->name_count > header->variable_count
+     || header->variable_count > LIBSAT_SNAPSHOT_VARIABLE_MAX
+     || header->root > header->node_count)
+    {
+        return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Check that the names are sorted by variable, and that each is a
+ * non-empty string in the strings.
+ *
+ * The strings end with a zero byte, so each name is terminated.
+ */
+static status check_names(
+    const snapshot_header* header, const uint8_t* names,
+    const uint8_t* strings)
+{
+    size_t var_id, offset;
+    size_t next_var = 0;
+
+    for (size_t i = 0; i < header->name_count; ++i)
+    {
+        if (
+            !read_size(&var_id, names + i * SNAPSHOT_NAME_SIZE)
+         || !read_size(&offset, names + i * SNAPSHOT_NAME_SIZE + 8)
+         || var_id < next_var || var_id >= header->variable_count
+         || offset >= header->string_size || 0 == strings[offset])
+        {
+            return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+        }
+
+        next_var = var_id + 1;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the context variable of each snapshot variable, in order.
+ */
+static status load_variables(
+    size_t* translation, libsat_snapshot* snapshot,
+    const snapshot_header* header, const uint8_t* names,
+    const uint8_t* strings)
+{
+    status retval;
+    size_t name = 0;
+
+    for (size_t i = 0; i < header->variable_count; ++i)
+    {
+        if (
+            name < header->name_count
+         && i == snapshot_word_get(names + name * SNAPSHOT_NAME_SIZE))
+        {
+            retval =
+                libsat_context_variable_get(
+                    &translation[i], snapshot->context,
+                    (const char*)strings
+                        + snapshot_word_get(
+                            names + name * SNAPSHOT_NAME_SIZE + 8),
+                    LIBSAT_VARIABLE_GET_DEFAULT);
+            ++name;
+        }
+        else
+        {
+            retval =
+                libsat_context_variable_get(
+                    &translation[i], snapshot->context, NULL,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Build the nodes from their records, checking each record and
+ * relocating its references as it goes.
+ *
+ * Variables keep their ids in the snapshot, to be translated once the
+ * variables are loaded.
+ */
+static status relocate(
+    libsat_ast_node* nodes, const snapshot_header* header,
+    const uint8_t* records)
+{
+    for (size_t i = 0; i < header->node_count; ++i)
+    {
+        const uint8_t* record = records + i * SNAPSHOT_NODE_SIZE;
+        libsat_ast_node* node = nodes + i;
+        uint64_t type = snapshot_word_get(record);
+        size_t next, first, second;
+
+        memset(node, 0, sizeof(*node));
+
+        /* every reference is to an earlier node. */
+        if (
+            !read_size(&next, record + 8) || !read_size(&first, record + 16)
+         || !read_size(&second, record + 24)
+         || !read_size(&node->span.begin_line, record + 40)
+         || !read_size(&node->span.begin_col, record + 48)
+         || !read_size(&node->span.end_line, record + 56)
+         || !read_size(&node->span.end_col, record + 64) || next > i)
+        {
+            return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+        }
+
+        node->type = (int)type;
+        node->weight = snapshot_word_get(record + 32);
+        node->next = (0 == next) ? NULL : nodes + next - 1;
+
+        switch (type)
+        {
+            case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+                if (first >= header->variable_count)
+                {
+                    return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+                }
+
+                node->value.variable_index = first;
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+                if (first > 1)
+                {
+                    return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+                }
+
+                node->value.boolean_literal = (1 == first);
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                if (0 == first || first > i)
+                {
+                    return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+                }
+
+                node->value.unary = nodes + first - 1;
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+            case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                if (0 == first || first > i || 0 == second || second > i)
+                {
+                    return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+                }
+
+                node->value.binary.lhs = nodes + first - 1;
+                node->value.binary.rhs = nodes + second - 1;
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                if (first > i)
+                {
+                    return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+                }
+
+                node->value.list.head = (0 == first) ? NULL : nodes + first - 1;
+                break;
+
+            default:
+                return ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Read a word that must fit in a size_t.
+ */
+static bool read_size(size_t* value, const uint8_t* data)
+{
+    uint64_t word = snapshot_word_get(data);
+
+    *value = (size_t)word;
+
+    return word == (uint64_t)*value;
+}
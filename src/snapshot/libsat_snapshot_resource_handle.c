@@ -0,0 +1,26 @@
+/**
+ * \file snapshot/libsat_snapshot_resource_handle.c
+ *
+ * \brief Get the resource handle for a given \ref libsat_snapshot instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "snapshot_internal.h"
+
+/**
+ * \brief Given a \ref libsat_snapshot instance, return the resource handle for
+ * this instance.
+ *
+ * \param snapshot      The \ref libsat_snapshot instance from which the
+ *                      resource handle is returned.
+ *
+ * \returns the resource handle for this snapshot.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_snapshot_resource_handle)(
+    LIBSAT_SYM(libsat_snapshot)* snapshot)
+{
+    return &snapshot->hdr;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file snapshot/libsat_snapshot_resource_release.c
+ *
+ * \brief Release the resources associated with a \ref libsat_snapshot.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "snapshot_internal.h"
+
+LIBSAT_IMPORT_snapshot;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Release a \ref libsat_snapshot resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_resource_release)(
+    RCPR_SYM(resource)* r)
+{
+    status retval = STATUS_SUCCESS;
+    libsat_snapshot* snapshot = (libsat_snapshot*)r;
+
+    /* cache allocator. */
+    allocator* alloc = snapshot->alloc;
+
+    /* reclaim arrays. */
+    retval = reclaim_if_set(alloc, snapshot->nodes, retval);
+    retval = reclaim_if_set(alloc, snapshot->buffer, retval);
+
+    /* reclaim structure. */
+    retval = reclaim_if_set(alloc, snapshot, retval);
+
+    /* return decoded status. */
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,530 @@
+/**
+ * \file snapshot/libsat_snapshot_write.c
+ *
+ * \brief Write a snapshot of a context and an optional AST.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "snapshot_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_snapshot;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief A node on the walk stack, visited once on entry and once on exit.
+ */
+typedef struct write_frame write_frame;
+struct write_frame
+{
+    const libsat_ast_node* node;
+    bool exit;
+};
+
+/**
+ * \brief The state of a write.
+ *
+ * The indices of the nodes written whose parents are not yet written are kept
+ * on a stack of their own.
+ */
+typedef struct snapshot_write snapshot_write;
+struct snapshot_write
+{
+    libsat_snapshot* snapshot;
+    size_t size;
+    size_t node_count;
+    write_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    size_t* indices;
+    size_t index_count;
+    size_t index_capacity;
+};
+
+/* forward decls. */
+static status write_nodes(
+    snapshot_write* write, const libsat_ast_node* node);
+static status write_node(
+    snapshot_write* write, const libsat_ast_node* node);
+static status write_names(
+    snapshot_write* write, size_t* name_count, size_t* string_size,
+    size_t names_offset);
+static status find_name(
+    const char** name, const libsat_context* context, size_t var_id);
+static status push_frame(
+    snapshot_write* write, const libsat_ast_node* node, bool exit);
+static status push_index(snapshot_write* write, size_t index);
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size);
+static status grow(snapshot_write* write, size_t count);
+
+/**
+ * \brief Write a snapshot of the context's variables and an optional AST.
+ *
+ * Nodes are written children first, and the statements of a list from the
+ * last to the first, so that every node only refers to nodes before it.
+ *
+ * \note The data is owned by this snapshot, and is invalidated by the next
+ * write.
+ *
+ * \param data          Pointer to receive the snapshot data on success.
+ * \param size          Pointer to receive the size of the data on success.
+ * \param snapshot      The snapshot for this operation.
+ * \param node          The AST to write, or NULL to write the variables only.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE if the AST holds an
+ *        unknown node type.
+ *      - ERROR_LIBSAT_SNAPSHOT_TOO_LARGE if the context has more than
+ *        \ref LIBSAT_SNAPSHOT_VARIABLE_MAX variables.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_write)(
+    const uint8_t** data, size_t* size, LIBSAT_SYM(libsat_snapshot)* snapshot,
+    const LIBSAT_SYM(libsat_ast_node)* node)
+{
+    status retval, release_retval;
+    snapshot_write write;
+    size_t name_count = 0, string_size = 0, names_offset;
+    const char* name;
+    uint8_t* header;
+
+    /* a snapshot that can't be loaded is not written. */
+    if (snapshot->context->variable_count > LIBSAT_SNAPSHOT_VARIABLE_MAX)
+    {
+        return ERROR_LIBSAT_SNAPSHOT_TOO_LARGE;
+    }
+
+    memset(&write, 0, sizeof(write));
+    write.snapshot = snapshot;
+
+    /* count the names first, so that the nodes can follow their table. */
+    for (size_t i = 0; i < snapshot->context->variable_count; ++i)
+    {
+        retval = find_name(&name, snapshot->context, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_write;
+        }
+
+        if (NULL != name)
+        {
+            ++name_count;
+        }
+    }
+
+    names_offset = SNAPSHOT_HEADER_SIZE;
+    write.size = names_offset + name_count * SNAPSHOT_NAME_SIZE;
+    retval = grow(&write, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_write;
+    }
+
+    if (NULL != node)
+    {
+        retval = write_nodes(&write, node);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_write;
+        }
+    }
+
+    retval = write_names(&write, &name_count, &string_size, names_offset);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_write;
+    }
+
+    header = snapshot->buffer;
+    memcpy(header, SNAPSHOT_MAGIC, 8);
+    snapshot_word_put(header + 8, LIBSAT_SNAPSHOT_VERSION);
+    snapshot_word_put(header + 16, snapshot->context->variable_count);
+    snapshot_word_put(header + 24, name_count);
+    snapshot_word_put(header + 32, write.node_count);
+    snapshot_word_put(header + 40, string_size);
+    snapshot_word_put(
+        header + 48, (NULL == node) ? 0 : write.indices[0] + 1);
+
+    /* success. */
+    *data = snapshot->buffer;
+    *size = write.size;
+    retval = STATUS_SUCCESS;
+
+cleanup_write:
+    if (NULL != write.frames)
+    {
+        release_retval = allocator_reclaim(snapshot->alloc, write.frames);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != write.indices)
+    {
+        release_retval = allocator_reclaim(snapshot->alloc, write.indices);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Write the nodes of an AST, children first, without recursion.
+ */
+static status write_nodes(
+    snapshot_write* write, const libsat_ast_node* node)
+{
+    status retval;
+    const libsat_ast_node* i;
+
+    retval = push_frame(write, node, false);
+
+    while (STATUS_SUCCESS == retval && write->frame_count > 0)
+    {
+        write_frame frame = write->frames[--write->frame_count];
+        node = frame.node;
+
+        if (frame.exit)
+        {
+            retval = write_node(write, node);
+            continue;
+        }
+
+        retval = push_frame(write, node, true);
+
+        switch (node->type)
+        {
+            case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = push_frame(write, node->value.unary, false);
+                }
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+            case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+            case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                /* the rhs is pushed first, so the lhs is written first. */
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = push_frame(write, node->value.binary.rhs, false);
+                }
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = push_frame(write, node->value.binary.lhs, false);
+                }
+                break;
+
+            /* the last statement is pushed last, so it is written first. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+                for (
+                    i = node->value.list.head;
+                    NULL != i && STATUS_SUCCESS == retval; i = i->next)
+                {
+                    retval = push_frame(write, i, false);
+                }
+                break;
+
+            default:
+                retval = ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE;
+                break;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Write a node whose children are written, and whose indices are on
+ * the index stack.
+ */
+static status write_node(
+    snapshot_write* write, const libsat_ast_node* node)
+{
+    status retval;
+    uint8_t* record;
+    size_t first = 0, second = 0, offset, index;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            first = node->value.variable_index;
+            break;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+            first = node->value.boolean_literal ? 1 : 0;
+            break;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            first = write->indices[--write->index_count] + 1;
+            break;
+
+        /* the rhs was written last, so its index is on top. */
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            offset = write->size - write->node_count * SNAPSHOT_NODE_SIZE;
+            for (
+                const libsat_ast_node* i = node->value.list.head; NULL != i;
+                i = i->next)
+            {
+                index = write->indices[--write->index_count];
+
+                /* link the statement written just before this one. */
+                if (0 != first)
+                {
+                    snapshot_word_put(
+                        write->snapshot->buffer + offset
+                            + (first - 1) * SNAPSHOT_NODE_SIZE + 8,
+                        index + 1);
+                }
+                else
+                {
+                    second = index + 1;
+                }
+
+                first = index + 1;
+            }
+
+            /* the head was popped first. */
+            first = second;
+            second = 0;
+            break;
+
+        default:
+            second = write->indices[--write->index_count] + 1;
+            first = write->indices[--write->index_count] + 1;
+            break;
+    }
+
+    retval = grow(write, SNAPSHOT_NODE_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    record = write->snapshot->buffer + write->size;
+    snapshot_word_put(record, (uint64_t)node->type);
+    snapshot_word_put(record + 8, 0);
+    snapshot_word_put(record + 16, first);
+    snapshot_word_put(record + 24, second);
+    snapshot_word_put(record + 32, node->weight);
+    snapshot_word_put(record + 40, node->span.begin_line);
+    snapshot_word_put(record + 48, node->span.begin_col);
+    snapshot_word_put(record + 56, node->span.end_line);
+    snapshot_word_put(record + 64, node->span.end_col);
+    write->size += SNAPSHOT_NODE_SIZE;
+
+    return push_index(write, write->node_count++);
+}
+
+/**
+ * \brief Write the name table and the strings of the names.
+ */
+static status write_names(
+    snapshot_write* write, size_t* name_count, size_t* string_size,
+    size_t names_offset)
+{
+    status retval;
+    const libsat_context* context = write->snapshot->context;
+    size_t strings_offset = write->size;
+    size_t count = 0, length;
+    const char* name;
+
+    for (size_t i = 0; i < context->variable_count; ++i)
+    {
+        retval = find_name(&name, context, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+        else if (NULL == name)
+        {
+            continue;
+        }
+
+        length = strlen(name) + 1;
+        retval = grow(write, length);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        snapshot_word_put(
+            write->snapshot->buffer + names_offset + count * SNAPSHOT_NAME_SIZE,
+            i);
+        snapshot_word_put(
+            write->snapshot->buffer + names_offset + count * SNAPSHOT_NAME_SIZE
+                + 8,
+            write->size - strings_offset);
+        memcpy(write->snapshot->buffer + write->size, name, length);
+        write->size += length;
+        ++count;
+    }
+
+    *name_count = count;
+    *string_size = write->size - strings_offset;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Find the name of a variable, or NULL if it has none.
+ *
+ * The names of an overlay's base are in the base's table.
+ */
+static status find_name(
+    const char** name, const libsat_context* context, size_t var_id)
+{
+    status retval;
+    intern_entry* entry;
+
+    if (NULL != context->base && var_id < context->base_variable_count)
+    {
+        context = context->base;
+    }
+
+    retval =
+        rbtree_find((resource**)&entry, context->intern_to_string, &var_id);
+    if (ERROR_RBTREE_NOT_FOUND == retval)
+    {
+        *name = NULL;
+        return STATUS_SUCCESS;
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *name = entry->string;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a frame onto the walk stack, growing it if needed.
+ */
+static status push_frame(
+    snapshot_write* write, const libsat_ast_node* node, bool exit)
+{
+    status retval;
+
+    retval =
+        reserve(
+            write->snapshot->alloc, (void**)&write->frames,
+            &write->frame_capacity, write->frame_count,
+            sizeof(*write->frames));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    write->frames[write->frame_count].node = node;
+    write->frames[write->frame_count].exit = exit;
+    ++write->frame_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a node index onto the index stack, growing it if needed.
+ */
+static status push_index(snapshot_write* write, size_t index)
+{
+    status retval;
+
+    retval =
+        reserve(
+            write->snapshot->alloc, (void**)&write->indices,
+            &write->index_capacity, write->index_count,
+            sizeof(*write->indices));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    write->indices[write->index_count++] = index;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make room for one more element in a stack.
+ */
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size)
+{
+    status retval;
+
+    if (count == *capacity)
+    {
+        size_t new_capacity = (0 == *capacity) ? 16 : 2 * *capacity;
+
+        retval = memory_resize(alloc, array, new_capacity * size);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *capacity = new_capacity;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make room for count more bytes after the data written so far.
+ */
+static status grow(snapshot_write* write, size_t count)
+{
+    status retval;
+    libsat_snapshot* snapshot = write->snapshot;
+
+    if (write->size + count > snapshot->buffer_capacity)
+    {
+        size_t capacity =
+            (0 == snapshot->buffer_capacity) ? 256 : snapshot->buffer_capacity;
+        while (capacity < write->size + count)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(snapshot->alloc, (void**)&snapshot->buffer, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        snapshot->buffer_capacity = capacity;
+    }
+
+    return STATUS_SUCCESS;
+}
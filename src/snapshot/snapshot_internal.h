@@ -0,0 +1,126 @@
+/**
+ * \file snapshot/snapshot_internal.h
+ *
+ * \brief Internal details for snapshots.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/snapshot.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/resource/protected.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/*
+ * A snapshot is laid out as a header, a name table, a node table, and the
+ * strings of the names, with no padding between them:
+ *
+ *   header:  magic, version, variable count, name count, node count, string
+ *            size, and root, the index of the root node plus one, or zero.
+ *            The variable count is at most LIBSAT_SNAPSHOT_VARIABLE_MAX.
+ *   names:   variable, and the offset of its string in the strings, sorted
+ *            by variable.
+ *   nodes:   type, next, first, second, weight, and the source span. Node
+ *            references are an index plus one, or zero, and always refer to
+ *            an earlier node. A variable keeps its id in first, and a boolean
+ *            literal its value.
+ *   strings: the names, each terminated by a zero byte.
+ */
+
+/** \brief The magic bytes that begin a snapshot. */
+#define SNAPSHOT_MAGIC                                              "LSATSNAP"
+
+/** \brief The size of the header, in bytes. */
+#define SNAPSHOT_HEADER_SIZE                                          (7 * 8)
+
+/** \brief The size of an entry in the name table, in bytes. */
+#define SNAPSHOT_NAME_SIZE                                            (2 * 8)
+
+/** \brief The size of an entry in the node table, in bytes. */
+#define SNAPSHOT_NODE_SIZE                                            (9 * 8)
+
+/**
+ * \brief libsat_snapshot implementation.
+ */
+struct LIBSAT_SYM(libsat_snapshot)
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    LIBSAT_SYM(libsat_context)* context;
+    LIBSAT_SYM(libsat_ast_node)* nodes;
+    uint8_t* buffer;
+    size_t buffer_capacity;
+};
+
+/**
+ * \brief Read a little-endian word.
+ */
+static inline uint64_t snapshot_word_get(const uint8_t* data)
+{
+    uint64_t value = 0;
+
+    for (int i = 7; i >= 0; --i)
+    {
+        value = (value << 8) | data[i];
+    }
+
+    return value;
+}
+
+/**
+ * \brief Write a little-endian word.
+ */
+static inline void snapshot_word_put(uint8_t* data, uint64_t value)
+{
+    for (int i = 0; i < 8; ++i)
+    {
+        data[i] = (uint8_t)(value >> (8 * i));
+    }
+}
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Release a \ref libsat_snapshot resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_snapshot_resource_release)(
+    RCPR_SYM(resource)* r);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_snapshot_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_snapshot_resource_release( \
+        RCPR_SYM(resource)* x) { \
+            return LIBSAT_SYM(libsat_snapshot_resource_release)(x); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_snapshot_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_snapshot_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_snapshot_internal \
+    __INTERNAL_LIBSAT_IMPORT_snapshot_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,536 @@
+/**
+ * \file solver/libsat_approx_count_models.c
+ *
+ * \brief Estimate the projected model count of a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+typedef struct estimate
+{
+    size_t cells;
+    size_t hashes;
+} estimate;
+
+typedef struct approximation
+{
+    libsat_context* context;
+    const size_t* projection;
+    size_t projection_count;
+    size_t* vars;
+    size_t thresh;
+    size_t cells;
+    uint64_t seed;
+} approximation;
+
+static status bounded(
+    int* result, approximation* state, size_t iteration, size_t hashes);
+static status add_hash(
+    approximation* state, size_t iteration, size_t row);
+static bool tally(void* user, const uint8_t* values, size_t count);
+static int estimate_compare(const void* lhs, const void* rhs);
+static double log2_of(double x);
+static size_t ceiling(double x);
+static uint64_t next_random(uint64_t* state);
+
+/**
+ * \brief Estimate the number of models of this context, projected onto the
+ * given variables.
+ *
+ * Each iteration adds random parity constraints over the projection to the
+ * native xor matrix, one at a time, until the models left in the cell that
+ * they pick can be enumerated below a threshold; the number of models in the
+ * cell, times two to the number of constraints, estimates the count. The
+ * median of the estimates is within a factor of 1 + epsilon of the count with
+ * a probability of at least 1 - delta. Counts below the threshold are exact.
+ *
+ * The parity constraints of each iteration are derived from the seed, so the
+ * same seed gives the same estimate. Each constraint is added with a fresh
+ * variable that a clause in a scope makes false, so that what the solver
+ * learns from it is retracted along with the scope.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if the estimate is not zero, unsatisfiable
+ *                      if it is zero, and unknown if a solve gave up.
+ * \param cells         Pointer to receive the number of models in the median
+ *                      cell.
+ * \param hashes        Pointer to receive the number of parity constraints of
+ *                      the median cell; the estimate is cells · 2^hashes.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ * \param epsilon       The tolerance of the estimate, which must be positive.
+ * \param delta         The confidence of the estimate, which must be between
+ *                      zero and one.
+ * \param seed          The seed of the parity constraints.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if epsilon or delta is out of range.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_approx_count_models)(
+    int* result, size_t* cells, size_t* hashes,
+    LIBSAT_SYM(libsat_context)* context, const size_t* projection,
+    size_t projection_count, double epsilon, double delta, uint64_t seed)
+{
+    status retval, release_retval;
+    approximation state;
+    estimate* estimates;
+    size_t iterations, hash_count = 1;
+
+    *cells = 0;
+    *hashes = 0;
+
+    if (!(epsilon > 0.0) || !(delta > 0.0) || !(delta < 1.0))
+    {
+        retval = ERROR_LIBSAT_SOLVER_BAD_OPTION;
+        goto done;
+    }
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < projection_count; ++i)
+    {
+        if (projection[i] >= context->variable_count)
+        {
+            retval = ERROR_LIBSAT_SOLVER_BAD_VARIABLE;
+            goto done;
+        }
+    }
+
+    memset(&state, 0, sizeof(state));
+    state.context = context;
+    state.projection = projection;
+    state.projection_count = projection_count;
+    state.seed = seed;
+    state.thresh =
+        1
+      + ceiling(
+            9.84 * (1.0 + epsilon / (1.0 + epsilon))
+          * (1.0 + 1.0 / epsilon) * (1.0 + 1.0 / epsilon));
+    iterations = ceiling(17.0 * log2_of(3.0 / delta));
+
+    /* one variable per projection variable, plus the fresh variable. */
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&state.vars,
+            (projection_count + 1) * sizeof(*state.vars));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&estimates,
+            iterations * sizeof(*estimates));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_vars;
+    }
+
+    /* a count below the threshold is exact. */
+    retval = bounded(result, &state, 0, 0);
+    if (STATUS_SUCCESS != retval || LIBSAT_SOLVE_RESULT_UNKNOWN == *result)
+    {
+        goto cleanup_estimates;
+    }
+
+    if (state.cells < state.thresh)
+    {
+        *cells = state.cells;
+        *result =
+            (0 == *cells)
+                ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+                : LIBSAT_SOLVE_RESULT_SATISFIABLE;
+        goto cleanup_estimates;
+    }
+
+    for (size_t i = 0; i < iterations; ++i)
+    {
+        /* start from the number of constraints of the last iteration. */
+        retval = bounded(result, &state, i, hash_count);
+        if (STATUS_SUCCESS != retval || LIBSAT_SOLVE_RESULT_UNKNOWN == *result)
+        {
+            goto cleanup_estimates;
+        }
+
+        if (state.cells >= state.thresh)
+        {
+            /* add constraints until the cell is small enough. */
+            while (
+                state.cells >= state.thresh
+             && hash_count <= projection_count)
+            {
+                hash_count += 1;
+                retval = bounded(result, &state, i, hash_count);
+                if (
+                    STATUS_SUCCESS != retval
+                 || LIBSAT_SOLVE_RESULT_UNKNOWN == *result)
+                {
+                    goto cleanup_estimates;
+                }
+            }
+
+            estimates[i].cells = state.cells;
+            estimates[i].hashes = hash_count;
+            continue;
+        }
+
+        /* drop constraints while the cell stays small enough. */
+        estimates[i].cells = state.cells;
+        estimates[i].hashes = hash_count;
+        while (hash_count > 1)
+        {
+            retval = bounded(result, &state, i, hash_count - 1);
+            if (
+                STATUS_SUCCESS != retval
+             || LIBSAT_SOLVE_RESULT_UNKNOWN == *result)
+            {
+                goto cleanup_estimates;
+            }
+
+            if (state.cells >= state.thresh)
+            {
+                break;
+            }
+
+            hash_count -= 1;
+            estimates[i].cells = state.cells;
+            estimates[i].hashes = hash_count;
+        }
+    }
+
+    qsort(estimates, iterations, sizeof(*estimates), &estimate_compare);
+    *cells = estimates[iterations / 2].cells;
+    *hashes = estimates[iterations / 2].hashes;
+    *result =
+        (0 == *cells)
+            ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+            : LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    retval = STATUS_SUCCESS;
+    goto cleanup_estimates;
+
+cleanup_estimates:
+    release_retval = allocator_reclaim(context->alloc, estimates);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_vars:
+    release_retval = allocator_reclaim(context->alloc, state.vars);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Count the models in the cell of the first hashes parity constraints
+ * of an iteration, stopping at the threshold.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result of the
+ *                      enumeration.
+ * \param state         The approximation, which receives the number of models
+ *                      in the cell.
+ * \param iteration     The iteration of the constraints.
+ * \param hashes        The number of constraints.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status bounded(
+    int* result, approximation* state, size_t iteration, size_t hashes)
+{
+    status retval, release_retval;
+    libsat_context* context = state->context;
+    size_t row_count = context->xor_matrix->row_count;
+    size_t column_count = context->xor_matrix->column_count;
+    size_t models;
+
+    state->cells = 0;
+
+    retval = libsat_context_push(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < hashes; ++i)
+    {
+        retval = add_hash(state, iteration, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scope;
+        }
+    }
+
+    retval =
+        libsat_enumerate_models(
+            result, &models, context, state->projection,
+            state->projection_count, &tally, state);
+    goto cleanup_scope;
+
+cleanup_scope:
+    release_retval = libsat_context_pop(context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* rows of the matrix are not retracted by the scope. */
+    xor_matrix_truncate(context->xor_matrix, row_count, column_count);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Add a parity constraint of an iteration, in the open scope.
+ *
+ * Each projection variable is in the constraint with a probability of one
+ * half, and its parity is random.
+ *
+ * \param state         The approximation.
+ * \param iteration     The iteration of the constraint.
+ * \param row           The index of the constraint in the iteration.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status add_hash(
+    approximation* state, size_t iteration, size_t row)
+{
+    status retval;
+    libsat_context* context = state->context;
+    uint64_t random =
+        state->seed
+      ^ ((uint64_t)(iteration + 1) * 0x9e3779b97f4a7c15ULL)
+      ^ ((uint64_t)(row + 1) * 0xbf58476d1ce4e5b9ULL);
+    uint64_t bits = 0;
+    size_t count = 0, fresh;
+    libsat_literal lit;
+    bool parity;
+
+    if (0 == random)
+    {
+        random = 1;
+    }
+
+    /* warm the generator up, since nearby seeds start out alike. */
+    for (int i = 0; i < 4; ++i)
+    {
+        (void)next_random(&random);
+    }
+
+    for (size_t i = 0; i < state->projection_count; ++i)
+    {
+        if (0 == i % 64)
+        {
+            bits = next_random(&random);
+        }
+
+        if (bits & 1)
+        {
+            state->vars[count++] = state->projection[i];
+        }
+
+        bits >>= 1;
+    }
+
+    parity = next_random(&random) >> 63;
+
+    /* the fresh variable is false while the scope is open. */
+    retval =
+        libsat_context_variable_get(
+            &fresh, context, NULL,
+            LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    state->vars[count++] = fresh;
+    retval =
+        libsat_xor_matrix_add_row(
+            context->xor_matrix, state->vars, count, parity);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    lit = LIBSAT_LITERAL_MAKE(fresh, true);
+
+    return libsat_cnf_add_clause(context->cnf, &lit, 1);
+}
+
+/**
+ * \brief Add the models of an enumerated cube to the cell, stopping once the
+ * cell reaches the threshold.
+ */
+static bool tally(void* user, const uint8_t* values, size_t count)
+{
+    approximation* state = (approximation*)user;
+    size_t open = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        open += (LIBSAT_VALUE_UNASSIGNED == values[i]);
+    }
+
+    if (open >= 8 * sizeof(size_t) - 1)
+    {
+        state->cells = state->thresh;
+    }
+    else
+    {
+        state->cells += (size_t)1 << open;
+    }
+
+    if (state->cells >= state->thresh)
+    {
+        state->cells = state->thresh;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * \brief Order estimates by cells · 2^hashes.
+ */
+static int estimate_compare(const void* lhs, const void* rhs)
+{
+    const estimate* l = (const estimate*)lhs;
+    const estimate* r = (const estimate*)rhs;
+    size_t lcells = l->cells, rcells = r->cells;
+
+    if (0 == lcells || 0 == rcells)
+    {
+        return (0 != lcells) - (0 != rcells);
+    }
+
+    /* cells are below the threshold, so a wide gap decides by itself. */
+    if (l->hashes > r->hashes + 32)
+    {
+        return 1;
+    }
+    else if (r->hashes > l->hashes + 32)
+    {
+        return -1;
+    }
+    else if (l->hashes > r->hashes)
+    {
+        lcells <<= l->hashes - r->hashes;
+    }
+    else
+    {
+        rcells <<= r->hashes - l->hashes;
+    }
+
+    return (lcells > rcells) - (lcells < rcells);
+}
+
+/**
+ * \brief Get the base two logarithm of a positive number, to about six
+ * decimal places.
+ */
+static double log2_of(double x)
+{
+    double result = 0.0, bit = 0.5;
+
+    while (x >= 2.0)
+    {
+        x /= 2.0;
+        result += 1.0;
+    }
+
+    while (x < 1.0)
+    {
+        x *= 2.0;
+        result -= 1.0;
+    }
+
+    /* each squaring of the mantissa gives the next bit. */
+    for (int i = 0; i < 20; ++i)
+    {
+        x *= x;
+        if (x >= 2.0)
+        {
+            x /= 2.0;
+            result += bit;
+        }
+
+        bit /= 2.0;
+    }
+
+    return result;
+}
+
+/**
+ * \brief Round a non-negative number up to a whole number.
+ */
+static size_t ceiling(double x)
+{
+    size_t whole = (size_t)x;
+
+    return whole + ((double)whole < x);
+}
+
+/**
+ * \brief Step a xorshift64* generator.
+ */
+static uint64_t next_random(uint64_t* state)
+{
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+
+    return x * 0x2545f4914f6cdd1dULL;
+}
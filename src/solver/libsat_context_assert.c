@@ -0,0 +1,1100 @@
+/**
+ * \file solver/libsat_context_assert.c
+ *
+ * \brief Assert parsed statements in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+typedef struct tseitin_frame
+{
+    const libsat_ast_node* node;
+    size_t base;
+    bool expanded;
+} tseitin_frame;
+
+typedef struct tseitin_walk
+{
+    allocator* alloc;
+    libsat_context* context;
+    tseitin_frame* frames;
+    size_t frame_count;
+    size_t frame_capacity;
+    const libsat_ast_node** nodes;
+    size_t node_count;
+    size_t node_capacity;
+    libsat_literal* lits;
+    size_t lit_count;
+    size_t lit_capacity;
+    libsat_literal* clause;
+    size_t clause_capacity;
+} tseitin_walk;
+
+static status assert_statement(
+    tseitin_walk* walk, const libsat_ast_node* statement);
+static status assert_soft(
+    tseitin_walk* walk, const libsat_ast_node* statement);
+static bool alias_sides(
+    libsat_literal* lhs, libsat_literal* rhs, libsat_context* context,
+    const libsat_ast_node* statement);
+static status assert_alias(
+    tseitin_walk* walk, libsat_literal lhs, libsat_literal rhs);
+static bool variable_unused(libsat_context* context, size_t var_id);
+static status assert_expression(
+    tseitin_walk* walk, const libsat_ast_node* expression);
+static status assert_disjunction(
+    tseitin_walk* walk, const libsat_ast_node* disjunction);
+static status encode(
+    libsat_literal* lit, tseitin_walk* walk,
+    const libsat_ast_node* expression);
+static status expand(tseitin_walk* walk, size_t frame);
+static status gate(libsat_literal* lit, tseitin_walk* walk, size_t frame);
+static status gate_nary(
+    libsat_literal* lit, tseitin_walk* walk, size_t base, bool conjunction);
+static status fresh_literal(libsat_literal* lit, tseitin_walk* walk);
+static status push_frame(tseitin_walk* walk, const libsat_ast_node* node);
+static status push_node(tseitin_walk* walk, const libsat_ast_node* node);
+static status push_lit(tseitin_walk* walk, libsat_literal lit);
+static status reserve_clause(tseitin_walk* walk, size_t count);
+static status walk_cleanup(tseitin_walk* walk, status retval);
+
+/**
+ * \brief Assert a parsed statement or statement list in this context.
+ *
+ * Outside of a scope, statements that make one variable or its negation
+ * equivalent to another are merged first: the variables are joined in the
+ * alias table of the context, and later statements use the root of each
+ * variable. An alias that no clause has used yet is eliminated right away, so
+ * it costs the solver nothing. Outside of a scope, a statement whose
+ * expression is an exclusive disjunction of parity terms is added to the
+ * native xor matrix. Otherwise, a
+ * top-level conjunction is split into separate assertions and a top-level
+ * disjunction becomes a single clause; every other subexpression is named by
+ * a fresh variable, defined by clauses that make it equivalent to that
+ * subexpression. Chains of the same conjunction or disjunction share a single
+ * variable. A soft statement is not asserted at all: its expression is named,
+ * and the name is recorded with its weight for \ref libsat_solve_maxsat.
+ *
+ * \param context       The context for this operation.
+ * \param node          The statement or statement list to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT if the node is not a statement or
+ *        statement list.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_assert)(
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node)
+{
+    status retval;
+    tseitin_walk walk;
+    const libsat_ast_node* statement;
+    libsat_literal lhs, rhs;
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* check the node before changing anything. */
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            break;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            for (
+                statement = node->value.list.head; NULL != statement;
+                statement = statement->next)
+            {
+                if (LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT != statement->type)
+                {
+                    retval = ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT;
+                    goto done;
+                }
+            }
+            break;
+
+        default:
+            retval = ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT;
+            goto done;
+    }
+
+    /* set up the walk. */
+    memset(&walk, 0, sizeof(walk));
+    walk.alloc = context->alloc;
+    walk.context = context;
+
+    /* assert each statement. */
+    if (LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT == node->type)
+    {
+        retval = assert_statement(&walk, node);
+        goto cleanup_walk;
+    }
+
+    /* aliases are merged before the rest of the list is encoded. */
+    retval = STATUS_SUCCESS;
+    for (
+        statement = node->value.list.head;
+        NULL != statement && STATUS_SUCCESS == retval;
+        statement = statement->next)
+    {
+        if (alias_sides(&lhs, &rhs, context, statement))
+        {
+            retval = assert_alias(&walk, lhs, rhs);
+        }
+    }
+
+    for (
+        statement = node->value.list.head;
+        NULL != statement && STATUS_SUCCESS == retval;
+        statement = statement->next)
+    {
+        if (!alias_sides(&lhs, &rhs, context, statement))
+        {
+            retval = assert_statement(&walk, statement);
+        }
+    }
+
+    goto cleanup_walk;
+
+cleanup_walk:
+    retval = walk_cleanup(&walk, retval);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Assert a single statement.
+ *
+ * \param walk          The walk state.
+ * \param statement     The statement to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_statement(
+    tseitin_walk* walk, const libsat_ast_node* statement)
+{
+    status retval;
+    const libsat_ast_node* expression = statement->value.unary;
+    libsat_literal lhs, rhs;
+
+    if (0 != statement->weight)
+    {
+        return assert_soft(walk, statement);
+    }
+
+    if (alias_sides(&lhs, &rhs, walk->context, statement))
+    {
+        return assert_alias(walk, lhs, rhs);
+    }
+
+    /* parity statements go to the xor matrix when they fit. Matrix rows can
+     * not be retracted, so statements in a scope are always encoded. */
+    if (   LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION == expression->type
+        && 0 == walk->context->scope_count)
+    {
+        retval =
+            libsat_xor_matrix_add_statement(
+                walk->context->xor_matrix, statement);
+        if (ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT != retval)
+        {
+            return retval;
+        }
+    }
+
+    return assert_expression(walk, expression);
+}
+
+/**
+ * \brief Record a soft statement by the literal that names its expression.
+ *
+ * The literal is marked as mentioned, so that it is never merged away as an
+ * unused alias.
+ *
+ * \param walk          The walk state.
+ * \param statement     The soft statement.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_soft(
+    tseitin_walk* walk, const libsat_ast_node* statement)
+{
+    status retval;
+    libsat_context* context = walk->context;
+    libsat_literal lit;
+
+    retval = encode(&lit, walk, statement->value.unary);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = cnf_mention(context->cnf, &lit, 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* grow the soft statements if needed. */
+    if (context->soft_count == context->soft_capacity)
+    {
+        size_t capacity =
+            (0 == context->soft_capacity) ? 16 : 2 * context->soft_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&context->soft_literals,
+                capacity * sizeof(*context->soft_literals));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&context->soft_weights,
+                capacity * sizeof(*context->soft_weights));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        context->soft_capacity = capacity;
+    }
+
+    context->soft_literals[context->soft_count] = lit;
+    context->soft_weights[context->soft_count] = statement->weight;
+    context->soft_count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the sides of a statement that makes one variable or its negation
+ * equivalent to another.
+ *
+ * Aliases are only merged outside of a scope, since the alias table can not
+ * be rolled back, and soft statements are never aliases.
+ *
+ * \param lhs           Pointer to receive the literal of the left side.
+ * \param rhs           Pointer to receive the literal of the right side.
+ * \param context       The context for this operation.
+ * \param statement     The statement to check.
+ *
+ * \returns true if this statement is an alias, and false otherwise.
+ */
+static bool alias_sides(
+    libsat_literal* lhs, libsat_literal* rhs, libsat_context* context,
+    const libsat_ast_node* statement)
+{
+    const libsat_ast_node* expression = statement->value.unary;
+    const libsat_ast_node* sides[2];
+    libsat_literal lits[2];
+
+    if (   0 != context->scope_count
+        || 0 != statement->weight
+        || (   LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL != expression->type
+            && LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT != expression->type))
+    {
+        return false;
+    }
+
+    sides[0] = expression->value.binary.lhs;
+    sides[1] = expression->value.binary.rhs;
+    for (size_t i = 0; i < 2; ++i)
+    {
+        bool negated = false;
+
+        while (LIBSAT_PARSER_AST_NODE_TYPE_NEGATION == sides[i]->type)
+        {
+            negated = !negated;
+            sides[i] = sides[i]->value.unary;
+        }
+
+        if (LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE != sides[i]->type)
+        {
+            return false;
+        }
+
+        lits[i] = LIBSAT_LITERAL_MAKE(sides[i]->value.variable_index, negated);
+    }
+
+    *lhs = lits[0];
+    *rhs = lits[1];
+    return true;
+}
+
+/**
+ * \brief Merge two literals in the alias table.
+ *
+ * The root of one side becomes an alias of the other. A root that no clause
+ * has used yet is preferred as the alias; its definition then goes straight
+ * to the elimination stack, and it is only added back if it is used again.
+ *
+ * \param walk          The walk state.
+ * \param lhs           The literal of the left side.
+ * \param rhs           The literal of the right side.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_alias(
+    tseitin_walk* walk, libsat_literal lhs, libsat_literal rhs)
+{
+    status retval;
+    libsat_context* context = walk->context;
+    libsat_cnf* cnf = context->cnf;
+    libsat_literal a = solver_alias_find(context, lhs);
+    libsat_literal b = solver_alias_find(context, rhs);
+    libsat_literal tmp, clause[2];
+    bool a_unused, b_unused;
+    size_t var_id, root;
+
+    /* an alias of itself holds, and an alias of its negation can't. */
+    if (LIBSAT_LITERAL_VARIABLE(a) == LIBSAT_LITERAL_VARIABLE(b))
+    {
+        return
+            (a == b) ? STATUS_SUCCESS : libsat_cnf_add_clause(cnf, clause, 0);
+    }
+
+    /* a is the side that becomes the alias. */
+    a_unused = variable_unused(context, LIBSAT_LITERAL_VARIABLE(a));
+    b_unused = variable_unused(context, LIBSAT_LITERAL_VARIABLE(b));
+    if (   (b_unused && !a_unused)
+        || (   b_unused == a_unused
+            && LIBSAT_LITERAL_VARIABLE(b) > LIBSAT_LITERAL_VARIABLE(a)))
+    {
+        tmp = a;
+        a = b;
+        b = tmp;
+        a_unused = b_unused;
+    }
+
+    /* link the variable of a to the literal it is equivalent to. */
+    var_id = LIBSAT_LITERAL_VARIABLE(a);
+    if (LIBSAT_LITERAL_IS_NEGATED(a))
+    {
+        b = LIBSAT_LITERAL_NEGATE(b);
+    }
+
+    retval = solver_alias_link(context, var_id, b);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    a = LIBSAT_LITERAL_MAKE(var_id, false);
+
+    /* a used variable keeps its definition as two clauses. */
+    if (!a_unused)
+    {
+        retval = cnf_add_binary(cnf, a, LIBSAT_LITERAL_NEGATE(b));
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = cnf_add_binary(cnf, LIBSAT_LITERAL_NEGATE(a), b);
+        }
+
+        return retval;
+    }
+
+    /* an unused variable is eliminated by its definition. Models are extended
+     * from the most recent elimination back, so the other side must be active
+     * when it is pushed. */
+    root = LIBSAT_LITERAL_VARIABLE(b);
+    if (CNF_VARIABLE_ACTIVE != cnf_variable_state(cnf, root))
+    {
+        retval = cnf_restore(cnf, root);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    clause[0] = a;
+    clause[1] = LIBSAT_LITERAL_NEGATE(b);
+    retval = cnf_eliminate_push(cnf, clause[0], clause, 2);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    clause[0] = LIBSAT_LITERAL_NEGATE(a);
+    clause[1] = b;
+    return cnf_eliminate_push(cnf, clause[0], clause, 2);
+}
+
+/**
+ * \brief Check that no clause, native constraint, or xor row has used a
+ * variable.
+ */
+static bool variable_unused(libsat_context* context, size_t var_id)
+{
+    const libsat_xor_matrix* matrix = context->xor_matrix;
+
+    return
+        !cnf_variable_mentioned(context->cnf, var_id)
+     && (   var_id >= matrix->variable_capacity
+         || LIBSAT_XOR_NO_COLUMN == matrix->variable_column[var_id]);
+}
+
+/**
+ * \brief Assert that an expression is true.
+ *
+ * \param walk          The walk state.
+ * \param expression    The expression to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_expression(
+    tseitin_walk* walk, const libsat_ast_node* expression)
+{
+    status retval;
+    size_t base = walk->node_count;
+    libsat_literal clause[2];
+
+    retval = push_node(walk, expression);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    while (walk->node_count > base)
+    {
+        const libsat_ast_node* node = walk->nodes[--walk->node_count];
+
+        switch (node->type)
+        {
+            /* each side of a conjunction is asserted on its own. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+                retval = push_node(walk, node->value.binary.rhs);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = push_node(walk, node->value.binary.lhs);
+                }
+                break;
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+                retval = assert_disjunction(walk, node);
+                break;
+
+            /* a → b is the clause ¬a ∨ b. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+                retval = encode(&clause[0], walk, node->value.binary.lhs);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = encode(&clause[1], walk, node->value.binary.rhs);
+                }
+                if (STATUS_SUCCESS == retval)
+                {
+                    clause[0] = LIBSAT_LITERAL_NEGATE(clause[0]);
+                    retval =
+                        libsat_cnf_add_clause(walk->context->cnf, clause, 2);
+                }
+                break;
+
+            /* true adds nothing, and false is the empty clause. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+                retval = STATUS_SUCCESS;
+                if (!node->value.boolean_literal)
+                {
+                    retval =
+                        libsat_cnf_add_clause(walk->context->cnf, clause, 0);
+                }
+                break;
+
+            /* anything else is a unit clause of its encoding. */
+            default:
+                retval = encode(&clause[0], walk, node);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval =
+                        libsat_cnf_add_clause(walk->context->cnf, clause, 1);
+                }
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            walk->node_count = base;
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Assert a disjunction as a single clause over its disjuncts.
+ *
+ * \param walk          The walk state.
+ * \param disjunction   The disjunction to assert.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_disjunction(
+    tseitin_walk* walk, const libsat_ast_node* disjunction)
+{
+    status retval;
+    size_t node_base = walk->node_count;
+    size_t lit_base = walk->lit_count;
+    libsat_literal lit;
+
+    retval = push_node(walk, disjunction);
+
+    /* encode each disjunct of the chain. */
+    while (STATUS_SUCCESS == retval && walk->node_count > node_base)
+    {
+        const libsat_ast_node* node = walk->nodes[--walk->node_count];
+
+        if (LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION == node->type)
+        {
+            retval = push_node(walk, node->value.binary.rhs);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = push_node(walk, node->value.binary.lhs);
+            }
+        }
+        else
+        {
+            retval = encode(&lit, walk, node);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = push_lit(walk, lit);
+            }
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval =
+            libsat_cnf_add_clause(
+                walk->context->cnf, walk->lits + lit_base,
+                walk->lit_count - lit_base);
+    }
+
+    walk->node_count = node_base;
+    walk->lit_count = lit_base;
+
+    return retval;
+}
+
+/**
+ * \brief Get a literal that is equivalent to an expression.
+ *
+ * \note This walk uses an explicit stack, since long chains produce very deep
+ * left-leaning trees. Each frame leaves exactly one literal on the literal
+ * stack once it is complete.
+ *
+ * \param lit           Pointer to receive the literal.
+ * \param walk          The walk state.
+ * \param expression    The expression to encode.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status encode(
+    libsat_literal* lit, tseitin_walk* walk,
+    const libsat_ast_node* expression)
+{
+    status retval;
+    size_t frame_base = walk->frame_count;
+    size_t lit_base = walk->lit_count;
+    libsat_literal result;
+
+    retval = push_frame(walk, expression);
+
+    while (STATUS_SUCCESS == retval && walk->frame_count > frame_base)
+    {
+        size_t frame = walk->frame_count - 1;
+
+        /* push the operands of this frame first. */
+        if (!walk->frames[frame].expanded)
+        {
+            retval = expand(walk, frame);
+            continue;
+        }
+
+        /* all operands are encoded; combine them. */
+        retval = gate(&result, walk, frame);
+        if (STATUS_SUCCESS == retval)
+        {
+            walk->lit_count = walk->frames[frame].base;
+            walk->frame_count = frame;
+            retval = push_lit(walk, result);
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        *lit = walk->lits[lit_base];
+    }
+
+    walk->frame_count = frame_base;
+    walk->lit_count = lit_base;
+
+    return retval;
+}
+
+/**
+ * \brief Expand a frame by pushing frames for its operands.
+ *
+ * Variables and constants complete immediately. Chains of the same
+ * conjunction or disjunction are flattened into one frame.
+ *
+ * \param walk          The walk state.
+ * \param frame         The index of the frame to expand.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status expand(tseitin_walk* walk, size_t frame)
+{
+    status retval;
+    const libsat_ast_node* node = walk->frames[frame].node;
+    size_t node_base = walk->node_count;
+    libsat_literal lit;
+
+    walk->frames[frame].expanded = true;
+    walk->frames[frame].base = walk->lit_count;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            walk->frame_count = frame;
+            return
+                push_lit(
+                    walk,
+                    solver_alias_find(
+                        walk->context,
+                        LIBSAT_LITERAL_MAKE(
+                            node->value.variable_index, false)));
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+            retval = solver_true_literal(&lit, walk->context);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            walk->frame_count = frame;
+            return
+                push_lit(
+                    walk,
+                    node->value.boolean_literal
+                        ? lit : LIBSAT_LITERAL_NEGATE(lit));
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            return push_frame(walk, node->value.unary);
+
+        /* push one frame per operand of the chain. */
+        case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+        case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            retval = push_node(walk, node);
+            while (STATUS_SUCCESS == retval && walk->node_count > node_base)
+            {
+                const libsat_ast_node* operand =
+                    walk->nodes[--walk->node_count];
+
+                if (operand->type == node->type)
+                {
+                    retval = push_node(walk, operand->value.binary.rhs);
+                    if (STATUS_SUCCESS == retval)
+                    {
+                        retval = push_node(walk, operand->value.binary.lhs);
+                    }
+                }
+                else
+                {
+                    retval = push_frame(walk, operand);
+                }
+            }
+
+            walk->node_count = node_base;
+            return retval;
+
+        /* the lhs is on top, so that it is encoded first. */
+        case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+        case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+        case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+        case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+            retval = push_frame(walk, node->value.binary.rhs);
+            if (STATUS_SUCCESS == retval)
+            {
+                retval = push_frame(walk, node->value.binary.lhs);
+            }
+            return retval;
+
+        default:
+            return ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT;
+    }
+}
+
+/**
+ * \brief Combine the encoded operands of a frame.
+ *
+ * \param lit           Pointer to receive the literal for this frame.
+ * \param walk          The walk state.
+ * \param frame         The index of the frame to combine.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status gate(libsat_literal* lit, tseitin_walk* walk, size_t frame)
+{
+    status retval;
+    const libsat_ast_node* node = walk->frames[frame].node;
+    size_t base = walk->frames[frame].base;
+    libsat_cnf* cnf = walk->context->cnf;
+    libsat_literal a, b, g;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            *lit = LIBSAT_LITERAL_NEGATE(walk->lits[base]);
+            return STATUS_SUCCESS;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+            return gate_nary(lit, walk, base, true);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+            return gate_nary(lit, walk, base, false);
+
+        default:
+            break;
+    }
+
+    a = walk->lits[base];
+    b = walk->lits[base + 1];
+
+    retval = fresh_literal(&g, walk);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* g ↔ (¬a ∨ b). */
+    if (LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION == node->type)
+    {
+        retval =
+            cnf_add_ternary(
+                cnf, LIBSAT_LITERAL_NEGATE(g), LIBSAT_LITERAL_NEGATE(a), b);
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = cnf_add_binary(cnf, a, g);
+        }
+        if (STATUS_SUCCESS == retval)
+        {
+            retval = cnf_add_binary(cnf, LIBSAT_LITERAL_NEGATE(b), g);
+        }
+
+        *lit = g;
+        return retval;
+    }
+
+    /* g ↔ (a ⊻ b). */
+    retval =
+        cnf_add_ternary(cnf, LIBSAT_LITERAL_NEGATE(g), a, b);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval =
+            cnf_add_ternary(
+                cnf, LIBSAT_LITERAL_NEGATE(g), LIBSAT_LITERAL_NEGATE(a),
+                LIBSAT_LITERAL_NEGATE(b));
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = cnf_add_ternary(cnf, g, LIBSAT_LITERAL_NEGATE(a), b);
+    }
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = cnf_add_ternary(cnf, g, a, LIBSAT_LITERAL_NEGATE(b));
+    }
+
+    /* a ↔ b and a := b are the negation of a ⊻ b. */
+    *lit =
+        (LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION == node->type)
+            ? g : LIBSAT_LITERAL_NEGATE(g);
+
+    return retval;
+}
+
+/**
+ * \brief Define a fresh literal equivalent to the conjunction or disjunction
+ * of the literals above base.
+ *
+ * \param lit           Pointer to receive the literal.
+ * \param walk          The walk state.
+ * \param base          The first operand on the literal stack.
+ * \param conjunction   True for a conjunction, false for a disjunction.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status gate_nary(
+    libsat_literal* lit, tseitin_walk* walk, size_t base, bool conjunction)
+{
+    status retval;
+    size_t count = walk->lit_count - base;
+    libsat_literal g;
+
+    retval = fresh_literal(&g, walk);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = reserve_clause(walk, count + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* for a conjunction, g → l for each l; for a disjunction, l → g. By De
+     * Morgan, the two differ only in which polarities are negated. */
+    walk->clause[0] = conjunction ? g : LIBSAT_LITERAL_NEGATE(g);
+    for (size_t i = 0; i < count; ++i)
+    {
+        libsat_literal operand = walk->lits[base + i];
+
+        retval =
+            conjunction
+                ? cnf_add_binary(
+                    walk->context->cnf, LIBSAT_LITERAL_NEGATE(g), operand)
+                : cnf_add_binary(
+                    walk->context->cnf, g, LIBSAT_LITERAL_NEGATE(operand));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->clause[1 + i] =
+            conjunction ? LIBSAT_LITERAL_NEGATE(operand) : operand;
+    }
+
+    /* and the reverse direction as one long clause. */
+    retval =
+        libsat_cnf_add_clause(walk->context->cnf, walk->clause, count + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *lit = g;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a literal for a fresh variable.
+ *
+ * \param lit           Pointer to receive the literal.
+ * \param walk          The walk state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status fresh_literal(libsat_literal* lit, tseitin_walk* walk)
+{
+    status retval;
+    size_t var_id;
+
+    retval = cnf_fresh_variable(&var_id, walk->context->cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *lit = LIBSAT_LITERAL_MAKE(var_id, false);
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push an unexpanded frame for an expression.
+ */
+static status push_frame(tseitin_walk* walk, const libsat_ast_node* node)
+{
+    status retval;
+
+    if (walk->frame_count == walk->frame_capacity)
+    {
+        size_t capacity =
+            (0 == walk->frame_capacity) ? 32 : 2 * walk->frame_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->frames,
+                capacity * sizeof(*walk->frames));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->frame_capacity = capacity;
+    }
+
+    walk->frames[walk->frame_count].node = node;
+    walk->frames[walk->frame_count].base = 0;
+    walk->frames[walk->frame_count].expanded = false;
+    walk->frame_count += 1;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a node onto the node stack.
+ */
+static status push_node(tseitin_walk* walk, const libsat_ast_node* node)
+{
+    status retval;
+
+    if (walk->node_count == walk->node_capacity)
+    {
+        size_t capacity =
+            (0 == walk->node_capacity) ? 32 : 2 * walk->node_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->nodes,
+                capacity * sizeof(*walk->nodes));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->node_capacity = capacity;
+    }
+
+    walk->nodes[walk->node_count++] = node;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a literal onto the literal stack.
+ */
+static status push_lit(tseitin_walk* walk, libsat_literal lit)
+{
+    status retval;
+
+    if (walk->lit_count == walk->lit_capacity)
+    {
+        size_t capacity =
+            (0 == walk->lit_capacity) ? 32 : 2 * walk->lit_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->lits,
+                capacity * sizeof(*walk->lits));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->lit_capacity = capacity;
+    }
+
+    walk->lits[walk->lit_count++] = lit;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make room for a clause of the given size.
+ */
+static status reserve_clause(tseitin_walk* walk, size_t count)
+{
+    status retval;
+
+    if (count > walk->clause_capacity)
+    {
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->clause,
+                count * sizeof(*walk->clause));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->clause_capacity = count;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the walk stacks.
+ *
+ * \param walk          The walk state.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status walk_cleanup(tseitin_walk* walk, status retval)
+{
+    status release_retval;
+    void* arrays[4] = {
+        walk->frames, walk->nodes, walk->lits, walk->clause };
+
+    for (size_t i = 0; i < 4; ++i)
+    {
+        if (NULL != arrays[i])
+        {
+            release_retval = allocator_reclaim(walk->alloc, arrays[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    return retval;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file solver/libsat_context_cnf.c
+ *
+ * \brief Get the clause database of a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "../base/libsat_base_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+
+/**
+ * \brief Get the clause database of this context.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns the clause database of this context, or NULL if an overlay could
+ * not create it.
+ */
+LIBSAT_SYM(libsat_cnf)*
+LIBSAT_SYM(libsat_context_cnf)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    /* an overlay creates its solver state on first use. */
+    if (STATUS_SUCCESS != context_solver_ensure(context))
+    {
+        return NULL;
+    }
+
+    return context->cnf;
+}
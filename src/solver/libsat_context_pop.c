@@ -0,0 +1,155 @@
+/**
+ * \file solver/libsat_context_pop.c
+ *
+ * \brief Close an assertion scope in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_rbtree;
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status forget_names(libsat_context* context, size_t variable_count);
+
+/**
+ * \brief Close the most recent assertion scope in this context.
+ *
+ * The solver forgets the variables of the scope and every clause that
+ * mentions one of them, the database drops the clauses and soft statements
+ * added in the scope, and the variable table is rewound so that the ids of the
+ * scope are reused.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_SCOPE if no scope is open.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_pop)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_context_scope* scope;
+
+    if (context->frozen)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (0 == context->scope_count)
+    {
+        return ERROR_LIBSAT_SOLVER_NO_SCOPE;
+    }
+
+    scope = &context->scopes[context->scope_count - 1];
+
+    /* retract the scope from the solver and the database. */
+    solver_backtrack(context->solver, 0);
+    retval =
+        solver_pop(
+            context->solver, scope->variable_count, scope->clause_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    cnf_truncate(context->cnf, scope->clause_count, scope->native_count);
+
+    /* rewind the variable table. */
+    retval = forget_names(context, scope->variable_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    context->variable_count = scope->variable_count;
+    context->soft_count = scope->soft_count;
+    context->has_true_variable = scope->has_true_variable;
+    context->scope_count -= 1;
+
+    /* guard with the enclosing scope, if there is one. */
+    context->cnf->guarded = (context->scope_count > 0);
+    if (context->cnf->guarded)
+    {
+        context->cnf->guard =
+            LIBSAT_LITERAL_NEGATE(
+                context->scopes[context->scope_count - 1].activation);
+    }
+
+    /* the last result may refer to forgotten variables. */
+    context->solver->last_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    context->solver->model_count = 0;
+    context->solver->core_count = 0;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Remove the names of every variable from the given id on.
+ *
+ * \param context       The context for this operation.
+ * \param variable_count The number of variables to keep.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status forget_names(libsat_context* context, size_t variable_count)
+{
+    status retval;
+    intern_entry* entry;
+
+    for (size_t i = variable_count; i < context->variable_count; ++i)
+    {
+        /* unique variables have no name. */
+        retval =
+            rbtree_find((resource**)&entry, context->intern_to_string, &i);
+        if (ERROR_RBTREE_NOT_FOUND == retval)
+        {
+            continue;
+        }
+        else if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* each tree holds a reference to the entry. */
+        retval = rbtree_delete(NULL, context->string_to_intern, entry->string);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = rbtree_delete(NULL, context->intern_to_string, &i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
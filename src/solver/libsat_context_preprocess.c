@@ -0,0 +1,231 @@
+/**
+ * \file solver/libsat_context_preprocess.c
+ *
+ * \brief Simplify the clauses of a \ref libsat_context before solving.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../preprocess/preprocess_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_preprocess_internal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status preprocess(libsat_context* context, const uint8_t* frozen);
+
+/**
+ * \brief Simplify the clauses asserted in this context before solving.
+ *
+ * Units are propagated, equivalent literals found as cycles of binary clauses
+ * are replaced by one of them, subsumed clauses are removed, clauses are
+ * strengthened by self-subsuming resolution, and variables are eliminated by
+ * bounded variable elimination. Variables used by native constraints, the
+ * native xor matrix, or soft statements are kept.
+ *
+ * The clauses of an eliminated variable move to the elimination stack of the
+ * database, which extends every model to the eliminated variables and gives
+ * the clauses back if the variable is used again. The solver forgets its
+ * clauses, and imports the simplified database on the next solve.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - ERROR_LIBSAT_SOLVER_SCOPE_OPEN if a scope is open.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_ACTIVE if a proof is being written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_preprocess)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval, release_retval;
+    libsat_cnf* cnf;
+    const libsat_xor_matrix* matrix;
+    size_t slots =
+        (0 == context->variable_count) ? 1 : context->variable_count;
+    uint8_t* frozen;
+
+    if (context->frozen)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    cnf = context->cnf;
+    matrix = context->xor_matrix;
+
+    /* scoped clauses carry activation literals that must stay as they are. */
+    if (context->scope_count > 0)
+    {
+        return ERROR_LIBSAT_SOLVER_SCOPE_OPEN;
+    }
+
+    /* a proof checks against the database as it was. */
+    if (NULL != context->solver->proof)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_ACTIVE;
+    }
+
+    /* nothing that is used again may stay eliminated. */
+    retval = solver_reactivate(context, NULL, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* variables used outside of the clauses are never eliminated. */
+    retval = allocator_allocate(context->alloc, (void**)&frozen, slots);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(frozen, 0, slots);
+    for (size_t i = 0; i < cnf->native_literal_count; ++i)
+    {
+        frozen[LIBSAT_LITERAL_VARIABLE(cnf->native_literals[i])] = 1;
+    }
+
+    for (size_t i = 0; i < matrix->column_count; ++i)
+    {
+        frozen[matrix->column_variable[i]] = 1;
+    }
+
+    for (size_t i = 0; i < context->soft_count; ++i)
+    {
+        frozen[LIBSAT_LITERAL_VARIABLE(context->soft_literals[i])] = 1;
+    }
+
+    retval = preprocess(context, frozen);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_frozen;
+    }
+
+    /* the solver imports the simplified database on the next solve. */
+    solver_reset(context->solver);
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_frozen;
+
+cleanup_frozen:
+    release_retval = allocator_reclaim(context->alloc, frozen);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Run the preprocessor over the database of a context.
+ *
+ * \param context       The context for this operation.
+ * \param frozen        The variables that may not be eliminated.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status preprocess(libsat_context* context, const uint8_t* frozen)
+{
+    status retval, release_retval;
+    preprocessor pre;
+
+    retval =
+        preprocessor_init(
+            &pre, context->cnf, context->variable_count, frozen);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_preprocessor;
+    }
+
+    retval = preprocessor_substitute(&pre);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_preprocessor;
+    }
+
+    retval = preprocessor_subsume(&pre);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_preprocessor;
+    }
+
+    retval = preprocessor_eliminate(&pre);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_preprocessor;
+    }
+
+    retval = preprocessor_emit(&pre);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_preprocessor;
+    }
+
+    /* later statements use the substitutes as well. */
+    for (size_t i = 0; i < pre.var_count && !pre.inconsistent; ++i)
+    {
+        libsat_literal a, b;
+
+        if (pre.substitute[i] == LIBSAT_LITERAL_MAKE(i, false))
+        {
+            continue;
+        }
+
+        a = solver_alias_find(context, LIBSAT_LITERAL_MAKE(i, false));
+        b = solver_alias_find(context, pre.substitute[i]);
+        if (LIBSAT_LITERAL_VARIABLE(a) == LIBSAT_LITERAL_VARIABLE(b))
+        {
+            continue;
+        }
+
+        retval =
+            solver_alias_link(
+                context, LIBSAT_LITERAL_VARIABLE(a),
+                LIBSAT_LITERAL_IS_NEGATED(a) ? LIBSAT_LITERAL_NEGATE(b) : b);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_preprocessor;
+        }
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto cleanup_preprocessor;
+
+cleanup_preprocessor:
+    release_retval = preprocessor_dispose(&pre);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
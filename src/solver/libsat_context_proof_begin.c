@@ -0,0 +1,87 @@
+/**
+ * \file solver/libsat_context_proof_begin.c
+ *
+ * \brief Begin writing a proof of the solves in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Begin writing a proof of the solves in this context.
+ *
+ * The solver must not have seen any clause yet, so that every clause it learns
+ * is logged, and its clause numbers match the database.
+ *
+ * \param context       The context for this operation.
+ * \param fd            The file descriptor to write to. It stays open, and
+ *                      remains owned by the caller.
+ * \param format        The \ref libsat_proof_format to write.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if the format is unknown.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_ACTIVE if a proof is already being written.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if the context has already
+ *        solved, or holds native constraints.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_proof_begin)(
+    LIBSAT_SYM(libsat_context)* context, int fd, int format)
+{
+    status retval;
+    libsat_solver* solver;
+
+    switch (format)
+    {
+        case LIBSAT_PROOF_FORMAT_DRAT:
+        case LIBSAT_PROOF_FORMAT_LRAT:
+            break;
+
+        default:
+            return ERROR_LIBSAT_SOLVER_BAD_OPTION;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver = context->solver;
+
+    if (NULL != solver->proof)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_ACTIVE;
+    }
+
+    /* anything the solver already knows would be missing from the proof. */
+    if (
+        0 != solver->imported_clauses || 0 != solver->clause_count
+     || 0 != solver->trail_count || solver->inconsistent)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED;
+    }
+
+    if (0 != context->cnf->native_count || 0 != context->xor_matrix->row_count)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED;
+    }
+
+    return
+        solver_proof_begin(
+            solver, fd, format, libsat_cnf_clause_count(context->cnf));
+}
@@ -0,0 +1,41 @@
+/**
+ * \file solver/libsat_context_proof_end.c
+ *
+ * \brief Finish the proof being written in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Finish the proof being written in this context.
+ *
+ * Whatever is still buffered is written out. Solves after this are no longer
+ * logged.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_PROOF if no proof is being written.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if some part of the proof could not
+ *        be written.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_proof_end)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    if (NULL == context->solver || NULL == context->solver->proof)
+    {
+        return ERROR_LIBSAT_SOLVER_NO_PROOF;
+    }
+
+    return solver_proof_end(context->solver);
+}
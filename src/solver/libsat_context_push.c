@@ -0,0 +1,109 @@
+/**
+ * \file solver/libsat_context_push.c
+ *
+ * \brief Open an assertion scope in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Open a new assertion scope in this context.
+ *
+ * The scope records the sizes of the variable table and the clause database,
+ * then creates its activation variable. Until the scope is popped, every
+ * clause added to the database carries the negation of the activation
+ * literal. Any variable eliminated by preprocessing is added back first.
+ *
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_context_push)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_context_scope scope;
+    size_t var_id;
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        return ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* scoped clauses are never preprocessed, so nothing stays eliminated. */
+    retval = cnf_restore_all(context->cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* grow the scope stack if needed. */
+    if (context->scope_count == context->scope_capacity)
+    {
+        size_t capacity =
+            (0 == context->scope_capacity) ? 8 : 2 * context->scope_capacity;
+
+        retval =
+            memory_resize(
+                context->alloc, (void**)&context->scopes,
+                capacity * sizeof(*context->scopes));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        context->scope_capacity = capacity;
+    }
+
+    /* record what to restore. */
+    scope.variable_count = context->variable_count;
+    scope.clause_count = libsat_cnf_clause_count(context->cnf);
+    scope.native_count = libsat_cnf_native_count(context->cnf);
+    scope.soft_count = context->soft_count;
+    scope.has_true_variable = context->has_true_variable;
+
+    /* the activation variable is the first variable of the scope. */
+    retval =
+        libsat_context_variable_get(
+            &var_id, context, NULL,
+            LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    scope.activation = LIBSAT_LITERAL_MAKE(var_id, false);
+    context->scopes[context->scope_count++] = scope;
+
+    /* guard everything added from here on. */
+    context->cnf->guarded = true;
+    context->cnf->guard = LIBSAT_LITERAL_NEGATE(scope.activation);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
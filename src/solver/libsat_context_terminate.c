@@ -0,0 +1,27 @@
+/**
+ * \file solver/libsat_context_terminate.c
+ *
+ * \brief Ask a solve running in a \ref libsat_context to give up.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+/**
+ * \brief Ask a solve running in this context to give up.
+ *
+ * The request is a flag that every solver of the context checks before each
+ * decision, so it is safe to raise from any thread.
+ *
+ * \param context       The context for this operation.
+ */
+void
+LIBSAT_SYM(libsat_context_terminate)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    atomic_store(&context->terminate, true);
+}
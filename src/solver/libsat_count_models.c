@@ -0,0 +1,143 @@
+/**
+ * \file solver/libsat_count_models.c
+ *
+ * \brief Count the projected models of a \ref libsat_context exactly.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../count/count_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_count_internal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Count the models of this context, projected onto the given
+ * variables.
+ *
+ * The count is found by a search that splits what is left of the constraints
+ * into independent components after each decision, multiplies their counts,
+ * and caches the count of each component it has seen. Clauses, native
+ * constraints, and rows of the native xor matrix are counted directly, as are
+ * the clauses removed by preprocessing. Learned clauses are not needed.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if the count is not zero, unsatisfiable if
+ *                      it is zero, and unknown if the count was stopped.
+ * \param count         Pointer to receive the count, as 32-bit words with the
+ *                      least significant word first. It is owned by the
+ *                      context, and is invalidated by the next count.
+ * \param word_count    Pointer to receive the number of words in the count,
+ *                      which is zero for a count of zero.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_count_models)(
+    int* result, const uint32_t** count, size_t* word_count,
+    LIBSAT_SYM(libsat_context)* context, const size_t* projection,
+    size_t projection_count)
+{
+    status retval, release_retval;
+    libsat_solver* solver;
+    counter counter;
+    const counter_number* number;
+    bool stopped;
+
+    for (size_t i = 0; i < projection_count; ++i)
+    {
+        if (projection[i] >= context->variable_count)
+        {
+            retval = ERROR_LIBSAT_SOLVER_BAD_VARIABLE;
+            goto done;
+        }
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    solver = context->solver;
+
+    retval = counter_init(&counter, context, projection, projection_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_counter;
+    }
+
+    retval = counter_run(&number, &stopped, &counter);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_counter;
+    }
+
+    /* copy the count out of the counter. */
+    if (number->count > solver->count_capacity)
+    {
+        retval =
+            memory_resize(
+                context->alloc, (void**)&solver->count_words,
+                number->count * sizeof(*solver->count_words));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_counter;
+        }
+
+        solver->count_capacity = number->count;
+    }
+
+    if (stopped)
+    {
+        *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        *word_count = 0;
+    }
+    else
+    {
+        *result =
+            counter_number_is_zero(number)
+                ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+                : LIBSAT_SOLVE_RESULT_SATISFIABLE;
+        *word_count = number->count;
+        if (0 != number->count)
+        {
+            memcpy(
+                solver->count_words, number->words,
+                number->count * sizeof(*number->words));
+        }
+    }
+
+    *count = solver->count_words;
+    retval = STATUS_SUCCESS;
+    goto cleanup_counter;
+
+cleanup_counter:
+    release_retval = counter_dispose(&counter);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* a request to terminate ends with this call. */
+    atomic_store(&context->terminate, false);
+
+done:
+    return retval;
+}
@@ -0,0 +1,530 @@
+/**
+ * \file solver/libsat_enumerate_models.c
+ *
+ * \brief Enumerate the projected models of a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief The role of a variable while a model is shrunk.
+ */
+enum enumerate_role
+{
+    /** \brief The variable is not projected, and keeps its value. */
+    ROLE_FREE = 0,
+
+    /** \brief The variable is projected, and may still be left out. */
+    ROLE_CANDIDATE,
+
+    /** \brief The variable is projected, and was needed by a clause with no
+     * other true literal. */
+    ROLE_NEEDED,
+
+    /** \brief The variable is projected, and was picked to satisfy a clause. */
+    ROLE_PICKED,
+
+    /** \brief The variable is projected, and is already in the blocking
+     * clause. */
+    ROLE_BLOCKED,
+};
+
+/* forward decls. */
+typedef struct enumeration
+{
+    libsat_context* context;
+    const size_t* projection;
+    size_t projection_count;
+    uint8_t* roles;
+    size_t role_count;
+    uint8_t* values;
+    libsat_literal* block;
+    uint32_t* counts;
+    size_t count_capacity;
+    bool shrink;
+} enumeration;
+
+static status enumeration_init(
+    enumeration* state, libsat_context* context, const size_t* projection,
+    size_t projection_count);
+static status enumeration_cleanup(enumeration* state, status retval);
+static status shrink(enumeration* state);
+static void cover(enumeration* state, bool pick);
+static void drop_redundant(enumeration* state);
+static status block(enumeration* state);
+
+/**
+ * \brief Enumerate the models of this context, projected onto the given
+ * variables.
+ *
+ * A model is shrunk against the irredundant clauses of the solver, which
+ * include the blocking clauses added so far, so a shrunk model never overlaps
+ * one that was reported before. Projection variables fixed at level zero are
+ * always kept, since the clauses that they satisfy may have been dropped.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param count         Pointer to receive the number of models reported.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ * \param callback      The callback to receive each model.
+ * \param user          The user pointer passed to the callback.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_VARIABLE if a projection variable does not
+ *        exist.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_enumerate_models)(
+    int* result, size_t* count, LIBSAT_SYM(libsat_context)* context,
+    const size_t* projection, size_t projection_count,
+    LIBSAT_SYM(libsat_model_callback) callback, void* user)
+{
+    status retval, release_retval;
+    enumeration state;
+    size_t models = 0;
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    for (size_t i = 0; i < projection_count; ++i)
+    {
+        if (projection[i] >= context->variable_count)
+        {
+            retval = ERROR_LIBSAT_SOLVER_BAD_VARIABLE;
+            goto done;
+        }
+    }
+
+    retval = enumeration_init(&state, context, projection, projection_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = enumeration_cleanup(&state, retval);
+        goto done;
+    }
+
+    /* the blocking clauses are retracted with this scope. */
+    retval = libsat_context_push(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        retval = enumeration_cleanup(&state, retval);
+        goto done;
+    }
+
+    state.shrink =
+        0 == context->cnf->native_count
+     && 0 == context->xor_matrix->row_count;
+
+    for (;;)
+    {
+        retval = libsat_solve_with_assumptions(result, context, NULL, 0);
+        if (
+            STATUS_SUCCESS != retval
+         || LIBSAT_SOLVE_RESULT_SATISFIABLE != *result)
+        {
+            break;
+        }
+
+        retval = shrink(&state);
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+
+        models += 1;
+        if (!callback(user, state.values, projection_count))
+        {
+            break;
+        }
+
+        retval = block(&state);
+        if (STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+    }
+
+    *count = models;
+
+    release_retval = libsat_context_pop(context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    retval = enumeration_cleanup(&state, retval);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Set up the buffers of an enumeration.
+ *
+ * \param state         The enumeration to set up.
+ * \param context       The context for this operation.
+ * \param projection    The ids of the variables to project onto.
+ * \param projection_count The number of projection variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status enumeration_init(
+    enumeration* state, libsat_context* context, const size_t* projection,
+    size_t projection_count)
+{
+    status retval;
+
+    memset(state, 0, sizeof(*state));
+    state->context = context;
+    state->projection = projection;
+    state->projection_count = projection_count;
+    state->role_count = context->variable_count;
+
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&state->roles, state->role_count + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(state->roles, ROLE_FREE, state->role_count + 1);
+
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&state->values, projection_count + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        allocator_allocate(
+            context->alloc, (void**)&state->block,
+            (projection_count + 1) * sizeof(*state->block));
+}
+
+/**
+ * \brief Release the buffers of an enumeration.
+ *
+ * \param state         The enumeration to clean up.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status enumeration_cleanup(enumeration* state, status retval)
+{
+    status release_retval;
+    void* buffers[] = {
+        state->roles, state->values, state->block, state->counts };
+
+    for (size_t i = 0; i < sizeof(buffers) / sizeof(buffers[0]); ++i)
+    {
+        if (NULL != buffers[i])
+        {
+            release_retval =
+                allocator_reclaim(state->context->alloc, buffers[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Shrink the model of the last solve, and fill in the values reported
+ * for it.
+ *
+ * First, a projection variable that is the only true literal of a clause is
+ * needed. Then, each clause still left unsatisfied picks its first true
+ * projection literal. Finally, picked variables that every one of their
+ * clauses can do without are left out again, one at a time, which leaves a
+ * prime implicant.
+ *
+ * \param state         The enumeration state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status shrink(enumeration* state)
+{
+    status retval;
+    libsat_solver* solver = state->context->solver;
+
+    for (size_t i = 0; i < state->projection_count; ++i)
+    {
+        size_t var_id = state->projection[i];
+
+        state->roles[var_id] =
+            (   !state->shrink
+             || LIBSAT_VALUE_UNASSIGNED != solver->values[var_id])
+                ? ROLE_NEEDED : ROLE_CANDIDATE;
+    }
+
+    if (state->shrink)
+    {
+        if (solver->clause_count > state->count_capacity)
+        {
+            retval =
+                memory_resize(
+                    state->context->alloc, (void**)&state->counts,
+                    solver->clause_count * sizeof(*state->counts));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            state->count_capacity = solver->clause_count;
+        }
+
+        cover(state, false);
+        cover(state, true);
+        drop_redundant(state);
+    }
+
+    for (size_t i = 0; i < state->projection_count; ++i)
+    {
+        size_t var_id = state->projection[i];
+
+        state->values[i] =
+            (ROLE_CANDIDATE == state->roles[var_id])
+                ? LIBSAT_VALUE_UNASSIGNED : solver->model[var_id];
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Return true if a literal is true in the model and kept.
+ *
+ * \param state         The enumeration state.
+ * \param lit           The literal to check.
+ *
+ * \returns true if the literal is true and its variable is not left out.
+ */
+static bool kept_true(const enumeration* state, libsat_literal lit)
+{
+    const libsat_solver* solver = state->context->solver;
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+    uint8_t want =
+        LIBSAT_LITERAL_IS_NEGATED(lit) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+
+    return
+        solver->model[var_id] == want
+     && (var_id >= state->role_count || ROLE_CANDIDATE != state->roles[var_id]);
+}
+
+/**
+ * \brief Make sure that every irredundant clause has a kept true literal.
+ *
+ * \param state         The enumeration state.
+ * \param pick          If false, only clauses with a single true literal are
+ *                      covered, by needing it. If true, every clause is
+ *                      covered, by picking its first true literal.
+ */
+static void cover(enumeration* state, bool pick)
+{
+    libsat_solver* solver = state->context->solver;
+
+    for (size_t i = 0; i < solver->clause_count; ++i)
+    {
+        const solver_clause* clause = &solver->clauses[i];
+        const libsat_literal* lits = solver_clause_lits(solver, i);
+        libsat_literal only = 0;
+        size_t candidates = 0;
+        uint32_t kept = 0;
+
+        if (clause->learned || clause->deleted)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < clause->size; ++j)
+        {
+            size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[j]);
+
+            if (kept_true(state, lits[j]))
+            {
+                kept += 1;
+            }
+            else if (
+                solver->model[var_id]
+                    == (LIBSAT_LITERAL_IS_NEGATED(lits[j])
+                            ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE))
+            {
+                if (0 == candidates++)
+                {
+                    only = lits[j];
+                }
+            }
+        }
+
+        if (0 == kept && (1 == candidates || (pick && 0 < candidates)))
+        {
+            state->roles[LIBSAT_LITERAL_VARIABLE(only)] =
+                pick ? ROLE_PICKED : ROLE_NEEDED;
+        }
+    }
+}
+
+/**
+ * \brief Leave out picked variables that no clause needs.
+ *
+ * A picked variable can be left out if every clause that it satisfies has
+ * another kept true literal. Each variable left out lowers those counts, so
+ * variables are checked one at a time.
+ *
+ * \param state         The enumeration state, with every clause covered.
+ */
+static void drop_redundant(enumeration* state)
+{
+    libsat_solver* solver = state->context->solver;
+
+    /* count the kept true literals of each clause. */
+    for (size_t i = 0; i < solver->clause_count; ++i)
+    {
+        const libsat_literal* lits = solver_clause_lits(solver, i);
+
+        state->counts[i] = 0;
+        if (solver->clauses[i].learned || solver->clauses[i].deleted)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < solver->clauses[i].size; ++j)
+        {
+            state->counts[i] += kept_true(state, lits[j]);
+        }
+    }
+
+    for (size_t p = 0; p < state->projection_count; ++p)
+    {
+        size_t var_id = state->projection[p];
+        libsat_literal lit;
+        bool needed = false;
+
+        if (ROLE_PICKED != state->roles[var_id])
+        {
+            continue;
+        }
+
+        lit =
+            LIBSAT_LITERAL_MAKE(
+                var_id, LIBSAT_VALUE_FALSE == solver->model[var_id]);
+
+        for (size_t i = 0; i < solver->clause_count && !needed; ++i)
+        {
+            const solver_clause* clause = &solver->clauses[i];
+            const libsat_literal* lits = solver_clause_lits(solver, i);
+
+            if (clause->learned || clause->deleted || state->counts[i] > 1)
+            {
+                continue;
+            }
+
+            for (size_t j = 0; j < clause->size; ++j)
+            {
+                if (lits[j] == lit)
+                {
+                    needed = true;
+                    break;
+                }
+            }
+        }
+
+        if (needed)
+        {
+            continue;
+        }
+
+        state->roles[var_id] = ROLE_CANDIDATE;
+        for (size_t i = 0; i < solver->clause_count; ++i)
+        {
+            const solver_clause* clause = &solver->clauses[i];
+            const libsat_literal* lits = solver_clause_lits(solver, i);
+
+            if (clause->learned || clause->deleted)
+            {
+                continue;
+            }
+
+            for (size_t j = 0; j < clause->size; ++j)
+            {
+                if (lits[j] == lit)
+                {
+                    state->counts[i] -= 1;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/**
+ * \brief Add a clause blocking the shrunk model.
+ *
+ * \param state         The enumeration state, with the model shrunk.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status block(enumeration* state)
+{
+    libsat_solver* solver = state->context->solver;
+    size_t size = 0;
+
+    for (size_t i = 0; i < state->projection_count; ++i)
+    {
+        size_t var_id = state->projection[i];
+
+        /* a variable projected twice is only blocked once. */
+        if (   ROLE_CANDIDATE != state->roles[var_id]
+            && ROLE_BLOCKED != state->roles[var_id])
+        {
+            state->roles[var_id] = ROLE_BLOCKED;
+            state->block[size++] =
+                LIBSAT_LITERAL_MAKE(
+                    var_id, LIBSAT_VALUE_TRUE == solver->model[var_id]);
+        }
+    }
+
+    return libsat_cnf_add_clause(state->context->cnf, state->block, size);
+}
@@ -0,0 +1,47 @@
+/**
+ * \file solver/libsat_failed_assumptions.c
+ *
+ * \brief Get the failed assumptions from the last solve of a
+ * \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "solver_internal.h"
+
+/**
+ * \brief Get the failed assumptions from the last solve.
+ *
+ * \param core          Pointer to receive the failed assumptions.
+ * \param count         Pointer to receive the number of failed assumptions.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_CORE if the last solve was not
+ *        unsatisfiable.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_failed_assumptions)(
+    const LIBSAT_SYM(libsat_literal)** core, size_t* count,
+    const LIBSAT_SYM(libsat_context)* context)
+{
+    const LIBSAT_SYM(libsat_solver)* solver = context->solver;
+
+    /* an overlay that has never solved has no solver yet. */
+    if (
+        NULL == solver
+     || LIBSAT_SOLVE_RESULT_UNSATISFIABLE != solver->last_result)
+    {
+        return ERROR_LIBSAT_SOLVER_NO_CORE;
+    }
+
+    *core = solver->core;
+    *count = solver->core_count;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,49 @@
+/**
+ * \file solver/libsat_model_value.c
+ *
+ * \brief Get a variable value from the last model found in a
+ * \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "solver_internal.h"
+
+/**
+ * \brief Get the value of a variable in the model found by the last solve.
+ *
+ * Variables created after the last solve are unassigned.
+ *
+ * \param value         Pointer to receive the \ref libsat_value of this
+ *                      variable.
+ * \param context       The context for this operation.
+ * \param var_id        The variable id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NO_MODEL if the last solve was not satisfiable.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_model_value)(
+    uint8_t* value, const LIBSAT_SYM(libsat_context)* context, size_t var_id)
+{
+    const LIBSAT_SYM(libsat_solver)* solver = context->solver;
+
+    /* an overlay that has never solved has no solver yet. */
+    if (
+        NULL == solver
+     || LIBSAT_SOLVE_RESULT_SATISFIABLE != solver->last_result)
+    {
+        return ERROR_LIBSAT_SOLVER_NO_MODEL;
+    }
+
+    *value =
+        (var_id < solver->model_count)
+            ? solver->model[var_id] : LIBSAT_VALUE_UNASSIGNED;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,792 @@
+/**
+ * \file solver/libsat_solve_cube_and_conquer.c
+ *
+ * \brief Solve the statements asserted in a \ref libsat_context by splitting
+ * them into cubes and conquering the cubes in parallel.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief No worker has found an answer yet.
+ */
+#define CONQUER_NO_WINNER                                        ((size_t)-1)
+
+/**
+ * \brief The number of splits made beyond one cube per worker, so that each
+ * worker starts with about eight cubes and stealing can balance the load.
+ */
+#define CONQUER_EXTRA_DEPTH                                                 3
+
+/**
+ * \brief The most splits made along any cube.
+ */
+#define CONQUER_MAX_DEPTH                                                  16
+
+typedef struct conquer conquer;
+
+/**
+ * \brief A single worker, with the range of cubes it owns.
+ *
+ * The owner takes cubes from the front of its range, and thieves take them
+ * from the back.
+ */
+typedef struct conquer_worker conquer_worker;
+struct conquer_worker
+{
+    conquer* c;
+    libsat_solver* solver;
+    libsat_xor_matrix* matrix;
+    size_t index;
+    pthread_t thread;
+    bool started;
+    pthread_mutex_t lock;
+    bool lock_init;
+    size_t begin;
+    size_t end;
+    libsat_literal* assumptions;
+    bool* base_core;
+    status retval;
+    int result;
+};
+
+/**
+ * \brief State shared by all of the workers.
+ */
+struct conquer
+{
+    allocator* alloc;
+    libsat_context* context;
+    const libsat_literal* base;
+    size_t base_count;
+    solver_cube_set cubes;
+    conquer_worker* workers;
+    size_t worker_count;
+    void* ring_memory;
+    solver_ring* rings;
+    atomic_bool stop;
+    atomic_size_t winner;
+};
+
+/* forward decls. */
+static status conquer_init(
+    conquer* c, libsat_context* context, size_t thread_count);
+static status conquer_split(conquer* c, size_t thread_count);
+static status conquer_workers_create(conquer* c, size_t thread_count);
+static status conquer_finish(int* result, conquer* c);
+static status conquer_refuted(conquer* c);
+static status conquer_cleanup(conquer* c);
+static bool conquer_take(size_t* cube, conquer_worker* worker);
+static void conquer_run(conquer_worker* worker);
+static void* conquer_thread(void* arg);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions by
+ * splitting them into cubes, and solving the cubes in parallel.
+ *
+ * The solver of the context runs a lookahead that picks the variables that
+ * propagate the most in both phases, and splits on them until there are about
+ * eight cubes per worker. Each worker then solves cubes under the assumptions
+ * and the cube, taking cubes from its own share first and stealing from the
+ * other workers once its share is gone. Workers share short learned clauses as
+ * in \ref libsat_solve_portfolio.
+ *
+ * A satisfiable cube answers the whole problem. A cube whose failed
+ * assumptions do not involve the cube also answers it. Once every cube is
+ * refuted, the failed assumptions are those used to refute any cube.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ * \param thread_count  The number of workers. With one worker or fewer, this
+ *                      is the same as \ref libsat_solve_with_assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and more than one worker is asked for.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_cube_and_conquer)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count,
+    size_t thread_count)
+{
+    status retval, release_retval;
+    conquer c;
+
+    if (thread_count <= 1)
+    {
+        return
+            libsat_solve_with_assumptions(result, context, assumptions, count);
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* a proof follows a single solver. */
+    if (NULL != context->solver->proof)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED;
+    }
+
+    retval = solver_reactivate(context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = conquer_init(&c, context, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_conquer;
+    }
+
+    retval =
+        solver_scope_assumptions(
+            &c.base, &c.base_count, context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_conquer;
+    }
+
+    retval = conquer_split(&c, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_conquer;
+    }
+
+    /* lookahead alone may decide the problem, or the assumptions. */
+    if (c.cubes.decided)
+    {
+        retval =
+            solver_solve(
+                result, context->solver, context->cnf, context->xor_matrix,
+                context->variable_count, c.base, c.base_count);
+        if (STATUS_SUCCESS == retval)
+        {
+            solver_scope_core_filter(context);
+        }
+
+        goto cleanup_conquer;
+    }
+
+    retval = conquer_workers_create(&c, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_conquer;
+    }
+
+    /* start the other workers on their own threads. */
+    for (size_t i = 1; i < c.worker_count; ++i)
+    {
+        if (
+            0 != pthread_create(
+                    &c.workers[i].thread, NULL, &conquer_thread,
+                    c.workers + i))
+        {
+            atomic_store(&c.stop, true);
+            retval = ERROR_LIBSAT_SOLVER_THREAD_CREATE;
+            break;
+        }
+
+        c.workers[i].started = true;
+    }
+
+    /* the solver of the context runs on this thread. */
+    if (STATUS_SUCCESS == retval)
+    {
+        conquer_run(c.workers);
+    }
+
+    for (size_t i = 1; i < c.worker_count; ++i)
+    {
+        if (c.workers[i].started)
+        {
+            pthread_join(c.workers[i].thread, NULL);
+        }
+    }
+
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = conquer_finish(result, &c);
+    }
+
+cleanup_conquer:
+    release_retval = conquer_cleanup(&c);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    atomic_store(&context->terminate, false);
+
+    return retval;
+}
+
+/**
+ * \brief Initialize the shared state, leaving everything else empty for
+ * \ref conquer_cleanup.
+ *
+ * \param c             The state to initialize.
+ * \param context       The context for this operation.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_init(
+    conquer* c, libsat_context* context, size_t thread_count)
+{
+    status retval;
+
+    memset(c, 0, sizeof(*c));
+    c->alloc = context->alloc;
+    c->context = context;
+    c->cubes.alloc = context->alloc;
+    atomic_init(&c->stop, false);
+    atomic_init(&c->winner, CONQUER_NO_WINNER);
+
+    /* allocate the workers. */
+    retval =
+        allocator_allocate(
+            c->alloc, (void**)&c->workers,
+            thread_count * sizeof(*c->workers));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(c->workers, 0, thread_count * sizeof(*c->workers));
+    c->worker_count = thread_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Split the problem into cubes with the solver of the context.
+ *
+ * \param c             The shared state.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_split(conquer* c, size_t thread_count)
+{
+    status retval;
+    libsat_context* context = c->context;
+    libsat_solver* solver = context->solver;
+    size_t depth = CONQUER_EXTRA_DEPTH;
+
+    /* about eight cubes per worker. */
+    for (size_t n = 1; n < thread_count && depth < CONQUER_MAX_DEPTH; n *= 2)
+    {
+        depth += 1;
+    }
+
+    retval =
+        solver_prepare(
+            solver, context->variable_count, c->base, c->base_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver_backtrack(solver, 0);
+    retval = solver_import(solver, context->cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        solver_cubes(
+            &c->cubes, solver, context->cnf, context->xor_matrix, depth);
+}
+
+/**
+ * \brief Create the workers, hand each an equal share of the cubes, and
+ * attach them to the sharing rings.
+ *
+ * \param c             The shared state.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_workers_create(conquer* c, size_t thread_count)
+{
+    status retval;
+    size_t longest = 0;
+
+    /* allocate the sharing rings. */
+    retval =
+        solver_rings_create(
+            &c->ring_memory, &c->rings, c->alloc, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < c->cubes.cube_count; ++i)
+    {
+        size_t start = (0 == i) ? 0 : c->cubes.ends[i - 1];
+
+        if (c->cubes.ends[i] - start > longest)
+        {
+            longest = c->cubes.ends[i] - start;
+        }
+    }
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        conquer_worker* worker = c->workers + i;
+
+        worker->c = c;
+        worker->index = i;
+        worker->begin = i * c->cubes.cube_count / thread_count;
+        worker->end = (i + 1) * c->cubes.cube_count / thread_count;
+
+        if (0 != pthread_mutex_init(&worker->lock, NULL))
+        {
+            return ERROR_LIBSAT_SOLVER_THREAD_CREATE;
+        }
+
+        worker->lock_init = true;
+
+        if (0 == i)
+        {
+            worker->solver = c->context->solver;
+            worker->matrix = c->context->xor_matrix;
+        }
+        else
+        {
+            retval =
+                solver_worker_create(
+                    &worker->solver, &worker->matrix, c->context, i);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        /* each cube is solved under the assumptions and the cube. */
+        retval =
+            allocator_allocate(
+                c->alloc, (void**)&worker->assumptions,
+                (c->base_count + longest + 1) * sizeof(*worker->assumptions));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (c->base_count > 0)
+        {
+            memcpy(
+                worker->assumptions, c->base,
+                c->base_count * sizeof(*c->base));
+        }
+
+        retval =
+            allocator_allocate(
+                c->alloc, (void**)&worker->base_core,
+                (c->base_count + 1) * sizeof(*worker->base_core));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memset(
+            worker->base_core, 0,
+            (c->base_count + 1) * sizeof(*worker->base_core));
+
+        retval =
+            solver_share_attach(
+                worker->solver, c->rings, thread_count, i, &c->stop);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Report the answer of the winner, or the refutation of every cube,
+ * through the context. After a request to terminate, the answer may be
+ * unknown.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param c             The shared state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_finish(int* result, conquer* c)
+{
+    status retval;
+    libsat_solver* solver;
+    size_t winner = atomic_load(&c->winner);
+
+    /* any failure means that some cube was not solved. */
+    if (CONQUER_NO_WINNER == winner)
+    {
+        for (size_t i = 0; i < c->worker_count; ++i)
+        {
+            if (STATUS_SUCCESS != c->workers[i].retval)
+            {
+                return c->workers[i].retval;
+            }
+        }
+
+        /* a request to terminate may have left cubes unsolved. */
+        if (atomic_load(&c->context->terminate))
+        {
+            solver = c->context->solver;
+            solver->last_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+            solver->core_count = 0;
+            solver->model_count = 0;
+            *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+            return STATUS_SUCCESS;
+        }
+
+        retval = conquer_refuted(c);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+    else if (0 != winner)
+    {
+        retval =
+            solver_result_copy(c->context->solver, c->workers[winner].solver);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the caller only sees its own assumptions in the core. */
+    solver_scope_core_filter(c->context);
+    *result = c->context->solver->last_result;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Record that every cube is refuted.
+ *
+ * The failed assumptions are every assumption used to refute a cube. If
+ * lookahead refuted a branch on its own, it used all of them.
+ *
+ * \param c             The shared state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_refuted(conquer* c)
+{
+    status retval;
+    libsat_solver* solver = c->context->solver;
+    size_t size = c->base_count;
+
+    /* keep room for as many as the assumptions. */
+    if (solver->assumption_capacity > size)
+    {
+        size = solver->assumption_capacity;
+    }
+
+    retval =
+        memory_resize(
+            solver->alloc, (void**)&solver->core,
+            (size + 1) * sizeof(*solver->core));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver->core_count = 0;
+    for (size_t i = 0; i < c->base_count; ++i)
+    {
+        bool used = c->cubes.refuted;
+
+        for (size_t j = 0; j < c->worker_count && !used; ++j)
+        {
+            used = c->workers[j].base_core[i];
+        }
+
+        if (used)
+        {
+            solver->core[solver->core_count++] = c->base[i];
+        }
+    }
+
+    solver->model_count = 0;
+    solver->last_result = LIBSAT_SOLVE_RESULT_UNSATISFIABLE;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the workers, cubes, and rings, and detach the solver of the
+ * context from them.
+ *
+ * \param c             The shared state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status conquer_cleanup(conquer* c)
+{
+    status retval = STATUS_SUCCESS;
+    status release_retval;
+
+    /* the solver of the context goes back to solving alone. */
+    solver_share_detach(c->context->solver);
+
+    for (size_t i = 0; i < c->worker_count; ++i)
+    {
+        conquer_worker* worker = c->workers + i;
+
+        if (worker->lock_init)
+        {
+            pthread_mutex_destroy(&worker->lock);
+        }
+
+        if (NULL != worker->assumptions)
+        {
+            release_retval = allocator_reclaim(c->alloc, worker->assumptions);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        if (NULL != worker->base_core)
+        {
+            release_retval = allocator_reclaim(c->alloc, worker->base_core);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        if (0 == i)
+        {
+            continue;
+        }
+
+        if (NULL != worker->solver)
+        {
+            release_retval = resource_release(&worker->solver->hdr);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        if (NULL != worker->matrix)
+        {
+            release_retval =
+                resource_release(
+                    libsat_xor_matrix_resource_handle(worker->matrix));
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    release_retval = solver_cubes_dispose(&c->cubes);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    if (NULL != c->ring_memory)
+    {
+        release_retval = allocator_reclaim(c->alloc, c->ring_memory);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != c->workers)
+    {
+        release_retval = allocator_reclaim(c->alloc, c->workers);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Take the next cube for a worker, stealing one from the back of
+ * another worker's share once its own share is gone.
+ *
+ * \param cube          Pointer to receive the index of the cube.
+ * \param worker        The worker taking a cube.
+ *
+ * \returns true if a cube was taken, or false if none are left.
+ */
+static bool conquer_take(size_t* cube, conquer_worker* worker)
+{
+    conquer* c = worker->c;
+    bool found = false;
+
+    pthread_mutex_lock(&worker->lock);
+    if (worker->begin < worker->end)
+    {
+        *cube = worker->begin++;
+        found = true;
+    }
+    pthread_mutex_unlock(&worker->lock);
+
+    /* steal, starting with the next worker over. */
+    for (size_t i = 1; i < c->worker_count && !found; ++i)
+    {
+        conquer_worker* victim =
+            c->workers + (worker->index + i) % c->worker_count;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->begin < victim->end)
+        {
+            *cube = --victim->end;
+            found = true;
+        }
+        pthread_mutex_unlock(&victim->lock);
+    }
+
+    return found;
+}
+
+/**
+ * \brief Solve cubes until none are left, or until some worker answers the
+ * whole problem.
+ *
+ * A worker that fails stops the others as well.
+ *
+ * \param worker        The worker to run.
+ */
+static void conquer_run(conquer_worker* worker)
+{
+    conquer* c = worker->c;
+    size_t cube;
+
+    worker->result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    while (!atomic_load(&c->stop) && conquer_take(&cube, worker))
+    {
+        size_t start = (0 == cube) ? 0 : c->cubes.ends[cube - 1];
+        size_t size = c->cubes.ends[cube] - start;
+        size_t expected = CONQUER_NO_WINNER;
+        bool involves_cube = false;
+
+        if (size > 0)
+        {
+            memcpy(
+                worker->assumptions + c->base_count, c->cubes.lits + start,
+                size * sizeof(*worker->assumptions));
+        }
+
+        worker->retval =
+            solver_solve(
+                &worker->result, worker->solver, c->context->cnf,
+                worker->matrix, c->context->variable_count,
+                worker->assumptions, c->base_count + size);
+        if (STATUS_SUCCESS != worker->retval)
+        {
+            atomic_store(&c->stop, true);
+            return;
+        }
+
+        if (LIBSAT_SOLVE_RESULT_UNKNOWN == worker->result)
+        {
+            return;
+        }
+
+        /* sort the failed assumptions into the cube and the rest. */
+        for (size_t i = 0; i < worker->solver->core_count; ++i)
+        {
+            libsat_literal lit = worker->solver->core[i];
+            bool in_base = false;
+
+            for (size_t j = 0; j < c->base_count && !in_base; ++j)
+            {
+                if (c->base[j] == lit)
+                {
+                    worker->base_core[j] = true;
+                    in_base = true;
+                }
+            }
+
+            involves_cube = involves_cube || !in_base;
+        }
+
+        /* a model, or a refutation without the cube, answers everything. */
+        if (
+            LIBSAT_SOLVE_RESULT_SATISFIABLE == worker->result
+         || !involves_cube)
+        {
+            atomic_compare_exchange_strong(
+                &c->winner, &expected, worker->index);
+            atomic_store(&c->stop, true);
+            return;
+        }
+    }
+}
+
+/**
+ * \brief Thread entry point for a worker.
+ */
+static void* conquer_thread(void* arg)
+{
+    conquer_run((conquer_worker*)arg);
+
+    return NULL;
+}
@@ -0,0 +1,861 @@
+/**
+ * \file solver/libsat_solve_maxsat.c
+ *
+ * \brief Find the cheapest way to violate the soft statements of a
+ * \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+#define MAXSAT_NONE ((size_t)-1)
+
+/* forward decls. */
+typedef struct maxsat_term
+{
+    libsat_literal lit;
+    uint64_t weight;
+    uint64_t cost;
+    size_t sum;
+    size_t bound;
+    bool extended;
+} maxsat_term;
+
+typedef struct maxsat_sum
+{
+    size_t start;
+    size_t count;
+    uint64_t weight;
+} maxsat_sum;
+
+typedef struct maxsat_search
+{
+    libsat_context* context;
+    maxsat_term* terms;
+    size_t term_count;
+    size_t term_capacity;
+    size_t soft_count;
+    maxsat_sum* sums;
+    size_t sum_count;
+    size_t sum_capacity;
+    libsat_literal* inputs;
+    size_t input_count;
+    size_t input_capacity;
+    libsat_literal* lits;
+    size_t lit_capacity;
+    uint64_t* weights;
+    size_t weight_capacity;
+    size_t* slots;
+    size_t slot_capacity;
+    uint8_t* best;
+    size_t best_capacity;
+    uint64_t best_cost;
+    bool found;
+} maxsat_search;
+
+static status search_init(maxsat_search* search);
+static status search_dispose(maxsat_search* search);
+static status linear(int* result, maxsat_search* search);
+static status core_guided(int* result, maxsat_search* search);
+static status relax(maxsat_search* search, size_t core_count);
+static status add_output(maxsat_search* search, size_t sum, size_t bound);
+static status add_term(
+    maxsat_search* search, libsat_literal lit, uint64_t weight, size_t sum,
+    size_t bound);
+static status record_model(maxsat_search* search);
+static status restore_best(int* result, maxsat_search* search);
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size);
+
+/**
+ * \brief Solve this context for the cheapest set of soft statements to
+ * violate.
+ *
+ * Soft statements are those parsed with a weight, such as [5] a ∨ b; the cost
+ * of a model is the sum of the weights of the soft statements it violates.
+ * Every statement without a weight must hold.
+ *
+ * The core-guided strategy assumes every soft statement, and while the solve
+ * fails, charges the smallest weight of its failed assumptions to the lower
+ * bound and takes that weight off each of them, as in OLL. The failed
+ * assumptions then feed a new sum, whose outputs say that at least two, then
+ * three, and so on of them are violated; each output is a native constraint
+ * over the sum, created once the output before it has been charged. The first
+ * model found is optimal. The linear strategy instead finds any model, then
+ * adds a native constraint that the next model must cost less, until none
+ * does.
+ *
+ * Either strategy works in a scope, so that nothing it adds outlives the call.
+ * The optimal model is solved for once more afterward, and can be read with
+ * \ref libsat_model_value.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result: it is
+ *                      satisfiable if an optimal model was found,
+ *                      unsatisfiable if the statements without a weight can
+ *                      not hold, and unknown if a solve gave up.
+ * \param cost          Pointer to receive the cost of the optimal model, or of
+ *                      the best model found if a solve gave up, or UINT64_MAX
+ *                      if there is no such model.
+ * \param context       The context for this operation.
+ * \param strategy      The \ref libsat_maxsat_strategy to use.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if the strategy is not recognized.
+ *      - ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW if the weights of the soft
+ *        statements sum past 64 bits.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_maxsat)(
+    int* result, uint64_t* cost, LIBSAT_SYM(libsat_context)* context,
+    int strategy)
+{
+    status retval, release_retval;
+    maxsat_search search;
+
+    if (
+        LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED != strategy
+     && LIBSAT_MAXSAT_STRATEGY_LINEAR != strategy)
+    {
+        retval = ERROR_LIBSAT_SOLVER_BAD_OPTION;
+        goto done;
+    }
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    memset(&search, 0, sizeof(search));
+    search.context = context;
+    search.best_cost = UINT64_MAX;
+
+    retval = search_init(&search);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_search;
+    }
+
+    retval = libsat_context_push(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_search;
+    }
+
+    if (LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED == strategy)
+    {
+        retval = core_guided(result, &search);
+    }
+    else
+    {
+        retval = linear(result, &search);
+    }
+
+    release_retval = libsat_context_pop(context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_search;
+    }
+
+    /* solve for the best model outside of the scope. */
+    if (search.found)
+    {
+        retval = restore_best(result, &search);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_search;
+        }
+    }
+
+    *cost = search.best_cost;
+    retval = STATUS_SUCCESS;
+    goto cleanup_search;
+
+cleanup_search:
+    release_retval = search_dispose(&search);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    /* a request to terminate ends with this call. */
+    atomic_store(&context->terminate, false);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Gather the soft statements of the context as terms, merging the
+ * weights of statements with the same literal.
+ *
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW if the weights sum past 64 bits.
+ *      - a non-zero error code on failure.
+ */
+static status search_init(maxsat_search* search)
+{
+    status retval;
+    libsat_context* context = search->context;
+    libsat_literal lit;
+    size_t slot;
+    uint64_t total = 0;
+
+    for (size_t i = 0; i < context->soft_count; ++i)
+    {
+        if (context->soft_weights[i] > UINT64_MAX - total)
+        {
+            return ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW;
+        }
+
+        total += context->soft_weights[i];
+        lit = solver_alias_find(context, context->soft_literals[i]);
+        slot = (lit < search->slot_capacity) ? search->slots[lit] : 0;
+        if (0 != slot)
+        {
+            search->terms[slot - 1].weight += context->soft_weights[i];
+            search->terms[slot - 1].cost += context->soft_weights[i];
+            continue;
+        }
+
+        retval =
+            add_term(
+                search, lit, context->soft_weights[i], MAXSAT_NONE,
+                MAXSAT_NONE);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    search->soft_count = search->term_count;
+
+    return
+        reserve(
+            context->alloc, (void**)&search->best, &search->best_capacity,
+            search->soft_count, sizeof(*search->best));
+}
+
+/**
+ * \brief Release the arrays of the search state.
+ *
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status search_dispose(maxsat_search* search)
+{
+    status retval = STATUS_SUCCESS, release_retval;
+    allocator* alloc = search->context->alloc;
+    void* arrays[] = {
+        search->terms, search->sums, search->inputs, search->lits,
+        search->weights, search->slots, search->best };
+
+    for (size_t i = 0; i < sizeof(arrays) / sizeof(arrays[0]); ++i)
+    {
+        if (NULL != arrays[i])
+        {
+            release_retval = allocator_reclaim(alloc, arrays[i]);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Search from above: find a model, then require a cheaper one until
+ * there is none.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status linear(int* result, maxsat_search* search)
+{
+    status retval;
+    libsat_context* context = search->context;
+    int step;
+
+    retval =
+        reserve(
+            context->alloc, (void**)&search->lits, &search->lit_capacity,
+            search->soft_count, sizeof(*search->lits));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        reserve(
+            context->alloc, (void**)&search->weights,
+            &search->weight_capacity, search->soft_count,
+            sizeof(*search->weights));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the cost counts the weight of each violated term. */
+    for (size_t i = 0; i < search->soft_count; ++i)
+    {
+        search->lits[i] = LIBSAT_LITERAL_NEGATE(search->terms[i].lit);
+        search->weights[i] = search->terms[i].weight;
+    }
+
+    for (;;)
+    {
+        retval = libsat_solve_with_assumptions(&step, context, NULL, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (LIBSAT_SOLVE_RESULT_SATISFIABLE != step)
+        {
+            break;
+        }
+
+        retval = record_model(search);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (0 == search->best_cost)
+        {
+            break;
+        }
+
+        retval =
+            libsat_cnf_add_pseudo_boolean(
+                context->cnf, search->lits, search->weights,
+                search->soft_count, LIBSAT_CNF_RELATION_AT_MOST,
+                search->best_cost - 1, LIBSAT_CNF_ENCODING_NATIVE);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* no cheaper model means the best one is optimal. */
+    if (LIBSAT_SOLVE_RESULT_UNKNOWN == step)
+    {
+        *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    }
+    else if (search->found)
+    {
+        *result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    }
+    else
+    {
+        *result = LIBSAT_SOLVE_RESULT_UNSATISFIABLE;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Search from below: relax each core of the assumed terms until the
+ * terms that are left can all hold.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status core_guided(int* result, maxsat_search* search)
+{
+    status retval;
+    libsat_context* context = search->context;
+    const libsat_literal* core;
+    size_t core_count, assumed, kept;
+
+    for (;;)
+    {
+        retval =
+            reserve(
+                context->alloc, (void**)&search->lits, &search->lit_capacity,
+                search->term_count, sizeof(*search->lits));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* assume every term that still has weight. */
+        assumed = 0;
+        for (size_t i = 0; i < search->term_count; ++i)
+        {
+            if (0 != search->terms[i].weight)
+            {
+                search->lits[assumed++] = search->terms[i].lit;
+            }
+        }
+
+        retval =
+            libsat_solve_with_assumptions(
+                result, context, search->lits, assumed);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (LIBSAT_SOLVE_RESULT_SATISFIABLE == *result)
+        {
+            return record_model(search);
+        }
+        else if (LIBSAT_SOLVE_RESULT_UNKNOWN == *result)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        retval = libsat_failed_assumptions(&core, &core_count, context);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        /* an empty core means that the hard statements can not hold. */
+        if (0 == core_count)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        /* the core is owned by the solver, so copy its terms before
+         * relaxing. */
+        kept = 0;
+        for (size_t i = 0; i < core_count; ++i)
+        {
+            if (
+                core[i] < search->slot_capacity
+             && 0 != search->slots[core[i]])
+            {
+                search->lits[kept++] = core[i];
+            }
+        }
+
+        retval = relax(search, kept);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+}
+
+/**
+ * \brief Relax the terms of a core, which is held in the literal scratch.
+ *
+ * The smallest weight of the core is taken off each of its terms. A sum
+ * output in the core may now be violated, so the next output of its sum is
+ * created. A core of one term can never hold, so it is made false; a larger
+ * core gets a sum of its own, whose first output to cost anything says that
+ * at least two of its terms are violated.
+ *
+ * \param search        The search state.
+ * \param core_count    The number of literals in the core.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status relax(maxsat_search* search, size_t core_count)
+{
+    status retval;
+    libsat_context* context = search->context;
+    maxsat_term* term;
+    maxsat_sum* sum;
+    libsat_literal unit;
+    uint64_t least = UINT64_MAX;
+    size_t index, start;
+
+    for (size_t i = 0; i < core_count; ++i)
+    {
+        term = &search->terms[search->slots[search->lits[i]] - 1];
+        if (term->weight < least)
+        {
+            least = term->weight;
+        }
+    }
+
+    /* the inputs of the new sum are the violations of the core. */
+    retval =
+        reserve(
+            context->alloc, (void**)&search->inputs, &search->input_capacity,
+            search->input_count + core_count, sizeof(*search->inputs));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    start = search->input_count;
+    for (size_t i = 0; i < core_count; ++i)
+    {
+        index = search->slots[search->lits[i]] - 1;
+        term = &search->terms[index];
+        term->weight -= least;
+        search->inputs[search->input_count++] =
+            LIBSAT_LITERAL_NEGATE(term->lit);
+
+        if (MAXSAT_NONE != term->sum && !term->extended)
+        {
+            term->extended = true;
+            retval = add_output(search, term->sum, term->bound + 1);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+    }
+
+    if (1 == core_count)
+    {
+        search->input_count = start;
+        unit = LIBSAT_LITERAL_NEGATE(search->lits[0]);
+
+        return libsat_cnf_add_clause(context->cnf, &unit, 1);
+    }
+
+    retval =
+        reserve(
+            context->alloc, (void**)&search->sums, &search->sum_capacity,
+            search->sum_count + 1, sizeof(*search->sums));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    sum = &search->sums[search->sum_count++];
+    sum->start = start;
+    sum->count = core_count;
+    sum->weight = least;
+
+    return add_output(search, search->sum_count - 1, 2);
+}
+
+/**
+ * \brief Create the output of a sum that holds when at least bound of its
+ * inputs are true, and add its negation as a term with the weight of the sum.
+ *
+ * The output o is defined by the native constraint
+ * sum(inputs) + (n - bound + 1) · ¬o ≤ n over the n inputs, so that o is
+ * forced once bound of the inputs are true.
+ *
+ * \param search        The search state.
+ * \param sum           The index of the sum.
+ * \param bound         The bound of the output.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status add_output(maxsat_search* search, size_t sum, size_t bound)
+{
+    status retval;
+    libsat_context* context = search->context;
+    size_t count = search->sums[sum].count;
+    libsat_literal output;
+    size_t var_id;
+
+    /* no more than every input can be true. */
+    if (bound > count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        libsat_context_variable_get(
+            &var_id, context, NULL,
+            LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    output = LIBSAT_LITERAL_MAKE(var_id, false);
+
+    /* the term scratch is in use, so the constraint is built in the inputs. */
+    retval =
+        reserve(
+            context->alloc, (void**)&search->inputs, &search->input_capacity,
+            search->input_count + count + 1, sizeof(*search->inputs));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        reserve(
+            context->alloc, (void**)&search->weights,
+            &search->weight_capacity, count + 1, sizeof(*search->weights));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(
+        search->inputs + search->input_count,
+        search->inputs + search->sums[sum].start,
+        count * sizeof(*search->inputs));
+    search->inputs[search->input_count + count] =
+        LIBSAT_LITERAL_NEGATE(output);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        search->weights[i] = 1;
+    }
+
+    search->weights[count] = count - bound + 1;
+
+    retval =
+        libsat_cnf_add_pseudo_boolean(
+            context->cnf, search->inputs + search->input_count,
+            search->weights, count + 1, LIBSAT_CNF_RELATION_AT_MOST, count,
+            LIBSAT_CNF_ENCODING_NATIVE);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        add_term(
+            search, LIBSAT_LITERAL_NEGATE(output), search->sums[sum].weight,
+            sum, bound);
+}
+
+/**
+ * \brief Add a term, and index it by its literal.
+ *
+ * \param search        The search state.
+ * \param lit           The literal that the term wants to be true.
+ * \param weight        The weight of the term.
+ * \param sum           The sum that the term is an output of, or MAXSAT_NONE.
+ * \param bound         The bound of that output.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status add_term(
+    maxsat_search* search, libsat_literal lit, uint64_t weight, size_t sum,
+    size_t bound)
+{
+    status retval;
+    allocator* alloc = search->context->alloc;
+    size_t slot_capacity = search->slot_capacity;
+    maxsat_term* term;
+
+    retval =
+        reserve(
+            alloc, (void**)&search->terms, &search->term_capacity,
+            search->term_count + 1, sizeof(*search->terms));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        reserve(
+            alloc, (void**)&search->slots, &search->slot_capacity, lit + 1,
+            sizeof(*search->slots));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(
+        search->slots + slot_capacity, 0,
+        (search->slot_capacity - slot_capacity) * sizeof(*search->slots));
+
+    term = &search->terms[search->term_count++];
+    term->lit = lit;
+    term->weight = weight;
+    term->cost = weight;
+    term->sum = sum;
+    term->bound = bound;
+    term->extended = false;
+    search->slots[lit] = search->term_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Price the model of the last solve, and keep it if it is the best so
+ * far.
+ *
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status record_model(maxsat_search* search)
+{
+    status retval;
+    uint64_t cost = 0;
+    bool kept = false;
+
+    /* the first pass prices the model, and the second keeps it. */
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (size_t i = 0; i < search->soft_count; ++i)
+        {
+            const maxsat_term* term = &search->terms[i];
+            uint8_t value;
+
+            retval =
+                libsat_model_value(
+                    &value, search->context,
+                    LIBSAT_LITERAL_VARIABLE(term->lit));
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            if (LIBSAT_LITERAL_IS_NEGATED(term->lit))
+            {
+                value =
+                    (LIBSAT_VALUE_TRUE == value)
+                        ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+            }
+
+            if (kept)
+            {
+                search->best[i] = (LIBSAT_VALUE_TRUE == value);
+            }
+            else if (LIBSAT_VALUE_TRUE != value)
+            {
+                cost += term->cost;
+            }
+        }
+
+        if (search->found && cost >= search->best_cost)
+        {
+            return STATUS_SUCCESS;
+        }
+
+        kept = true;
+    }
+
+    search->best_cost = cost;
+    search->found = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Solve for the best model again, assuming the terms that it satisfies.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result; the
+ *                      result of the search is kept unless this solve gives
+ *                      up.
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status restore_best(int* result, maxsat_search* search)
+{
+    status retval;
+    size_t assumed = 0;
+    int step;
+
+    for (size_t i = 0; i < search->soft_count; ++i)
+    {
+        if (search->best[i])
+        {
+            search->lits[assumed++] = search->terms[i].lit;
+        }
+    }
+
+    retval =
+        libsat_solve_with_assumptions(
+            &step, search->context, search->lits, assumed);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (LIBSAT_SOLVE_RESULT_SATISFIABLE != step)
+    {
+        *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Grow an array to hold at least count elements.
+ */
+static status reserve(
+    allocator* alloc, void** array, size_t* capacity, size_t count,
+    size_t size)
+{
+    status retval;
+    size_t grown;
+
+    if (count <= *capacity)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    grown = (0 == *capacity) ? 16 : 2 * *capacity;
+    while (grown < count)
+    {
+        grown *= 2;
+    }
+
+    retval = memory_resize(alloc, array, grown * size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    *capacity = grown;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,27 @@
+/**
+ * \file solver/libsat_solve_options_init.c
+ *
+ * \brief Set up the default options of a solve.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <string.h>
+
+/**
+ * \brief Set solve options to their defaults.
+ *
+ * \param options       The options to set up.
+ */
+void
+LIBSAT_SYM(libsat_solve_options_init)(
+    LIBSAT_SYM(libsat_solve_options)* options)
+{
+    memset(options, 0, sizeof(*options));
+
+    options->heuristic = LIBSAT_SOLVE_HEURISTIC_EVSIDS;
+    options->restart = LIBSAT_SOLVE_RESTART_LUBY;
+    options->rephase = false;
+}
@@ -0,0 +1,430 @@
+/**
+ * \file solver/libsat_solve_portfolio.c
+ *
+ * \brief Solve the statements asserted in a \ref libsat_context with a
+ * portfolio of diversified workers.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <pthread.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief No worker has found an answer yet.
+ */
+#define PORTFOLIO_NO_WINNER                                      ((size_t)-1)
+
+/**
+ * \brief A single worker in the portfolio.
+ */
+typedef struct portfolio_worker portfolio_worker;
+struct portfolio_worker
+{
+    libsat_solver* solver;
+    libsat_xor_matrix* matrix;
+    const libsat_cnf* cnf;
+    size_t var_count;
+    const libsat_literal* assumptions;
+    size_t count;
+    size_t index;
+    atomic_bool* stop;
+    atomic_size_t* winner;
+    pthread_t thread;
+    bool started;
+    status retval;
+    int result;
+};
+
+/**
+ * \brief State shared by all of the workers in the portfolio.
+ */
+typedef struct portfolio portfolio;
+struct portfolio
+{
+    allocator* alloc;
+    portfolio_worker* workers;
+    size_t worker_count;
+    void* ring_memory;
+    solver_ring* rings;
+    atomic_bool stop;
+    atomic_size_t winner;
+};
+
+/* forward decls. */
+static status portfolio_init(
+    portfolio* p, libsat_context* context, const libsat_literal* assumptions,
+    size_t count, size_t thread_count);
+static status portfolio_cleanup(portfolio* p, libsat_context* context);
+static void portfolio_run(portfolio_worker* worker);
+static void* portfolio_thread(void* arg);
+
+/**
+ * \brief Solve the asserted statements under the given assumptions with a
+ * portfolio of diversified workers running in parallel.
+ *
+ * The solver of the context runs on the calling thread, and each other worker
+ * runs on its own thread with a fresh solver and its own copy of the native
+ * xor matrix. Workers differ in seed, restart policy, and initial phase, and
+ * share learned clauses with a low LBD through lock-free rings. The first
+ * worker to reach an answer stops the others, and its model or core is
+ * reported through the context as for \ref libsat_solve_with_assumptions.
+ *
+ * \note The allocator of the context must be safe to use from several threads
+ * at once.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ * \param thread_count  The number of workers. With one worker or fewer, this
+ *                      is the same as \ref libsat_solve_with_assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_THREAD_CREATE if a worker thread could not be
+ *        started.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and more than one worker is asked for.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_portfolio)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count,
+    size_t thread_count)
+{
+    status retval, release_retval;
+    portfolio p;
+    size_t winner;
+
+    if (thread_count <= 1)
+    {
+        return
+            libsat_solve_with_assumptions(result, context, assumptions, count);
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* a proof follows a single solver. */
+    if (NULL != context->solver->proof)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED;
+    }
+
+    retval = solver_reactivate(context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = portfolio_init(&p, context, assumptions, count, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_portfolio;
+    }
+
+    /* start the other workers on their own threads. */
+    for (size_t i = 1; i < p.worker_count; ++i)
+    {
+        if (
+            0 != pthread_create(
+                    &p.workers[i].thread, NULL, &portfolio_thread,
+                    p.workers + i))
+        {
+            atomic_store(&p.stop, true);
+            retval = ERROR_LIBSAT_SOLVER_THREAD_CREATE;
+            break;
+        }
+
+        p.workers[i].started = true;
+    }
+
+    /* the solver of the context runs on this thread. */
+    if (STATUS_SUCCESS == retval)
+    {
+        portfolio_run(p.workers);
+    }
+
+    for (size_t i = 1; i < p.worker_count; ++i)
+    {
+        if (p.workers[i].started)
+        {
+            pthread_join(p.workers[i].thread, NULL);
+        }
+    }
+
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_portfolio;
+    }
+
+    /* without a winner, report the first failure. */
+    winner = atomic_load(&p.winner);
+    if (PORTFOLIO_NO_WINNER == winner)
+    {
+        for (size_t i = 0; i < p.worker_count; ++i)
+        {
+            if (STATUS_SUCCESS != p.workers[i].retval)
+            {
+                retval = p.workers[i].retval;
+                goto cleanup_portfolio;
+            }
+        }
+
+        *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        goto cleanup_portfolio;
+    }
+
+    /* report the answer of the winner through the context. */
+    if (0 != winner)
+    {
+        retval =
+            solver_result_copy(context->solver, p.workers[winner].solver);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_portfolio;
+        }
+    }
+
+    /* the caller only sees its own assumptions in the core. */
+    solver_scope_core_filter(context);
+    *result = p.workers[winner].result;
+
+cleanup_portfolio:
+    release_retval = portfolio_cleanup(&p, context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    atomic_store(&context->terminate, false);
+
+    return retval;
+}
+
+/**
+ * \brief Create the workers and sharing rings of a portfolio.
+ *
+ * On failure, whatever was created is left for \ref portfolio_cleanup.
+ *
+ * \param p             The portfolio to initialize.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ * \param thread_count  The number of workers.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status portfolio_init(
+    portfolio* p, libsat_context* context, const libsat_literal* assumptions,
+    size_t count, size_t thread_count)
+{
+    status retval;
+    const libsat_literal* lits;
+    size_t total;
+
+    memset(p, 0, sizeof(*p));
+    p->alloc = context->alloc;
+    atomic_init(&p->stop, false);
+    atomic_init(&p->winner, PORTFOLIO_NO_WINNER);
+
+    retval =
+        solver_scope_assumptions(&lits, &total, context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* allocate the workers. */
+    retval =
+        allocator_allocate(
+            p->alloc, (void**)&p->workers,
+            thread_count * sizeof(*p->workers));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(p->workers, 0, thread_count * sizeof(*p->workers));
+    p->worker_count = thread_count;
+
+    /* allocate the sharing rings. */
+    retval =
+        solver_rings_create(
+            &p->ring_memory, &p->rings, p->alloc, thread_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* set up each worker. */
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        portfolio_worker* worker = p->workers + i;
+
+        worker->cnf = context->cnf;
+        worker->var_count = context->variable_count;
+        worker->assumptions = lits;
+        worker->count = total;
+        worker->index = i;
+        worker->stop = &p->stop;
+        worker->winner = &p->winner;
+
+        if (0 == i)
+        {
+            worker->solver = context->solver;
+            worker->matrix = context->xor_matrix;
+        }
+        else
+        {
+            retval =
+                solver_worker_create(
+                    &worker->solver, &worker->matrix, context, i);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+
+        retval =
+            solver_share_attach(
+                worker->solver, p->rings, thread_count, i, &p->stop);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Release the workers and sharing rings of a portfolio, and detach the
+ * solver of the context from them.
+ *
+ * \param p             The portfolio to clean up.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status portfolio_cleanup(portfolio* p, libsat_context* context)
+{
+    status retval = STATUS_SUCCESS;
+    status release_retval;
+
+    /* the solver of the context goes back to solving alone. */
+    solver_share_detach(context->solver);
+
+    for (size_t i = 1; i < p->worker_count; ++i)
+    {
+        portfolio_worker* worker = p->workers + i;
+
+        if (NULL != worker->solver)
+        {
+            release_retval = resource_release(&worker->solver->hdr);
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+
+        if (NULL != worker->matrix)
+        {
+            release_retval =
+                resource_release(
+                    libsat_xor_matrix_resource_handle(worker->matrix));
+            if (STATUS_SUCCESS != release_retval)
+            {
+                retval = release_retval;
+            }
+        }
+    }
+
+    if (NULL != p->ring_memory)
+    {
+        release_retval = allocator_reclaim(p->alloc, p->ring_memory);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != p->workers)
+    {
+        release_retval = allocator_reclaim(p->alloc, p->workers);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
+
+/**
+ * \brief Run one worker to completion, and claim the win if it is the first
+ * to reach an answer.
+ *
+ * A worker that fails stops the others as well.
+ *
+ * \param worker        The worker to run.
+ */
+static void portfolio_run(portfolio_worker* worker)
+{
+    size_t expected = PORTFOLIO_NO_WINNER;
+
+    worker->result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    worker->retval =
+        solver_solve(
+            &worker->result, worker->solver, worker->cnf, worker->matrix,
+            worker->var_count, worker->assumptions, worker->count);
+    if (STATUS_SUCCESS != worker->retval)
+    {
+        atomic_store(worker->stop, true);
+        return;
+    }
+
+    if (LIBSAT_SOLVE_RESULT_UNKNOWN != worker->result)
+    {
+        atomic_compare_exchange_strong(
+            worker->winner, &expected, worker->index);
+        atomic_store(worker->stop, true);
+    }
+}
+
+/**
+ * \brief Thread entry point for a worker.
+ */
+static void* portfolio_thread(void* arg)
+{
+    portfolio_run((portfolio_worker*)arg);
+
+    return NULL;
+}
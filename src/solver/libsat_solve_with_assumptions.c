@@ -0,0 +1,47 @@
+/**
+ * \file solver/libsat_solve_with_assumptions.c
+ *
+ * \brief Solve the statements asserted in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+LIBSAT_IMPORT_solver;
+
+/**
+ * \brief Solve the asserted statements under the given assumptions.
+ *
+ * This solves with the default options.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if a proof is being written, and the
+ *        database has changed since it began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and the database holds native constraints or parity statements.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if the proof could not be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_with_assumptions)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count)
+{
+    libsat_solve_options options;
+
+    libsat_solve_options_init(&options);
+
+    return
+        libsat_solve_with_options(
+            result, context, &options, assumptions, count);
+}
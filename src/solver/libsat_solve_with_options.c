@@ -0,0 +1,120 @@
+/**
+ * \file solver/libsat_solve_with_options.c
+ *
+ * \brief Solve the statements asserted in a \ref libsat_context, with
+ * options for this call.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Solve the asserted statements under the given assumptions, with
+ * options for this call.
+ *
+ * The activation literal of every open scope is assumed ahead of the given
+ * assumptions, and is left out of the failed assumptions. The limits of the
+ * options are set for this call only.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param context       The context for this operation.
+ * \param options       The options for this call.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_BAD_OPTION if an option is out of range.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if a proof is being written, and the
+ *        database has changed since it began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if a proof is being written,
+ *        and the database holds native constraints or parity statements.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if the proof could not be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_solve_with_options)(
+    int* result, LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_solve_options)* options,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count)
+{
+    status retval;
+    const libsat_literal* lits;
+    size_t total;
+
+    switch (options->heuristic)
+    {
+        case LIBSAT_SOLVE_HEURISTIC_EVSIDS:
+        case LIBSAT_SOLVE_HEURISTIC_VMTF:
+            break;
+
+        default:
+            return ERROR_LIBSAT_SOLVER_BAD_OPTION;
+    }
+
+    switch (options->restart)
+    {
+        case LIBSAT_SOLVE_RESTART_LUBY:
+        case LIBSAT_SOLVE_RESTART_GEOMETRIC:
+        case LIBSAT_SOLVE_RESTART_GLUCOSE:
+        case LIBSAT_SOLVE_RESTART_STABILIZING:
+            break;
+
+        default:
+            return ERROR_LIBSAT_SOLVER_BAD_OPTION;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = solver_reactivate(context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        solver_scope_assumptions(&lits, &total, context, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver_heuristic_set(context->solver, options->heuristic);
+    solver_restart_set(context->solver, options->restart, options->rephase);
+    solver_limits_set(context->solver, options);
+
+    retval =
+        solver_solve(
+            result, context->solver, context->cnf, context->xor_matrix,
+            context->variable_count, lits, total);
+
+    /* the limits and any request to terminate end with this call. */
+    solver_limits_set(context->solver, NULL);
+    atomic_store(&context->terminate, false);
+
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the caller only sees its own assumptions in the core. */
+    solver_scope_core_filter(context);
+
+    return STATUS_SUCCESS;
+}
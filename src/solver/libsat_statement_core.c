@@ -0,0 +1,455 @@
+/**
+ * \file solver/libsat_statement_core.c
+ *
+ * \brief Find the statements responsible for an unsatisfiable statement list.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+typedef struct core_search
+{
+    libsat_context* context;
+    libsat_literal* candidates;
+    size_t candidate_count;
+    uint8_t* marks;
+    size_t first;
+    size_t statement_count;
+} core_search;
+
+static status gather(
+    size_t* count, libsat_context* context, const libsat_ast_node* node);
+static status assert_guarded(core_search* search);
+static status refine(core_search* search);
+static status minimize(core_search* search);
+
+/**
+ * \brief Find the statements responsible for the unsatisfiability of a
+ * statement list.
+ *
+ * The selectors are created together, right after the activation variable of
+ * the scope, so the selector of a statement is found from its variable id.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result of the
+ *                      statements together with the context.
+ * \param core          Pointer to receive the statements of the core.
+ * \param count         Pointer to receive the number of statements in the
+ *                      core.
+ * \param context       The context for this operation.
+ * \param node          The statement or statement list to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT if the node is not a statement or
+ *        statement list.
+ *      - ERROR_LIBSAT_BASE_CONTEXT_FROZEN if the context is frozen.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_statement_core)(
+    int* result, const LIBSAT_SYM(libsat_ast_node)*** core, size_t* count,
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_ast_node)* node)
+{
+    status retval, release_retval;
+    libsat_solver* solver;
+    core_search search;
+    size_t kept = 0;
+
+    /* a frozen context can't be changed. */
+    if (context->frozen)
+    {
+        retval = ERROR_LIBSAT_BASE_CONTEXT_FROZEN;
+        goto done;
+    }
+
+    /* an overlay creates its solver state on first use. */
+    retval = context_solver_ensure(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    solver = context->solver;
+
+    memset(&search, 0, sizeof(search));
+    search.context = context;
+
+    retval = gather(&search.statement_count, context, node);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* one selector and one mark per statement. */
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&search.candidates,
+            (search.statement_count + 1) * sizeof(*search.candidates));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval =
+        allocator_allocate(
+            context->alloc, (void**)&search.marks, search.statement_count + 1);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_candidates;
+    }
+
+    memset(search.marks, 0, search.statement_count + 1);
+
+    retval = libsat_context_push(context);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_marks;
+    }
+
+    retval = assert_guarded(&search);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scope;
+    }
+
+    retval =
+        libsat_solve_with_assumptions(
+            result, context, search.candidates, search.candidate_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_scope;
+    }
+
+    if (LIBSAT_SOLVE_RESULT_UNSATISFIABLE == *result)
+    {
+        retval = refine(&search);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scope;
+        }
+
+        retval = minimize(&search);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto cleanup_scope;
+        }
+
+        /* keep the statements of the core, in list order. */
+        for (size_t i = 0; i < search.candidate_count; ++i)
+        {
+            search.marks[
+                LIBSAT_LITERAL_VARIABLE(search.candidates[i])
+                    - search.first] = 1;
+        }
+
+        for (size_t i = 0; i < search.statement_count; ++i)
+        {
+            if (search.marks[i])
+            {
+                solver->statement_core[kept++] = solver->statement_core[i];
+            }
+        }
+    }
+
+    /* success. */
+    *core = solver->statement_core;
+    *count = kept;
+    retval = STATUS_SUCCESS;
+    goto cleanup_scope;
+
+cleanup_scope:
+    release_retval = libsat_context_pop(context);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_marks:
+    release_retval = allocator_reclaim(context->alloc, search.marks);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_candidates:
+    release_retval = allocator_reclaim(context->alloc, search.candidates);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Gather the statements of a node into the statement core buffer of
+ * the solver.
+ *
+ * \param count         Pointer to receive the number of statements.
+ * \param context       The context for this operation.
+ * \param node          The statement or statement list.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT if the node is not a statement or
+ *        statement list.
+ *      - a non-zero error code on failure.
+ */
+static status gather(
+    size_t* count, libsat_context* context, const libsat_ast_node* node)
+{
+    status retval;
+    libsat_solver* solver = context->solver;
+    const libsat_ast_node* statement;
+    size_t total = 0;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            total = 1;
+            break;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            for (
+                statement = node->value.list.head; NULL != statement;
+                statement = statement->next)
+            {
+                if (LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT != statement->type)
+                {
+                    return ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT;
+                }
+
+                ++total;
+            }
+            break;
+
+        default:
+            return ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT;
+    }
+
+    if (total > solver->statement_capacity)
+    {
+        retval =
+            memory_resize(
+                context->alloc, (void**)&solver->statement_core,
+                total * sizeof(*solver->statement_core));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        solver->statement_capacity = total;
+    }
+
+    if (LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT == node->type)
+    {
+        solver->statement_core[0] = node;
+    }
+    else
+    {
+        total = 0;
+        for (
+            statement = node->value.list.head; NULL != statement;
+            statement = statement->next)
+        {
+            solver->statement_core[total++] = statement;
+        }
+    }
+
+    *count = total;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Create a selector for each statement, and assert the statement under
+ * it.
+ *
+ * \param search        The search state, with the statements gathered.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assert_guarded(core_search* search)
+{
+    status retval;
+    libsat_context* context = search->context;
+    libsat_cnf* cnf = context->cnf;
+    libsat_literal guard = cnf->guard;
+    libsat_literal constant;
+    size_t var_id;
+
+    for (size_t i = 0; i < search->statement_count; ++i)
+    {
+        retval =
+            libsat_context_variable_get(
+                &var_id, context, NULL,
+                LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (0 == i)
+        {
+            search->first = var_id;
+        }
+
+        search->candidates[i] = LIBSAT_LITERAL_MAKE(var_id, false);
+    }
+
+    search->candidate_count = search->statement_count;
+
+    /* the constants are created under the scope, not under a selector. */
+    retval = solver_true_literal(&constant, context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* each statement only holds while its selector is assumed. */
+    retval = STATUS_SUCCESS;
+    for (
+        size_t i = 0; i < search->statement_count && STATUS_SUCCESS == retval;
+        ++i)
+    {
+        cnf->guard = LIBSAT_LITERAL_NEGATE(search->candidates[i]);
+        retval =
+            libsat_context_assert(
+                context, context->solver->statement_core[i]);
+    }
+
+    cnf->guard = guard;
+
+    return retval;
+}
+
+/**
+ * \brief Shrink the candidates to the failed selectors of the last solve.
+ *
+ * The order of the candidates that remain is kept.
+ *
+ * \param search        The search state.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status refine(core_search* search)
+{
+    status retval;
+    const libsat_literal* failed;
+    size_t failed_count, index;
+    size_t kept = 0;
+
+    retval =
+        libsat_failed_assumptions(&failed, &failed_count, search->context);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    for (size_t i = 0; i < failed_count; ++i)
+    {
+        index = LIBSAT_LITERAL_VARIABLE(failed[i]) - search->first;
+        if (index < search->statement_count)
+        {
+            search->marks[index] = 1;
+        }
+    }
+
+    /* every failed selector was a candidate, so this clears the marks. */
+    for (size_t i = 0; i < search->candidate_count; ++i)
+    {
+        index = LIBSAT_LITERAL_VARIABLE(search->candidates[i]) - search->first;
+        if (search->marks[index])
+        {
+            search->marks[index] = 0;
+            search->candidates[kept++] = search->candidates[i];
+        }
+    }
+
+    search->candidate_count = kept;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Minimize the core by leaving out one candidate at a time.
+ *
+ * The candidates before the necessary count are known to be needed. Any
+ * smaller core found while leaving a candidate out still holds all of them,
+ * since each was needed in a larger set, so they stay at the front when the
+ * candidates are refined.
+ *
+ * \param search        The search state, with the candidates holding a core.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status minimize(core_search* search)
+{
+    status retval;
+    libsat_literal* candidates = search->candidates;
+    libsat_literal tmp;
+    size_t necessary = 0;
+    size_t last;
+    int result;
+
+    while (necessary < search->candidate_count)
+    {
+        /* leave the next candidate out by moving it past the end. */
+        last = search->candidate_count - 1;
+        tmp = candidates[necessary];
+        candidates[necessary] = candidates[last];
+        candidates[last] = tmp;
+
+        retval =
+            libsat_solve_with_assumptions(
+                &result, search->context, candidates, last);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result)
+        {
+            /* the candidate left out is not needed, nor is anything else
+             * outside of this core. */
+            search->candidate_count = last;
+            retval = refine(search);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+        }
+        else
+        {
+            /* the candidate is needed, or could not be shown otherwise. */
+            candidates[last] = candidates[necessary];
+            candidates[necessary] = tmp;
+            necessary += 1;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,74 @@
+/**
+ * \file solver/solver_alias_link.c
+ *
+ * \brief Make a variable of a \ref libsat_context an alias of a literal.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Make a root variable an alias of a literal in a context.
+ *
+ * \param context       The context for this operation.
+ * \param var_id        The root variable to link.
+ * \param lit           The literal that this variable is equivalent to. Its
+ *                      variable must be a different root.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_alias_link)(
+    LIBSAT_SYM(libsat_context)* context, size_t var_id,
+    LIBSAT_SYM(libsat_literal) lit)
+{
+    status retval;
+    size_t needed = var_id;
+
+    if (LIBSAT_LITERAL_VARIABLE(lit) > needed)
+    {
+        needed = LIBSAT_LITERAL_VARIABLE(lit);
+    }
+
+    /* grow the alias table if needed; new variables are their own roots. */
+    if (needed >= context->alias_capacity)
+    {
+        size_t capacity =
+            (0 == context->alias_capacity) ? 64 : 2 * context->alias_capacity;
+        while (capacity <= needed)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                context->alloc, (void**)&context->alias,
+                capacity * sizeof(*context->alias));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        for (size_t i = context->alias_capacity; i < capacity; ++i)
+        {
+            context->alias[i] = LIBSAT_LITERAL_MAKE(i, false);
+        }
+
+        context->alias_capacity = capacity;
+    }
+
+    context->alias[var_id] = lit;
+
+    return STATUS_SUCCESS;
+}
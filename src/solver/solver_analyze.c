@@ -0,0 +1,302 @@
+/**
+ * \file solver/solver_analyze.c
+ *
+ * \brief Conflict analysis for a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static void bump(libsat_solver* solver, size_t var_id);
+static void vmtf_bump_all(libsat_solver* solver);
+static int vmtf_entry_compare(const void* lhs, const void* rhs);
+static bool redundant(const libsat_solver* solver, libsat_literal lit);
+static uint32_t compute_lbd(libsat_solver* solver);
+static void touch(libsat_solver* solver, size_t clause);
+
+/**
+ * \brief Analyze a conflict, leaving the first UIP clause in learned.
+ *
+ * The conflict is resolved with the reasons of literals from the current
+ * decision level, in reverse trail order, until a single such literal
+ * remains. Every variable involved is bumped, and literals whose reasons are
+ * already covered by the clause are dropped. Under VMTF, the bumped variables
+ * are moved to the end of the queue after the analysis, in the order they had
+ * in the queue before it. Learned clauses that take part
+ * are marked as used, and their LBD is lowered if it has dropped.
+ *
+ * \param backjump      Pointer to receive the backjump level.
+ * \param solver        The solver for this operation.
+ * \param conflict      The conflicting clause.
+ */
+void
+LIBSAT_SYM(solver_analyze)(
+    size_t* backjump, LIBSAT_SYM(libsat_solver)* solver, size_t conflict)
+{
+    size_t clause = conflict;
+    size_t path_count = 0;
+    size_t index = solver->trail_count;
+    size_t first = 0;
+    libsat_literal uip = 0;
+    size_t kept;
+
+    /* slot zero is reserved for the asserting literal. */
+    solver->learned_count = 1;
+    solver->vmtf_bumped_count = 0;
+
+    do
+    {
+        const libsat_literal* lits = solver_clause_lits(solver, clause);
+        size_t size = solver->clauses[clause].size;
+
+        touch(solver, clause);
+
+        /* the first literal of a reason is the one that it implied. */
+        for (size_t i = first; i < size; ++i)
+        {
+            size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[i]);
+
+            if (solver->seen[var_id] || 0 == solver->levels[var_id])
+            {
+                continue;
+            }
+
+            bump(solver, var_id);
+            solver->seen[var_id] = 1;
+
+            if (solver->levels[var_id] >= solver->level)
+            {
+                path_count += 1;
+            }
+            else
+            {
+                solver->learned[solver->learned_count++] = lits[i];
+            }
+        }
+
+        /* find the next literal from this level on the trail. */
+        do
+        {
+            --index;
+        } while (!solver->seen[LIBSAT_LITERAL_VARIABLE(solver->trail[index])]);
+
+        uip = solver->trail[index];
+        clause = solver->reasons[LIBSAT_LITERAL_VARIABLE(uip)];
+        solver->seen[LIBSAT_LITERAL_VARIABLE(uip)] = 0;
+        path_count -= 1;
+        first = 1;
+    } while (path_count > 0);
+
+    solver->learned[0] = LIBSAT_LITERAL_NEGATE(uip);
+
+    if (LIBSAT_SOLVE_HEURISTIC_VMTF == solver->heuristic)
+    {
+        vmtf_bump_all(solver);
+    }
+
+    /* drop literals implied by the rest of the clause. */
+    kept = 1;
+    for (size_t i = 1; i < solver->learned_count; ++i)
+    {
+        solver->scratch[i] = solver->learned[i];
+        if (!redundant(solver, solver->learned[i]))
+        {
+            solver->learned[kept++] = solver->learned[i];
+        }
+    }
+
+    for (size_t i = 1; i < solver->learned_count; ++i)
+    {
+        solver->seen[LIBSAT_LITERAL_VARIABLE(solver->scratch[i])] = 0;
+    }
+
+    solver->learned_count = kept;
+
+    /* the backjump level is the highest level left in the clause. */
+    *backjump = 0;
+    if (solver->learned_count > 1)
+    {
+        size_t best = 1;
+        libsat_literal tmp;
+
+        for (size_t i = 2; i < solver->learned_count; ++i)
+        {
+            if (
+                solver->levels[LIBSAT_LITERAL_VARIABLE(solver->learned[i])]
+              > solver->levels[LIBSAT_LITERAL_VARIABLE(solver->learned[best])])
+            {
+                best = i;
+            }
+        }
+
+        tmp = solver->learned[1];
+        solver->learned[1] = solver->learned[best];
+        solver->learned[best] = tmp;
+        *backjump =
+            solver->levels[LIBSAT_LITERAL_VARIABLE(solver->learned[1])];
+    }
+
+    solver->learned_lbd = compute_lbd(solver);
+
+    /* decay activity by growing the increment. */
+    solver->var_inc /= 0.95;
+}
+
+/**
+ * \brief Bump the activity of a variable, rescaling all activity on overflow.
+ * Under VMTF, the variable is also gathered to be moved to the end of the
+ * queue once the analysis is done.
+ */
+static void bump(libsat_solver* solver, size_t var_id)
+{
+    solver->activity[var_id] += solver->var_inc;
+
+    if (solver->activity[var_id] > 1e100)
+    {
+        for (size_t i = 0; i < solver->var_count; ++i)
+        {
+            solver->activity[i] *= 1e-100;
+        }
+
+        solver->var_inc *= 1e-100;
+    }
+
+    if (LIBSAT_SOLVE_HEURISTIC_VMTF == solver->heuristic)
+    {
+        solver_vmtf_entry* entry =
+            &solver->vmtf_bumped[solver->vmtf_bumped_count++];
+
+        entry->stamp = solver->vmtf_stamp[var_id];
+        entry->var_id = var_id;
+    }
+    else if (SOLVER_NOT_IN_HEAP != solver->heap_index[var_id])
+    {
+        solver_heap_percolate_up(solver, var_id);
+    }
+}
+
+/**
+ * \brief Move the gathered variables to the end of the VMTF queue, the least
+ * recently bumped first, so that they keep their order relative to each other.
+ */
+static void vmtf_bump_all(libsat_solver* solver)
+{
+    qsort(
+        solver->vmtf_bumped, solver->vmtf_bumped_count,
+        sizeof(*solver->vmtf_bumped), &vmtf_entry_compare);
+
+    for (size_t i = 0; i < solver->vmtf_bumped_count; ++i)
+    {
+        solver_vmtf_bump(solver, solver->vmtf_bumped[i].var_id);
+    }
+}
+
+/**
+ * \brief Order gathered variables by increasing stamp.
+ */
+static int vmtf_entry_compare(const void* lhs, const void* rhs)
+{
+    const solver_vmtf_entry* l = (const solver_vmtf_entry*)lhs;
+    const solver_vmtf_entry* r = (const solver_vmtf_entry*)rhs;
+
+    return (l->stamp > r->stamp) - (l->stamp < r->stamp);
+}
+
+/**
+ * \brief A literal is redundant if every other literal in its reason is
+ * already in the clause or fixed at level zero.
+ */
+static bool redundant(const libsat_solver* solver, libsat_literal lit)
+{
+    size_t reason = solver->reasons[LIBSAT_LITERAL_VARIABLE(lit)];
+    const libsat_literal* lits;
+
+    if (SOLVER_NO_REASON == reason)
+    {
+        return false;
+    }
+
+    lits = solver_clause_lits(solver, reason);
+    for (size_t i = 1; i < solver->clauses[reason].size; ++i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lits[i]);
+
+        if (!solver->seen[var_id] && 0 != solver->levels[var_id])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * \brief Count the distinct decision levels in the learned clause.
+ */
+static uint32_t compute_lbd(libsat_solver* solver)
+{
+    uint32_t lbd = 0;
+
+    solver->stamp += 1;
+    for (size_t i = 0; i < solver->learned_count; ++i)
+    {
+        size_t level =
+            solver->levels[LIBSAT_LITERAL_VARIABLE(solver->learned[i])];
+
+        if (solver->level_stamp[level] != solver->stamp)
+        {
+            solver->level_stamp[level] = solver->stamp;
+            lbd += 1;
+        }
+    }
+
+    return lbd;
+}
+
+/**
+ * \brief Mark a learned clause as used, and lower its LBD if its literals now
+ * span fewer decision levels.
+ */
+static void touch(libsat_solver* solver, size_t clause)
+{
+    solver_clause* entry = &solver->clauses[clause];
+    const libsat_literal* lits;
+    uint32_t lbd = 0;
+
+    if (!entry->learned)
+    {
+        return;
+    }
+
+    entry->used = true;
+    if (entry->lbd <= SOLVER_TIER_CORE_LBD)
+    {
+        return;
+    }
+
+    lits = solver_clause_lits(solver, clause);
+    solver->stamp += 1;
+    for (size_t i = 0; i < entry->size && lbd < entry->lbd; ++i)
+    {
+        size_t level = solver->levels[LIBSAT_LITERAL_VARIABLE(lits[i])];
+
+        if (solver->level_stamp[level] != solver->stamp)
+        {
+            solver->level_stamp[level] = solver->stamp;
+            lbd += 1;
+        }
+    }
+
+    if (lbd < entry->lbd)
+    {
+        entry->lbd = lbd;
+    }
+}
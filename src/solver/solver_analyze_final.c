@@ -0,0 +1,130 @@
+/**
+ * \file solver/solver_analyze_final.c
+ *
+ * \brief Compute the failed assumptions of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static void log_core(libsat_solver* solver, libsat_literal lit);
+
+/**
+ * \brief Compute the assumptions responsible for a false assumption.
+ *
+ * The reasons for the negation of the assumption are followed back along the
+ * trail. Every decision reached this way is an earlier assumption, and belongs
+ * in the core together with the false assumption itself. While a proof is
+ * written, the negation of the core is logged as a lemma.
+ *
+ * \param solver        The solver for this operation.
+ * \param lit           The assumption that is false.
+ */
+void
+LIBSAT_SYM(solver_analyze_final)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit)
+{
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+    solver->core[0] = lit;
+    solver->core_count = 1;
+
+    /* a false assumption at level zero fails on its own. */
+    if (0 == solver->level || 0 == solver->levels[var_id])
+    {
+        goto done;
+    }
+
+    solver->seen[var_id] = 1;
+    for (size_t i = solver->trail_count; i > solver->trail_lim[0]; --i)
+    {
+        libsat_literal trail_lit = solver->trail[i - 1];
+        size_t x = LIBSAT_LITERAL_VARIABLE(trail_lit);
+        size_t reason = solver->reasons[x];
+
+        if (!solver->seen[x])
+        {
+            continue;
+        }
+
+        if (SOLVER_NO_REASON == reason)
+        {
+            solver->core[solver->core_count++] = trail_lit;
+        }
+        else
+        {
+            const libsat_literal* lits = solver_clause_lits(solver, reason);
+
+            for (size_t k = 1; k < solver->clauses[reason].size; ++k)
+            {
+                size_t y = LIBSAT_LITERAL_VARIABLE(lits[k]);
+
+                if (0 != solver->levels[y])
+                {
+                    solver->seen[y] = 1;
+                }
+            }
+        }
+
+        solver->seen[x] = 0;
+    }
+
+    solver->seen[var_id] = 0;
+
+done:
+    if (NULL != solver->proof)
+    {
+        log_core(solver, lit);
+    }
+}
+
+/**
+ * \brief Log the negation of the core as a lemma.
+ *
+ * The negation of the false assumption follows from the rest of the core
+ * through its reason, or is a level zero fact. An assumption that is false
+ * because its negation was assumed as well gives a tautology, which is not
+ * logged.
+ *
+ * \param solver        The solver for this operation.
+ * \param lit           The assumption that is false.
+ */
+static void log_core(libsat_solver* solver, libsat_literal lit)
+{
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+    size_t reason = solver->reasons[var_id];
+    libsat_literal negated = LIBSAT_LITERAL_NEGATE(lit);
+
+    /* propagation is done, so scratch is free. */
+    for (size_t i = 0; i < solver->core_count; ++i)
+    {
+        solver->scratch[i] = LIBSAT_LITERAL_NEGATE(solver->core[i]);
+    }
+
+    solver_proof_units(solver);
+    if (0 == solver->levels[var_id])
+    {
+        solver_proof_chain(
+            solver, solver->scratch, solver->core_count, &negated, 1,
+            solver->unit_ids[var_id]);
+    }
+    else if (SOLVER_NO_REASON != reason)
+    {
+        solver_proof_chain(
+            solver, solver->scratch, solver->core_count,
+            solver_clause_lits(solver, reason), solver->clauses[reason].size,
+            solver->clauses[reason].id);
+    }
+    else
+    {
+        return;
+    }
+
+    solver_proof_add(solver, solver->scratch, solver->core_count);
+}
@@ -0,0 +1,62 @@
+/**
+ * \file solver/solver_backtrack.c
+ *
+ * \brief Undo assignments in a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Undo every assignment above the given decision level.
+ *
+ * The value of each undone variable is saved as its preferred phase, and the
+ * variable becomes a decision candidate again: it goes back in the heap under
+ * EVSIDS, and under VMTF the search position moves back to it if it was
+ * bumped more recently.
+ *
+ * \param solver        The solver for this operation.
+ * \param level         The decision level to return to.
+ */
+void
+LIBSAT_SYM(solver_backtrack)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t level)
+{
+    size_t end;
+
+    if (solver->level <= level)
+    {
+        return;
+    }
+
+    end = solver->trail_lim[level];
+    for (size_t i = solver->trail_count; i > end; --i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(solver->trail[i - 1]);
+
+        solver->phases[var_id] = solver->values[var_id];
+        solver->values[var_id] = LIBSAT_VALUE_UNASSIGNED;
+        solver->reasons[var_id] = SOLVER_NO_REASON;
+
+        if (LIBSAT_SOLVE_HEURISTIC_VMTF != solver->heuristic)
+        {
+            solver_heap_insert(solver, var_id);
+        }
+        else if (
+            SOLVER_NO_VARIABLE == solver->vmtf_search
+         || solver->vmtf_stamp[var_id]
+                > solver->vmtf_stamp[solver->vmtf_search])
+        {
+            solver->vmtf_search = var_id;
+        }
+    }
+
+    solver->trail_count = end;
+    solver->qhead = end;
+    solver->level = level;
+}
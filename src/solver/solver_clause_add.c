@@ -0,0 +1,112 @@
+/**
+ * \file solver/solver_clause_add.c
+ *
+ * \brief Add a clause to a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Add a clause of at least two literals and watch its first two.
+ *
+ * \param clause        Pointer to receive the clause index on success.
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ * \param learned       True if this clause is learned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_clause_add)(
+    size_t* clause, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count, bool learned)
+{
+    status retval;
+    solver_clause* entry;
+    size_t index = solver->clause_count;
+
+    /* grow the arena if needed. */
+    if (solver->arena_count + count > solver->arena_capacity)
+    {
+        size_t capacity =
+            (0 == solver->arena_capacity) ? 256 : 2 * solver->arena_capacity;
+
+        while (capacity < solver->arena_count + count)
+        {
+            capacity *= 2;
+        }
+
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->arena,
+                capacity * sizeof(*solver->arena));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        solver->arena_capacity = capacity;
+    }
+
+    /* grow the clause array if needed. */
+    if (solver->clause_count == solver->clause_capacity)
+    {
+        size_t capacity =
+            (0 == solver->clause_capacity) ? 64 : 2 * solver->clause_capacity;
+
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->clauses,
+                capacity * sizeof(*solver->clauses));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        solver->clause_capacity = capacity;
+    }
+
+    /* watch the first two literals. */
+    retval = solver_watch_add(solver, lits[0], index, lits[1]);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = solver_watch_add(solver, lits[1], index, lits[0]);
+    if (STATUS_SUCCESS != retval)
+    {
+        solver->watches[lits[0]].count -= 1;
+        return retval;
+    }
+
+    /* store the clause. */
+    entry = &solver->clauses[index];
+    entry->start = solver->arena_count;
+    entry->size = count;
+    entry->id = 0;
+    entry->lbd = 0;
+    entry->learned = learned;
+    entry->deleted = false;
+    entry->used = false;
+    entry->vivified = false;
+    memcpy(solver->arena + solver->arena_count, lits, count * sizeof(*lits));
+    solver->arena_count += count;
+    solver->clause_count += 1;
+
+    /* success. */
+    *clause = index;
+    return STATUS_SUCCESS;
+}
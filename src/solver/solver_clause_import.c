@@ -0,0 +1,117 @@
+/**
+ * \file solver/solver_clause_import.c
+ *
+ * \brief Simplify and store a clause at decision level zero.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Simplify a clause against the level zero assignment and store it.
+ *
+ * Fixed literals, duplicates, and tautologies are dropped. What remains is
+ * stored as a clause, enqueued as a fact, or marks the solver inconsistent.
+ * While a proof is written, what remains keeps the number of the clause, or is
+ * logged as a lemma with a number of its own if any literal was dropped.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param lits          The literals of this clause.
+ * \param size          The number of literals.
+ * \param learned       True if this clause is learned.
+ * \param id            The number of this clause in the proof, or zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_clause_import)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t size, bool learned, uint64_t id)
+{
+    status retval;
+    size_t count = 0, clause;
+    bool satisfied = false;
+
+    /* seen records the polarity of each literal kept so far. */
+    for (size_t i = 0; i < size && !satisfied; ++i)
+    {
+        libsat_literal lit = lits[i];
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+        uint8_t mark = LIBSAT_LITERAL_IS_NEGATED(lit) ? 2 : 1;
+
+        switch (solver_lit_value(solver, lit))
+        {
+            case LIBSAT_VALUE_TRUE:
+                satisfied = true;
+                continue;
+
+            case LIBSAT_VALUE_FALSE:
+                continue;
+
+            default:
+                break;
+        }
+
+        if (0 == solver->seen[var_id])
+        {
+            solver->seen[var_id] = mark;
+            solver->scratch[count++] = lit;
+        }
+        else if (mark != solver->seen[var_id])
+        {
+            satisfied = true;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        solver->seen[LIBSAT_LITERAL_VARIABLE(solver->scratch[i])] = 0;
+    }
+
+    if (satisfied)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* a clause that lost literals is logged as a lemma of its own. */
+    if (NULL != solver->proof && count < size)
+    {
+        solver_proof_chain(solver, solver->scratch, count, lits, size, id);
+        id = solver_proof_add(solver, solver->scratch, count);
+    }
+
+    /* store what remains. */
+    switch (count)
+    {
+        case 0:
+            solver->inconsistent = true;
+            return STATUS_SUCCESS;
+
+        case 1:
+            solver_enqueue(solver, solver->scratch[0], SOLVER_NO_REASON);
+            solver->unit_ids[LIBSAT_LITERAL_VARIABLE(solver->scratch[0])] =
+                id;
+            return STATUS_SUCCESS;
+
+        default:
+            retval =
+                solver_clause_add(
+                    &clause, solver, solver->scratch, count, learned);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            solver->clauses[clause].lbd = learned ? (uint32_t)count : 0;
+            solver->clauses[clause].id = id;
+            return STATUS_SUCCESS;
+    }
+}
@@ -0,0 +1,74 @@
+/**
+ * \file solver/solver_create.c
+ *
+ * \brief Create a \ref libsat_solver instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* the vtable entry for the libsat_solver instance. */
+RCPR_VTABLE
+resource_vtable libsat_solver_vtable = {
+    &solver_resource_release };
+
+/**
+ * \brief Create a solver instance.
+ *
+ * \param solver        Pointer to the solver pointer to be set to this created
+ *                      instance on success.
+ * \param alloc         The allocator to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_create)(
+    LIBSAT_SYM(libsat_solver)** solver, RCPR_SYM(allocator)* alloc)
+{
+    status retval;
+    libsat_solver* tmp;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_solver_vtable);
+
+    /* initialize solver. */
+    tmp->alloc = alloc;
+    tmp->var_inc = 1.0;
+    tmp->vmtf_first = SOLVER_NO_VARIABLE;
+    tmp->vmtf_last = SOLVER_NO_VARIABLE;
+    tmp->vmtf_search = SOLVER_NO_VARIABLE;
+    tmp->next_inprocess = SOLVER_INPROCESS_INTERVAL;
+    tmp->stable_length = SOLVER_STABLE_INTERVAL;
+    tmp->stable_next = SOLVER_STABLE_INTERVAL;
+    tmp->last_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    solver_limits_set(tmp, NULL);
+
+    /* success. */
+    *solver = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
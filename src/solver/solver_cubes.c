@@ -0,0 +1,396 @@
+/**
+ * \file solver/solver_cubes.c
+ *
+ * \brief Split a problem into cubes by lookahead.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status assume_base(
+    solver_cube_set* cubes, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix);
+static status split(
+    solver_cube_set* cubes, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix, size_t depth);
+static status extend(
+    bool* conflict, solver_cube_set* cubes, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit);
+static status emit(solver_cube_set* cubes);
+
+/**
+ * \brief Split the problem under the assumptions into cubes.
+ *
+ * The assumptions are decided first. Then lookahead picks a variable to split
+ * on, both of its phases are decided in turn, and each half is split again
+ * until depth splits have been made along it. Literals forced by a failed
+ * literal extend the cube without counting as a split. Halves that propagate
+ * to a conflict are refuted, and are left out.
+ *
+ * Propagation may learn a fact, which returns the solver to level zero. When
+ * that happens, splitting starts over with the new fact in place. If the
+ * assumptions alone fail, or the problem is unsatisfiable, no cubes are made
+ * and the set is marked decided, so that the caller can solve it directly.
+ *
+ * \param cubes         The cube set to fill. It must be empty.
+ * \param solver        The solver for this operation. It must be prepared
+ *                      with the assumptions, at decision level zero, with the
+ *                      database imported.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param depth         The number of splits along each cube.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_cubes)(
+    LIBSAT_SYM(solver_cube_set)* cubes, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    size_t depth)
+{
+    status retval;
+
+    cubes->alloc = solver->alloc;
+
+    retval =
+        memory_resize(
+            cubes->alloc, (void**)&cubes->path,
+            (solver->var_capacity + 1) * sizeof(*cubes->path));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    do
+    {
+        cubes->lit_count = 0;
+        cubes->cube_count = 0;
+        cubes->path_count = 0;
+        cubes->refuted = false;
+        cubes->decided = false;
+        cubes->reset = false;
+
+        retval = assume_base(cubes, solver, cnf, matrix);
+        if (STATUS_SUCCESS == retval && !cubes->decided && !cubes->reset)
+        {
+            retval = split(cubes, solver, cnf, matrix, depth);
+        }
+
+        solver_backtrack(solver, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    } while (cubes->reset && !solver->inconsistent);
+
+    if (solver->inconsistent)
+    {
+        cubes->decided = true;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Decide the assumptions, one per level, and propagate them.
+ *
+ * \param cubes         The cube set for this operation.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assume_base(
+    solver_cube_set* cubes, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix)
+{
+    status retval;
+    size_t conflict;
+
+    retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (SOLVER_NO_CONFLICT != conflict || solver->inconsistent)
+    {
+        cubes->decided = true;
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < solver->assumption_count; ++i)
+    {
+        libsat_literal lit = solver->assumptions[i];
+
+        switch (solver_lit_value(solver, lit))
+        {
+            /* an assumption that already holds gets an empty level. */
+            case LIBSAT_VALUE_TRUE:
+                solver_new_level(solver);
+                continue;
+
+            case LIBSAT_VALUE_FALSE:
+                cubes->decided = true;
+                return STATUS_SUCCESS;
+
+            default:
+                break;
+        }
+
+        solver_new_level(solver);
+        solver_enqueue(solver, lit, SOLVER_NO_REASON);
+
+        retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (solver->level != i + 1 || solver->inconsistent)
+        {
+            cubes->reset = true;
+            return STATUS_SUCCESS;
+        }
+
+        if (SOLVER_NO_CONFLICT != conflict)
+        {
+            cubes->decided = true;
+            return STATUS_SUCCESS;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Split the current cube until depth splits have been made along it.
+ *
+ * On return, the solver and the path are back where they were on entry,
+ * unless a fact was learned.
+ *
+ * \param cubes         The cube set for this operation.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param depth         The number of splits left.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status split(
+    solver_cube_set* cubes, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix, size_t depth)
+{
+    status retval = STATUS_SUCCESS;
+    size_t level = solver->level;
+    size_t path_count = cubes->path_count;
+    libsat_literal branch;
+    int outcome;
+    bool conflict;
+
+    for (;;)
+    {
+        if (0 == depth)
+        {
+            retval = emit(cubes);
+            goto done;
+        }
+
+        retval = solver_lookahead(&branch, &outcome, solver, cnf, matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        switch (outcome)
+        {
+            case SOLVER_LOOKAHEAD_ASSIGNED:
+                retval = emit(cubes);
+                goto done;
+
+            case SOLVER_LOOKAHEAD_CONFLICT:
+                cubes->refuted = true;
+                goto done;
+
+            case SOLVER_LOOKAHEAD_RESET:
+                cubes->reset = true;
+                goto done;
+
+            /* a forced literal extends the cube without a split. */
+            case SOLVER_LOOKAHEAD_FORCED:
+                retval =
+                    extend(&conflict, cubes, solver, cnf, matrix, branch);
+                if (STATUS_SUCCESS != retval || cubes->reset)
+                {
+                    goto done;
+                }
+
+                if (conflict)
+                {
+                    cubes->refuted = true;
+                    goto done;
+                }
+
+                continue;
+
+            default:
+                break;
+        }
+
+        /* split on the branch, then on its negation. */
+        for (int phase = 0; phase < 2; ++phase)
+        {
+            libsat_literal lit =
+                (0 == phase) ? branch : LIBSAT_LITERAL_NEGATE(branch);
+            size_t branch_level = solver->level;
+            size_t branch_path = cubes->path_count;
+
+            retval = extend(&conflict, cubes, solver, cnf, matrix, lit);
+            if (STATUS_SUCCESS != retval || cubes->reset)
+            {
+                goto done;
+            }
+
+            if (conflict)
+            {
+                cubes->refuted = true;
+            }
+            else
+            {
+                retval = split(cubes, solver, cnf, matrix, depth - 1);
+                if (STATUS_SUCCESS != retval || cubes->reset)
+                {
+                    goto done;
+                }
+            }
+
+            solver_backtrack(solver, branch_level);
+            cubes->path_count = branch_path;
+        }
+
+        goto done;
+    }
+
+done:
+    if (!cubes->reset)
+    {
+        solver_backtrack(solver, level);
+    }
+
+    cubes->path_count = path_count;
+
+    return retval;
+}
+
+/**
+ * \brief Decide a literal on a new level, add it to the path, and propagate.
+ *
+ * \param conflict      Pointer to receive whether propagation conflicted.
+ * \param cubes         The cube set for this operation.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param lit           The literal to decide.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status extend(
+    bool* conflict, solver_cube_set* cubes, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit)
+{
+    status retval;
+    size_t level = solver->level;
+    size_t clause;
+
+    solver_new_level(solver);
+    solver_enqueue(solver, lit, SOLVER_NO_REASON);
+    cubes->path[cubes->path_count++] = lit;
+
+    retval = solver_propagate_all(&clause, solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    if (solver->level != level + 1 || solver->inconsistent)
+    {
+        cubes->reset = true;
+    }
+
+    *conflict = SOLVER_NO_CONFLICT != clause;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Add the current path as a cube.
+ *
+ * \param cubes         The cube set for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status emit(solver_cube_set* cubes)
+{
+    status retval;
+
+    if (cubes->lit_count + cubes->path_count > cubes->lit_capacity)
+    {
+        size_t capacity = 2 * cubes->lit_capacity + cubes->path_count + 16;
+
+        retval =
+            memory_resize(
+                cubes->alloc, (void**)&cubes->lits,
+                capacity * sizeof(*cubes->lits));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cubes->lit_capacity = capacity;
+    }
+
+    if (cubes->cube_count + 1 > cubes->cube_capacity)
+    {
+        size_t capacity = 2 * cubes->cube_capacity + 16;
+
+        retval =
+            memory_resize(
+                cubes->alloc, (void**)&cubes->ends,
+                capacity * sizeof(*cubes->ends));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        cubes->cube_capacity = capacity;
+    }
+
+    for (size_t i = 0; i < cubes->path_count; ++i)
+    {
+        cubes->lits[cubes->lit_count++] = cubes->path[i];
+    }
+
+    cubes->ends[cubes->cube_count++] = cubes->lit_count;
+
+    return STATUS_SUCCESS;
+}
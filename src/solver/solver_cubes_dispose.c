@@ -0,0 +1,70 @@
+/**
+ * \file solver/solver_cubes_dispose.c
+ *
+ * \brief Reclaim the memory held by a \ref solver_cube_set.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Reclaim the memory held by a cube set, leaving it empty.
+ *
+ * \param cubes         The cube set to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_cubes_dispose)(
+    LIBSAT_SYM(solver_cube_set)* cubes)
+{
+    status retval = STATUS_SUCCESS;
+    allocator* alloc = cubes->alloc;
+
+    retval = reclaim_if_set(alloc, cubes->lits, retval);
+    retval = reclaim_if_set(alloc, cubes->ends, retval);
+    retval = reclaim_if_set(alloc, cubes->path, retval);
+
+    memset(cubes, 0, sizeof(*cubes));
+
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
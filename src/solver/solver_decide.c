@@ -0,0 +1,61 @@
+/**
+ * \file solver/solver_decide.c
+ *
+ * \brief Pick the next decision variable of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Pick the next variable to decide.
+ *
+ * Under EVSIDS, assigned variables are popped from the heap until an
+ * unassigned one turns up. Under VMTF, the queue is walked from the search
+ * position towards its front, and the search position is left on the
+ * variable found, since every variable behind it is assigned.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns the unassigned variable ranked first by the decision heuristic, or
+ * SOLVER_NO_VARIABLE if every variable is assigned.
+ */
+size_t
+LIBSAT_SYM(solver_decide)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    if (LIBSAT_SOLVE_HEURISTIC_VMTF == solver->heuristic)
+    {
+        size_t var_id = solver->vmtf_search;
+
+        while (
+            SOLVER_NO_VARIABLE != var_id
+         && LIBSAT_VALUE_UNASSIGNED != solver->values[var_id])
+        {
+            var_id = solver->vmtf_prev[var_id];
+        }
+
+        if (SOLVER_NO_VARIABLE != var_id)
+        {
+            solver->vmtf_search = var_id;
+        }
+
+        return var_id;
+    }
+
+    while (solver->heap_count > 0)
+    {
+        size_t var_id = solver_heap_pop(solver);
+
+        if (LIBSAT_VALUE_UNASSIGNED == solver->values[var_id])
+        {
+            return var_id;
+        }
+    }
+
+    return SOLVER_NO_VARIABLE;
+}
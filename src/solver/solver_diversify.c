@@ -0,0 +1,92 @@
+/**
+ * \file solver/solver_diversify.c
+ *
+ * \brief Diversify a portfolio worker.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static uint64_t next_random(uint64_t* state);
+
+/**
+ * \brief Give a portfolio worker its own seed, restart policy, and phase.
+ *
+ * Each worker starts from a small random activity seeded by its index, so the
+ * workers make different early decisions. Workers take turns restarting on
+ * the Luby sequence, geometrically, as glucose does, and with stabilizing
+ * phases and rephasing. Every third worker starts with all phases true, and
+ * the one after it with random phases.
+ *
+ * \param solver        The solver for this operation. Its variables must
+ *                      already be reserved.
+ * \param index         The index of this worker in the portfolio.
+ */
+void
+LIBSAT_SYM(solver_diversify)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t index)
+{
+    static const int restarts[] = {
+        LIBSAT_SOLVE_RESTART_LUBY, LIBSAT_SOLVE_RESTART_GEOMETRIC,
+        LIBSAT_SOLVE_RESTART_GLUCOSE, LIBSAT_SOLVE_RESTART_STABILIZING };
+    uint64_t state = 0x9e3779b97f4a7c15ULL * (index + 1);
+
+    solver_restart_set(
+        solver, restarts[index % 4],
+        LIBSAT_SOLVE_RESTART_STABILIZING == restarts[index % 4]);
+
+    for (size_t i = 0; i < solver->var_count; ++i)
+    {
+        uint64_t r = next_random(&state);
+
+        /* stay well below the first bump, so conflicts soon take over. */
+        solver->activity[i] = (double)(r >> 11) * 0x1.0p-63;
+
+        switch (index % 3)
+        {
+            case 1:
+                solver->phases[i] = LIBSAT_VALUE_TRUE;
+                break;
+
+            case 2:
+                solver->phases[i] =
+                    (r & 1) ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    /* rebuild the decision heap on the new activity. */
+    solver->heap_count = 0;
+    memset(
+        solver->heap_index, 0xff,
+        solver->var_capacity * sizeof(*solver->heap_index));
+    for (size_t i = 0; i < solver->var_count; ++i)
+    {
+        solver_heap_insert(solver, i);
+    }
+}
+
+/**
+ * \brief Step a xorshift64* generator.
+ */
+static uint64_t next_random(uint64_t* state)
+{
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+
+    return x * 0x2545f4914f6cdd1dULL;
+}
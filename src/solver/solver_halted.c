@@ -0,0 +1,95 @@
+/**
+ * \file solver/solver_halted.c
+ *
+ * \brief Check whether a \ref libsat_solver should give up.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <time.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static bool flag_raised(const atomic_bool* flag);
+static bool slow_limits_reached(const libsat_solver* solver);
+
+/**
+ * \brief Check whether the solver should give up.
+ *
+ * This runs before every decision, so the flags and counters are checked each
+ * time, but the clock and the memory of the solver are only checked once every
+ * \ref SOLVER_LIMIT_CHECK_INTERVAL calls.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns true if the solver should give up.
+ */
+bool
+LIBSAT_SYM(solver_halted)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    if (solver->halted)
+    {
+        return true;
+    }
+
+    if (
+        flag_raised(solver->terminate)
+     || flag_raised(solver->stop)
+     || solver->conflicts >= solver->conflict_limit
+     || solver->propagations >= solver->propagation_limit)
+    {
+        solver->halted = true;
+        return true;
+    }
+
+    if (0 == solver->limit_countdown)
+    {
+        solver->limit_countdown = SOLVER_LIMIT_CHECK_INTERVAL;
+        solver->halted = slow_limits_reached(solver);
+    }
+
+    solver->limit_countdown -= 1;
+
+    return solver->halted;
+}
+
+/**
+ * \brief Check whether a flag is set, treating a missing flag as clear.
+ */
+static bool flag_raised(const atomic_bool* flag)
+{
+    return
+        NULL != flag && atomic_load_explicit(flag, memory_order_relaxed);
+}
+
+/**
+ * \brief Check the limits that are too costly to check every time.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns true if the deadline has passed or the memory limit is exceeded.
+ */
+static bool slow_limits_reached(const libsat_solver* solver)
+{
+    struct timespec now;
+
+    if (0 != solver->deadline)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (
+            (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec
+                >= solver->deadline)
+        {
+            return true;
+        }
+    }
+
+    return
+        0 != solver->memory_limit
+     && solver_memory(solver) > solver->memory_limit;
+}
@@ -0,0 +1,35 @@
+/**
+ * \file solver/solver_heap_insert.c
+ *
+ * \brief Add a variable to the decision heap of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Add a variable to the decision heap.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to add.
+ */
+void
+LIBSAT_SYM(solver_heap_insert)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id)
+{
+    /* a variable is only in the heap once. */
+    if (SOLVER_NOT_IN_HEAP != solver->heap_index[var_id])
+    {
+        return;
+    }
+
+    solver->heap[solver->heap_count] = var_id;
+    solver->heap_index[var_id] = solver->heap_count;
+    solver->heap_count += 1;
+
+    solver_heap_percolate_up(solver, var_id);
+}
@@ -0,0 +1,45 @@
+/**
+ * \file solver/solver_heap_percolate_up.c
+ *
+ * \brief Restore the decision heap order of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Restore the heap order after the activity of a variable increases.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable whose activity increased.
+ */
+void
+LIBSAT_SYM(solver_heap_percolate_up)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id)
+{
+    size_t i = solver->heap_index[var_id];
+    double activity = solver->activity[var_id];
+
+    /* move parents down until the variable fits. */
+    while (i > 0)
+    {
+        size_t parent = (i - 1) / 2;
+        size_t parent_var = solver->heap[parent];
+
+        if (solver->activity[parent_var] >= activity)
+        {
+            break;
+        }
+
+        solver->heap[i] = parent_var;
+        solver->heap_index[parent_var] = i;
+        i = parent;
+    }
+
+    solver->heap[i] = var_id;
+    solver->heap_index[var_id] = i;
+}
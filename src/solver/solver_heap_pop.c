@@ -0,0 +1,72 @@
+/**
+ * \file solver/solver_heap_pop.c
+ *
+ * \brief Remove the most active variable from a \ref libsat_solver heap.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Remove the most active variable from the decision heap.
+ *
+ * \param solver        The solver for this operation. The heap must not be
+ *                      empty.
+ *
+ * \returns the most active variable.
+ */
+size_t
+LIBSAT_SYM(solver_heap_pop)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    size_t top = solver->heap[0];
+    size_t last;
+    double activity;
+    size_t i = 0;
+
+    solver->heap_index[top] = SOLVER_NOT_IN_HEAP;
+    solver->heap_count -= 1;
+    if (0 == solver->heap_count)
+    {
+        return top;
+    }
+
+    /* sift the last variable down from the root. */
+    last = solver->heap[solver->heap_count];
+    activity = solver->activity[last];
+    for (;;)
+    {
+        size_t child = 2 * i + 1;
+
+        if (child >= solver->heap_count)
+        {
+            break;
+        }
+
+        if (
+            child + 1 < solver->heap_count
+         && solver->activity[solver->heap[child + 1]]
+                > solver->activity[solver->heap[child]])
+        {
+            child += 1;
+        }
+
+        if (solver->activity[solver->heap[child]] <= activity)
+        {
+            break;
+        }
+
+        solver->heap[i] = solver->heap[child];
+        solver->heap_index[solver->heap[i]] = i;
+        i = child;
+    }
+
+    solver->heap[i] = last;
+    solver->heap_index[last] = i;
+
+    return top;
+}
@@ -0,0 +1,52 @@
+/**
+ * \file solver/solver_heuristic_set.c
+ *
+ * \brief Switch the decision heuristic of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Switch the decision heuristic of a solver.
+ *
+ * The structure of the heuristic that was not in use is stale. The heap is
+ * rebuilt over the current activity, and the VMTF search position restarts
+ * from the end of the queue.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param heuristic     The \ref libsat_solve_heuristic to use.
+ */
+void
+LIBSAT_SYM(solver_heuristic_set)(
+    LIBSAT_SYM(libsat_solver)* solver, int heuristic)
+{
+    if (heuristic == solver->heuristic)
+    {
+        return;
+    }
+
+    solver->heuristic = heuristic;
+
+    if (LIBSAT_SOLVE_HEURISTIC_VMTF == heuristic)
+    {
+        solver->vmtf_search = solver->vmtf_last;
+        return;
+    }
+
+    solver->heap_count = 0;
+    memset(
+        solver->heap_index, 0xff,
+        solver->var_capacity * sizeof(*solver->heap_index));
+    for (size_t i = 0; i < solver->var_count; ++i)
+    {
+        solver_heap_insert(solver, i);
+    }
+}
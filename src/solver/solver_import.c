@@ -0,0 +1,60 @@
+/**
+ * \file solver/solver_import.c
+ *
+ * \brief Import new clauses from a \ref libsat_cnf into a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Import the clauses added to a database since the last import.
+ *
+ * A proof numbers each clause by its position in the database, counting from
+ * one.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to import from.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_import)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    status retval;
+    size_t clause_count = libsat_cnf_clause_count(cnf);
+
+    for (; solver->imported_clauses < clause_count; ++solver->imported_clauses)
+    {
+        const libsat_literal* lits;
+        size_t size;
+
+        retval =
+            libsat_cnf_clause_get(
+                &lits, &size, cnf, solver->imported_clauses);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            solver_clause_import(
+                solver, lits, size, false, solver->imported_clauses + 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
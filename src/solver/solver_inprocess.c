@@ -0,0 +1,106 @@
+/**
+ * \file solver/solver_inprocess.c
+ *
+ * \brief Run a scheduled round of inprocessing on a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/**
+ * \brief Run a round of inprocessing if one is due.
+ *
+ * A round is due once the solver has seen next_inprocess conflicts, and the
+ * interval between rounds grows by SOLVER_INPROCESS_INCREMENT each time. A
+ * round probes for failed literals, vivifies learned clauses and then reduces
+ * the learned clause database. Probing and vivification share a budget of
+ * SOLVER_INPROCESS_EFFORT percent of the propagations that search spent since
+ * the last round, so that inprocessing keeps to a fixed share of the run.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_inprocess)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    uint64_t start = solver->propagations;
+    uint64_t search, budget, spent;
+    size_t conflict;
+
+    if (solver->conflicts < solver->next_inprocess)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* the budget follows the search effort since the last round. */
+    search = start - solver->inprocess_propagations;
+    budget = (search - solver->search_propagations) / 100;
+    budget *= SOLVER_INPROCESS_EFFORT;
+    if (budget < SOLVER_INPROCESS_MIN_EFFORT)
+    {
+        budget = SOLVER_INPROCESS_MIN_EFFORT;
+    }
+
+    solver->search_propagations = search;
+    solver->inprocess_rounds += 1;
+    solver->next_inprocess =
+        solver->conflicts + SOLVER_INPROCESS_INTERVAL
+      + SOLVER_INPROCESS_INCREMENT * solver->inprocess_rounds;
+
+    /* level zero must be fully propagated before anything is assumed. */
+    retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    if (!solver->inconsistent)
+    {
+        retval = solver_probe(solver, cnf, matrix, budget / 2);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* vivification gets whatever probing left over. */
+    spent = solver->propagations - start;
+    if (!solver->inconsistent && spent < budget)
+    {
+        retval = solver_vivify(solver, cnf, matrix, budget - spent);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    retval = solver_reduce(solver);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    solver->inprocess_propagations += solver->propagations - start;
+
+    return retval;
+}
@@ -0,0 +1,1804 @@
+/**
+ * \file solver/solver_internal.h
+ *
+ * \brief Internal details for the CDCL solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/cnf.h>
+#include <libsat/literal.h>
+#include <libsat/solver.h>
+#include <libsat/xor.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/resource/protected.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "../base/libsat_base_internal.h"
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Reason for a decision or an assumption.
+ */
+#define SOLVER_NO_REASON                                         ((size_t)-1)
+
+/**
+ * \brief No conflict was found.
+ */
+#define SOLVER_NO_CONFLICT                                       ((size_t)-1)
+
+/**
+ * \brief A variable that is not in the decision heap.
+ */
+#define SOLVER_NOT_IN_HEAP                                       ((size_t)-1)
+
+/**
+ * \brief There is no variable left to decide.
+ */
+#define SOLVER_NO_VARIABLE                                       ((size_t)-1)
+
+/**
+ * \brief The base interval of the Luby restart sequence, in conflicts.
+ */
+#define SOLVER_RESTART_BASE                                               100
+
+/**
+ * \brief The base interval of the Luby restart sequence in stable phases.
+ */
+#define SOLVER_STABLE_RESTART_BASE                                       1024
+
+/**
+ * \brief The number of conflicts in the first focused phase of stabilizing
+ * restarts. Each stable phase is as long as the focused phase before it, and
+ * each focused phase is twice as long as the one before it.
+ */
+#define SOLVER_STABLE_INTERVAL                                           1000
+
+/**
+ * \brief The smoothing factor of the fast moving average of learned LBD.
+ */
+#define SOLVER_GLUCOSE_FAST_ALPHA                                 (1.0 / 32)
+
+/**
+ * \brief The smoothing factor of the slow moving average of learned LBD.
+ */
+#define SOLVER_GLUCOSE_SLOW_ALPHA                               (1.0 / 4096)
+
+/**
+ * \brief Glucose restarts once the fast average of learned LBD exceeds the
+ * slow average by this factor.
+ */
+#define SOLVER_GLUCOSE_MARGIN                                            1.25
+
+/**
+ * \brief The fewest conflicts between glucose restarts.
+ */
+#define SOLVER_GLUCOSE_MIN_CONFLICTS                                       50
+
+/**
+ * \brief The most conflicts between glucose restarts, so that scheduled work
+ * between restarts still runs when the averages never call for one.
+ */
+#define SOLVER_GLUCOSE_MAX_CONFLICTS                                    10000
+
+/**
+ * \brief The number of conflicts before the first rephase. Each later rephase
+ * comes this many conflicts later than the interval before it.
+ */
+#define SOLVER_REPHASE_INTERVAL                                          1000
+
+/**
+ * \brief The clock and the memory limit are checked once per this many checks
+ * of the other limits.
+ */
+#define SOLVER_LIMIT_CHECK_INTERVAL                                        64
+
+/**
+ * \brief The size of the proof buffer, which is written out once it fills.
+ */
+#define SOLVER_PROOF_BUFFER_SIZE                                     0x100000
+
+/**
+ * \brief Learned clauses with at most this LBD are shared with other workers.
+ */
+#define SOLVER_SHARE_MAX_LBD                                                6
+
+/**
+ * \brief The number of literal slots in a sharing ring. This must be a power
+ * of two.
+ */
+#define SOLVER_SHARE_RING_SLOTS                                       0x8000
+
+/**
+ * \brief The number of conflicts before the first round of inprocessing. Each
+ * later round comes SOLVER_INPROCESS_INCREMENT conflicts later than the last.
+ */
+#define SOLVER_INPROCESS_INTERVAL                                        2000
+
+/**
+ * \brief The growth of the interval between rounds of inprocessing.
+ */
+#define SOLVER_INPROCESS_INCREMENT                                        300
+
+/**
+ * \brief The share of search propagations, in percent, that a round of
+ * inprocessing may spend on probing and vivification.
+ */
+#define SOLVER_INPROCESS_EFFORT                                            10
+
+/**
+ * \brief The smallest propagation budget of a round of inprocessing.
+ */
+#define SOLVER_INPROCESS_MIN_EFFORT                                     10000
+
+/**
+ * \brief Learned clauses with at most this LBD are kept for good.
+ */
+#define SOLVER_TIER_CORE_LBD                                                2
+
+/**
+ * \brief Learned clauses with at most this LBD are kept while they are used.
+ */
+#define SOLVER_TIER_MID_LBD                                                 6
+
+/**
+ * \brief The number of most active variables that lookahead tries.
+ */
+#define SOLVER_LOOKAHEAD_CANDIDATES                                        64
+
+/**
+ * \brief Lookahead found a variable to split on.
+ */
+#define SOLVER_LOOKAHEAD_SPLIT                                              0
+
+/**
+ * \brief Lookahead found a literal that fails, so its negation is forced.
+ */
+#define SOLVER_LOOKAHEAD_FORCED                                             1
+
+/**
+ * \brief Lookahead found a variable that fails in both phases.
+ */
+#define SOLVER_LOOKAHEAD_CONFLICT                                           2
+
+/**
+ * \brief Every variable is assigned.
+ */
+#define SOLVER_LOOKAHEAD_ASSIGNED                                           3
+
+/**
+ * \brief Propagation learned a fact and returned the solver to level zero.
+ */
+#define SOLVER_LOOKAHEAD_RESET                                              4
+
+/**
+ * \brief A set of cubes that together cover every assignment consistent with
+ * the assumptions.
+ *
+ * The literals of cube i run from ends[i - 1], or zero, up to ends[i]. The
+ * path holds the cube being built, and has room for var_capacity + 1
+ * literals.
+ */
+typedef struct LIBSAT_SYM(solver_cube_set) LIBSAT_SYM(solver_cube_set);
+struct LIBSAT_SYM(solver_cube_set)
+{
+    RCPR_SYM(allocator)* alloc;
+    LIBSAT_SYM(libsat_literal)* lits;
+    size_t lit_count;
+    size_t lit_capacity;
+    size_t* ends;
+    size_t cube_count;
+    size_t cube_capacity;
+    LIBSAT_SYM(libsat_literal)* path;
+    size_t path_count;
+
+    /* a branch was refuted under all of the assumptions. */
+    bool refuted;
+
+    /* the assumptions alone fail, or the problem is unsatisfiable. */
+    bool decided;
+
+    /* a fact was learned while splitting, so splitting starts over. */
+    bool reset;
+};
+
+/**
+ * \brief A lock-free ring through which one worker exports learned clauses to
+ * all of the others.
+ *
+ * Each clause is written as its size followed by its literals. Only the owner
+ * writes, and publishes a clause by advancing head past it. Readers keep their
+ * own positions, and discard whatever the owner has lapped while they read it.
+ */
+typedef struct LIBSAT_SYM(solver_ring) LIBSAT_SYM(solver_ring);
+struct LIBSAT_SYM(solver_ring)
+{
+    _Alignas(64) atomic_uint_fast64_t head;
+    _Alignas(64) atomic_size_t slots[SOLVER_SHARE_RING_SLOTS];
+};
+
+/**
+ * \brief A clause in the solver. Its literals live in the arena, starting at
+ * start. The first two literals are watched. A learned clause is marked as
+ * used when it takes part in conflict analysis, and as vivified once
+ * vivification has tried to shorten it. While a proof is written, id is the
+ * number of the clause in the proof.
+ */
+typedef struct LIBSAT_SYM(solver_clause) LIBSAT_SYM(solver_clause);
+struct LIBSAT_SYM(solver_clause)
+{
+    size_t start;
+    size_t size;
+    uint64_t id;
+    uint32_t lbd;
+    bool learned;
+    bool deleted;
+    bool used;
+    bool vivified;
+};
+
+/**
+ * \brief A watch on a clause. If the blocker is true, the clause is satisfied
+ * and need not be visited.
+ */
+typedef struct LIBSAT_SYM(solver_watch) LIBSAT_SYM(solver_watch);
+struct LIBSAT_SYM(solver_watch)
+{
+    size_t clause;
+    LIBSAT_SYM(libsat_literal) blocker;
+};
+
+/**
+ * \brief A variable bumped by conflict analysis, with its VMTF stamp from
+ * before the bump.
+ */
+typedef struct LIBSAT_SYM(solver_vmtf_entry) LIBSAT_SYM(solver_vmtf_entry);
+struct LIBSAT_SYM(solver_vmtf_entry)
+{
+    uint64_t stamp;
+    size_t var_id;
+};
+
+/**
+ * \brief The watches on a single literal.
+ */
+typedef struct LIBSAT_SYM(solver_watch_list) LIBSAT_SYM(solver_watch_list);
+struct LIBSAT_SYM(solver_watch_list)
+{
+    LIBSAT_SYM(solver_watch)* items;
+    size_t count;
+    size_t capacity;
+};
+
+/**
+ * \brief A proof being written by a solver.
+ *
+ * Clauses of the database are numbered from one in database order, and
+ * learned clauses are numbered after them. The hints of the next LRAT clause
+ * are gathered in hints, and the variables marked while gathering them are
+ * listed in marks. The ids array holds the numbers of intermediate clauses
+ * while probing. Units of the level zero trail before unit_next have a number
+ * in the unit_ids array of the solver. The first write error is kept in
+ * error, and reported at the end of the solve.
+ */
+typedef struct LIBSAT_SYM(solver_proof) LIBSAT_SYM(solver_proof);
+struct LIBSAT_SYM(solver_proof)
+{
+    int fd;
+    int format;
+    uint8_t* buffer;
+    size_t buffer_count;
+    size_t clause_count;
+    uint64_t next_id;
+    uint64_t* hints;
+    size_t hint_count;
+    size_t hint_capacity;
+    size_t* marks;
+    uint64_t* ids;
+    size_t unit_next;
+    status error;
+};
+
+/**
+ * \brief libsat_solver implementation.
+ *
+ * Per-variable arrays are indexed by variable id and hold var_capacity
+ * entries. The watch array is indexed by literal, and holds the clauses
+ * watching that literal, which are visited when it becomes false.
+ *
+ * Decisions come from the activity heap under EVSIDS, or from the VMTF queue,
+ * which links every variable in the order it was last bumped. The search
+ * position of the queue is never behind an unassigned variable. The heap only
+ * follows activity under EVSIDS, and the queue is only bumped under VMTF.
+ * The variables that one conflict bumps are gathered in vmtf_bumped, and moved
+ * to the end of the queue in their old order, so that their relative recency
+ * is kept.
+ *
+ * The target array holds the longest conflict-free assignment seen since the
+ * last rephase, which covered target_count trail literals. Stable phases
+ * decide towards it, and rephasing may copy it into the saved phases.
+ */
+struct LIBSAT_SYM(libsat_solver)
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+
+    /* variables. */
+    size_t var_count;
+    size_t var_capacity;
+    uint8_t* values;
+    size_t* levels;
+    size_t* reasons;
+    double* activity;
+    uint8_t* phases;
+    uint8_t* seen;
+    size_t* heap;
+    size_t heap_count;
+    size_t* heap_index;
+    double var_inc;
+    uint8_t* target;
+    size_t target_count;
+    size_t* vmtf_prev;
+    size_t* vmtf_next;
+    uint64_t* vmtf_stamp;
+    size_t vmtf_first;
+    size_t vmtf_last;
+    size_t vmtf_search;
+    uint64_t vmtf_clock;
+    LIBSAT_SYM(solver_vmtf_entry)* vmtf_bumped;
+    size_t vmtf_bumped_count;
+
+    /* trail. */
+    LIBSAT_SYM(libsat_literal)* trail;
+    size_t trail_count;
+    size_t qhead;
+    size_t* trail_lim;
+    uint64_t* level_stamp;
+    size_t level_capacity;
+    uint64_t stamp;
+    size_t level;
+
+    /* clauses. */
+    LIBSAT_SYM(libsat_literal)* arena;
+    size_t arena_count;
+    size_t arena_capacity;
+    LIBSAT_SYM(solver_clause)* clauses;
+    size_t clause_count;
+    size_t clause_capacity;
+    LIBSAT_SYM(solver_watch_list)* watches;
+    size_t imported_clauses;
+    bool inconsistent;
+
+    /* scratch space, each holding var_capacity + 1 literals. */
+    LIBSAT_SYM(libsat_literal)* learned;
+    size_t learned_count;
+    uint32_t learned_lbd;
+    LIBSAT_SYM(libsat_literal)* scratch;
+    LIBSAT_SYM(libsat_literal)* implied;
+
+    /* assumptions and results. */
+    LIBSAT_SYM(libsat_literal)* assumptions;
+    size_t assumption_count;
+    size_t assumption_capacity;
+    LIBSAT_SYM(libsat_literal)* core;
+    size_t core_count;
+    uint8_t* model;
+    size_t model_count;
+    int last_result;
+    const LIBSAT_SYM(libsat_ast_node)** statement_core;
+    size_t statement_capacity;
+    uint32_t* count_words;
+    size_t count_capacity;
+
+    /* search policy and parallel workers. */
+    int heuristic;
+    int restart_policy;
+    bool rephase;
+    bool stable;
+    uint64_t stable_next;
+    uint64_t stable_length;
+    double lbd_fast;
+    double lbd_slow;
+    uint64_t lbd_samples;
+    uint64_t rephase_next;
+    uint64_t rephase_count;
+    const atomic_bool* stop;
+    const atomic_bool* terminate;
+    LIBSAT_SYM(solver_ring)* rings;
+    size_t ring_count;
+    size_t ring_self;
+    uint64_t* ring_read;
+
+    /* inprocessing schedule. */
+    uint64_t next_inprocess;
+    uint64_t inprocess_rounds;
+    uint64_t inprocess_propagations;
+    uint64_t search_propagations;
+    size_t probe_next;
+
+    /* proof logging. */
+    LIBSAT_SYM(solver_proof)* proof;
+    uint64_t* unit_ids;
+
+    /* limits of the current call. */
+    uint64_t conflict_limit;
+    uint64_t propagation_limit;
+    uint64_t deadline;
+    size_t memory_limit;
+    unsigned limit_countdown;
+    bool halted;
+
+    /* statistics. */
+    uint64_t conflicts;
+    uint64_t decisions;
+    uint64_t propagations;
+    uint64_t restarts;
+};
+
+/******************************************************************************/
+/* Start of inline helpers.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the value of a literal.
+ */
+static inline uint8_t solver_lit_value(
+    const LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit)
+{
+    uint8_t value = solver->values[LIBSAT_LITERAL_VARIABLE(lit)];
+
+    if (LIBSAT_VALUE_UNASSIGNED == value || !LIBSAT_LITERAL_IS_NEGATED(lit))
+    {
+        return value;
+    }
+
+    return
+        (LIBSAT_VALUE_TRUE == value) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+}
+
+/**
+ * \brief Get the literals of a clause.
+ */
+static inline LIBSAT_SYM(libsat_literal)* solver_clause_lits(
+    const LIBSAT_SYM(libsat_solver)* solver, size_t clause)
+{
+    return solver->arena + solver->clauses[clause].start;
+}
+
+/**
+ * \brief Make a literal true at the current decision level.
+ */
+static inline void solver_enqueue(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit,
+    size_t reason)
+{
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+    solver->values[var_id] =
+        LIBSAT_LITERAL_IS_NEGATED(lit)
+            ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+    solver->levels[var_id] = solver->level;
+    solver->reasons[var_id] = reason;
+    solver->trail[solver->trail_count++] = lit;
+}
+
+/**
+ * \brief Open a new decision level.
+ */
+static inline void solver_new_level(LIBSAT_SYM(libsat_solver)* solver)
+{
+    solver->trail_lim[solver->level++] = solver->trail_count;
+}
+
+/**
+ * \brief Get the literal that a literal is an alias of in a context.
+ *
+ * The alias table maps each variable to a literal equivalent to it; a
+ * variable that maps to itself is a root. Paths are halved on the way.
+ */
+static inline LIBSAT_SYM(libsat_literal) solver_alias_find(
+    LIBSAT_SYM(libsat_context)* context, LIBSAT_SYM(libsat_literal) lit)
+{
+    for (;;)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+        LIBSAT_SYM(libsat_literal) parent, grandparent;
+
+        if (var_id >= context->alias_capacity)
+        {
+            return lit;
+        }
+
+        parent = context->alias[var_id];
+        if (LIBSAT_LITERAL_VARIABLE(parent) == var_id)
+        {
+            return lit;
+        }
+
+        grandparent = context->alias[LIBSAT_LITERAL_VARIABLE(parent)];
+        context->alias[var_id] =
+            LIBSAT_LITERAL_IS_NEGATED(parent)
+                ? LIBSAT_LITERAL_NEGATE(grandparent) : grandparent;
+        lit =
+            LIBSAT_LITERAL_IS_NEGATED(lit)
+                ? LIBSAT_LITERAL_NEGATE(context->alias[var_id])
+                : context->alias[var_id];
+    }
+}
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Create a solver instance.
+ *
+ * \param solver        Pointer to the solver pointer to be set to this created
+ *                      instance on success.
+ * \param alloc         The allocator to use for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_create)(
+    LIBSAT_SYM(libsat_solver)** solver, RCPR_SYM(allocator)* alloc);
+
+/**
+ * \brief Release a \ref libsat_solver resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_resource_release)(
+    RCPR_SYM(resource)* r);
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Make room for the given number of variables.
+ *
+ * New variables are unassigned, have no activity, and are added to the
+ * decision heap.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reserve)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count);
+
+/**
+ * \brief Add a clause of at least two literals and watch its first two.
+ *
+ * \param clause        Pointer to receive the clause index on success.
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ * \param learned       True if this clause is learned.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_clause_add)(
+    size_t* clause, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count, bool learned);
+
+/**
+ * \brief Watch a clause on a literal.
+ *
+ * \param solver        The solver for this operation.
+ * \param lit           The literal to watch.
+ * \param clause        The clause to visit when this literal becomes false.
+ * \param blocker       Another literal of the clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_watch_add)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit,
+    size_t clause, LIBSAT_SYM(libsat_literal) blocker);
+
+/**
+ * \brief Add a clause that explains an implication or a conflict found outside
+ * of the clause database.
+ *
+ * Every literal but at most one must be false. If one literal is unassigned,
+ * it is enqueued with this clause as its reason; otherwise, this clause is the
+ * conflict. The literals are reordered so that the unassigned or highest-level
+ * literal and the next highest false literal are watched. Unit explanations
+ * are facts, and are enqueued at decision level zero after backtracking.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause. These are reordered.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reason_add)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver,
+    LIBSAT_SYM(libsat_literal)* lits, size_t count);
+
+/**
+ * \brief Import the clauses added to a database since the last import.
+ *
+ * This must be called at decision level zero. Satisfied clauses are skipped,
+ * false literals are dropped, and units are enqueued.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to import from.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_import)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Propagate the trail through the clause database.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Propagate the native xor matrix under the current assignment.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param progress      Pointer to a flag that is set if a literal was
+ *                      assigned.
+ * \param solver        The solver for this operation.
+ * \param matrix        The matrix to propagate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_xor)(
+    size_t* conflict, bool* progress, LIBSAT_SYM(libsat_solver)* solver,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Propagate the native constraints of a database under the current
+ * assignment.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param progress      Pointer to a flag that is set if a literal was
+ *                      assigned.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding the native constraints.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_native)(
+    size_t* conflict, bool* progress, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf);
+
+/**
+ * \brief Analyze a conflict, leaving the first UIP clause in learned.
+ *
+ * The asserting literal is placed first, and a literal from the backjump
+ * level second.
+ *
+ * \param backjump      Pointer to receive the backjump level.
+ * \param solver        The solver for this operation.
+ * \param conflict      The conflicting clause. At least one of its literals
+ *                      must be assigned at the current decision level.
+ */
+void
+LIBSAT_SYM(solver_analyze)(
+    size_t* backjump, LIBSAT_SYM(libsat_solver)* solver, size_t conflict);
+
+/**
+ * \brief Compute the assumptions responsible for a false assumption.
+ *
+ * \param solver        The solver for this operation.
+ * \param lit           The assumption that is false.
+ */
+void
+LIBSAT_SYM(solver_analyze_final)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit);
+
+/**
+ * \brief Undo every assignment above the given decision level.
+ *
+ * \param solver        The solver for this operation.
+ * \param level         The decision level to return to.
+ */
+void
+LIBSAT_SYM(solver_backtrack)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t level);
+
+/**
+ * \brief Search for a model until a result is found or the conflict budget is
+ * spent.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result. An
+ *                      unknown result means that the budget was spent.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of conflicts allowed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_search)(
+    int* result, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    uint64_t budget);
+
+/**
+ * \brief Solve a database and xor matrix under the given assumptions.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to solve.
+ * \param matrix        The native xor matrix.
+ * \param var_count     The number of variables.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_solve)(
+    int* result, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    size_t var_count, const LIBSAT_SYM(libsat_literal)* assumptions,
+    size_t count);
+
+/**
+ * \brief Forget every variable from the given id on, and every clause that
+ * mentions one of them.
+ *
+ * The solver must be at decision level zero. Surviving clauses are compacted,
+ * and the forgotten variables are reset so that their ids can be reused.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables to keep.
+ * \param clause_count  The number of database clauses to keep imported.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_pop)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count, size_t clause_count);
+
+/**
+ * \brief Forget every clause, so that the database is imported again on the
+ * next solve.
+ *
+ * Level zero facts, activity, and saved phases are kept.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_reset)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Simplify a clause against the level zero assignment and store it.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param lits          The literals of this clause.
+ * \param size          The number of literals.
+ * \param learned       True if this clause is learned.
+ * \param id            The number of this clause in the proof, or zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_clause_import)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t size, bool learned, uint64_t id);
+
+/**
+ * \brief Publish a learned clause on the sharing ring of this solver.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ */
+void
+LIBSAT_SYM(solver_share_export)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count);
+
+/**
+ * \brief Import the clauses published by the other workers since the last
+ * import.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_share_import)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Give a portfolio worker its own seed, restart policy, and phase.
+ *
+ * \param solver        The solver for this operation. Its variables must
+ *                      already be reserved.
+ * \param index         The index of this worker in the portfolio.
+ */
+void
+LIBSAT_SYM(solver_diversify)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t index);
+
+/**
+ * \brief Copy the result, model, and core of one solver to another.
+ *
+ * \param dst           The solver receiving the result.
+ * \param src           The solver holding the result.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_result_copy)(
+    LIBSAT_SYM(libsat_solver)* dst, const LIBSAT_SYM(libsat_solver)* src);
+
+/**
+ * \brief Prepend the activation literals of the open scopes of a context to
+ * the given assumptions.
+ *
+ * \param lits          Pointer to receive the assumptions to solve with.
+ * \param total         Pointer to receive the number of assumptions.
+ * \param context       The context for this operation.
+ * \param assumptions   The caller's assumptions.
+ * \param count         The number of caller assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_scope_assumptions)(
+    const LIBSAT_SYM(libsat_literal)** lits, size_t* total,
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count);
+
+/**
+ * \brief Remove the activation literals of the open scopes of a context from
+ * the core of its solver.
+ *
+ * \param context       The context for this operation.
+ */
+void
+LIBSAT_SYM(solver_scope_core_filter)(
+    LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Get the literal that is always true in this context, creating it if
+ * necessary.
+ *
+ * \param lit           Pointer to receive the literal.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_true_literal)(
+    LIBSAT_SYM(libsat_literal)* lit, LIBSAT_SYM(libsat_context)* context);
+
+/**
+ * \brief Add back every eliminated variable that a clause, a native
+ * constraint, the native xor matrix, or an assumption uses.
+ *
+ * \param context       The context for this operation.
+ * \param assumptions   The caller's assumptions.
+ * \param count         The number of caller assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reactivate)(
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count);
+
+/**
+ * \brief Run a round of inprocessing if one is due.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_inprocess)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Look for failed literals, and for literals implied by both phases of
+ * a variable, and fix them at level zero.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of propagations to spend.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_probe)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, uint64_t budget);
+
+/**
+ * \brief Shorten the learned clauses that are worth keeping by propagating
+ * the negation of their literals.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of propagations to spend.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_vivify)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, uint64_t budget);
+
+/**
+ * \brief Delete learned clauses by LBD tier, and compact the clause database.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reduce)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Make a root variable an alias of a literal in a context.
+ *
+ * \param context       The context for this operation.
+ * \param var_id        The root variable to link.
+ * \param lit           The literal that this variable is equivalent to. Its
+ *                      variable must be a different root.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_alias_link)(
+    LIBSAT_SYM(libsat_context)* context, size_t var_id,
+    LIBSAT_SYM(libsat_literal) lit);
+
+/**
+ * \brief Verify the assumptions of a call, and make room for its variables
+ * and assumptions.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_prepare)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count);
+
+/**
+ * \brief Propagate clauses, then the xor matrix, then native constraints,
+ * until none of them assigns anything new.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_all)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Pick the variable whose two phases propagate the most.
+ *
+ * \param branch        Pointer to receive the literal to split on, or the
+ *                      forced literal.
+ * \param outcome       Pointer to receive the SOLVER_LOOKAHEAD_* outcome.
+ * \param solver        The solver for this operation. Propagation must be
+ *                      complete and without conflict.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_lookahead)(
+    LIBSAT_SYM(libsat_literal)* branch, int* outcome,
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Split the problem under the assumptions into cubes.
+ *
+ * \param cubes         The cube set to fill. It must be empty.
+ * \param solver        The solver for this operation. It must be prepared
+ *                      with the assumptions, at decision level zero, with the
+ *                      database imported.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param depth         The number of splits along each cube.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_cubes)(
+    LIBSAT_SYM(solver_cube_set)* cubes, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    size_t depth);
+
+/**
+ * \brief Reclaim the memory held by a cube set.
+ *
+ * \param cubes         The cube set to dispose.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_cubes_dispose)(
+    LIBSAT_SYM(solver_cube_set)* cubes);
+
+/**
+ * \brief Create a parallel worker for a context, with a fresh solver and its
+ * own copy of the native xor matrix.
+ *
+ * \param solver        Pointer to receive the worker solver.
+ * \param matrix        Pointer to receive the copy of the xor matrix.
+ * \param context       The context for this operation.
+ * \param index         The index of this worker, used to diversify it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_worker_create)(
+    LIBSAT_SYM(libsat_solver)** solver, LIBSAT_SYM(libsat_xor_matrix)** matrix,
+    LIBSAT_SYM(libsat_context)* context, size_t index);
+
+/**
+ * \brief Allocate a set of sharing rings, aligned to a cache line.
+ *
+ * \param memory        Pointer to receive the block to reclaim later.
+ * \param rings         Pointer to receive the aligned rings.
+ * \param alloc         The allocator to use for this operation.
+ * \param count         The number of rings.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_rings_create)(
+    void** memory, LIBSAT_SYM(solver_ring)** rings, RCPR_SYM(allocator)* alloc,
+    size_t count);
+
+/**
+ * \brief Attach a solver to a set of sharing rings and a stop flag.
+ *
+ * \param solver        The solver for this operation.
+ * \param rings         The rings shared by the workers.
+ * \param count         The number of rings.
+ * \param self          The ring this solver publishes to.
+ * \param stop          The flag that stops this solver.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_share_attach)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(solver_ring)* rings,
+    size_t count, size_t self, const atomic_bool* stop);
+
+/**
+ * \brief Detach a solver from its sharing rings and stop flag.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_share_detach)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Add a variable to the decision heap.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to add.
+ */
+void
+LIBSAT_SYM(solver_heap_insert)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id);
+
+/**
+ * \brief Restore the heap order after the activity of a variable increases.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable whose activity increased.
+ */
+void
+LIBSAT_SYM(solver_heap_percolate_up)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id);
+
+/**
+ * \brief Remove the most active variable from the decision heap.
+ *
+ * \param solver        The solver for this operation. The heap must not be
+ *                      empty.
+ *
+ * \returns the most active variable.
+ */
+size_t
+LIBSAT_SYM(solver_heap_pop)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Add a variable to the end of the VMTF queue, as the most recently
+ * bumped.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to add. It must not be in the queue.
+ */
+void
+LIBSAT_SYM(solver_vmtf_enqueue)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id);
+
+/**
+ * \brief Move a variable to the end of the VMTF queue.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to bump.
+ */
+void
+LIBSAT_SYM(solver_vmtf_bump)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id);
+
+/**
+ * \brief Drop the variables at or past a count from the VMTF queue, keeping
+ * the order of the rest.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables to keep.
+ */
+void
+LIBSAT_SYM(solver_vmtf_truncate)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count);
+
+/**
+ * \brief Pick the next variable to decide.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns the unassigned variable ranked first by the decision heuristic, or
+ * SOLVER_NO_VARIABLE if every variable is assigned.
+ */
+size_t
+LIBSAT_SYM(solver_decide)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Set the restart policy of a solver, and whether it rephases.
+ *
+ * \param solver        The solver for this operation.
+ * \param restart       The \ref libsat_solve_restart policy.
+ * \param rephase       True if saved phases are periodically reset.
+ */
+void
+LIBSAT_SYM(solver_restart_set)(
+    LIBSAT_SYM(libsat_solver)* solver, int restart, bool rephase);
+
+/**
+ * \brief Switch between stable and focused phases if a switch is due.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_stabilize)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Reset the saved phases if a rephase is due.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ */
+void
+LIBSAT_SYM(solver_rephase)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Switch the decision heuristic of a solver.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param heuristic     The \ref libsat_solve_heuristic to use.
+ */
+void
+LIBSAT_SYM(solver_heuristic_set)(
+    LIBSAT_SYM(libsat_solver)* solver, int heuristic);
+
+/**
+ * \brief Set the limits of a solver from the options of a call, starting from
+ * its current statistics.
+ *
+ * \param solver        The solver for this operation.
+ * \param options       The options holding the limits, or NULL to clear them.
+ */
+void
+LIBSAT_SYM(solver_limits_set)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_solve_options)* options);
+
+/**
+ * \brief Check whether the solver should give up.
+ *
+ * The solver gives up once termination is requested, another worker of a
+ * portfolio has an answer, or a limit of the call is reached. Once it gives
+ * up, it stays halted until the next solve.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns true if the solver should give up.
+ */
+bool
+LIBSAT_SYM(solver_halted)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Get the number of bytes held by a solver.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns the number of bytes held by the solver.
+ */
+size_t
+LIBSAT_SYM(solver_memory)(
+    const LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Begin writing a proof.
+ *
+ * \param solver        The solver for this operation.
+ * \param fd            The file descriptor to write to.
+ * \param format        The \ref libsat_proof_format to write.
+ * \param clause_count  The number of clauses in the database.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_begin)(
+    LIBSAT_SYM(libsat_solver)* solver, int fd, int format,
+    size_t clause_count);
+
+/**
+ * \brief Write out the rest of a proof and stop logging.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if some part of the proof could not
+ *        be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_end)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Check that a solve can be logged, and size the proof scratch space to
+ * the variables of the solver.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to solve.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if the database has changed since
+ *        the proof began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if the database holds native
+ *        constraints or parity statements.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_prepare)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Write out the proof buffer. A failure is kept as the error of the
+ * proof, and the rest of the proof is dropped.
+ *
+ * \param proof         The proof for this operation.
+ */
+void
+LIBSAT_SYM(solver_proof_flush)(
+    LIBSAT_SYM(solver_proof)* proof);
+
+/**
+ * \brief Append a number to the proof buffer, seven bits at a time, starting
+ * from the least significant.
+ *
+ * \param proof         The proof for this operation.
+ * \param value         The number to append.
+ */
+void
+LIBSAT_SYM(solver_proof_put)(
+    LIBSAT_SYM(solver_proof)* proof, uint64_t value);
+
+/**
+ * \brief Log the level zero facts that do not have a number in the proof yet.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_proof_units)(
+    LIBSAT_SYM(libsat_solver)* solver);
+
+/**
+ * \brief Gather the LRAT hints of a lemma that is false under the current
+ * assignment.
+ *
+ * The given clause must be false once the lemma is, apart from literals of the
+ * lemma's own variables. Its literals are followed back along the trail to the
+ * lemma, and the reasons met on the way become the hints.
+ *
+ * \param solver        The solver for this operation.
+ * \param lemma         The literals of the lemma.
+ * \param count         The number of literals in the lemma.
+ * \param lits          The literals of the clause.
+ * \param size          The number of literals in the clause.
+ * \param id            The number of the clause in the proof.
+ */
+void
+LIBSAT_SYM(solver_proof_chain)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lemma, size_t count,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t size, uint64_t id);
+
+/**
+ * \brief Log a lemma with the hints gathered for it.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of the lemma.
+ * \param count         The number of literals.
+ *
+ * \returns the number of the lemma in the proof, or zero if no proof is being
+ * written.
+ */
+uint64_t
+LIBSAT_SYM(solver_proof_add)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count);
+
+/**
+ * \brief Log the deletion of a clause.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of the clause.
+ * \param count         The number of literals.
+ * \param id            The number of the clause in the proof.
+ */
+void
+LIBSAT_SYM(solver_proof_delete)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count, uint64_t id);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_solver_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    typedef LIBSAT_SYM(libsat_solver) sym ## libsat_solver; \
+    typedef LIBSAT_SYM(solver_clause) sym ## solver_clause; \
+    typedef LIBSAT_SYM(solver_watch) sym ## solver_watch; \
+    typedef LIBSAT_SYM(solver_watch_list) sym ## solver_watch_list; \
+    typedef LIBSAT_SYM(solver_vmtf_entry) sym ## solver_vmtf_entry; \
+    typedef LIBSAT_SYM(solver_ring) sym ## solver_ring; \
+    typedef LIBSAT_SYM(solver_cube_set) sym ## solver_cube_set; \
+    typedef LIBSAT_SYM(solver_proof) sym ## solver_proof; \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_create( \
+        LIBSAT_SYM(libsat_solver)** x, RCPR_SYM(allocator)* y) { \
+            return LIBSAT_SYM(solver_create)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_resource_release( \
+        RCPR_SYM(resource)* x) { \
+            return LIBSAT_SYM(solver_resource_release)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_reserve( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            return LIBSAT_SYM(solver_reserve)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_clause_add( \
+        size_t* v, LIBSAT_SYM(libsat_solver)* w, \
+        const LIBSAT_SYM(libsat_literal)* x, size_t y, bool z) { \
+            return LIBSAT_SYM(solver_clause_add)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_watch_add( \
+        LIBSAT_SYM(libsat_solver)* w, LIBSAT_SYM(libsat_literal) x, \
+        size_t y, LIBSAT_SYM(libsat_literal) z) { \
+            return LIBSAT_SYM(solver_watch_add)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_reason_add( \
+        size_t* w, LIBSAT_SYM(libsat_solver)* x, \
+        LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_reason_add)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_import( \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_cnf)* y) { \
+            return LIBSAT_SYM(solver_import)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_propagate( \
+        size_t* x, LIBSAT_SYM(libsat_solver)* y) { \
+            return LIBSAT_SYM(solver_propagate)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_propagate_xor( \
+        size_t* w, bool* x, LIBSAT_SYM(libsat_solver)* y, \
+        LIBSAT_SYM(libsat_xor_matrix)* z) { \
+            return LIBSAT_SYM(solver_propagate_xor)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_propagate_native( \
+        size_t* w, bool* x, LIBSAT_SYM(libsat_solver)* y, \
+        const LIBSAT_SYM(libsat_cnf)* z) { \
+            return LIBSAT_SYM(solver_propagate_native)(w,x,y,z); } \
+    static inline void \
+    sym ## solver_analyze( \
+        size_t* x, LIBSAT_SYM(libsat_solver)* y, size_t z) { \
+            LIBSAT_SYM(solver_analyze)(x,y,z); } \
+    static inline void \
+    sym ## solver_analyze_final( \
+        LIBSAT_SYM(libsat_solver)* x, LIBSAT_SYM(libsat_literal) y) { \
+            LIBSAT_SYM(solver_analyze_final)(x,y); } \
+    static inline void \
+    sym ## solver_backtrack( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_backtrack)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_search( \
+        int* v, LIBSAT_SYM(libsat_solver)* w, \
+        const LIBSAT_SYM(libsat_cnf)* x, \
+        LIBSAT_SYM(libsat_xor_matrix)* y, uint64_t z) { \
+            return LIBSAT_SYM(solver_search)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_solve( \
+        int* t, LIBSAT_SYM(libsat_solver)* u, \
+        const LIBSAT_SYM(libsat_cnf)* v, \
+        LIBSAT_SYM(libsat_xor_matrix)* w, size_t x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_solve)(t,u,v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_pop( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y, size_t z) { \
+            return LIBSAT_SYM(solver_pop)(x,y,z); } \
+    static inline void \
+    sym ## solver_reset( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            LIBSAT_SYM(solver_reset)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_clause_import( \
+        LIBSAT_SYM(libsat_solver)* v, const LIBSAT_SYM(libsat_literal)* w, \
+        size_t x, bool y, uint64_t z) { \
+            return LIBSAT_SYM(solver_clause_import)(v,w,x,y,z); } \
+    static inline void \
+    sym ## solver_share_export( \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_literal)* y, \
+        size_t z) { \
+            LIBSAT_SYM(solver_share_export)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_share_import( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_share_import)(x); } \
+    static inline void \
+    sym ## solver_diversify( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_diversify)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_result_copy( \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_solver)* y) { \
+            return LIBSAT_SYM(solver_result_copy)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_scope_assumptions( \
+        const LIBSAT_SYM(libsat_literal)** v, size_t* w, \
+        LIBSAT_SYM(libsat_context)* x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_scope_assumptions)(v,w,x,y,z); } \
+    static inline void \
+    sym ## solver_scope_core_filter( \
+        LIBSAT_SYM(libsat_context)* x) { \
+            LIBSAT_SYM(solver_scope_core_filter)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_true_literal( \
+        LIBSAT_SYM(libsat_literal)* x, LIBSAT_SYM(libsat_context)* y) { \
+            return LIBSAT_SYM(solver_true_literal)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_reactivate( \
+        LIBSAT_SYM(libsat_context)* x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_reactivate)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_inprocess( \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_cnf)* y, \
+        LIBSAT_SYM(libsat_xor_matrix)* z) { \
+            return LIBSAT_SYM(solver_inprocess)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_probe( \
+        LIBSAT_SYM(libsat_solver)* w, const LIBSAT_SYM(libsat_cnf)* x, \
+        LIBSAT_SYM(libsat_xor_matrix)* y, uint64_t z) { \
+            return LIBSAT_SYM(solver_probe)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_vivify( \
+        LIBSAT_SYM(libsat_solver)* w, const LIBSAT_SYM(libsat_cnf)* x, \
+        LIBSAT_SYM(libsat_xor_matrix)* y, uint64_t z) { \
+            return LIBSAT_SYM(solver_vivify)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_reduce( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_reduce)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_alias_link( \
+        LIBSAT_SYM(libsat_context)* x, size_t y, \
+        LIBSAT_SYM(libsat_literal) z) { \
+            return LIBSAT_SYM(solver_alias_link)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_prepare( \
+        LIBSAT_SYM(libsat_solver)* w, size_t x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_prepare)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_propagate_all( \
+        size_t* w, LIBSAT_SYM(libsat_solver)* x, \
+        const LIBSAT_SYM(libsat_cnf)* y, \
+        LIBSAT_SYM(libsat_xor_matrix)* z) { \
+            return LIBSAT_SYM(solver_propagate_all)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_lookahead( \
+        LIBSAT_SYM(libsat_literal)* v, int* w, \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_cnf)* y, \
+        LIBSAT_SYM(libsat_xor_matrix)* z) { \
+            return LIBSAT_SYM(solver_lookahead)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_cubes( \
+        LIBSAT_SYM(solver_cube_set)* v, LIBSAT_SYM(libsat_solver)* w, \
+        const LIBSAT_SYM(libsat_cnf)* x, \
+        LIBSAT_SYM(libsat_xor_matrix)* y, size_t z) { \
+            return LIBSAT_SYM(solver_cubes)(v,w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_cubes_dispose( \
+        LIBSAT_SYM(solver_cube_set)* x) { \
+            return LIBSAT_SYM(solver_cubes_dispose)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_worker_create( \
+        LIBSAT_SYM(libsat_solver)** w, LIBSAT_SYM(libsat_xor_matrix)** x, \
+        LIBSAT_SYM(libsat_context)* y, size_t z) { \
+            return LIBSAT_SYM(solver_worker_create)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_rings_create( \
+        void** w, LIBSAT_SYM(solver_ring)** x, RCPR_SYM(allocator)* y, \
+        size_t z) { \
+            return LIBSAT_SYM(solver_rings_create)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_share_attach( \
+        LIBSAT_SYM(libsat_solver)* v, LIBSAT_SYM(solver_ring)* w, \
+        size_t x, size_t y, const atomic_bool* z) { \
+            return LIBSAT_SYM(solver_share_attach)(v,w,x,y,z); } \
+    static inline void \
+    sym ## solver_share_detach( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            LIBSAT_SYM(solver_share_detach)(x); } \
+    static inline void \
+    sym ## solver_heap_insert( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_heap_insert)(x,y); } \
+    static inline void \
+    sym ## solver_heap_percolate_up( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_heap_percolate_up)(x,y); } \
+    static inline size_t \
+    sym ## solver_heap_pop( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_heap_pop)(x); } \
+    static inline void \
+    sym ## solver_vmtf_enqueue( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_vmtf_enqueue)(x,y); } \
+    static inline void \
+    sym ## solver_vmtf_bump( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_vmtf_bump)(x,y); } \
+    static inline void \
+    sym ## solver_vmtf_truncate( \
+        LIBSAT_SYM(libsat_solver)* x, size_t y) { \
+            LIBSAT_SYM(solver_vmtf_truncate)(x,y); } \
+    static inline size_t \
+    sym ## solver_decide( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_decide)(x); } \
+    static inline void \
+    sym ## solver_restart_set( \
+        LIBSAT_SYM(libsat_solver)* x, int y, bool z) { \
+            LIBSAT_SYM(solver_restart_set)(x,y,z); } \
+    static inline void \
+    sym ## solver_stabilize( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            LIBSAT_SYM(solver_stabilize)(x); } \
+    static inline void \
+    sym ## solver_rephase( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            LIBSAT_SYM(solver_rephase)(x); } \
+    static inline void \
+    sym ## solver_heuristic_set( \
+        LIBSAT_SYM(libsat_solver)* x, int y) { \
+            LIBSAT_SYM(solver_heuristic_set)(x,y); } \
+    static inline void \
+    sym ## solver_limits_set( \
+        LIBSAT_SYM(libsat_solver)* x, \
+        const LIBSAT_SYM(libsat_solve_options)* y) { \
+            LIBSAT_SYM(solver_limits_set)(x,y); } \
+    static inline bool \
+    sym ## solver_halted( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_halted)(x); } \
+    static inline size_t \
+    sym ## solver_memory( \
+        const LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_memory)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_proof_begin( \
+        LIBSAT_SYM(libsat_solver)* w, int x, int y, size_t z) { \
+            return LIBSAT_SYM(solver_proof_begin)(w,x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_proof_end( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            return LIBSAT_SYM(solver_proof_end)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## solver_proof_prepare( \
+        LIBSAT_SYM(libsat_solver)* x, const LIBSAT_SYM(libsat_cnf)* y, \
+        const LIBSAT_SYM(libsat_xor_matrix)* z) { \
+            return LIBSAT_SYM(solver_proof_prepare)(x,y,z); } \
+    static inline void \
+    sym ## solver_proof_flush( \
+        LIBSAT_SYM(solver_proof)* x) { \
+            LIBSAT_SYM(solver_proof_flush)(x); } \
+    static inline void \
+    sym ## solver_proof_put( \
+        LIBSAT_SYM(solver_proof)* x, uint64_t y) { \
+            LIBSAT_SYM(solver_proof_put)(x,y); } \
+    static inline void \
+    sym ## solver_proof_units( \
+        LIBSAT_SYM(libsat_solver)* x) { \
+            LIBSAT_SYM(solver_proof_units)(x); } \
+    static inline void \
+    sym ## solver_proof_chain( \
+        LIBSAT_SYM(libsat_solver)* u, \
+        const LIBSAT_SYM(libsat_literal)* v, size_t w, \
+        const LIBSAT_SYM(libsat_literal)* x, size_t y, uint64_t z) { \
+            LIBSAT_SYM(solver_proof_chain)(u,v,w,x,y,z); } \
+    static inline uint64_t \
+    sym ## solver_proof_add( \
+        LIBSAT_SYM(libsat_solver)* x, \
+        const LIBSAT_SYM(libsat_literal)* y, size_t z) { \
+            return LIBSAT_SYM(solver_proof_add)(x,y,z); } \
+    static inline void \
+    sym ## solver_proof_delete( \
+        LIBSAT_SYM(libsat_solver)* w, \
+        const LIBSAT_SYM(libsat_literal)* x, size_t y, uint64_t z) { \
+            LIBSAT_SYM(solver_proof_delete)(w,x,y,z); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_solver_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_solver_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_solver_internal \
+    __INTERNAL_LIBSAT_IMPORT_solver_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,64 @@
+/**
+ * \file solver/solver_limits_set.c
+ *
+ * \brief Set the limits of a \ref libsat_solver for a call.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <time.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Set the limits of a solver from the options of a call, starting from
+ * its current statistics.
+ *
+ * Conflict and propagation limits become absolute counts, and the time limit
+ * becomes a deadline on the monotonic clock.
+ *
+ * \param solver        The solver for this operation.
+ * \param options       The options holding the limits, or NULL to clear them.
+ */
+void
+LIBSAT_SYM(solver_limits_set)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_solve_options)* options)
+{
+    struct timespec now;
+
+    solver->conflict_limit = UINT64_MAX;
+    solver->propagation_limit = UINT64_MAX;
+    solver->deadline = 0;
+    solver->memory_limit = 0;
+
+    if (NULL == options)
+    {
+        return;
+    }
+
+    if (0 != options->conflict_limit)
+    {
+        solver->conflict_limit = solver->conflicts + options->conflict_limit;
+    }
+
+    if (0 != options->propagation_limit)
+    {
+        solver->propagation_limit =
+            solver->propagations + options->propagation_limit;
+    }
+
+    if (0 != options->time_limit_ms)
+    {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        solver->deadline =
+            (uint64_t)now.tv_sec * 1000000000
+          + (uint64_t)now.tv_nsec
+          + options->time_limit_ms * 1000000;
+    }
+
+    solver->memory_limit = options->memory_limit;
+}
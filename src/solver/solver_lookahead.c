@@ -0,0 +1,216 @@
+/**
+ * \file solver/solver_lookahead.c
+ *
+ * \brief Pick a branching variable for a \ref libsat_solver by lookahead.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static size_t select_candidates(libsat_solver* solver);
+static status probe(
+    size_t* count, bool* failed, bool* reset, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit);
+
+/**
+ * \brief Pick the variable whose two phases propagate the most.
+ *
+ * Each of the most active unassigned variables is tried in both phases, and
+ * scored by the product of the number of literals that each phase assigns, so
+ * that a split reduces both halves. A phase that conflicts is a failed
+ * literal, which forces the other phase.
+ *
+ * The solver is returned to its current decision level, unless propagation
+ * learns a fact, in which case it is left at level zero and the outcome is
+ * SOLVER_LOOKAHEAD_RESET.
+ *
+ * \param branch        Pointer to receive the literal to split on, or the
+ *                      forced literal.
+ * \param outcome       Pointer to receive the SOLVER_LOOKAHEAD_* outcome.
+ * \param solver        The solver for this operation. Propagation must be
+ *                      complete and without conflict.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_lookahead)(
+    LIBSAT_SYM(libsat_literal)* branch, int* outcome,
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    size_t candidates = select_candidates(solver);
+    uint64_t best_score = 0;
+    bool found = false;
+
+    if (0 == candidates)
+    {
+        *outcome = SOLVER_LOOKAHEAD_ASSIGNED;
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < candidates; ++i)
+    {
+        libsat_literal pos = solver->learned[i];
+        libsat_literal neg = LIBSAT_LITERAL_NEGATE(pos);
+        size_t pos_count, neg_count;
+        bool pos_failed, neg_failed, reset;
+        uint64_t score;
+
+        retval =
+            probe(
+                &pos_count, &pos_failed, &reset, solver, cnf, matrix, pos);
+        if (STATUS_SUCCESS != retval || reset)
+        {
+            *outcome = SOLVER_LOOKAHEAD_RESET;
+            return retval;
+        }
+
+        retval =
+            probe(
+                &neg_count, &neg_failed, &reset, solver, cnf, matrix, neg);
+        if (STATUS_SUCCESS != retval || reset)
+        {
+            *outcome = SOLVER_LOOKAHEAD_RESET;
+            return retval;
+        }
+
+        /* a failed literal decides its variable. */
+        if (pos_failed && neg_failed)
+        {
+            *outcome = SOLVER_LOOKAHEAD_CONFLICT;
+            return STATUS_SUCCESS;
+        }
+        else if (pos_failed || neg_failed)
+        {
+            *branch = pos_failed ? neg : pos;
+            *outcome = SOLVER_LOOKAHEAD_FORCED;
+            return STATUS_SUCCESS;
+        }
+
+        score =
+            (uint64_t)pos_count * neg_count + pos_count + neg_count;
+        if (!found || score > best_score)
+        {
+            /* explore the phase that propagates more first. */
+            *branch = (pos_count >= neg_count) ? pos : neg;
+            best_score = score;
+            found = true;
+        }
+    }
+
+    *outcome = SOLVER_LOOKAHEAD_SPLIT;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Collect the most active unassigned variables, most active first, as
+ * positive literals in the learned scratch buffer.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns the number of candidates.
+ */
+static size_t select_candidates(libsat_solver* solver)
+{
+    size_t count = 0;
+
+    for (size_t var_id = 0; var_id < solver->var_count; ++var_id)
+    {
+        double activity = solver->activity[var_id];
+        size_t pos;
+
+        if (LIBSAT_VALUE_UNASSIGNED != solver->values[var_id])
+        {
+            continue;
+        }
+
+        /* find where this variable belongs in the sorted candidates. */
+        pos = count;
+        while (
+            pos > 0
+         && solver->activity[
+                LIBSAT_LITERAL_VARIABLE(solver->learned[pos - 1])] < activity)
+        {
+            pos -= 1;
+        }
+
+        if (pos >= SOLVER_LOOKAHEAD_CANDIDATES)
+        {
+            continue;
+        }
+
+        if (count < SOLVER_LOOKAHEAD_CANDIDATES)
+        {
+            count += 1;
+        }
+
+        for (size_t i = count - 1; i > pos; --i)
+        {
+            solver->learned[i] = solver->learned[i - 1];
+        }
+
+        solver->learned[pos] = LIBSAT_LITERAL_MAKE(var_id, false);
+    }
+
+    return count;
+}
+
+/**
+ * \brief Assume a literal on a new level, propagate it, and undo it.
+ *
+ * \param count         Pointer to receive the number of literals assigned.
+ * \param failed        Pointer to receive whether propagation conflicted.
+ * \param reset         Pointer to receive whether propagation learned a fact
+ *                      and returned to level zero.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param lit           The literal to probe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status probe(
+    size_t* count, bool* failed, bool* reset, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit)
+{
+    status retval;
+    size_t level = solver->level;
+    size_t start = solver->trail_count;
+    size_t conflict;
+
+    solver_new_level(solver);
+    solver_enqueue(solver, lit, SOLVER_NO_REASON);
+
+    retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        solver_backtrack(solver, level);
+        return retval;
+    }
+
+    *reset = solver->level != level + 1 || solver->inconsistent;
+    *failed = SOLVER_NO_CONFLICT != conflict;
+    *count = solver->trail_count - start;
+
+    if (!*reset)
+    {
+        solver_backtrack(solver, level);
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file solver/solver_memory.c
+ *
+ * \brief Measure the memory held by a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Get the number of bytes held by a solver.
+ *
+ * This counts the clause arena, the clause table, the watch lists, the
+ * per-variable arrays, and the proof buffer, which together make up nearly all
+ * of the memory of a solver. The watch lists are walked, so this is not meant
+ * to be called at every conflict.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns the number of bytes held by the solver.
+ */
+size_t
+LIBSAT_SYM(solver_memory)(
+    const LIBSAT_SYM(libsat_solver)* solver)
+{
+    size_t bytes = 0;
+
+    bytes += solver->arena_capacity * sizeof(*solver->arena);
+    bytes += solver->clause_capacity * sizeof(*solver->clauses);
+
+    /* each variable has two watch lists, one per literal. */
+    for (size_t i = 0; i < 2 * solver->var_capacity; ++i)
+    {
+        bytes +=
+            sizeof(*solver->watches)
+          + solver->watches[i].capacity * sizeof(*solver->watches[i].items);
+    }
+
+    bytes +=
+        solver->var_capacity
+      * (sizeof(*solver->values) + sizeof(*solver->levels)
+       + sizeof(*solver->reasons) + sizeof(*solver->activity)
+       + sizeof(*solver->phases) + sizeof(*solver->seen)
+       + sizeof(*solver->heap) + sizeof(*solver->heap_index)
+       + sizeof(*solver->target) + sizeof(*solver->vmtf_prev)
+       + sizeof(*solver->vmtf_next) + sizeof(*solver->vmtf_stamp)
+       + sizeof(*solver->vmtf_bumped)
+       + sizeof(*solver->trail) + sizeof(*solver->learned)
+       + sizeof(*solver->scratch) + sizeof(*solver->implied)
+       + sizeof(*solver->unit_ids));
+
+    if (NULL != solver->proof)
+    {
+        bytes += SOLVER_PROOF_BUFFER_SIZE;
+    }
+
+    return bytes;
+}
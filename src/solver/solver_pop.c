@@ -0,0 +1,186 @@
+/**
+ * \file solver/solver_pop.c
+ *
+ * \brief Forget the variables and clauses of a retracted scope.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static bool clause_mentions(
+    const libsat_solver* solver, size_t clause, size_t var_count);
+
+/**
+ * \brief Forget every variable from the given id on, and every clause that
+ * mentions one of them.
+ *
+ * Every clause asserted in a scope carries the negation of the scope's
+ * activation literal, and so does every clause learned from one. Since the
+ * activation variable is the first variable of its scope, dropping the
+ * clauses that mention a forgotten variable drops exactly the clauses that
+ * depend on the scope. A proof logs the deletion of every clause that is
+ * dropped.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables to keep.
+ * \param clause_count  The number of database clauses to keep imported.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_pop)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count, size_t clause_count)
+{
+    status retval;
+    size_t kept = 0, arena_count = 0, trail_count = 0, qhead = 0;
+
+    /* level zero facts are about to lose their reasons. */
+    solver_proof_units(solver);
+
+    if (var_count >= solver->var_count)
+    {
+        goto forget_clauses;
+    }
+
+    /* drop level zero facts about forgotten variables. */
+    for (size_t i = 0; i < solver->trail_count; ++i)
+    {
+        if (LIBSAT_LITERAL_VARIABLE(solver->trail[i]) < var_count)
+        {
+            solver->trail[trail_count++] = solver->trail[i];
+            if (i < solver->qhead)
+            {
+                qhead = trail_count;
+            }
+        }
+    }
+
+    solver->trail_count = trail_count;
+    solver->qhead = qhead;
+
+    /* reset the forgotten variables. */
+    for (size_t i = var_count; i < solver->var_count; ++i)
+    {
+        solver->values[i] = LIBSAT_VALUE_UNASSIGNED;
+        solver->levels[i] = 0;
+        solver->activity[i] = 0.0;
+        solver->phases[i] = LIBSAT_VALUE_UNASSIGNED;
+        solver->target[i] = LIBSAT_VALUE_UNASSIGNED;
+        solver->seen[i] = 0;
+        solver->unit_ids[i] = 0;
+    }
+
+    /* rebuild the decision heap over the variables that remain. */
+    solver->heap_count = 0;
+    memset(
+        solver->heap_index, 0xff,
+        solver->var_capacity * sizeof(*solver->heap_index));
+    for (size_t i = 0; i < var_count; ++i)
+    {
+        solver_heap_insert(solver, i);
+    }
+
+    solver_vmtf_truncate(solver, var_count);
+
+    solver->var_count = var_count;
+
+forget_clauses:
+    /* compact the clauses that survive, and watch them again. */
+    for (size_t i = 0; i < 2 * solver->var_capacity; ++i)
+    {
+        solver->watches[i].count = 0;
+    }
+
+    for (size_t i = 0; i < solver->clause_count; ++i)
+    {
+        solver_clause entry = solver->clauses[i];
+        libsat_literal* lits;
+
+        if (entry.deleted || clause_mentions(solver, i, var_count))
+        {
+            if (0 != entry.id)
+            {
+                solver_proof_delete(
+                    solver, solver->arena + entry.start, entry.size,
+                    entry.id);
+            }
+
+            continue;
+        }
+
+        memmove(
+            solver->arena + arena_count, solver->arena + entry.start,
+            entry.size * sizeof(*solver->arena));
+        entry.start = arena_count;
+        arena_count += entry.size;
+        solver->clauses[kept] = entry;
+
+        lits = solver_clause_lits(solver, kept);
+        retval = solver_watch_add(solver, lits[0], kept, lits[1]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval = solver_watch_add(solver, lits[1], kept, lits[0]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        kept += 1;
+    }
+
+    solver->clause_count = kept;
+    solver->arena_count = arena_count;
+
+    if (NULL != solver->proof)
+    {
+        solver->proof->unit_next = solver->trail_count;
+    }
+
+    /* clause indices have moved; level zero never needs its reasons. */
+    for (size_t i = 0; i < solver->trail_count; ++i)
+    {
+        solver->reasons[LIBSAT_LITERAL_VARIABLE(solver->trail[i])] =
+            SOLVER_NO_REASON;
+    }
+
+    /* the retracted database clauses will not be imported again. */
+    if (solver->imported_clauses > clause_count)
+    {
+        solver->imported_clauses = clause_count;
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Return true if a clause mentions a variable at or past the given id.
+ */
+static bool clause_mentions(
+    const libsat_solver* solver, size_t clause, size_t var_count)
+{
+    const libsat_literal* lits = solver_clause_lits(solver, clause);
+
+    for (size_t i = 0; i < solver->clauses[clause].size; ++i)
+    {
+        if (LIBSAT_LITERAL_VARIABLE(lits[i]) >= var_count)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
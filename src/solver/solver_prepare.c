@@ -0,0 +1,119 @@
+/**
+ * \file solver/solver_prepare.c
+ *
+ * \brief Prepare a \ref libsat_solver for a call.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Verify the assumptions of a call, and make room for its variables
+ * and assumptions.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_prepare)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count)
+{
+    status retval;
+    size_t levels;
+
+    /* verify the assumptions. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (LIBSAT_LITERAL_VARIABLE(assumptions[i]) >= var_count)
+        {
+            return ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION;
+        }
+    }
+
+    retval = solver_reserve(solver, var_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* every variable and every assumption may open a level. */
+    levels = solver->var_capacity + count + 1;
+    if (levels > solver->level_capacity)
+    {
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->trail_lim,
+                levels * sizeof(*solver->trail_lim));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->level_stamp,
+                levels * sizeof(*solver->level_stamp));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memset(solver->level_stamp, 0, levels * sizeof(*solver->level_stamp));
+        solver->stamp = 0;
+        solver->level_capacity = levels;
+    }
+
+    /* copy the assumptions; the core is a subset of them. */
+    if (count > solver->assumption_capacity)
+    {
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->assumptions,
+                count * sizeof(*solver->assumptions));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->core,
+                count * sizeof(*solver->core));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        solver->assumption_capacity = count;
+    }
+
+    if (count > 0)
+    {
+        memcpy(
+            solver->assumptions, assumptions,
+            count * sizeof(*solver->assumptions));
+    }
+
+    solver->assumption_count = count;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,374 @@
+/**
+ * \file solver/solver_probe.c
+ *
+ * \brief Failed literal probing for a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status probe_variable(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    size_t var_id);
+static status assume(
+    bool* failed, bool* reset, uint64_t* id, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit);
+static status lift(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    libsat_literal pos, size_t common);
+static status fix(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    libsat_literal lit, uint64_t id);
+static void chain_reason(libsat_solver* solver, const libsat_literal* pair);
+
+/**
+ * \brief Look for failed literals, and for literals implied by both phases of
+ * a variable, and fix them at level zero.
+ *
+ * Variables are probed round robin, picking up where the last round stopped,
+ * until every variable is tried or the budget is spent. A phase whose
+ * propagation conflicts is a failed literal, so the other phase is a fact.
+ * A literal that both phases imply is a fact as well. While a proof is written,
+ * each fact is logged as a lemma before it is fixed.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of propagations to spend.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_probe)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, uint64_t budget)
+{
+    status retval;
+    uint64_t start = solver->propagations;
+
+    for (
+        size_t tried = 0;
+        tried < solver->var_count && !solver->inconsistent
+     && solver->propagations - start < budget;
+        ++tried)
+    {
+        size_t var_id = solver->probe_next % solver->var_count;
+
+        solver->probe_next = var_id + 1;
+        if (LIBSAT_VALUE_UNASSIGNED != solver->values[var_id])
+        {
+            continue;
+        }
+
+        retval = probe_variable(solver, cnf, matrix, var_id);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Probe both phases of a variable.
+ *
+ * The literals implied by the positive phase are kept in the learned scratch
+ * buffer, which propagation leaves alone. Those that are still true under the
+ * negative phase are implied by both.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param var_id        The variable to probe.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status probe_variable(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    size_t var_id)
+{
+    status retval;
+    libsat_literal pos = LIBSAT_LITERAL_MAKE(var_id, false);
+    size_t start = solver->trail_count;
+    size_t common = 0;
+    uint64_t id;
+    bool failed, reset;
+
+    /* the positive phase. */
+    retval = assume(&failed, &reset, &id, solver, cnf, matrix, pos);
+    if (STATUS_SUCCESS != retval || reset)
+    {
+        return retval;
+    }
+
+    if (failed)
+    {
+        solver_backtrack(solver, 0);
+        return fix(solver, cnf, matrix, LIBSAT_LITERAL_NEGATE(pos), id);
+    }
+
+    solver->learned_count = 0;
+    for (size_t i = start + 1; i < solver->trail_count; ++i)
+    {
+        solver->learned[solver->learned_count++] = solver->trail[i];
+    }
+
+    solver_backtrack(solver, 0);
+
+    /* the negative phase. */
+    retval =
+        assume(
+            &failed, &reset, &id, solver, cnf, matrix,
+            LIBSAT_LITERAL_NEGATE(pos));
+    if (STATUS_SUCCESS != retval || reset)
+    {
+        return retval;
+    }
+
+    if (failed)
+    {
+        solver_backtrack(solver, 0);
+        return fix(solver, cnf, matrix, pos, id);
+    }
+
+    /* keep what both phases imply. */
+    for (size_t i = 0; i < solver->learned_count; ++i)
+    {
+        if (LIBSAT_VALUE_TRUE == solver_lit_value(solver, solver->learned[i]))
+        {
+            solver->learned[common++] = solver->learned[i];
+        }
+    }
+
+    if (NULL != solver->proof)
+    {
+        return lift(solver, cnf, matrix, pos, common);
+    }
+
+    solver_backtrack(solver, 0);
+
+    for (size_t i = 0; i < common && !solver->inconsistent; ++i)
+    {
+        retval = fix(solver, cnf, matrix, solver->learned[i], 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Log and fix the literals that both phases of a variable imply.
+ *
+ * For each such literal x, the clause (pos | x) is logged while the negative
+ * phase is still on the trail. The positive phase is then assumed again, to
+ * log (-pos | x), and x follows from the two, which are deleted once it is
+ * logged. DRAT needs no hints, so the positive phase is only assumed again for
+ * LRAT.
+ *
+ * \param solver        The solver for this operation, with the negative phase
+ *                      assumed.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param pos           The positive phase of the variable.
+ * \param common        The number of literals that both phases imply, at the
+ *                      start of the learned scratch buffer.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status lift(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    libsat_literal pos, size_t common)
+{
+    status retval;
+    solver_proof* proof = solver->proof;
+    bool lrat = LIBSAT_PROOF_FORMAT_LRAT == proof->format;
+    libsat_literal pair[2];
+    uint64_t id, other;
+    bool failed, reset;
+
+    /* (pos | x) follows from the negative phase. */
+    pair[0] = pos;
+    for (size_t i = 0; i < common; ++i)
+    {
+        pair[1] = solver->learned[i];
+        chain_reason(solver, pair);
+        proof->ids[i] = solver_proof_add(solver, pair, 2);
+    }
+
+    solver_backtrack(solver, 0);
+
+    if (lrat)
+    {
+        retval = assume(&failed, &reset, &id, solver, cnf, matrix, pos);
+        if (STATUS_SUCCESS != retval || reset || failed)
+        {
+            solver_backtrack(solver, 0);
+            return retval;
+        }
+    }
+
+    /* (-pos | x) follows from the positive phase, and x from both. */
+    for (size_t i = 0; i < common; ++i)
+    {
+        pair[0] = LIBSAT_LITERAL_NEGATE(pos);
+        pair[1] = solver->learned[i];
+        if (lrat)
+        {
+            chain_reason(solver, pair);
+        }
+
+        id = solver_proof_add(solver, pair, 2);
+        other = proof->ids[i];
+
+        proof->hints[0] = id;
+        proof->hints[1] = other;
+        proof->hint_count = 2;
+        proof->ids[i] = solver_proof_add(solver, &solver->learned[i], 1);
+
+        solver_proof_delete(solver, pair, 2, id);
+        pair[0] = pos;
+        solver_proof_delete(solver, pair, 2, other);
+    }
+
+    solver_backtrack(solver, 0);
+
+    for (size_t i = 0; i < common && !solver->inconsistent; ++i)
+    {
+        retval = fix(solver, cnf, matrix, solver->learned[i], proof->ids[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Assume a literal on a new level, and propagate it.
+ *
+ * \param failed        Pointer to receive whether propagation conflicted.
+ * \param reset         Pointer to receive whether propagation learned a fact
+ *                      and returned to level zero.
+ * \param id            Pointer to receive the number in the proof of the
+ *                      negation of a failed literal, or zero.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param lit           The literal to assume.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status assume(
+    bool* failed, bool* reset, uint64_t* id, libsat_solver* solver,
+    const libsat_cnf* cnf, libsat_xor_matrix* matrix, libsat_literal lit)
+{
+    status retval;
+    size_t conflict;
+
+    solver_new_level(solver);
+    solver_enqueue(solver, lit, SOLVER_NO_REASON);
+
+    retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        solver_backtrack(solver, 0);
+        return retval;
+    }
+
+    *reset = 1 != solver->level || solver->inconsistent;
+    *failed = SOLVER_NO_CONFLICT != conflict;
+    *id = 0;
+
+    /* the negation of a failed literal follows from the conflict. */
+    if (NULL != solver->proof && *failed && !*reset)
+    {
+        libsat_literal negated = LIBSAT_LITERAL_NEGATE(lit);
+
+        solver_proof_chain(
+            solver, &negated, 1, solver_clause_lits(solver, conflict),
+            solver->clauses[conflict].size, solver->clauses[conflict].id);
+        *id = solver_proof_add(solver, &negated, 1);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Make a literal a fact at level zero, and propagate it.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param lit           The literal to fix.
+ * \param id            The number of the literal as a lemma in the proof, or
+ *                      zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status fix(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    libsat_literal lit, uint64_t id)
+{
+    size_t conflict;
+
+    switch (solver_lit_value(solver, lit))
+    {
+        case LIBSAT_VALUE_TRUE:
+            return STATUS_SUCCESS;
+
+        case LIBSAT_VALUE_FALSE:
+            if (NULL != solver->proof)
+            {
+                solver_proof_chain(solver, NULL, 0, &lit, 1, id);
+                solver_proof_add(solver, NULL, 0);
+            }
+
+            solver->inconsistent = true;
+            return STATUS_SUCCESS;
+
+        default:
+            solver_enqueue(solver, lit, SOLVER_NO_REASON);
+            solver->unit_ids[LIBSAT_LITERAL_VARIABLE(lit)] = id;
+            return solver_propagate_all(&conflict, solver, cnf, matrix);
+    }
+}
+
+/**
+ * \brief Gather the hints of a binary clause from the reason of its second
+ * literal, which is true on the trail.
+ *
+ * \param solver        The solver for this operation.
+ * \param pair          The literals of the clause.
+ */
+static void chain_reason(libsat_solver* solver, const libsat_literal* pair)
+{
+    size_t reason = solver->reasons[LIBSAT_LITERAL_VARIABLE(pair[1])];
+
+    solver_proof_chain(
+        solver, pair, 2, solver_clause_lits(solver, reason),
+        solver->clauses[reason].size, solver->clauses[reason].id);
+}
@@ -0,0 +1,73 @@
+/**
+ * \file solver/solver_proof_add.c
+ *
+ * \brief Log a lemma in a proof.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Log a lemma with the hints gathered for it.
+ *
+ * A binary DRAT lemma is an 'a', its literals, and a zero. Literals are
+ * written as twice their one-based variable, plus one if negated, which is
+ * the solver literal plus two. A binary LRAT lemma also starts with its
+ * number, and ends with its hints and a zero; numbers are written doubled, as
+ * a positive literal would be. The hints are used up.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of the lemma.
+ * \param count         The number of literals.
+ *
+ * \returns the number of the lemma in the proof, or zero if no proof is being
+ * written.
+ */
+uint64_t
+LIBSAT_SYM(solver_proof_add)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count)
+{
+    solver_proof* proof = solver->proof;
+    uint64_t id;
+
+    if (NULL == proof)
+    {
+        return 0;
+    }
+
+    id = proof->next_id++;
+
+    solver_proof_put(proof, 'a');
+    if (LIBSAT_PROOF_FORMAT_LRAT == proof->format)
+    {
+        solver_proof_put(proof, 2 * id);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        solver_proof_put(proof, (uint64_t)lits[i] + 2);
+    }
+
+    solver_proof_put(proof, 0);
+
+    if (LIBSAT_PROOF_FORMAT_LRAT == proof->format)
+    {
+        for (size_t i = 0; i < proof->hint_count; ++i)
+        {
+            solver_proof_put(proof, 2 * proof->hints[i]);
+        }
+
+        solver_proof_put(proof, 0);
+    }
+
+    proof->hint_count = 0;
+
+    return id;
+}
@@ -0,0 +1,81 @@
+/**
+ * \file solver/solver_proof_begin.c
+ *
+ * \brief Begin writing a proof from a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief Begin writing a proof.
+ *
+ * The clauses of the database keep the numbers from one to clause_count, so
+ * the first learned clause is numbered clause_count + 1.
+ *
+ * \param solver        The solver for this operation.
+ * \param fd            The file descriptor to write to.
+ * \param format        The \ref libsat_proof_format to write.
+ * \param clause_count  The number of clauses in the database.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_begin)(
+    LIBSAT_SYM(libsat_solver)* solver, int fd, int format,
+    size_t clause_count)
+{
+    status retval, release_retval;
+    solver_proof* tmp;
+
+    /* allocate memory for the proof. */
+    retval = allocator_allocate(solver->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* allocate the buffer. */
+    retval =
+        allocator_allocate(
+            solver->alloc, (void**)&tmp->buffer, SOLVER_PROOF_BUFFER_SIZE);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* initialize the proof. */
+    tmp->fd = fd;
+    tmp->format = format;
+    tmp->clause_count = clause_count;
+    tmp->next_id = (uint64_t)clause_count + 1;
+    tmp->error = STATUS_SUCCESS;
+
+    /* success. */
+    solver->proof = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    release_retval = allocator_reclaim(solver->alloc, tmp);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -0,0 +1,155 @@
+/**
+ * \file solver/solver_proof_chain.c
+ *
+ * \brief Gather the LRAT hints of a lemma from the trail.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static void visit(
+    libsat_solver* solver, size_t* mark_count, size_t* pending,
+    libsat_literal lit);
+
+/**
+ * \brief Gather the LRAT hints of a lemma that is false under the current
+ * assignment.
+ *
+ * The given clause must be false once the lemma is, apart from literals of the
+ * lemma's own variables. Its literals are followed back along the trail to the
+ * lemma, and the reasons met on the way become the hints.
+ *
+ * Once the lemma is assumed false, the unit clauses of the level zero facts
+ * that are used hold first. The reasons then propagate in trail order, and the
+ * given clause comes last, as the conflict. Unit hints fill the hint array
+ * from the front, while reasons are found from the end of the trail backwards
+ * and so fill it from the back; the two are joined at the end. DRAT needs no
+ * hints, so nothing is gathered for it.
+ *
+ * \param solver        The solver for this operation.
+ * \param lemma         The literals of the lemma.
+ * \param count         The number of literals in the lemma.
+ * \param lits          The literals of the clause.
+ * \param size          The number of literals in the clause.
+ * \param id            The number of the clause in the proof.
+ */
+void
+LIBSAT_SYM(solver_proof_chain)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lemma, size_t count,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t size, uint64_t id)
+{
+    solver_proof* proof = solver->proof;
+    size_t mark_count = 0, pending = 0;
+    size_t chain_top;
+
+    if (NULL == proof || LIBSAT_PROOF_FORMAT_LRAT != proof->format)
+    {
+        return;
+    }
+
+    /* every fact that a hint may use needs its number first. */
+    solver_proof_units(solver);
+
+    proof->hint_count = 0;
+    chain_top = proof->hint_capacity;
+
+    /* the lemma's own variables are never followed. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lemma[i]);
+
+        if (0 == solver->seen[var_id])
+        {
+            solver->seen[var_id] = 2;
+            proof->marks[mark_count++] = var_id;
+        }
+    }
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        visit(solver, &mark_count, &pending, lits[i]);
+    }
+
+    /* resolve the marked literals with their reasons, latest first. */
+    for (size_t i = solver->trail_count; i > 0 && pending > 0; --i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(solver->trail[i - 1]);
+        size_t reason = solver->reasons[var_id];
+        const libsat_literal* reason_lits;
+
+        if (1 != solver->seen[var_id])
+        {
+            continue;
+        }
+
+        pending -= 1;
+        if (SOLVER_NO_REASON == reason)
+        {
+            continue;
+        }
+
+        proof->hints[--chain_top] = solver->clauses[reason].id;
+        reason_lits = solver_clause_lits(solver, reason);
+        for (size_t k = 1; k < solver->clauses[reason].size; ++k)
+        {
+            visit(solver, &mark_count, &pending, reason_lits[k]);
+        }
+    }
+
+    /* the reasons follow the units, and the clause comes last. */
+    memmove(
+        proof->hints + proof->hint_count, proof->hints + chain_top,
+        (proof->hint_capacity - chain_top) * sizeof(*proof->hints));
+    proof->hint_count += proof->hint_capacity - chain_top;
+    proof->hints[proof->hint_count++] = id;
+
+    for (size_t i = 0; i < mark_count; ++i)
+    {
+        solver->seen[proof->marks[i]] = 0;
+    }
+}
+
+/**
+ * \brief Mark a false literal to be followed back along the trail, or add the
+ * unit clause of a level zero fact to the hints.
+ *
+ * \param solver        The solver for this operation.
+ * \param mark_count    The number of marked variables, which is updated.
+ * \param pending       The number of literals left to follow, which is
+ *                      updated.
+ * \param lit           The literal to visit.
+ */
+static void visit(
+    libsat_solver* solver, size_t* mark_count, size_t* pending,
+    libsat_literal lit)
+{
+    solver_proof* proof = solver->proof;
+    size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+    if (0 != solver->seen[var_id])
+    {
+        return;
+    }
+
+    proof->marks[(*mark_count)++] = var_id;
+    if (0 == solver->levels[var_id])
+    {
+        solver->seen[var_id] = 3;
+        proof->hints[proof->hint_count++] = solver->unit_ids[var_id];
+    }
+    else
+    {
+        solver->seen[var_id] = 1;
+        *pending += 1;
+    }
+}
@@ -0,0 +1,56 @@
+/**
+ * \file solver/solver_proof_delete.c
+ *
+ * \brief Log the deletion of a clause in a proof.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Log the deletion of a clause.
+ *
+ * Level zero facts may depend on the clause, so they are numbered first. A
+ * binary DRAT deletion is a 'd', the literals of the clause, and a zero,
+ * while a binary LRAT deletion only names the clause by its number.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of the clause.
+ * \param count         The number of literals.
+ * \param id            The number of the clause in the proof.
+ */
+void
+LIBSAT_SYM(solver_proof_delete)(
+    LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_literal)* lits, size_t count, uint64_t id)
+{
+    solver_proof* proof = solver->proof;
+
+    if (NULL == proof)
+    {
+        return;
+    }
+
+    solver_proof_units(solver);
+
+    solver_proof_put(proof, 'd');
+    if (LIBSAT_PROOF_FORMAT_LRAT == proof->format)
+    {
+        solver_proof_put(proof, 2 * id);
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            solver_proof_put(proof, (uint64_t)lits[i] + 2);
+        }
+    }
+
+    solver_proof_put(proof, 0);
+}
@@ -0,0 +1,80 @@
+/**
+ * \file solver/solver_proof_end.c
+ *
+ * \brief Finish the proof written by a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Write out the rest of a proof and stop logging.
+ *
+ * The proof is released even if it could not be written.
+ *
+ * \param solver        The solver for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if some part of the proof could not
+ *        be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_end)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    status retval;
+    solver_proof* proof = solver->proof;
+    allocator* alloc = solver->alloc;
+
+    solver_proof_flush(proof);
+    retval = proof->error;
+
+    retval = reclaim_if_set(alloc, proof->buffer, retval);
+    retval = reclaim_if_set(alloc, proof->hints, retval);
+    retval = reclaim_if_set(alloc, proof->marks, retval);
+    retval = reclaim_if_set(alloc, proof->ids, retval);
+    retval = reclaim_if_set(alloc, proof, retval);
+
+    solver->proof = NULL;
+
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,54 @@
+/**
+ * \file solver/solver_proof_flush.c
+ *
+ * \brief Write out the buffered part of a proof.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <errno.h>
+#include <libsat/status.h>
+#include <unistd.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Write out the proof buffer. A failure is kept as the error of the
+ * proof, and the rest of the proof is dropped.
+ *
+ * Short writes are continued, and writes interrupted by a signal are retried.
+ *
+ * \param proof         The proof for this operation.
+ */
+void
+LIBSAT_SYM(solver_proof_flush)(
+    LIBSAT_SYM(solver_proof)* proof)
+{
+    size_t offset = 0;
+
+    while (STATUS_SUCCESS == proof->error && offset < proof->buffer_count)
+    {
+        ssize_t written =
+            write(
+                proof->fd, proof->buffer + offset,
+                proof->buffer_count - offset);
+
+        if (written < 0 && EINTR == errno)
+        {
+            continue;
+        }
+
+        if (written <= 0)
+        {
+            proof->error = ERROR_LIBSAT_SOLVER_PROOF_WRITE;
+            break;
+        }
+
+        offset += (size_t)written;
+    }
+
+    proof->buffer_count = 0;
+}
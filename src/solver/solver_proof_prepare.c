@@ -0,0 +1,100 @@
+/**
+ * \file solver/solver_proof_prepare.c
+ *
+ * \brief Prepare the proof of a \ref libsat_solver for a solve.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Check that a solve can be logged, and size the proof scratch space to
+ * the variables of the solver.
+ *
+ * A proof only checks against the database it began with, so any clause added
+ * since then makes it stale.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to solve.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if the database has changed since
+ *        the proof began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if the database holds native
+ *        constraints or parity statements.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_proof_prepare)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    solver_proof* proof = solver->proof;
+    size_t capacity = solver->var_capacity + 2;
+
+    if (NULL == proof)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    if (libsat_cnf_clause_count(cnf) != proof->clause_count)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_STALE;
+    }
+
+    if (0 != cnf->native_count || 0 != matrix->row_count)
+    {
+        return ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED;
+    }
+
+    /* each variable adds at most one hint, besides the clause it starts at. */
+    if (proof->hint_capacity >= capacity)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        memory_resize(
+            solver->alloc, (void**)&proof->hints,
+            capacity * sizeof(*proof->hints));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        memory_resize(
+            solver->alloc, (void**)&proof->marks,
+            capacity * sizeof(*proof->marks));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        memory_resize(
+            solver->alloc, (void**)&proof->ids,
+            capacity * sizeof(*proof->ids));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* success. */
+    proof->hint_capacity = capacity;
+    return STATUS_SUCCESS;
+}
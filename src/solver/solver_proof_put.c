@@ -0,0 +1,42 @@
+/**
+ * \file solver/solver_proof_put.c
+ *
+ * \brief Append a number to a binary proof.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Append a number to the proof buffer, seven bits at a time, starting
+ * from the least significant.
+ *
+ * The high bit of each byte is set when more bytes follow, so numbers below
+ * 128, such as the markers of the binary formats, take a single byte. The
+ * buffer is written out once it is nearly full.
+ *
+ * \param proof         The proof for this operation.
+ * \param value         The number to append.
+ */
+void
+LIBSAT_SYM(solver_proof_put)(
+    LIBSAT_SYM(solver_proof)* proof, uint64_t value)
+{
+    /* a 64-bit number takes at most ten bytes. */
+    if (proof->buffer_count + 10 > SOLVER_PROOF_BUFFER_SIZE)
+    {
+        solver_proof_flush(proof);
+    }
+
+    while (value >= 0x80)
+    {
+        proof->buffer[proof->buffer_count++] = (uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+
+    proof->buffer[proof->buffer_count++] = (uint8_t)value;
+}
@@ -0,0 +1,66 @@
+/**
+ * \file solver/solver_proof_units.c
+ *
+ * \brief Log the level zero facts of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Log the level zero facts that do not have a number in the proof yet.
+ *
+ * LRAT hints name clauses, so a fact implied at level zero needs a unit clause
+ * of its own before a hint can refer to it. These are logged lazily, in trail
+ * order, so that the facts each one follows from are numbered before it.
+ * Facts that were logged as lemmas already have their number. DRAT checkers
+ * propagate facts on their own, but logging them keeps each fact in place
+ * once the reason that implied it is deleted.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_proof_units)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    solver_proof* proof = solver->proof;
+    size_t end =
+        (0 == solver->level) ? solver->trail_count : solver->trail_lim[0];
+
+    if (NULL == proof)
+    {
+        return;
+    }
+
+    for (; proof->unit_next < end; ++proof->unit_next)
+    {
+        libsat_literal lit = solver->trail[proof->unit_next];
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+        size_t reason = solver->reasons[var_id];
+        const libsat_literal* lits;
+
+        if (0 != solver->unit_ids[var_id] || SOLVER_NO_REASON == reason)
+        {
+            continue;
+        }
+
+        /* the rest of the reason is false at level zero. */
+        proof->hint_count = 0;
+        lits = solver_clause_lits(solver, reason);
+        for (size_t i = 1; i < solver->clauses[reason].size; ++i)
+        {
+            proof->hints[proof->hint_count++] =
+                solver->unit_ids[LIBSAT_LITERAL_VARIABLE(lits[i])];
+        }
+
+        proof->hints[proof->hint_count++] = solver->clauses[reason].id;
+        solver->unit_ids[var_id] = solver_proof_add(solver, &lit, 1);
+    }
+}
@@ -0,0 +1,151 @@
+/**
+ * \file solver/solver_propagate.c
+ *
+ * \brief Unit propagation over the clauses of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Propagate the trail through the clause database.
+ *
+ * Each clause watches two of its literals. When a watched literal becomes
+ * false, the clause looks for a replacement that is not false; if there is
+ * none, the other watched literal is implied, or the clause is in conflict.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver)
+{
+    status retval = STATUS_SUCCESS;
+
+    *conflict = SOLVER_NO_CONFLICT;
+
+    while (solver->qhead < solver->trail_count)
+    {
+        libsat_literal false_lit =
+            LIBSAT_LITERAL_NEGATE(solver->trail[solver->qhead++]);
+        solver_watch_list* list = &solver->watches[false_lit];
+        size_t i = 0, j = 0;
+
+        solver->propagations += 1;
+
+        while (i < list->count)
+        {
+            solver_watch watch = list->items[i];
+            libsat_literal* lits;
+            libsat_literal first;
+            size_t size;
+            bool found = false;
+
+            /* a true blocker means the clause is satisfied. */
+            if (LIBSAT_VALUE_TRUE == solver_lit_value(solver, watch.blocker))
+            {
+                list->items[j++] = list->items[i++];
+                continue;
+            }
+
+            /* watches on deleted clauses are dropped lazily. */
+            if (solver->clauses[watch.clause].deleted)
+            {
+                ++i;
+                continue;
+            }
+
+            /* make sure the false literal is the second watch. */
+            lits = solver_clause_lits(solver, watch.clause);
+            size = solver->clauses[watch.clause].size;
+            if (lits[0] == false_lit)
+            {
+                lits[0] = lits[1];
+                lits[1] = false_lit;
+            }
+
+            ++i;
+
+            /* if the first watch is true, the clause is satisfied. */
+            first = lits[0];
+            if (
+                first != watch.blocker
+             && LIBSAT_VALUE_TRUE == solver_lit_value(solver, first))
+            {
+                list->items[j].clause = watch.clause;
+                list->items[j].blocker = first;
+                ++j;
+                continue;
+            }
+
+            /* look for a new literal to watch. */
+            for (size_t k = 2; k < size; ++k)
+            {
+                if (LIBSAT_VALUE_FALSE != solver_lit_value(solver, lits[k]))
+                {
+                    lits[1] = lits[k];
+                    lits[k] = false_lit;
+
+                    retval =
+                        solver_watch_add(solver, lits[1], watch.clause, first);
+                    if (STATUS_SUCCESS != retval)
+                    {
+                        /* keep the remaining watches before failing. */
+                        lits[k] = lits[1];
+                        lits[1] = false_lit;
+                        --i;
+                        goto compact;
+                    }
+
+                    found = true;
+                    break;
+                }
+            }
+
+            if (found)
+            {
+                continue;
+            }
+
+            /* the clause is unit or conflicting. */
+            list->items[j].clause = watch.clause;
+            list->items[j].blocker = first;
+            ++j;
+
+            if (LIBSAT_VALUE_FALSE == solver_lit_value(solver, first))
+            {
+                *conflict = watch.clause;
+                solver->qhead = solver->trail_count;
+                goto compact;
+            }
+
+            solver_enqueue(solver, first, watch.clause);
+        }
+
+compact:
+        while (i < list->count)
+        {
+            list->items[j++] = list->items[i++];
+        }
+
+        list->count = j;
+
+        if (SOLVER_NO_CONFLICT != *conflict || STATUS_SUCCESS != retval)
+        {
+            break;
+        }
+    }
+
+    return retval;
+}
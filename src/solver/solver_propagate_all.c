@@ -0,0 +1,94 @@
+/**
+ * \file solver/solver_propagate_all.c
+ *
+ * \brief Propagate every kind of constraint in a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Propagate clauses, then the xor matrix, then native constraints,
+ * until none of them assigns anything new.
+ *
+ * An explanation that turns out to be a fact returns the solver to decision
+ * level zero, so callers that track levels must check for this. A conflict at
+ * level zero makes the solver inconsistent, and ends a proof with the empty
+ * clause.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_all)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    bool progress;
+
+    do
+    {
+        progress = false;
+
+        retval = solver_propagate(conflict, solver);
+        if (
+            STATUS_SUCCESS != retval || SOLVER_NO_CONFLICT != *conflict
+         || solver->inconsistent)
+        {
+            goto done;
+        }
+
+        retval = solver_propagate_xor(conflict, &progress, solver, matrix);
+        if (
+            STATUS_SUCCESS != retval || SOLVER_NO_CONFLICT != *conflict
+         || solver->inconsistent)
+        {
+            goto done;
+        }
+
+        if (progress)
+        {
+            continue;
+        }
+
+        retval = solver_propagate_native(conflict, &progress, solver, cnf);
+        if (
+            STATUS_SUCCESS != retval || SOLVER_NO_CONFLICT != *conflict
+         || solver->inconsistent)
+        {
+            goto done;
+        }
+    } while (progress);
+
+done:
+    /* a conflict without decisions is never found again, so remember it. */
+    if (
+        STATUS_SUCCESS == retval && SOLVER_NO_CONFLICT != *conflict
+     && 0 == solver->level)
+    {
+        if (NULL != solver->proof)
+        {
+            solver_proof_chain(
+                solver, NULL, 0, solver_clause_lits(solver, *conflict),
+                solver->clauses[*conflict].size,
+                solver->clauses[*conflict].id);
+            solver_proof_add(solver, NULL, 0);
+        }
+
+        solver->inconsistent = true;
+    }
+
+    return retval;
+}
@@ -0,0 +1,130 @@
+/**
+ * \file solver/solver_propagate_native.c
+ *
+ * \brief Propagate native cardinality and pseudo-Boolean constraints in a
+ * \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Propagate the native constraints of a database under the current
+ * assignment.
+ *
+ * A constraint sum(w[i] * l[i]) <= bound is violated by its true literals
+ * once their weight exceeds the bound, and forces any literal heavier than
+ * the remaining slack to be false. Both are explained by the negations of the
+ * true literals.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param progress      Pointer to a flag that is set if a literal was
+ *                      assigned.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding the native constraints.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_native)(
+    size_t* conflict, bool* progress, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf)
+{
+    status retval;
+    size_t start = 0;
+    size_t level = solver->level;
+
+    *conflict = SOLVER_NO_CONFLICT;
+
+    for (size_t c = 0; c < cnf->native_count; ++c)
+    {
+        size_t end = cnf->native_end[c];
+        uint64_t bound = cnf->native_bound[c];
+        uint64_t used = 0;
+        size_t true_count = 0;
+
+        /* collect the true literals, leaving room for an implied literal. */
+        for (size_t i = start; i < end; ++i)
+        {
+            libsat_literal lit = cnf->native_literals[i];
+
+            size_t var_id = LIBSAT_LITERAL_VARIABLE(lit);
+
+            if (LIBSAT_VALUE_TRUE != solver_lit_value(solver, lit))
+            {
+                continue;
+            }
+
+            /* a repeated literal counts twice, but is explained once. */
+            used += cnf->native_weights[i];
+            if (!solver->seen[var_id])
+            {
+                solver->seen[var_id] = 1;
+                solver->scratch[1 + true_count++] = LIBSAT_LITERAL_NEGATE(lit);
+            }
+        }
+
+        for (size_t k = 0; k < true_count; ++k)
+        {
+            solver->seen[LIBSAT_LITERAL_VARIABLE(solver->scratch[1 + k])] = 0;
+        }
+
+        /* too much weight is a conflict. */
+        if (used > bound)
+        {
+            *progress = true;
+            return
+                solver_reason_add(
+                    conflict, solver, solver->scratch + 1, true_count);
+        }
+
+        /* any unassigned literal heavier than the slack must be false. */
+        for (size_t i = start; i < end; ++i)
+        {
+            libsat_literal lit = cnf->native_literals[i];
+
+            if (
+                cnf->native_weights[i] <= bound - used
+             || LIBSAT_VALUE_UNASSIGNED != solver_lit_value(solver, lit))
+            {
+                continue;
+            }
+
+            solver->implied[0] = LIBSAT_LITERAL_NEGATE(lit);
+            for (size_t k = 0; k < true_count; ++k)
+            {
+                solver->implied[1 + k] = solver->scratch[1 + k];
+            }
+
+            retval =
+                solver_reason_add(
+                    conflict, solver, solver->implied, 1 + true_count);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            *progress = true;
+
+            /* a fact resets the search, which invalidates this pass. */
+            if (solver->level != level || solver->inconsistent)
+            {
+                return STATUS_SUCCESS;
+            }
+        }
+
+        start = end;
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
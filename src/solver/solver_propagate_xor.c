@@ -0,0 +1,99 @@
+/**
+ * \file solver/solver_propagate_xor.c
+ *
+ * \brief Propagate the native xor matrix in a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+
+/**
+ * \brief Propagate the native xor matrix under the current assignment.
+ *
+ * Each implied literal, and any conflict, is explained by the reduced row
+ * that produced it. The explanation is added as a learned clause so that
+ * conflict analysis can treat it like any other reason.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param progress      Pointer to a flag that is set if a literal was
+ *                      assigned.
+ * \param solver        The solver for this operation.
+ * \param matrix        The matrix to propagate.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_propagate_xor)(
+    size_t* conflict, bool* progress, LIBSAT_SYM(libsat_solver)* solver,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    size_t implied_count = 0;
+    size_t count;
+    size_t level = solver->level;
+
+    *conflict = SOLVER_NO_CONFLICT;
+
+    if (0 == libsat_xor_matrix_row_count(matrix))
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        libsat_xor_matrix_propagate(
+            &implied_count, matrix, solver->values, solver->var_count,
+            solver->implied, solver->var_capacity + 1);
+
+    /* explain a conflict with its row. */
+    if (ERROR_LIBSAT_XOR_CONFLICT == retval)
+    {
+        xor_matrix_explain(
+            solver->scratch, &count, matrix, solver->values,
+            solver->var_count, LIBSAT_XOR_NO_COLUMN);
+
+        *progress = true;
+        return solver_reason_add(conflict, solver, solver->scratch, count);
+    }
+    else if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* explain each implied literal with its pivot row. */
+    for (size_t i = 0; i < implied_count; ++i)
+    {
+        xor_matrix_explain(
+            solver->scratch, &count, matrix, solver->values,
+            solver->var_count, solver->implied[i]);
+
+        retval = solver_reason_add(conflict, solver, solver->scratch, count);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        *progress = true;
+
+        /* a fact resets the search, which invalidates the other rows. */
+        if (solver->level != level || solver->inconsistent)
+        {
+            break;
+        }
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,140 @@
+/**
+ * \file solver/solver_reactivate.c
+ *
+ * \brief Add back the eliminated variables that a \ref libsat_context uses
+ * again.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "../cnf/cnf_internal.h"
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status restore_all_of(
+    libsat_cnf* cnf, const libsat_literal* lits, size_t begin, size_t end);
+
+/**
+ * \brief Add back every eliminated variable that a clause, a native
+ * constraint, the native xor matrix, or an assumption uses.
+ *
+ * Only the clauses and native constraints added since the last check are
+ * scanned. Restored clauses are appended to the database, and only mention
+ * variables that are active again, so they need no check of their own.
+ *
+ * \param context       The context for this operation.
+ * \param assumptions   The caller's assumptions.
+ * \param count         The number of caller assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reactivate)(
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count)
+{
+    status retval;
+    libsat_cnf* cnf = context->cnf;
+    const libsat_xor_matrix* matrix = context->xor_matrix;
+    size_t clause_count = cnf->clause_count;
+    size_t native_count = cnf->native_count;
+    size_t begin, end;
+
+    if (0 == cnf->eliminated_count)
+    {
+        goto done;
+    }
+
+    /* new clauses. Restoring appends to the literals, so they are looked up
+     * again each time. */
+    begin = (0 == cnf->checked_clauses)
+        ? 0 : cnf->clause_end[cnf->checked_clauses - 1];
+    end = (0 == clause_count) ? 0 : cnf->clause_end[clause_count - 1];
+    for (size_t i = begin; i < end; ++i)
+    {
+        retval =
+            cnf_restore(cnf, LIBSAT_LITERAL_VARIABLE(cnf->literals[i]));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* new native constraints. */
+    for (size_t i = cnf->checked_natives; i < native_count; ++i)
+    {
+        retval =
+            restore_all_of(
+                cnf, cnf->native_literals,
+                (0 == i) ? 0 : cnf->native_end[i - 1], cnf->native_end[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the xor matrix. */
+    for (size_t i = 0; i < matrix->column_count; ++i)
+    {
+        retval = cnf_restore(cnf, matrix->column_variable[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    /* the assumptions. */
+    retval = restore_all_of(cnf, assumptions, 0, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+done:
+    cnf->checked_clauses = cnf->clause_count;
+    cnf->checked_natives = cnf->native_count;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Restore every eliminated variable in a run of literals.
+ *
+ * \param cnf           The database for this operation.
+ * \param lits          The literals.
+ * \param begin         The first literal to check.
+ * \param end           One past the last literal to check.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status restore_all_of(
+    libsat_cnf* cnf, const libsat_literal* lits, size_t begin, size_t end)
+{
+    status retval;
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        retval = cnf_restore(cnf, LIBSAT_LITERAL_VARIABLE(lits[i]));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/**
+ * \file solver/solver_reason_add.c
+ *
+ * \brief Add an explanation clause to a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static size_t lit_rank(const libsat_solver* solver, libsat_literal lit);
+static void move_best(
+    const libsat_solver* solver, libsat_literal* lits, size_t start,
+    size_t count);
+
+/**
+ * \brief Add a clause that explains an implication or a conflict found outside
+ * of the clause database.
+ *
+ * \param conflict      Pointer to receive the conflicting clause, or
+ *                      SOLVER_NO_CONFLICT.
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause. These are reordered.
+ * \param count         The number of literals.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reason_add)(
+    size_t* conflict, LIBSAT_SYM(libsat_solver)* solver,
+    LIBSAT_SYM(libsat_literal)* lits, size_t count)
+{
+    status retval;
+    size_t clause;
+
+    *conflict = SOLVER_NO_CONFLICT;
+
+    /* an empty explanation means that the constraints are inconsistent. */
+    if (0 == count)
+    {
+        solver->inconsistent = true;
+        return STATUS_SUCCESS;
+    }
+
+    /* the watched literals are the unassigned or latest ones. */
+    move_best(solver, lits, 0, count);
+    if (count > 1)
+    {
+        move_best(solver, lits, 1, count);
+    }
+
+    /* a unit explanation, or one without any decisions, is a fact. */
+    if (1 == count || 0 == solver->levels[LIBSAT_LITERAL_VARIABLE(lits[1])])
+    {
+        solver_backtrack(solver, 0);
+
+        switch (solver_lit_value(solver, lits[0]))
+        {
+            case LIBSAT_VALUE_UNASSIGNED:
+                solver_enqueue(solver, lits[0], SOLVER_NO_REASON);
+                break;
+
+            case LIBSAT_VALUE_FALSE:
+                solver->inconsistent = true;
+                break;
+
+            default:
+                break;
+        }
+
+        return STATUS_SUCCESS;
+    }
+
+    /* keep the explanation as a learned clause. */
+    retval = solver_clause_add(&clause, solver, lits, count, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver->clauses[clause].lbd = (uint32_t)count;
+
+    if (LIBSAT_VALUE_UNASSIGNED == solver_lit_value(solver, lits[0]))
+    {
+        solver_enqueue(solver, lits[0], clause);
+    }
+    else
+    {
+        *conflict = clause;
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Rank a literal for watching: unassigned literals come first, then
+ * false literals by decreasing decision level.
+ */
+static size_t lit_rank(const libsat_solver* solver, libsat_literal lit)
+{
+    if (LIBSAT_VALUE_UNASSIGNED == solver_lit_value(solver, lit))
+    {
+        return (size_t)-1;
+    }
+
+    return solver->levels[LIBSAT_LITERAL_VARIABLE(lit)];
+}
+
+/**
+ * \brief Move the best ranked literal at or after start into start.
+ */
+static void move_best(
+    const libsat_solver* solver, libsat_literal* lits, size_t start,
+    size_t count)
+{
+    size_t best = start;
+    libsat_literal tmp;
+
+    for (size_t i = start + 1; i < count; ++i)
+    {
+        if (lit_rank(solver, lits[i]) > lit_rank(solver, lits[best]))
+        {
+            best = i;
+        }
+    }
+
+    tmp = lits[start];
+    lits[start] = lits[best];
+    lits[best] = tmp;
+}
@@ -0,0 +1,142 @@
+/**
+ * \file solver/solver_reduce.c
+ *
+ * \brief Delete learned clauses from a \ref libsat_solver by LBD tier.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <stdlib.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief A learned clause that may be deleted, with its sort keys.
+ */
+typedef struct reduce_candidate reduce_candidate;
+struct reduce_candidate
+{
+    bool used;
+    uint32_t lbd;
+    size_t size;
+    size_t clause;
+};
+
+/* forward decls. */
+static int candidate_compare(const void* lhs, const void* rhs);
+
+/**
+ * \brief Delete learned clauses by LBD tier, and compact the clause database.
+ *
+ * Learned clauses fall into three tiers. Core clauses, with an LBD of at most
+ * SOLVER_TIER_CORE_LBD, and binary clauses are always kept. Mid tier clauses,
+ * with an LBD of at most SOLVER_TIER_MID_LBD, are kept as long as conflict
+ * analysis uses them between reductions. Every other clause, and every mid
+ * tier clause that went unused, is a candidate, and the worse half of the
+ * candidates is deleted. Candidates that were used since the last reduction
+ * are better than those that were not; after that, lower LBD and then shorter
+ * clauses are better.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reduce)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    status retval, release_retval;
+    reduce_candidate* candidates;
+    size_t count = 0;
+
+    if (0 == solver->clause_count)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        allocator_allocate(
+            solver->alloc, (void**)&candidates,
+            solver->clause_count * sizeof(*candidates));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* collect the candidates, and start a new period of use. */
+    for (size_t i = 0; i < solver->clause_count; ++i)
+    {
+        solver_clause* entry = &solver->clauses[i];
+        bool used = entry->used;
+
+        if (!entry->learned || entry->deleted)
+        {
+            continue;
+        }
+
+        entry->used = false;
+        if (   entry->lbd <= SOLVER_TIER_CORE_LBD
+            || entry->size <= 2
+            || (entry->lbd <= SOLVER_TIER_MID_LBD && used))
+        {
+            continue;
+        }
+
+        candidates[count].used = used;
+        candidates[count].lbd = entry->lbd;
+        candidates[count].size = entry->size;
+        candidates[count].clause = i;
+        count += 1;
+    }
+
+    /* delete the worse half. */
+    qsort(candidates, count, sizeof(*candidates), &candidate_compare);
+    for (size_t i = 0; i < count / 2; ++i)
+    {
+        solver->clauses[candidates[i].clause].deleted = true;
+    }
+
+    release_retval = allocator_reclaim(solver->alloc, candidates);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    /* compact what is left. */
+    return
+        solver_pop(solver, solver->var_count, solver->imported_clauses);
+}
+
+/**
+ * \brief Order candidates from worst to best: unused first, then by
+ * decreasing LBD, then by decreasing size, then from oldest to newest.
+ */
+static int candidate_compare(const void* lhs, const void* rhs)
+{
+    const reduce_candidate* l = (const reduce_candidate*)lhs;
+    const reduce_candidate* r = (const reduce_candidate*)rhs;
+
+    if (l->used != r->used)
+    {
+        return l->used ? 1 : -1;
+    }
+
+    if (l->lbd != r->lbd)
+    {
+        return (l->lbd < r->lbd) - (l->lbd > r->lbd);
+    }
+
+    if (l->size != r->size)
+    {
+        return (l->size < r->size) - (l->size > r->size);
+    }
+
+    return (l->clause > r->clause) - (l->clause < r->clause);
+}
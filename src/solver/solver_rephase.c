@@ -0,0 +1,88 @@
+/**
+ * \file solver/solver_rephase.c
+ *
+ * \brief Reset the saved phases of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static uint64_t next_random(uint64_t* state);
+
+/**
+ * \brief Reset the saved phases if a rephase is due.
+ *
+ * Rephasing cycles through the target assignment, all false, the target
+ * assignment, all true, the target assignment, and random phases, so that
+ * the search keeps coming back to the best assignment it found while still
+ * leaving it now and then. Each interval between rephases grows by
+ * SOLVER_REPHASE_INTERVAL conflicts.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ */
+void
+LIBSAT_SYM(solver_rephase)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    uint64_t state;
+
+    if (!solver->rephase || solver->conflicts < solver->rephase_next)
+    {
+        return;
+    }
+
+    state = 0x9e3779b97f4a7c15ULL ^ solver->conflicts;
+    for (size_t i = 0; i < solver->var_count; ++i)
+    {
+        switch (solver->rephase_count % 6)
+        {
+            case 1:
+                solver->phases[i] = LIBSAT_VALUE_FALSE;
+                break;
+
+            case 3:
+                solver->phases[i] = LIBSAT_VALUE_TRUE;
+                break;
+
+            case 5:
+                solver->phases[i] =
+                    (next_random(&state) >> 32 & 1)
+                        ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE;
+                break;
+
+            default:
+                if (LIBSAT_VALUE_UNASSIGNED != solver->target[i])
+                {
+                    solver->phases[i] = solver->target[i];
+                }
+                break;
+        }
+    }
+
+    solver->rephase_count += 1;
+    solver->rephase_next =
+        solver->conflicts
+      + SOLVER_REPHASE_INTERVAL * (solver->rephase_count + 1);
+    solver->target_count = 0;
+}
+
+/**
+ * \brief Step a xorshift64* generator.
+ */
+static uint64_t next_random(uint64_t* state)
+{
+    uint64_t x = *state;
+
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    *state = x;
+
+    return x * 0x2545f4914f6cdd1dULL;
+}
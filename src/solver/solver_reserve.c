@@ -0,0 +1,278 @@
+/**
+ * \file solver/solver_reserve.c
+ *
+ * \brief Make room for variables in a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status grow(
+    allocator* alloc, void** memory, size_t size, size_t old_count,
+    size_t new_count, int fill);
+static status grow_all(libsat_solver* solver, size_t capacity);
+
+/**
+ * \brief Make room for the given number of variables.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_reserve)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count)
+{
+    status retval;
+
+    /* grow the per-variable arrays if needed. */
+    if (var_count > solver->var_capacity)
+    {
+        size_t capacity =
+            (0 == solver->var_capacity) ? 16 : 2 * solver->var_capacity;
+
+        if (capacity < var_count)
+        {
+            capacity = var_count;
+        }
+
+        retval = grow_all(solver, capacity);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        solver->var_capacity = capacity;
+    }
+
+    /* new variables start out as decision candidates. */
+    for (size_t i = solver->var_count; i < var_count; ++i)
+    {
+        solver->reasons[i] = SOLVER_NO_REASON;
+        solver_heap_insert(solver, i);
+        solver_vmtf_enqueue(solver, i);
+    }
+
+    if (var_count > solver->var_count)
+    {
+        solver->var_count = var_count;
+    }
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Grow every per-variable array to the given capacity.
+ *
+ * \param solver        The solver for this operation.
+ * \param capacity      The new variable capacity.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status grow_all(libsat_solver* solver, size_t capacity)
+{
+    status retval;
+    allocator* alloc = solver->alloc;
+    size_t old = solver->var_capacity;
+
+    retval = grow(alloc, (void**)&solver->values, 1, old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->levels, sizeof(size_t), old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->reasons, sizeof(size_t), old, capacity,
+            0xff);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->activity, sizeof(double), old, capacity,
+            0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = grow(alloc, (void**)&solver->phases, 1, old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = grow(alloc, (void**)&solver->seen, 1, old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(alloc, (void**)&solver->heap, sizeof(size_t), old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->heap_index, sizeof(size_t), old, capacity,
+            0xff);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = grow(alloc, (void**)&solver->target, 1, old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->unit_ids, sizeof(uint64_t), old,
+            capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->vmtf_prev, sizeof(size_t), old, capacity,
+            0xff);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->vmtf_next, sizeof(size_t), old, capacity,
+            0xff);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->vmtf_stamp, sizeof(uint64_t), old,
+            capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->vmtf_bumped, sizeof(solver_vmtf_entry),
+            old, capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->trail, sizeof(libsat_literal), old,
+            capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->watches, sizeof(solver_watch_list),
+            2 * old, 2 * capacity, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->learned, sizeof(libsat_literal), old,
+            capacity + 1, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval =
+        grow(
+            alloc, (void**)&solver->scratch, sizeof(libsat_literal), old,
+            capacity + 1, 0);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    return
+        grow(
+            alloc, (void**)&solver->implied, sizeof(libsat_literal), old,
+            capacity + 1, 0);
+}
+
+/**
+ * \brief Grow an array, filling the new entries with the given byte.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        Pointer to the array to grow.
+ * \param size          The size of each entry.
+ * \param old_count     The number of entries before growing.
+ * \param new_count     The number of entries after growing.
+ * \param fill          The byte to fill new entries with.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status grow(
+    allocator* alloc, void** memory, size_t size, size_t old_count,
+    size_t new_count, int fill)
+{
+    status retval;
+
+    retval = memory_resize(alloc, memory, new_count * size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(
+        ((uint8_t*)*memory) + old_count * size, fill,
+        (new_count - old_count) * size);
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,49 @@
+/**
+ * \file solver/solver_reset.c
+ *
+ * \brief Forget the clauses of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Forget every clause, so that the database is imported again on the
+ * next solve.
+ *
+ * This is used once the database has been rewritten in place. Learned clauses
+ * are forgotten too, since they may mention variables that the database no
+ * longer uses. Level zero facts, activity, and saved phases are kept; the facts
+ * are propagated again over the clauses that are imported.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_reset)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    solver_backtrack(solver, 0);
+
+    for (size_t i = 0; i < 2 * solver->var_capacity; ++i)
+    {
+        solver->watches[i].count = 0;
+    }
+
+    solver->clause_count = 0;
+    solver->arena_count = 0;
+    solver->imported_clauses = 0;
+
+    /* level zero facts outlive the clauses that implied them. */
+    for (size_t i = 0; i < solver->trail_count; ++i)
+    {
+        solver->reasons[LIBSAT_LITERAL_VARIABLE(solver->trail[i])] =
+            SOLVER_NO_REASON;
+    }
+
+    solver->qhead = 0;
+}
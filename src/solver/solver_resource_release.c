@@ -0,0 +1,119 @@
+/**
+ * \file solver/solver_resource_release.c
+ *
+ * \brief Release a \ref libsat_solver resource.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Release a \ref libsat_solver resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_resource_release)(
+    RCPR_SYM(resource)* r)
+{
+    status retval = STATUS_SUCCESS;
+    libsat_solver* solver = (libsat_solver*)r;
+
+    /* cache allocator. */
+    allocator* alloc = solver->alloc;
+
+    /* reclaim watch lists. */
+    if (NULL != solver->watches)
+    {
+        for (size_t i = 0; i < 2 * solver->var_capacity; ++i)
+        {
+            retval = reclaim_if_set(alloc, solver->watches[i].items, retval);
+        }
+    }
+
+    /* reclaim a proof that was never finished, without writing it. */
+    if (NULL != solver->proof)
+    {
+        retval = reclaim_if_set(alloc, solver->proof->buffer, retval);
+        retval = reclaim_if_set(alloc, solver->proof->hints, retval);
+        retval = reclaim_if_set(alloc, solver->proof->marks, retval);
+        retval = reclaim_if_set(alloc, solver->proof->ids, retval);
+        retval = reclaim_if_set(alloc, solver->proof, retval);
+    }
+
+    /* reclaim arrays. */
+    retval = reclaim_if_set(alloc, solver->values, retval);
+    retval = reclaim_if_set(alloc, solver->levels, retval);
+    retval = reclaim_if_set(alloc, solver->reasons, retval);
+    retval = reclaim_if_set(alloc, solver->activity, retval);
+    retval = reclaim_if_set(alloc, solver->phases, retval);
+    retval = reclaim_if_set(alloc, solver->seen, retval);
+    retval = reclaim_if_set(alloc, solver->heap, retval);
+    retval = reclaim_if_set(alloc, solver->heap_index, retval);
+    retval = reclaim_if_set(alloc, solver->target, retval);
+    retval = reclaim_if_set(alloc, solver->unit_ids, retval);
+    retval = reclaim_if_set(alloc, solver->vmtf_prev, retval);
+    retval = reclaim_if_set(alloc, solver->vmtf_next, retval);
+    retval = reclaim_if_set(alloc, solver->vmtf_stamp, retval);
+    retval = reclaim_if_set(alloc, solver->vmtf_bumped, retval);
+    retval = reclaim_if_set(alloc, solver->trail, retval);
+    retval = reclaim_if_set(alloc, solver->trail_lim, retval);
+    retval = reclaim_if_set(alloc, solver->level_stamp, retval);
+    retval = reclaim_if_set(alloc, solver->arena, retval);
+    retval = reclaim_if_set(alloc, solver->clauses, retval);
+    retval = reclaim_if_set(alloc, solver->watches, retval);
+    retval = reclaim_if_set(alloc, solver->learned, retval);
+    retval = reclaim_if_set(alloc, solver->scratch, retval);
+    retval = reclaim_if_set(alloc, solver->implied, retval);
+    retval = reclaim_if_set(alloc, solver->assumptions, retval);
+    retval = reclaim_if_set(alloc, solver->core, retval);
+    retval = reclaim_if_set(alloc, solver->model, retval);
+    retval = reclaim_if_set(alloc, (void*)solver->statement_core, retval);
+    retval = reclaim_if_set(alloc, solver->count_words, retval);
+    retval = reclaim_if_set(alloc, solver->ring_read, retval);
+
+    /* reclaim structure. */
+    retval = reclaim_if_set(alloc, solver, retval);
+
+    /* return decoded status. */
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,44 @@
+/**
+ * \file solver/solver_restart_set.c
+ *
+ * \brief Set the restart policy of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Set the restart policy of a solver, and whether it rephases.
+ *
+ * A new policy starts from a focused phase, and turning rephasing on starts
+ * its schedule over. The moving averages of learned LBD are kept, since they
+ * describe the problem rather than the policy.
+ *
+ * \param solver        The solver for this operation.
+ * \param restart       The \ref libsat_solve_restart policy.
+ * \param rephase       True if saved phases are periodically reset.
+ */
+void
+LIBSAT_SYM(solver_restart_set)(
+    LIBSAT_SYM(libsat_solver)* solver, int restart, bool rephase)
+{
+    if (restart != solver->restart_policy)
+    {
+        solver->restart_policy = restart;
+        solver->stable = false;
+        solver->stable_length = SOLVER_STABLE_INTERVAL;
+        solver->stable_next = solver->conflicts + SOLVER_STABLE_INTERVAL;
+    }
+
+    if (rephase && !solver->rephase)
+    {
+        solver->rephase_count = 0;
+        solver->rephase_next = solver->conflicts + SOLVER_REPHASE_INTERVAL;
+    }
+
+    solver->rephase = rephase;
+}
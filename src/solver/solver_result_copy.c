@@ -0,0 +1,76 @@
+/**
+ * \file solver/solver_result_copy.c
+ *
+ * \brief Copy the result of one \ref libsat_solver to another.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Copy the result, model, and core of one solver to another.
+ *
+ * \param dst           The solver receiving the result.
+ * \param src           The solver holding the result.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_result_copy)(
+    LIBSAT_SYM(libsat_solver)* dst, const LIBSAT_SYM(libsat_solver)* src)
+{
+    status retval;
+
+    dst->last_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    dst->model_count = 0;
+    dst->core_count = 0;
+
+    /* copy the model. */
+    if (src->model_count > 0)
+    {
+        retval =
+            memory_resize(dst->alloc, (void**)&dst->model, src->model_count);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memcpy(dst->model, src->model, src->model_count);
+        dst->model_count = src->model_count;
+    }
+
+    /* copy the core, keeping room for as many as the assumptions. */
+    if (src->core_count > 0)
+    {
+        size_t size = src->core_count;
+
+        if (dst->assumption_capacity > size)
+        {
+            size = dst->assumption_capacity;
+        }
+
+        retval =
+            memory_resize(
+                dst->alloc, (void**)&dst->core, size * sizeof(*dst->core));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        memcpy(dst->core, src->core, src->core_count * sizeof(*dst->core));
+        dst->core_count = src->core_count;
+    }
+
+    dst->last_result = src->last_result;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,58 @@
+/**
+ * \file solver/solver_rings_create.c
+ *
+ * \brief Allocate the sharing rings of a set of parallel workers.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+RCPR_IMPORT_allocator;
+
+/**
+ * \brief Allocate a set of sharing rings, aligned to a cache line.
+ *
+ * The allocator does not promise cache line alignment, so the block is over
+ * allocated and the rings start at the first aligned address in it. Every
+ * ring starts out empty.
+ *
+ * \param memory        Pointer to receive the block to reclaim later.
+ * \param rings         Pointer to receive the aligned rings.
+ * \param alloc         The allocator to use for this operation.
+ * \param count         The number of rings.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_rings_create)(
+    void** memory, LIBSAT_SYM(solver_ring)** rings, RCPR_SYM(allocator)* alloc,
+    size_t count)
+{
+    status retval;
+    void* tmp;
+    solver_ring* aligned;
+    const uintptr_t align = _Alignof(solver_ring);
+
+    retval =
+        allocator_allocate(alloc, &tmp, count * sizeof(*aligned) + align);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    aligned = (solver_ring*)(((uintptr_t)tmp + align - 1) & ~(align - 1));
+    for (size_t i = 0; i < count; ++i)
+    {
+        atomic_init(&aligned[i].head, 0);
+    }
+
+    *memory = tmp;
+    *rings = aligned;
+
+    return STATUS_SUCCESS;
+}
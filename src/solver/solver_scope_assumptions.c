@@ -0,0 +1,84 @@
+/**
+ * \file solver/solver_scope_assumptions.c
+ *
+ * \brief Assume the open scopes of a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Prepend the activation literals of the open scopes of a context to
+ * the given assumptions.
+ *
+ * Without open scopes, the caller's assumptions are used as they are.
+ * Otherwise, they are copied after the activation literals into a buffer
+ * owned by the context.
+ *
+ * \param lits          Pointer to receive the assumptions to solve with.
+ * \param total         Pointer to receive the number of assumptions.
+ * \param context       The context for this operation.
+ * \param assumptions   The caller's assumptions.
+ * \param count         The number of caller assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_scope_assumptions)(
+    const LIBSAT_SYM(libsat_literal)** lits, size_t* total,
+    LIBSAT_SYM(libsat_context)* context,
+    const LIBSAT_SYM(libsat_literal)* assumptions, size_t count)
+{
+    status retval;
+    size_t size = context->scope_count + count;
+
+    if (0 == context->scope_count)
+    {
+        *lits = assumptions;
+        *total = count;
+        return STATUS_SUCCESS;
+    }
+
+    /* grow the assumption buffer if needed. */
+    if (size > context->assumption_capacity)
+    {
+        retval =
+            memory_resize(
+                context->alloc, (void**)&context->assumptions,
+                size * sizeof(*context->assumptions));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        context->assumption_capacity = size;
+    }
+
+    /* assume the open scopes first. */
+    for (size_t i = 0; i < context->scope_count; ++i)
+    {
+        context->assumptions[i] = context->scopes[i].activation;
+    }
+
+    if (count > 0)
+    {
+        memcpy(
+            context->assumptions + context->scope_count, assumptions,
+            count * sizeof(*assumptions));
+    }
+
+    *lits = context->assumptions;
+    *total = size;
+
+    return STATUS_SUCCESS;
+}
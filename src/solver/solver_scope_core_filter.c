@@ -0,0 +1,60 @@
+/**
+ * \file solver/solver_scope_core_filter.c
+ *
+ * \brief Hide the open scopes of a \ref libsat_context from its core.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+
+/* forward decls. */
+static bool is_activation(
+    const libsat_context* context, libsat_literal lit);
+
+/**
+ * \brief Remove the activation literals of the open scopes of a context from
+ * the core of its solver.
+ *
+ * \param context       The context for this operation.
+ */
+void
+LIBSAT_SYM(solver_scope_core_filter)(
+    LIBSAT_SYM(libsat_context)* context)
+{
+    LIBSAT_SYM(libsat_solver)* solver = context->solver;
+    size_t kept = 0;
+
+    for (size_t i = 0; i < solver->core_count; ++i)
+    {
+        if (!is_activation(context, solver->core[i]))
+        {
+            solver->core[kept++] = solver->core[i];
+        }
+    }
+
+    solver->core_count = kept;
+}
+
+/**
+ * \brief Return true if a literal is the activation literal of an open scope.
+ */
+static bool is_activation(
+    const libsat_context* context, libsat_literal lit)
+{
+    for (size_t i = 0; i < context->scope_count; ++i)
+    {
+        if (context->scopes[i].activation == lit)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
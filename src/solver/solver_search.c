@@ -0,0 +1,359 @@
+/**
+ * \file solver/solver_search.c
+ *
+ * \brief Conflict-driven search for a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status learn(libsat_solver* solver, size_t conflict);
+static void save_target(libsat_solver* solver);
+static void average(double* avg, double value, double alpha, uint64_t samples);
+static bool restart_due(
+    const libsat_solver* solver, uint64_t conflicts, uint64_t budget);
+static bool glucose_due(const libsat_solver* solver, uint64_t conflicts);
+static bool decide_negated(const libsat_solver* solver, size_t var_id);
+
+/**
+ * \brief Search for a model until a result is found or the conflict budget is
+ * spent.
+ *
+ * The assumptions are decided first, one per decision level. After that, the
+ * variable picked by the decision heuristic is decided in its saved phase, or
+ * in a stable phase, in its target phase. Glucose and stabilizing restarts may
+ * end the search before the budget is spent. Before each decision, the search
+ * gives up with an unknown result if the solver is halted.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of conflicts allowed.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_search)(
+    int* result, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    uint64_t budget)
+{
+    status retval;
+    uint64_t conflicts = 0;
+    size_t conflict;
+    libsat_literal next;
+    bool found;
+
+    for (;;)
+    {
+        retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (solver->inconsistent)
+        {
+            *result = LIBSAT_SOLVE_RESULT_UNSATISFIABLE;
+            return STATUS_SUCCESS;
+        }
+
+        /* learn from a conflict and keep propagating. */
+        if (SOLVER_NO_CONFLICT != conflict)
+        {
+            solver->conflicts += 1;
+            conflicts += 1;
+
+            if (solver->stable || solver->rephase)
+            {
+                save_target(solver);
+            }
+
+            retval = learn(solver, conflict);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            continue;
+        }
+
+        /* give up once the solver is halted, or restart once the budget is
+         * spent or the policy calls for it. */
+        if (solver_halted(solver) || restart_due(solver, conflicts, budget))
+        {
+            *result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+            return STATUS_SUCCESS;
+        }
+
+        /* decide the next assumption. */
+        next = 0;
+        found = false;
+        while (solver->level < solver->assumption_count)
+        {
+            libsat_literal lit = solver->assumptions[solver->level];
+
+            switch (solver_lit_value(solver, lit))
+            {
+                /* an assumption that already holds gets an empty level. */
+                case LIBSAT_VALUE_TRUE:
+                    solver_new_level(solver);
+                    continue;
+
+                case LIBSAT_VALUE_FALSE:
+                    solver_analyze_final(solver, lit);
+                    *result = LIBSAT_SOLVE_RESULT_UNSATISFIABLE;
+                    return STATUS_SUCCESS;
+
+                default:
+                    next = lit;
+                    found = true;
+                    break;
+            }
+
+            break;
+        }
+
+        /* otherwise, ask the decision heuristic. */
+        if (!found)
+        {
+            size_t var_id = solver_decide(solver);
+
+            if (SOLVER_NO_VARIABLE != var_id)
+            {
+                next =
+                    LIBSAT_LITERAL_MAKE(
+                        var_id, decide_negated(solver, var_id));
+                found = true;
+            }
+        }
+
+        /* every variable is assigned. */
+        if (!found)
+        {
+            *result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+            return STATUS_SUCCESS;
+        }
+
+        solver->decisions += 1;
+        solver_new_level(solver);
+        solver_enqueue(solver, next, SOLVER_NO_REASON);
+    }
+}
+
+/**
+ * \brief Learn a clause from a conflict and assert it.
+ *
+ * Learned clauses with a low LBD are also published to the other workers of a
+ * portfolio. While a proof is written, the clause is logged before the
+ * backjump, while the trail still shows how it follows.
+ *
+ * \param solver        The solver for this operation.
+ * \param conflict      The conflicting clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status learn(libsat_solver* solver, size_t conflict)
+{
+    status retval;
+    const libsat_literal* lits = solver_clause_lits(solver, conflict);
+    size_t max_level = 0;
+    size_t backjump, clause;
+    uint64_t id = 0;
+
+    /* conflicts found outside of the clauses may be below this level. */
+    for (size_t i = 0; i < solver->clauses[conflict].size; ++i)
+    {
+        size_t level = solver->levels[LIBSAT_LITERAL_VARIABLE(lits[i])];
+
+        if (level > max_level)
+        {
+            max_level = level;
+        }
+    }
+
+    if (0 == max_level)
+    {
+        if (NULL != solver->proof)
+        {
+            solver_proof_chain(
+                solver, NULL, 0, lits, solver->clauses[conflict].size,
+                solver->clauses[conflict].id);
+            solver_proof_add(solver, NULL, 0);
+        }
+
+        solver->inconsistent = true;
+        return STATUS_SUCCESS;
+    }
+
+    solver_backtrack(solver, max_level);
+
+    /* learn the first UIP clause and jump back to where it is unit. */
+    solver_analyze(&backjump, solver, conflict);
+    if (NULL != solver->proof)
+    {
+        solver_proof_chain(
+            solver, solver->learned, solver->learned_count, lits,
+            solver->clauses[conflict].size, solver->clauses[conflict].id);
+        id = solver_proof_add(solver, solver->learned, solver->learned_count);
+    }
+
+    solver_backtrack(solver, backjump);
+
+    /* track the quality of learned clauses for glucose restarts. */
+    solver->lbd_samples += 1;
+    average(
+        &solver->lbd_fast, solver->learned_lbd, SOLVER_GLUCOSE_FAST_ALPHA,
+        solver->lbd_samples);
+    average(
+        &solver->lbd_slow, solver->learned_lbd, SOLVER_GLUCOSE_SLOW_ALPHA,
+        solver->lbd_samples);
+
+    /* glue clauses are worth sharing with the rest of a portfolio. */
+    if (solver->learned_lbd <= SOLVER_SHARE_MAX_LBD)
+    {
+        solver_share_export(solver, solver->learned, solver->learned_count);
+    }
+
+    if (1 == solver->learned_count)
+    {
+        solver_enqueue(solver, solver->learned[0], SOLVER_NO_REASON);
+        solver->unit_ids[LIBSAT_LITERAL_VARIABLE(solver->learned[0])] = id;
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        solver_clause_add(
+            &clause, solver, solver->learned, solver->learned_count, true);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    solver->clauses[clause].lbd = solver->learned_lbd;
+    solver->clauses[clause].id = id;
+    solver_enqueue(solver, solver->learned[0], clause);
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Save the assignment below the conflict level as the target, if it is
+ * the longest seen since the target was last reset.
+ *
+ * \param solver        The solver for this operation.
+ */
+static void save_target(libsat_solver* solver)
+{
+    size_t count;
+
+    if (0 == solver->level)
+    {
+        return;
+    }
+
+    count = solver->trail_lim[solver->level - 1];
+    if (count <= solver->target_count)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        size_t var_id = LIBSAT_LITERAL_VARIABLE(solver->trail[i]);
+
+        solver->target[var_id] = solver->values[var_id];
+    }
+
+    solver->target_count = count;
+}
+
+/**
+ * \brief Update an exponential moving average. The first samples are averaged
+ * exactly, so that the average does not start out biased towards zero.
+ */
+static void average(double* avg, double value, double alpha, uint64_t samples)
+{
+    if ((double)samples * alpha < 1.0)
+    {
+        alpha = 1.0 / (double)samples;
+    }
+
+    *avg += (value - *avg) * alpha;
+}
+
+/**
+ * \brief Decide whether the search should restart.
+ *
+ * \param solver        The solver for this operation.
+ * \param conflicts     The number of conflicts since the last restart.
+ * \param budget        The number of conflicts allowed.
+ *
+ * \returns true if the search should restart.
+ */
+static bool restart_due(
+    const libsat_solver* solver, uint64_t conflicts, uint64_t budget)
+{
+    if (conflicts >= budget)
+    {
+        return true;
+    }
+
+    switch (solver->restart_policy)
+    {
+        case LIBSAT_SOLVE_RESTART_GLUCOSE:
+            return glucose_due(solver, conflicts);
+
+        /* a phase switch waits for a restart. */
+        case LIBSAT_SOLVE_RESTART_STABILIZING:
+            return
+                solver->conflicts >= solver->stable_next
+             || (!solver->stable && glucose_due(solver, conflicts));
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * \brief Recent learned clauses are worse than usual, so a glucose restart is
+ * due.
+ */
+static bool glucose_due(const libsat_solver* solver, uint64_t conflicts)
+{
+    return
+        conflicts >= SOLVER_GLUCOSE_MIN_CONFLICTS
+     && solver->lbd_fast > SOLVER_GLUCOSE_MARGIN * solver->lbd_slow;
+}
+
+/**
+ * \brief Decide a variable in its saved phase, or in a stable phase, in its
+ * target phase if it has one.
+ */
+static bool decide_negated(const libsat_solver* solver, size_t var_id)
+{
+    uint8_t phase = solver->phases[var_id];
+
+    if (
+        solver->stable
+     && LIBSAT_VALUE_UNASSIGNED != solver->target[var_id])
+    {
+        phase = solver->target[var_id];
+    }
+
+    return LIBSAT_VALUE_TRUE != phase;
+}
@@ -0,0 +1,55 @@
+/**
+ * \file solver/solver_share_attach.c
+ *
+ * \brief Attach a \ref libsat_solver to a set of sharing rings.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Attach a solver to a set of sharing rings and a stop flag.
+ *
+ * The solver starts reading every ring from the beginning.
+ *
+ * \param solver        The solver for this operation.
+ * \param rings         The rings shared by the workers.
+ * \param count         The number of rings.
+ * \param self          The ring this solver publishes to.
+ * \param stop          The flag that stops this solver.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_share_attach)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(solver_ring)* rings,
+    size_t count, size_t self, const atomic_bool* stop)
+{
+    status retval;
+
+    retval =
+        memory_resize(
+            solver->alloc, (void**)&solver->ring_read,
+            count * sizeof(*solver->ring_read));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memset(solver->ring_read, 0, count * sizeof(*solver->ring_read));
+    solver->rings = rings;
+    solver->ring_count = count;
+    solver->ring_self = self;
+    solver->stop = stop;
+
+    return STATUS_SUCCESS;
+}
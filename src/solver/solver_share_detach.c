@@ -0,0 +1,27 @@
+/**
+ * \file solver/solver_share_detach.c
+ *
+ * \brief Detach a \ref libsat_solver from its sharing rings.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+/**
+ * \brief Detach a solver from its sharing rings and stop flag.
+ *
+ * The read positions are kept for the next attach.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_share_detach)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    solver->rings = NULL;
+    solver->ring_count = 0;
+    solver->ring_self = 0;
+    solver->stop = NULL;
+}
@@ -0,0 +1,56 @@
+/**
+ * \file solver/solver_share_export.c
+ *
+ * \brief Publish a learned clause to the other portfolio workers.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Publish a learned clause in the sharing ring of this worker.
+ *
+ * The clause is written past the head of the ring, and then published by
+ * advancing the head with release ordering. Nothing is published outside of a
+ * portfolio.
+ *
+ * \param solver        The solver for this operation.
+ * \param lits          The literals of this clause.
+ * \param count         The number of literals.
+ */
+void
+LIBSAT_SYM(solver_share_export)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_literal)* lits,
+    size_t count)
+{
+    solver_ring* ring;
+    uint64_t head;
+    const uint64_t mask = SOLVER_SHARE_RING_SLOTS - 1;
+
+    /* only workers in a portfolio share, and only clauses that fit. */
+    if (NULL == solver->rings || count + 1 > SOLVER_SHARE_RING_SLOTS)
+    {
+        return;
+    }
+
+    ring = solver->rings + solver->ring_self;
+
+    /* only this worker writes its ring, so head can be read relaxed. */
+    head = atomic_load_explicit(&ring->head, memory_order_relaxed);
+
+    atomic_store_explicit(
+        &ring->slots[head & mask], count, memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i)
+    {
+        atomic_store_explicit(
+            &ring->slots[(head + 1 + i) & mask], lits[i],
+            memory_order_relaxed);
+    }
+
+    atomic_store_explicit(
+        &ring->head, head + 1 + count, memory_order_release);
+}
@@ -0,0 +1,141 @@
+/**
+ * \file solver/solver_share_import.c
+ *
+ * \brief Import the clauses published by the other portfolio workers.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static status import_ring(libsat_solver* solver, size_t index);
+
+/**
+ * \brief Import the clauses published by the other workers since the last
+ * import.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_share_import)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    status retval;
+
+    if (NULL == solver->rings)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    for (size_t i = 0; i < solver->ring_count && !solver->inconsistent; ++i)
+    {
+        if (i == solver->ring_self)
+        {
+            continue;
+        }
+
+        retval = import_ring(solver, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Import the clauses published in one ring since the last import.
+ *
+ * Each clause is copied out of the ring before it is used. If the owner has
+ * lapped the clause by the time the copy is finished, the copy may be torn, so
+ * it is dropped and reading resumes at the current head.
+ *
+ * \param solver        The solver for this operation.
+ * \param index         The index of the ring to read.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status import_ring(libsat_solver* solver, size_t index)
+{
+    status retval;
+    solver_ring* ring = solver->rings + index;
+    const uint64_t mask = SOLVER_SHARE_RING_SLOTS - 1;
+    uint64_t read = solver->ring_read[index];
+    uint64_t head = atomic_load_explicit(&ring->head, memory_order_acquire);
+
+    while (read < head && !solver->inconsistent)
+    {
+        size_t count;
+        bool valid = true;
+
+        /* the owner has lapped us; skip to what is still in the ring. */
+        if (head - read > SOLVER_SHARE_RING_SLOTS)
+        {
+            read = head;
+            break;
+        }
+
+        count =
+            atomic_load_explicit(
+                &ring->slots[read & mask], memory_order_relaxed);
+        if (count > solver->var_count || read + 1 + count > head)
+        {
+            valid = false;
+            count = 0;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            libsat_literal lit =
+                atomic_load_explicit(
+                    &ring->slots[(read + 1 + i) & mask],
+                    memory_order_relaxed);
+
+            if (LIBSAT_LITERAL_VARIABLE(lit) >= solver->var_count)
+            {
+                valid = false;
+                break;
+            }
+
+            solver->implied[i] = lit;
+        }
+
+        /* verify that nothing we copied was overwritten meanwhile. */
+        atomic_thread_fence(memory_order_acquire);
+        if (
+            !valid
+         || atomic_load_explicit(&ring->head, memory_order_relaxed) - read
+                > SOLVER_SHARE_RING_SLOTS)
+        {
+            read = atomic_load_explicit(&ring->head, memory_order_acquire);
+            break;
+        }
+
+        read += 1 + count;
+
+        retval =
+            solver_clause_import(solver, solver->implied, count, true, 0);
+        if (STATUS_SUCCESS != retval)
+        {
+            solver->ring_read[index] = read;
+            return retval;
+        }
+    }
+
+    solver->ring_read[index] = read;
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,248 @@
+/**
+ * \file solver/solver_solve.c
+ *
+ * \brief Solve under assumptions with a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/* forward decls. */
+static uint64_t restart_budget(const libsat_solver* solver, uint64_t i);
+static uint64_t luby(uint64_t i);
+
+/**
+ * \brief Solve a database and xor matrix under the given assumptions.
+ *
+ * New clauses are imported, and the search is restarted on the sequence chosen
+ * by the restart policy of the solver. Learned clauses, activity, and saved
+ * phases carry over between calls. Phase switches, rephasing and rounds of
+ * inprocessing run between restarts as they come due. Models are extended to
+ * the variables eliminated from the database. In a portfolio, clauses shared by
+ * the other workers are imported at each restart. While a proof is written, it
+ * is written out before this returns. The search gives up with an unknown
+ * result once the solver is halted: by a request to terminate, by another
+ * worker of a portfolio with an answer, or by a limit of the call.
+ *
+ * \param result        Pointer to receive the \ref libsat_solve_result.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database to solve.
+ * \param matrix        The native xor matrix.
+ * \param var_count     The number of variables.
+ * \param assumptions   The literals to assume.
+ * \param count         The number of assumptions.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION if an assumption refers to a
+ *        variable that does not exist.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_STALE if the database has changed since
+ *        the proof began.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED if the database holds native
+ *        constraints or parity statements.
+ *      - ERROR_LIBSAT_SOLVER_PROOF_WRITE if the proof could not be written.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_solve)(
+    int* result, LIBSAT_SYM(libsat_solver)* solver,
+    const LIBSAT_SYM(libsat_cnf)* cnf, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    size_t var_count, const LIBSAT_SYM(libsat_literal)* assumptions,
+    size_t count)
+{
+    status retval;
+    int tmp = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    /* forget the previous result. */
+    solver->last_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    solver->core_count = 0;
+    solver->model_count = 0;
+    solver->halted = false;
+    solver->limit_countdown = 0;
+
+    retval = solver_prepare(solver, var_count, assumptions, count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = solver_proof_prepare(solver, cnf, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* bring in anything asserted since the last call. */
+    solver_backtrack(solver, 0);
+    retval = solver_import(solver, cnf);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* search with restarts. */
+    for (uint64_t i = 0; !solver->inconsistent; ++i)
+    {
+        retval = solver_share_import(solver);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        if (solver->inconsistent)
+        {
+            break;
+        }
+
+        retval =
+            solver_search(
+                &tmp, solver, cnf, matrix, restart_budget(solver, i));
+        if (STATUS_SUCCESS != retval)
+        {
+            solver_backtrack(solver, 0);
+            return retval;
+        }
+
+        if (LIBSAT_SOLVE_RESULT_UNKNOWN != tmp)
+        {
+            break;
+        }
+
+        /* give up once termination is requested or a limit is reached. */
+        if (solver->halted)
+        {
+            break;
+        }
+
+        solver->restarts += 1;
+        solver_backtrack(solver, 0);
+        solver_stabilize(solver);
+        solver_rephase(solver);
+
+        /* simplify between restarts, so learned clauses stay in check. */
+        retval = solver_inprocess(solver, cnf, matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    if (solver->inconsistent)
+    {
+        tmp = LIBSAT_SOLVE_RESULT_UNSATISFIABLE;
+        solver->core_count = 0;
+    }
+
+    /* keep the model. */
+    if (LIBSAT_SOLVE_RESULT_SATISFIABLE == tmp)
+    {
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&solver->model,
+                (0 == var_count) ? 1 : var_count);
+        if (STATUS_SUCCESS != retval)
+        {
+            solver_backtrack(solver, 0);
+            return retval;
+        }
+
+        memcpy(solver->model, solver->values, var_count);
+        solver->model_count = var_count;
+
+        /* give the eliminated variables values that fit their clauses. */
+        cnf_extend_model(cnf, solver->model, var_count);
+    }
+
+    solver_backtrack(solver, 0);
+
+    /* the proof so far is written out at the end of each solve. */
+    if (NULL != solver->proof)
+    {
+        solver_proof_flush(solver->proof);
+        if (STATUS_SUCCESS != solver->proof->error)
+        {
+            return solver->proof->error;
+        }
+    }
+
+    /* success. */
+    solver->last_result = tmp;
+    *result = tmp;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Get the conflict budget of the i-th restart.
+ *
+ * Geometric restarts grow by half each time, and are capped so that a long
+ * solve never overflows the budget. Glucose restarts, and stabilizing
+ * restarts in a focused phase, are driven by learned LBD, and the budget only
+ * bounds them. Stable phases follow a Luby sequence with a longer base.
+ */
+static uint64_t restart_budget(const libsat_solver* solver, uint64_t i)
+{
+    uint64_t budget = SOLVER_RESTART_BASE;
+
+    switch (solver->restart_policy)
+    {
+        case LIBSAT_SOLVE_RESTART_GEOMETRIC:
+            break;
+
+        case LIBSAT_SOLVE_RESTART_GLUCOSE:
+            return SOLVER_GLUCOSE_MAX_CONFLICTS;
+
+        case LIBSAT_SOLVE_RESTART_STABILIZING:
+            if (!solver->stable)
+            {
+                return SOLVER_GLUCOSE_MAX_CONFLICTS;
+            }
+
+            return luby(i) * SOLVER_STABLE_RESTART_BASE;
+
+        default:
+            return luby(i) * SOLVER_RESTART_BASE;
+    }
+
+    for (uint64_t j = 0; j < i && budget < (UINT64_C(1) << 40); ++j)
+    {
+        budget += budget / 2;
+    }
+
+    return budget;
+}
+
+/**
+ * \brief Get the i-th element of the Luby sequence 1, 1, 2, 1, 1, 2, 4, ...
+ */
+static uint64_t luby(uint64_t i)
+{
+    uint64_t size = 1, power = 1;
+
+    /* find the smallest complete subsequence holding index i. */
+    while (size < i + 1)
+    {
+        size = 2 * size + 1;
+        power *= 2;
+    }
+
+    /* descend into the copy of the smaller subsequence that holds it. */
+    while (size - 1 != i)
+    {
+        size = (size - 1) / 2;
+        power /= 2;
+        i = i % size;
+    }
+
+    return power;
+}
@@ -0,0 +1,44 @@
+/**
+ * \file solver/solver_stabilize.c
+ *
+ * \brief Alternate the stable and focused phases of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/solver.h>
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Switch between stable and focused phases if a switch is due.
+ *
+ * Only stabilizing restarts have phases. Each stable phase lasts as long as
+ * the focused phase before it, and the next focused phase lasts twice as
+ * long. The target assignment starts over with each phase.
+ *
+ * \param solver        The solver for this operation.
+ */
+void
+LIBSAT_SYM(solver_stabilize)(
+    LIBSAT_SYM(libsat_solver)* solver)
+{
+    if (
+        LIBSAT_SOLVE_RESTART_STABILIZING != solver->restart_policy
+     || solver->conflicts < solver->stable_next)
+    {
+        return;
+    }
+
+    solver->stable = !solver->stable;
+    if (!solver->stable)
+    {
+        solver->stable_length *= 2;
+    }
+
+    solver->stable_next = solver->conflicts + solver->stable_length;
+    solver->target_count = 0;
+}
@@ -0,0 +1,62 @@
+/**
+ * \file solver/solver_true_literal.c
+ *
+ * \brief Get the literal that is always true in a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "../cnf/cnf_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_cnf_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Get the literal that is always true in this context, creating it if
+ * necessary.
+ *
+ * The unit clause that makes the literal true is added under the current
+ * guard of the clause database, so a caller that guards clauses of its own
+ * must create the literal before setting its guard.
+ *
+ * \param lit           Pointer to receive the literal.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_true_literal)(
+    LIBSAT_SYM(libsat_literal)* lit, LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_literal unit;
+
+    if (!context->has_true_variable)
+    {
+        retval = cnf_fresh_variable(&context->true_variable, context->cnf);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        unit = LIBSAT_LITERAL_MAKE(context->true_variable, false);
+        retval = libsat_cnf_add_clause(context->cnf, &unit, 1);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        context->has_true_variable = true;
+    }
+
+    *lit = LIBSAT_LITERAL_MAKE(context->true_variable, false);
+    return STATUS_SUCCESS;
+}
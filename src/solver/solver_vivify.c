@@ -0,0 +1,289 @@
+/**
+ * \file solver/solver_vivify.c
+ *
+ * \brief Shorten the learned clauses of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status vivify_clause(
+    bool* reset, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix, size_t clause);
+static uint64_t log_lemma(
+    libsat_solver* solver, size_t clause, size_t conflict);
+static status replace(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    uint32_t lbd, uint64_t id);
+
+/**
+ * \brief Shorten the learned clauses that are worth keeping by propagating
+ * the negation of their literals.
+ *
+ * Each learned clause in the core and mid tiers is tried once. Its literals
+ * are falsified one at a time. A literal that is already false is implied by
+ * the others and is dropped, while a literal that is already true, or a
+ * conflict, ends the clause early. The clause is replaced by what remains,
+ * which a proof logs as a lemma, and the original is deleted.
+ *
+ * \param solver        The solver for this operation. It must be at decision
+ *                      level zero.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param budget        The number of propagations to spend.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_vivify)(
+    LIBSAT_SYM(libsat_solver)* solver, const LIBSAT_SYM(libsat_cnf)* cnf,
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, uint64_t budget)
+{
+    status retval;
+    uint64_t start = solver->propagations;
+    size_t clause_count = solver->clause_count;
+    bool reset = false;
+
+    for (
+        size_t i = 0;
+        i < clause_count && !reset && !solver->inconsistent
+     && solver->propagations - start < budget;
+        ++i)
+    {
+        const solver_clause* entry = &solver->clauses[i];
+
+        if (
+            !entry->learned || entry->deleted || entry->vivified
+         || entry->lbd > SOLVER_TIER_MID_LBD || entry->size <= 2)
+        {
+            continue;
+        }
+
+        retval = vivify_clause(&reset, solver, cnf, matrix, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Vivify a single clause.
+ *
+ * The literals that are kept go in the learned scratch buffer, which
+ * propagation leaves alone. The clause is deleted while it is vivified, so
+ * that it does not propagate itself, and is always replaced.
+ *
+ * \param reset         Pointer to receive whether propagation learned a fact
+ *                      and returned to level zero, which ends this round.
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param clause        The clause to vivify.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status vivify_clause(
+    bool* reset, libsat_solver* solver, const libsat_cnf* cnf,
+    libsat_xor_matrix* matrix, size_t clause)
+{
+    status retval;
+    size_t size = solver->clauses[clause].size;
+    uint32_t lbd = solver->clauses[clause].lbd;
+    size_t conflict = SOLVER_NO_CONFLICT;
+    uint64_t id;
+
+    /* a clause satisfied at level zero is no longer needed. */
+    solver->learned_count = 0;
+    for (size_t i = 0; i < size; ++i)
+    {
+        libsat_literal lit = solver_clause_lits(solver, clause)[i];
+
+        switch (solver_lit_value(solver, lit))
+        {
+            case LIBSAT_VALUE_TRUE:
+                solver->clauses[clause].deleted = true;
+                return STATUS_SUCCESS;
+
+            case LIBSAT_VALUE_FALSE:
+                break;
+
+            default:
+                solver->learned[solver->learned_count++] = lit;
+                break;
+        }
+    }
+
+    solver->clauses[clause].deleted = true;
+
+    /* falsify the remaining literals one at a time. */
+    size = solver->learned_count;
+    solver->learned_count = 0;
+    for (size_t i = 0; i < size && SOLVER_NO_CONFLICT == conflict; ++i)
+    {
+        libsat_literal lit = solver->learned[i];
+        uint8_t value = solver_lit_value(solver, lit);
+
+        if (LIBSAT_VALUE_FALSE == value)
+        {
+            continue;
+        }
+
+        solver->learned[solver->learned_count++] = lit;
+        if (LIBSAT_VALUE_TRUE == value)
+        {
+            break;
+        }
+
+        solver_new_level(solver);
+        solver_enqueue(solver, LIBSAT_LITERAL_NEGATE(lit), SOLVER_NO_REASON);
+
+        retval = solver_propagate_all(&conflict, solver, cnf, matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            solver_backtrack(solver, 0);
+            solver->clauses[clause].deleted = false;
+            return retval;
+        }
+
+        /* a fact was learned; keep the clause as it was. */
+        if (solver->level != solver->learned_count || solver->inconsistent)
+        {
+            solver_backtrack(solver, 0);
+            solver->clauses[clause].deleted = false;
+            solver->clauses[clause].vivified = true;
+            *reset = true;
+            return STATUS_SUCCESS;
+        }
+    }
+
+    id = log_lemma(solver, clause, conflict);
+    solver_backtrack(solver, 0);
+
+    return replace(solver, cnf, matrix, lbd, id);
+}
+
+/**
+ * \brief Log the literals that were kept as a lemma, while the trail still
+ * shows how they follow.
+ *
+ * The lemma is false under the trail, apart from a last literal that may be
+ * true. It follows from the conflict if there is one, from the reason of that
+ * true literal, or else from the original clause, which is now false. A clause
+ * that kept all of its literals keeps its number instead, and is then not
+ * logged as deleted.
+ *
+ * \param solver        The solver for this operation.
+ * \param clause        The clause that was vivified.
+ * \param conflict      The conflicting clause, or SOLVER_NO_CONFLICT.
+ *
+ * \returns the number of the lemma in the proof, or zero if no proof is being
+ * written.
+ */
+static uint64_t log_lemma(
+    libsat_solver* solver, size_t clause, size_t conflict)
+{
+    size_t count = solver->learned_count;
+    size_t source = clause;
+    uint64_t id;
+
+    if (NULL == solver->proof)
+    {
+        return 0;
+    }
+
+    if (count == solver->clauses[clause].size)
+    {
+        id = solver->clauses[clause].id;
+        solver->clauses[clause].id = 0;
+        return id;
+    }
+
+    if (SOLVER_NO_CONFLICT != conflict)
+    {
+        source = conflict;
+    }
+    else if (
+        0 < count
+     && LIBSAT_VALUE_TRUE
+            == solver_lit_value(solver, solver->learned[count - 1]))
+    {
+        source =
+            solver->reasons[
+                LIBSAT_LITERAL_VARIABLE(solver->learned[count - 1])];
+    }
+
+    solver_proof_chain(
+        solver, solver->learned, count, solver_clause_lits(solver, source),
+        solver->clauses[source].size, solver->clauses[source].id);
+
+    return solver_proof_add(solver, solver->learned, count);
+}
+
+/**
+ * \brief Replace a vivified clause with the literals that were kept.
+ *
+ * \param solver        The solver for this operation.
+ * \param cnf           The database holding native constraints.
+ * \param matrix        The native xor matrix.
+ * \param lbd           The LBD of the original clause.
+ * \param id            The number of the new clause in the proof, or zero.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status replace(
+    libsat_solver* solver, const libsat_cnf* cnf, libsat_xor_matrix* matrix,
+    uint32_t lbd, uint64_t id)
+{
+    status retval;
+    size_t clause;
+
+    switch (solver->learned_count)
+    {
+        case 0:
+            solver->inconsistent = true;
+            return STATUS_SUCCESS;
+
+        case 1:
+            solver_enqueue(solver, solver->learned[0], SOLVER_NO_REASON);
+            solver->unit_ids[LIBSAT_LITERAL_VARIABLE(solver->learned[0])] =
+                id;
+            return solver_propagate_all(&clause, solver, cnf, matrix);
+
+        default:
+            retval =
+                solver_clause_add(
+                    &clause, solver, solver->learned, solver->learned_count,
+                    true);
+            if (STATUS_SUCCESS != retval)
+            {
+                return retval;
+            }
+
+            if (lbd > solver->learned_count)
+            {
+                lbd = (uint32_t)solver->learned_count;
+            }
+
+            solver->clauses[clause].lbd = lbd;
+            solver->clauses[clause].id = id;
+            solver->clauses[clause].vivified = true;
+            return STATUS_SUCCESS;
+    }
+}
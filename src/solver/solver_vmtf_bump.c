@@ -0,0 +1,51 @@
+/**
+ * \file solver/solver_vmtf_bump.c
+ *
+ * \brief Move a variable to the end of the VMTF queue of a
+ * \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Move a variable to the end of the VMTF queue.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to bump.
+ */
+void
+LIBSAT_SYM(solver_vmtf_bump)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id)
+{
+    size_t prev = solver->vmtf_prev[var_id];
+    size_t next = solver->vmtf_next[var_id];
+
+    if (SOLVER_NO_VARIABLE == next)
+    {
+        return;
+    }
+
+    /* unlink the variable; it is not the last, so next is a variable. */
+    solver->vmtf_prev[next] = prev;
+    if (SOLVER_NO_VARIABLE == prev)
+    {
+        solver->vmtf_first = next;
+    }
+    else
+    {
+        solver->vmtf_next[prev] = next;
+    }
+
+    /* the search position must not be left pointing at a moved variable. */
+    if (solver->vmtf_search == var_id)
+    {
+        solver->vmtf_search = next;
+    }
+
+    solver_vmtf_enqueue(solver, var_id);
+}
@@ -0,0 +1,47 @@
+/**
+ * \file solver/solver_vmtf_enqueue.c
+ *
+ * \brief Add a variable to the VMTF queue of a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Add a variable to the end of the VMTF queue, as the most recently
+ * bumped.
+ *
+ * The variable gets a fresh stamp, so stamps increase from the front of the
+ * queue to its end. An unassigned variable becomes the search position.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_id        The variable to add. It must not be in the queue.
+ */
+void
+LIBSAT_SYM(solver_vmtf_enqueue)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_id)
+{
+    solver->vmtf_prev[var_id] = solver->vmtf_last;
+    solver->vmtf_next[var_id] = SOLVER_NO_VARIABLE;
+    solver->vmtf_stamp[var_id] = ++solver->vmtf_clock;
+
+    if (SOLVER_NO_VARIABLE == solver->vmtf_last)
+    {
+        solver->vmtf_first = var_id;
+    }
+    else
+    {
+        solver->vmtf_next[solver->vmtf_last] = var_id;
+    }
+
+    solver->vmtf_last = var_id;
+
+    if (LIBSAT_VALUE_UNASSIGNED == solver->values[var_id])
+    {
+        solver->vmtf_search = var_id;
+    }
+}
@@ -0,0 +1,61 @@
+/**
+ * \file solver/solver_vmtf_truncate.c
+ *
+ * \brief Drop forgotten variables from the VMTF queue of a
+ * \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Drop the variables at or past a count from the VMTF queue, keeping
+ * the order of the rest.
+ *
+ * The search position moves to the end of the queue, which is always safe.
+ *
+ * \param solver        The solver for this operation.
+ * \param var_count     The number of variables to keep.
+ */
+void
+LIBSAT_SYM(solver_vmtf_truncate)(
+    LIBSAT_SYM(libsat_solver)* solver, size_t var_count)
+{
+    size_t last = SOLVER_NO_VARIABLE;
+    size_t var_id = solver->vmtf_first;
+
+    solver->vmtf_first = SOLVER_NO_VARIABLE;
+    while (SOLVER_NO_VARIABLE != var_id)
+    {
+        size_t next = solver->vmtf_next[var_id];
+
+        if (var_id < var_count)
+        {
+            solver->vmtf_prev[var_id] = last;
+            if (SOLVER_NO_VARIABLE == last)
+            {
+                solver->vmtf_first = var_id;
+            }
+            else
+            {
+                solver->vmtf_next[last] = var_id;
+            }
+
+            last = var_id;
+        }
+
+        var_id = next;
+    }
+
+    if (SOLVER_NO_VARIABLE != last)
+    {
+        solver->vmtf_next[last] = SOLVER_NO_VARIABLE;
+    }
+
+    solver->vmtf_last = last;
+    solver->vmtf_search = last;
+}
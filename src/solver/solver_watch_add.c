@@ -0,0 +1,59 @@
+/**
+ * \file solver/solver_watch_add.c
+ *
+ * \brief Watch a clause on a literal in a \ref libsat_solver.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_solver_internal;
+
+/**
+ * \brief Watch a clause on a literal.
+ *
+ * \param solver        The solver for this operation.
+ * \param lit           The literal to watch.
+ * \param clause        The clause to visit when this literal becomes false.
+ * \param blocker       Another literal of the clause.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_watch_add)(
+    LIBSAT_SYM(libsat_solver)* solver, LIBSAT_SYM(libsat_literal) lit,
+    size_t clause, LIBSAT_SYM(libsat_literal) blocker)
+{
+    status retval;
+    solver_watch_list* list = &solver->watches[lit];
+
+    /* grow the list if needed. */
+    if (list->count == list->capacity)
+    {
+        size_t capacity = (0 == list->capacity) ? 4 : 2 * list->capacity;
+
+        retval =
+            memory_resize(
+                solver->alloc, (void**)&list->items,
+                capacity * sizeof(*list->items));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        list->capacity = capacity;
+    }
+
+    list->items[list->count].clause = clause;
+    list->items[list->count].blocker = blocker;
+    list->count += 1;
+
+    /* success. */
+    return STATUS_SUCCESS;
+}
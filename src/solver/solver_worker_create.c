@@ -0,0 +1,90 @@
+/**
+ * \file solver/solver_worker_create.c
+ *
+ * \brief Create a parallel worker for a \ref libsat_context.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+
+#include "../xor/xor_internal.h"
+#include "solver_internal.h"
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_solver_internal;
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+RCPR_IMPORT_resource;
+
+/**
+ * \brief Create a parallel worker for a context, with a fresh solver and its
+ * own copy of the native xor matrix.
+ *
+ * The solver is diversified by the index of the worker. On failure, nothing
+ * is left to release.
+ *
+ * \param solver        Pointer to receive the worker solver.
+ * \param matrix        Pointer to receive the copy of the xor matrix.
+ * \param context       The context for this operation.
+ * \param index         The index of this worker, used to diversify it.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(solver_worker_create)(
+    LIBSAT_SYM(libsat_solver)** solver, LIBSAT_SYM(libsat_xor_matrix)** matrix,
+    LIBSAT_SYM(libsat_context)* context, size_t index)
+{
+    status retval, release_retval;
+    libsat_solver* tmp_solver;
+    libsat_xor_matrix* tmp_matrix;
+
+    retval = solver_create(&tmp_solver, context->alloc);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    retval = xor_matrix_clone(&tmp_matrix, context->xor_matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_solver;
+    }
+
+    retval = solver_reserve(tmp_solver, context->variable_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_matrix;
+    }
+
+    solver_diversify(tmp_solver, index);
+    tmp_solver->terminate = &context->terminate;
+
+    /* success. */
+    *solver = tmp_solver;
+    *matrix = tmp_matrix;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_matrix:
+    release_retval =
+        resource_release(libsat_xor_matrix_resource_handle(tmp_matrix));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+cleanup_solver:
+    release_retval = resource_release(&tmp_solver->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
@@ -6,5 +6,8 @@
 #include "scanner/scanner_internal.h"
 
 LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
 LIBSAT_IMPORT_parser;
 LIBSAT_IMPORT_scanner;
+LIBSAT_IMPORT_solver;
+LIBSAT_IMPORT_xor;
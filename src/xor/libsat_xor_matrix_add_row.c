@@ -0,0 +1,73 @@
+/**
+ * \file xor/libsat_xor_matrix_add_row.c
+ *
+ * \brief Add a parity row to a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+
+/**
+ * \brief Add a row of the form vars[0] ⊻ ... ⊻ vars[count-1] = parity.
+ *
+ * \note A variable that appears twice cancels itself out.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param vars          The variable ids in this row.
+ * \param count         The number of variable ids in this row.
+ * \param parity        The parity of this row.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_add_row)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, const size_t* vars, size_t count,
+    bool parity)
+{
+    status retval;
+    size_t column;
+    uint64_t* row;
+
+    /* map every variable to a column first, since this may widen the rows. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        retval = xor_matrix_column_get(&column, matrix, vars[i]);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* append an empty row. */
+    retval = xor_matrix_row_append(&row, matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* set the bit for each variable. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        xor_row_toggle(row, matrix->variable_column[vars[i]] + 1);
+    }
+
+    /* set the parity. */
+    if (parity)
+    {
+        xor_row_toggle(row, LIBSAT_XOR_PARITY_BIT);
+    }
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
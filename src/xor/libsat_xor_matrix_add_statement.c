@@ -0,0 +1,276 @@
+/**
+ * \file xor/libsat_xor_matrix_add_statement.c
+ *
+ * \brief Add a parsed parity statement to a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+typedef struct parity_walk
+{
+    allocator* alloc;
+    const libsat_ast_node** stack;
+    size_t stack_count;
+    size_t stack_capacity;
+    size_t* vars;
+    size_t var_count;
+    size_t var_capacity;
+    bool parity;
+} parity_walk;
+
+static status walk_push(parity_walk* walk, const libsat_ast_node* node);
+static status walk_var(parity_walk* walk, size_t var_id);
+static status walk_expression(
+    parity_walk* walk, const libsat_ast_node* expression);
+static status walk_cleanup(parity_walk* walk, status retval);
+
+/**
+ * \brief Add a parsed statement to the matrix as a parity constraint.
+ *
+ * The statement must consist only of exclusive disjunctions, biconditionals,
+ * assignments, negations, variables, and boolean literals. Any such statement
+ * is equivalent to a single row of the form x1 ⊻ x2 ⊻ ... ⊻ xn = parity.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param statement     The statement node to add.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT if the statement contains any
+ *        other operator. The matrix is unchanged in this case.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_add_statement)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    const LIBSAT_SYM(libsat_ast_node)* statement)
+{
+    status retval;
+    parity_walk walk;
+
+    /* this must be a statement. */
+    if (LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT != statement->type)
+    {
+        retval = ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT;
+        goto done;
+    }
+
+    /* set up the walk. A statement asserts that its expression is true, so
+     * the terms must sum to one before any constants are folded in. */
+    memset(&walk, 0, sizeof(walk));
+    walk.alloc = matrix->alloc;
+    walk.parity = true;
+
+    /* collect the terms of this expression. */
+    retval = walk_expression(&walk, statement->value.unary);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_walk;
+    }
+
+    /* add the row. */
+    retval =
+        libsat_xor_matrix_add_row(
+            matrix, walk.vars, walk.var_count, walk.parity);
+    goto cleanup_walk;
+
+cleanup_walk:
+    retval = walk_cleanup(&walk, retval);
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Collect the variables and parity of a parity expression.
+ *
+ * \note This walk uses an explicit stack, since long xor chains produce very
+ * deep left-leaning trees.
+ *
+ * \param walk          The walk state.
+ * \param expression    The expression to walk.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT if any other operator is
+ *        found.
+ *      - a non-zero error code on failure.
+ */
+static status walk_expression(
+    parity_walk* walk, const libsat_ast_node* expression)
+{
+    status retval;
+    const libsat_ast_node* node;
+
+    retval = walk_push(walk, expression);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    while (walk->stack_count > 0)
+    {
+        node = walk->stack[--walk->stack_count];
+
+        switch (node->type)
+        {
+            case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+                retval = walk_var(walk, node->value.variable_index);
+                break;
+
+            /* a true constant flips the parity of the remaining terms. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+                walk->parity ^= node->value.boolean_literal;
+                retval = STATUS_SUCCESS;
+                break;
+
+            /* ¬e is e ⊻ true. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+                walk->parity = !walk->parity;
+                retval = walk_push(walk, node->value.unary);
+                break;
+
+            /* a ↔ b and a := b are both a ⊻ b ⊻ true. */
+            case LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL:
+            case LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT:
+                walk->parity = !walk->parity;
+                /* fall through. */
+
+            case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+                retval = walk_push(walk, node->value.binary.rhs);
+                if (STATUS_SUCCESS == retval)
+                {
+                    retval = walk_push(walk, node->value.binary.lhs);
+                }
+                break;
+
+            default:
+                retval = ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT;
+                break;
+        }
+
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Push a node onto the walk stack.
+ *
+ * \param walk          The walk state.
+ * \param node          The node to push.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status walk_push(parity_walk* walk, const libsat_ast_node* node)
+{
+    status retval;
+
+    if (walk->stack_count == walk->stack_capacity)
+    {
+        size_t capacity =
+            (0 == walk->stack_capacity) ? 32 : 2 * walk->stack_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->stack,
+                capacity * sizeof(*walk->stack));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->stack_capacity = capacity;
+    }
+
+    walk->stack[walk->stack_count++] = node;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Append a variable to the walk.
+ *
+ * \param walk          The walk state.
+ * \param var_id        The variable id to append.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status walk_var(parity_walk* walk, size_t var_id)
+{
+    status retval;
+
+    if (walk->var_count == walk->var_capacity)
+    {
+        size_t capacity =
+            (0 == walk->var_capacity) ? 32 : 2 * walk->var_capacity;
+
+        retval =
+            memory_resize(
+                walk->alloc, (void**)&walk->vars, capacity * sizeof(size_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        walk->var_capacity = capacity;
+    }
+
+    walk->vars[walk->var_count++] = var_id;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Reclaim the memory held by a walk.
+ *
+ * \param walk          The walk state.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status walk_cleanup(parity_walk* walk, status retval)
+{
+    status release_retval;
+
+    if (NULL != walk->stack)
+    {
+        release_retval = allocator_reclaim(walk->alloc, walk->stack);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    if (NULL != walk->vars)
+    {
+        release_retval = allocator_reclaim(walk->alloc, walk->vars);
+        if (STATUS_SUCCESS != release_retval)
+        {
+            retval = release_retval;
+        }
+    }
+
+    return retval;
+}
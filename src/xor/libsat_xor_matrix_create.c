@@ -0,0 +1,69 @@
+/**
+ * \file xor/libsat_xor_matrix_create.c
+ *
+ * \brief Create a \ref libsat_xor_matrix instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* the vtable entry for the libsat_xor_matrix instance. */
+RCPR_VTABLE
+resource_vtable libsat_xor_matrix_vtable = {
+    &libsat_xor_matrix_resource_release };
+
+/**
+ * \brief Create an empty xor matrix instance.
+ *
+ * \param matrix        Pointer to the matrix pointer to be set to this created
+ *                      matrix instance on success.
+ * \param context       The context for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_create)(
+    LIBSAT_SYM(libsat_xor_matrix)** matrix,
+    LIBSAT_SYM(libsat_context)* context)
+{
+    status retval;
+    libsat_xor_matrix* tmp;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(context->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_xor_matrix_vtable);
+
+    /* initialize matrix. Every row holds at least the parity bit. */
+    tmp->alloc = context->alloc;
+    tmp->row_words = 1;
+
+    /* success. */
+    *matrix = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
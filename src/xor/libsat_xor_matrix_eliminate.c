@@ -0,0 +1,110 @@
+/**
+ * \file xor/libsat_xor_matrix_eliminate.c
+ *
+ * \brief Reduce a \ref libsat_xor_matrix to reduced row echelon form.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static void swap_rows(uint64_t* lhs, uint64_t* rhs, size_t words);
+
+/**
+ * \brief Reduce the matrix to reduced row echelon form, dropping redundant
+ * rows.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_INCONSISTENT if the rows reduce to 0 = 1.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_eliminate)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    size_t words = matrix->row_words;
+    size_t pivot_row = 0;
+
+    /* Gauss-Jordan elimination over every column. */
+    for (size_t column = 0; column < matrix->column_count; ++column)
+    {
+        size_t bit = column + 1;
+        size_t found;
+        uint64_t* pivot;
+
+        /* find a row at or below the pivot row with this column set. */
+        for (found = pivot_row; found < matrix->row_count; ++found)
+        {
+            if (xor_row_test(matrix->rows + found * words, bit))
+            {
+                break;
+            }
+        }
+
+        if (found == matrix->row_count)
+        {
+            continue;
+        }
+
+        /* move it into the pivot position. */
+        pivot = matrix->rows + pivot_row * words;
+        if (found != pivot_row)
+        {
+            swap_rows(pivot, matrix->rows + found * words, words);
+        }
+
+        /* clear this column from every other row. */
+        for (size_t i = 0; i < matrix->row_count; ++i)
+        {
+            uint64_t* row = matrix->rows + i * words;
+
+            if (i != pivot_row && xor_row_test(row, bit))
+            {
+                xor_row_xor(row, pivot, words);
+            }
+        }
+
+        pivot_row += 1;
+    }
+
+    /* the rows after the last pivot have no columns left; any with parity
+     * set read 0 = 1. */
+    for (size_t i = pivot_row; i < matrix->row_count; ++i)
+    {
+        if (xor_row_test(matrix->rows + i * words, LIBSAT_XOR_PARITY_BIT))
+        {
+            return ERROR_LIBSAT_XOR_INCONSISTENT;
+        }
+    }
+
+    /* the remaining rows read 0 = 0, so drop them. */
+    matrix->row_count = pivot_row;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Swap two rows.
+ *
+ * \param lhs           The first row.
+ * \param rhs           The second row.
+ * \param words         The number of words in each row.
+ */
+static void swap_rows(uint64_t* lhs, uint64_t* rhs, size_t words)
+{
+    for (size_t i = 0; i < words; ++i)
+    {
+        uint64_t tmp = lhs[i];
+        lhs[i] = rhs[i];
+        rhs[i] = tmp;
+    }
+}
@@ -0,0 +1,111 @@
+/**
+ * \file xor/libsat_xor_matrix_propagate.c
+ *
+ * \brief Propagate a \ref libsat_xor_matrix under a partial assignment.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/status.h>
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+
+/* forward decls. */
+static bool row_assigned_parity(
+    const libsat_xor_matrix* matrix, const uint64_t* row);
+
+/**
+ * \brief Propagate the matrix under a partial assignment.
+ *
+ * \param implied_count Pointer to receive the number of implied literals.
+ * \param matrix        The matrix for this operation.
+ * \param values        The current assignment, indexed by variable id.
+ * \param value_count   The number of entries in \p values.
+ * \param implied       Array to receive the implied literals.
+ * \param implied_max   The capacity of \p implied.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - ERROR_LIBSAT_XOR_CONFLICT if the assignment violates the matrix.
+ *      - ERROR_LIBSAT_XOR_IMPLIED_BUFFER_TOO_SMALL if more than
+ *        \p implied_max literals are implied.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_propagate)(
+    size_t* implied_count, LIBSAT_SYM(libsat_xor_matrix)* matrix,
+    const uint8_t* values, size_t value_count,
+    LIBSAT_SYM(libsat_literal)* implied, size_t implied_max)
+{
+    status retval;
+    size_t words = matrix->row_words;
+    size_t count = 0;
+
+    /* eliminate over the unassigned columns. */
+    retval = xor_matrix_reduce(matrix, values, value_count);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* the rows without a pivot are fully assigned, and must be satisfied. */
+    for (size_t i = matrix->work_pivot_count; i < matrix->row_count; ++i)
+    {
+        if (row_assigned_parity(matrix, matrix->work + i * words))
+        {
+            matrix->work_conflict_row = i;
+            return ERROR_LIBSAT_XOR_CONFLICT;
+        }
+    }
+
+    /* a pivot row with no other unassigned column forces its pivot. */
+    for (size_t i = 0; i < matrix->work_pivot_count; ++i)
+    {
+        const uint64_t* row = matrix->work + i * words;
+        size_t var_id;
+        bool value;
+
+        if (1 != xor_row_count_masked(row, matrix->unassigned_mask, words))
+        {
+            continue;
+        }
+
+        if (count >= implied_max)
+        {
+            return ERROR_LIBSAT_XOR_IMPLIED_BUFFER_TOO_SMALL;
+        }
+
+        /* the pivot takes whatever value makes up the remaining parity. */
+        var_id = matrix->column_variable[matrix->work_pivot[i]];
+        value = row_assigned_parity(matrix, row);
+        implied[count++] = LIBSAT_LITERAL_MAKE(var_id, !value);
+    }
+
+    /* success. */
+    *implied_count = count;
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Compute the parity still owed by a row after its assigned columns are
+ * accounted for.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param row           The work row to inspect.
+ *
+ * \returns true if the row parity differs from the parity of its true columns.
+ */
+static bool row_assigned_parity(
+    const libsat_xor_matrix* matrix, const uint64_t* row)
+{
+    size_t true_count =
+        xor_row_count_masked(row, matrix->true_mask, matrix->row_words);
+
+    return
+        xor_row_test(row, LIBSAT_XOR_PARITY_BIT) != (0 != (true_count & 1));
+}
@@ -0,0 +1,26 @@
+/**
+ * \file xor/libsat_xor_matrix_resource_handle.c
+ *
+ * \brief Get the resource handle for a given \ref libsat_xor_matrix instance.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+/**
+ * \brief Given a \ref libsat_xor_matrix instance, return the resource handle
+ * for this instance.
+ *
+ * \param matrix        The \ref libsat_xor_matrix instance from which the
+ *                      resource handle is returned.
+ *
+ * \returns the resource handle for this matrix instance.
+ */
+RCPR_SYM(resource)*
+LIBSAT_SYM(libsat_xor_matrix_resource_handle)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    return &matrix->hdr;
+}
@@ -0,0 +1,78 @@
+/**
+ * \file xor/libsat_xor_matrix_resource_release.c
+ *
+ * \brief Release the resources associated with a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+
+/* forward decls. */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval);
+
+/**
+ * \brief Release a \ref libsat_xor_matrix resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_resource_release)(
+    RCPR_SYM(resource)* r)
+{
+    status retval = STATUS_SUCCESS;
+    libsat_xor_matrix* matrix = (libsat_xor_matrix*)r;
+
+    /* cache allocator. */
+    allocator* alloc = matrix->alloc;
+
+    /* reclaim arrays. */
+    retval = reclaim_if_set(alloc, matrix->rows, retval);
+    retval = reclaim_if_set(alloc, matrix->column_variable, retval);
+    retval = reclaim_if_set(alloc, matrix->variable_column, retval);
+    retval = reclaim_if_set(alloc, matrix->work, retval);
+    retval = reclaim_if_set(alloc, matrix->work_pivot, retval);
+    retval = reclaim_if_set(alloc, matrix->unassigned_mask, retval);
+    retval = reclaim_if_set(alloc, matrix->true_mask, retval);
+
+    /* reclaim structure. */
+    retval = reclaim_if_set(alloc, matrix, retval);
+
+    /* return decoded status. */
+    return retval;
+}
+
+/**
+ * \brief Reclaim memory if it is set, updating the status on error.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param memory        The memory to reclaim, or NULL.
+ * \param retval        The status so far.
+ *
+ * \returns the updated status.
+ */
+static status reclaim_if_set(allocator* alloc, void* memory, status retval)
+{
+    status release_retval;
+
+    if (NULL == memory)
+    {
+        return retval;
+    }
+
+    release_retval = allocator_reclaim(alloc, memory);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        return release_retval;
+    }
+
+    return retval;
+}
@@ -0,0 +1,24 @@
+/**
+ * \file xor/libsat_xor_matrix_row_count.c
+ *
+ * \brief Get the number of rows in a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+/**
+ * \brief Get the number of rows in the matrix.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns the number of rows in this matrix.
+ */
+size_t
+LIBSAT_SYM(libsat_xor_matrix_row_count)(
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    return matrix->row_count;
+}
@@ -0,0 +1,287 @@
+/**
+ * \file xor/xor_internal.h
+ *
+ * \brief Internal details for native parity constraints.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#pragma once
+
+#include <libsat/xor.h>
+#include <rcpr/allocator.h>
+#include <rcpr/resource.h>
+#include <rcpr/resource/protected.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+extern "C" {
+# endif /*__cplusplus*/
+
+/**
+ * \brief Bit index of the parity in each row. Column c is stored at bit c + 1,
+ * so that a single row xor also updates the parity.
+ */
+#define LIBSAT_XOR_PARITY_BIT                                               0
+
+/**
+ * \brief Sentinel for a variable without a column.
+ */
+#define LIBSAT_XOR_NO_COLUMN                                     ((size_t)-1)
+
+/**
+ * \brief libsat_xor_matrix implementation.
+ */
+struct LIBSAT_SYM(libsat_xor_matrix)
+{
+    RCPR_SYM(resource) hdr;
+    RCPR_SYM(allocator)* alloc;
+    uint64_t* rows;
+    size_t row_count;
+    size_t row_capacity;
+    size_t row_words;
+    size_t* column_variable;
+    size_t column_count;
+    size_t column_capacity;
+    size_t* variable_column;
+    size_t variable_capacity;
+    uint64_t* work;
+    size_t work_capacity;
+    size_t* work_pivot;
+    size_t work_pivot_count;
+    size_t work_conflict_row;
+    uint64_t* unassigned_mask;
+    uint64_t* true_mask;
+    size_t mask_words;
+};
+
+/******************************************************************************/
+/* Start of row operations.                                                   */
+/******************************************************************************/
+
+/**
+ * \brief Get the given bit of a row.
+ */
+static inline bool xor_row_test(const uint64_t* row, size_t bit)
+{
+    return 0 != ((row[bit / 64] >> (bit % 64)) & 1);
+}
+
+/**
+ * \brief Toggle the given bit of a row.
+ */
+static inline void xor_row_toggle(uint64_t* row, size_t bit)
+{
+    row[bit / 64] ^= ((uint64_t)1) << (bit % 64);
+}
+
+/**
+ * \brief Add the source row to the destination row over GF(2).
+ *
+ * \note This is written as a straight loop over independent words so that the
+ * compiler can vectorize it; rows never alias.
+ */
+static inline void xor_row_xor(
+    uint64_t* restrict dst, const uint64_t* restrict src, size_t words)
+{
+    for (size_t i = 0; i < words; ++i)
+    {
+        dst[i] ^= src[i];
+    }
+}
+
+/**
+ * \brief Count the bits set in both a row and a mask.
+ */
+static inline size_t xor_row_count_masked(
+    const uint64_t* row, const uint64_t* mask, size_t words)
+{
+    size_t count = 0;
+
+    for (size_t i = 0; i < words; ++i)
+    {
+        count += (size_t)__builtin_popcountll(row[i] & mask[i]);
+    }
+
+    return count;
+}
+
+/******************************************************************************/
+/* Start of constructors.                                                     */
+/******************************************************************************/
+
+/**
+ * \brief Release a \ref libsat_xor_matrix resource.
+ *
+ * \param r             The resource to release.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(libsat_xor_matrix_resource_release)(
+    RCPR_SYM(resource)* r);
+
+/******************************************************************************/
+/* Start of private methods.                                                  */
+/******************************************************************************/
+
+/**
+ * \brief Get the column for a variable, creating it if necessary.
+ *
+ * \note Creating a column may widen every row in the matrix, which invalidates
+ * any row pointers held by the caller.
+ *
+ * \param column        Pointer to receive the column index on success.
+ * \param matrix        The matrix for this operation.
+ * \param var_id        The variable id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_column_get)(
+    size_t* column, LIBSAT_SYM(libsat_xor_matrix)* matrix, size_t var_id);
+
+/**
+ * \brief Append an all-zero row to the matrix.
+ *
+ * \param row           Pointer to receive the new row on success.
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_row_append)(
+    uint64_t** row, LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Copy the rows and columns of a matrix.
+ *
+ * \param clone         Pointer to receive the copy on success.
+ * \param matrix        The matrix to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_clone)(
+    LIBSAT_SYM(libsat_xor_matrix)** clone,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix);
+
+/**
+ * \brief Reduce a working copy of the matrix under a partial assignment.
+ *
+ * On success, the first work_pivot_count rows of the work matrix each have a
+ * distinct unassigned pivot column recorded in work_pivot, and the remaining
+ * rows have no unassigned columns. The unassigned_mask and true_mask words
+ * describe the assignment in row layout.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param values        The current assignment, indexed by variable id.
+ * \param value_count   The number of entries in \p values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_reduce)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, const uint8_t* values,
+    size_t value_count);
+
+/**
+ * \brief Explain a literal implied by the most recent propagation, or the
+ * conflict it found.
+ *
+ * The explanation is a clause that follows from the matrix: the literal
+ * itself, plus the false literal of every other variable in the reduced row
+ * that implied it. For a conflict, the clause consists only of false
+ * literals.
+ *
+ * \param clause        Array to receive the clause. This must have room for
+ *                      one literal per column of the matrix.
+ * \param count         Pointer to receive the number of literals written.
+ * \param matrix        The matrix for this operation.
+ * \param values        The assignment passed to the most recent propagation.
+ * \param value_count   The number of entries in \p values.
+ * \param lit           The implied literal to explain, or LIBSAT_XOR_NO_COLUMN
+ *                      to explain the conflict.
+ */
+void
+LIBSAT_SYM(xor_matrix_explain)(
+    LIBSAT_SYM(libsat_literal)* clause, size_t* count,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix, const uint8_t* values,
+    size_t value_count, LIBSAT_SYM(libsat_literal) lit);
+
+/**
+ * \brief Drop the rows and columns added to a matrix since it had the given
+ * size.
+ *
+ * The variables of the dropped columns are unmapped, so that they get new
+ * columns if they are used again.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param row_count     The number of rows to keep.
+ * \param column_count  The number of columns to keep.
+ */
+void
+LIBSAT_SYM(xor_matrix_truncate)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, size_t row_count,
+    size_t column_count);
+
+/******************************************************************************/
+/* Start of private exports.                                                  */
+/******************************************************************************/
+#define __INTERNAL_LIBSAT_IMPORT_xor_internal_sym(sym) \
+    LIBSAT_BEGIN_EXPORT \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## libsat_xor_matrix_resource_release( \
+        RCPR_SYM(resource)* x) { \
+            return LIBSAT_SYM(libsat_xor_matrix_resource_release)(x); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## xor_matrix_column_get( \
+        size_t* x, LIBSAT_SYM(libsat_xor_matrix)* y, size_t z) { \
+            return LIBSAT_SYM(xor_matrix_column_get)(x,y,z); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## xor_matrix_row_append( \
+        uint64_t** x, LIBSAT_SYM(libsat_xor_matrix)* y) { \
+            return LIBSAT_SYM(xor_matrix_row_append)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## xor_matrix_clone( \
+        LIBSAT_SYM(libsat_xor_matrix)** x, \
+        const LIBSAT_SYM(libsat_xor_matrix)* y) { \
+            return LIBSAT_SYM(xor_matrix_clone)(x,y); } \
+    static inline status FN_DECL_MUST_CHECK \
+    sym ## xor_matrix_reduce( \
+        LIBSAT_SYM(libsat_xor_matrix)* x, const uint8_t* y, size_t z) { \
+            return LIBSAT_SYM(xor_matrix_reduce)(x,y,z); } \
+    static inline void \
+    sym ## xor_matrix_explain( \
+        LIBSAT_SYM(libsat_literal)* u, size_t* v, \
+        const LIBSAT_SYM(libsat_xor_matrix)* w, const uint8_t* x, size_t y, \
+        LIBSAT_SYM(libsat_literal) z) { \
+            LIBSAT_SYM(xor_matrix_explain)(u,v,w,x,y,z); } \
+    static inline void \
+    sym ## xor_matrix_truncate( \
+        LIBSAT_SYM(libsat_xor_matrix)* x, size_t y, size_t z) { \
+            LIBSAT_SYM(xor_matrix_truncate)(x,y,z); } \
+    LIBSAT_END_EXPORT \
+    REQUIRE_SEMICOLON_HERE
+#define LIBSAT_IMPORT_xor_internal_as(sym) \
+    __INTERNAL_LIBSAT_IMPORT_xor_internal_sym(sym ## _)
+#define LIBSAT_IMPORT_xor_internal \
+    __INTERNAL_LIBSAT_IMPORT_xor_internal_sym()
+
+/* C++ compatibility. */
+# ifdef   __cplusplus
+}
+# endif /*__cplusplus*/
@@ -0,0 +1,148 @@
+/**
+ * \file xor/xor_matrix_clone.c
+ *
+ * \brief Copy a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <rcpr/vtable.h>
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_xor;
+LIBSAT_IMPORT_xor_internal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+/* forward decls. */
+static status copy_array(
+    allocator* alloc, void** dst, const void* src, size_t size);
+
+/* the vtable entry for a cloned libsat_xor_matrix instance. */
+RCPR_VTABLE
+resource_vtable libsat_xor_matrix_clone_vtable = {
+    &libsat_xor_matrix_resource_release };
+
+/**
+ * \brief Copy the rows and columns of a matrix.
+ *
+ * The copy has its own work space, so that it can be propagated on another
+ * thread while the original is in use.
+ *
+ * \param clone         Pointer to receive the copy on success.
+ * \param matrix        The matrix to copy.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_clone)(
+    LIBSAT_SYM(libsat_xor_matrix)** clone,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval, release_retval;
+    libsat_xor_matrix* tmp;
+
+    /* allocate memory for this instance. */
+    retval = allocator_allocate(matrix->alloc, (void**)&tmp, sizeof(*tmp));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* clear memory. */
+    memset(tmp, 0, sizeof(*tmp));
+
+    /* initialize resource. */
+    resource_init(&tmp->hdr, &libsat_xor_matrix_clone_vtable);
+
+    /* copy the shape; the work space is built on first use. */
+    tmp->alloc = matrix->alloc;
+    tmp->row_count = matrix->row_count;
+    tmp->row_capacity = matrix->row_capacity;
+    tmp->row_words = matrix->row_words;
+    tmp->column_count = matrix->column_count;
+    tmp->column_capacity = matrix->column_capacity;
+    tmp->variable_capacity = matrix->variable_capacity;
+
+    retval =
+        copy_array(
+            tmp->alloc, (void**)&tmp->rows, matrix->rows,
+            matrix->row_capacity * matrix->row_words * sizeof(uint64_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    retval =
+        copy_array(
+            tmp->alloc, (void**)&tmp->column_variable, matrix->column_variable,
+            matrix->column_capacity * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    retval =
+        copy_array(
+            tmp->alloc, (void**)&tmp->variable_column, matrix->variable_column,
+            matrix->variable_capacity * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        goto cleanup_tmp;
+    }
+
+    /* success. */
+    *clone = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+cleanup_tmp:
+    release_retval = resource_release(&tmp->hdr);
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Copy an array, leaving the destination NULL if the source is empty.
+ *
+ * \param alloc         The allocator to use for this operation.
+ * \param dst           Pointer to receive the copy.
+ * \param src           The array to copy, or NULL.
+ * \param size          The size of the array in bytes.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status copy_array(
+    allocator* alloc, void** dst, const void* src, size_t size)
+{
+    status retval;
+
+    if (NULL == src || 0 == size)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    retval = memory_resize(alloc, dst, size);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    memcpy(*dst, src, size);
+
+    return STATUS_SUCCESS;
+}
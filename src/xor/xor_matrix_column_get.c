@@ -0,0 +1,215 @@
+/**
+ * \file xor/xor_matrix_column_get.c
+ *
+ * \brief Get or create the column for a variable in a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status grow_variable_map(libsat_xor_matrix* matrix, size_t var_id);
+static status grow_columns(libsat_xor_matrix* matrix);
+static status widen_rows(libsat_xor_matrix* matrix);
+
+/**
+ * \brief Get the column for a variable, creating it if necessary.
+ *
+ * \note Creating a column may widen every row in the matrix, which invalidates
+ * any row pointers held by the caller.
+ *
+ * \param column        Pointer to receive the column index on success.
+ * \param matrix        The matrix for this operation.
+ * \param var_id        The variable id.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_column_get)(
+    size_t* column, LIBSAT_SYM(libsat_xor_matrix)* matrix, size_t var_id)
+{
+    status retval;
+
+    /* is this variable already mapped? */
+    if (
+        var_id < matrix->variable_capacity
+     && LIBSAT_XOR_NO_COLUMN != matrix->variable_column[var_id])
+    {
+        *column = matrix->variable_column[var_id];
+        retval = STATUS_SUCCESS;
+        goto done;
+    }
+
+    /* make room in the variable map. */
+    retval = grow_variable_map(matrix, var_id);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* make room in the column map. */
+    if (matrix->column_count == matrix->column_capacity)
+    {
+        retval = grow_columns(matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* make room in each row; bit 0 is reserved for the parity. */
+    if (matrix->column_count + 1 >= matrix->row_words * 64)
+    {
+        retval = widen_rows(matrix);
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+    }
+
+    /* map the new column. */
+    matrix->column_variable[matrix->column_count] = var_id;
+    matrix->variable_column[var_id] = matrix->column_count;
+    *column = matrix->column_count;
+    matrix->column_count += 1;
+
+    /* success. */
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Grow the variable to column map so that it covers the given id.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param var_id        The variable id that must be covered.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status grow_variable_map(libsat_xor_matrix* matrix, size_t var_id)
+{
+    status retval;
+    size_t capacity;
+
+    if (var_id < matrix->variable_capacity)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    /* double the capacity, or jump straight to this variable. */
+    capacity = 2 * matrix->variable_capacity;
+    if (capacity <= var_id)
+    {
+        capacity = var_id + 1;
+    }
+
+    retval =
+        memory_resize(
+            matrix->alloc, (void**)&matrix->variable_column,
+            capacity * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* new entries have no column. */
+    for (size_t i = matrix->variable_capacity; i < capacity; ++i)
+    {
+        matrix->variable_column[i] = LIBSAT_XOR_NO_COLUMN;
+    }
+
+    matrix->variable_capacity = capacity;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the capacity of the column to variable map.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status grow_columns(libsat_xor_matrix* matrix)
+{
+    status retval;
+    size_t capacity =
+        (0 == matrix->column_capacity) ? 64 : 2 * matrix->column_capacity;
+
+    retval =
+        memory_resize(
+            matrix->alloc, (void**)&matrix->column_variable,
+            capacity * sizeof(size_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    matrix->column_capacity = capacity;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Double the width of every row in the matrix.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status widen_rows(libsat_xor_matrix* matrix)
+{
+    status retval;
+    size_t old_words = matrix->row_words;
+    size_t new_words = 2 * old_words;
+
+    /* nothing to copy if there are no rows yet. */
+    if (0 == matrix->row_capacity)
+    {
+        matrix->row_words = new_words;
+        return STATUS_SUCCESS;
+    }
+
+    retval =
+        memory_resize(
+            matrix->alloc, (void**)&matrix->rows,
+            matrix->row_capacity * new_words * sizeof(uint64_t));
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    /* spread the rows out from the back, so that no row is overwritten before
+     * it has been moved. */
+    for (size_t i = matrix->row_count; i > 0; --i)
+    {
+        uint64_t* src = matrix->rows + (i - 1) * old_words;
+        uint64_t* dst = matrix->rows + (i - 1) * new_words;
+
+        memmove(dst, src, old_words * sizeof(uint64_t));
+        memset(dst + old_words, 0, (new_words - old_words) * sizeof(uint64_t));
+    }
+
+    matrix->row_words = new_words;
+
+    return STATUS_SUCCESS;
+}
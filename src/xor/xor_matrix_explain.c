@@ -0,0 +1,81 @@
+/**
+ * \file xor/xor_matrix_explain.c
+ *
+ * \brief Explain the most recent propagation of a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_literal;
+
+/**
+ * \brief Explain a literal implied by the most recent propagation, or the
+ * conflict it found.
+ *
+ * \param clause        Array to receive the clause.
+ * \param count         Pointer to receive the number of literals written.
+ * \param matrix        The matrix for this operation.
+ * \param values        The assignment passed to the most recent propagation.
+ * \param value_count   The number of entries in \p values.
+ * \param lit           The implied literal to explain, or LIBSAT_XOR_NO_COLUMN
+ *                      to explain the conflict.
+ */
+void
+LIBSAT_SYM(xor_matrix_explain)(
+    LIBSAT_SYM(libsat_literal)* clause, size_t* count,
+    const LIBSAT_SYM(libsat_xor_matrix)* matrix, const uint8_t* values,
+    size_t value_count, LIBSAT_SYM(libsat_literal) lit)
+{
+    size_t words = matrix->row_words;
+    size_t row = matrix->work_conflict_row;
+    size_t implied_var = LIBSAT_XOR_NO_COLUMN;
+    const uint64_t* work;
+    size_t out = 0;
+
+    /* find the pivot row of the implied variable. */
+    if (LIBSAT_XOR_NO_COLUMN != lit)
+    {
+        size_t column;
+
+        implied_var = LIBSAT_LITERAL_VARIABLE(lit);
+        column = matrix->variable_column[implied_var];
+
+        for (row = 0; row < matrix->work_pivot_count; ++row)
+        {
+            if (matrix->work_pivot[row] == column)
+            {
+                break;
+            }
+        }
+    }
+
+    /* every other variable in the row is assigned; take its false literal. */
+    work = matrix->work + row * words;
+    for (size_t column = 0; column < matrix->column_count; ++column)
+    {
+        size_t var_id;
+
+        if (!xor_row_test(work, column + 1))
+        {
+            continue;
+        }
+
+        var_id = matrix->column_variable[column];
+        if (var_id == implied_var)
+        {
+            clause[out++] = lit;
+        }
+        else
+        {
+            bool value_true =
+                var_id < value_count && LIBSAT_VALUE_TRUE == values[var_id];
+
+            clause[out++] = LIBSAT_LITERAL_MAKE(var_id, value_true);
+        }
+    }
+
+    *count = out;
+}
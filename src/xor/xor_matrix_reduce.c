@@ -0,0 +1,240 @@
+/**
+ * \file xor/xor_matrix_reduce.c
+ *
+ * \brief Reduce a working copy of a \ref libsat_xor_matrix under a partial
+ * assignment.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_xor;
+
+/* forward decls. */
+static status ensure_work_capacity(libsat_xor_matrix* matrix);
+static void build_masks(
+    libsat_xor_matrix* matrix, const uint8_t* values, size_t value_count);
+static void swap_rows(uint64_t* lhs, uint64_t* rhs, size_t words);
+
+/**
+ * \brief Reduce a working copy of the matrix under a partial assignment.
+ *
+ * On success, the first work_pivot_count rows of the work matrix each have a
+ * distinct unassigned pivot column recorded in work_pivot, and the remaining
+ * rows have no unassigned columns. The unassigned_mask and true_mask words
+ * describe the assignment in row layout.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param values        The current assignment, indexed by variable id.
+ * \param value_count   The number of entries in \p values.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_reduce)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, const uint8_t* values,
+    size_t value_count)
+{
+    status retval;
+    size_t words = matrix->row_words;
+    size_t pivot_row = 0;
+
+    /* make room for the working copy. */
+    retval = ensure_work_capacity(matrix);
+    if (STATUS_SUCCESS != retval)
+    {
+        goto done;
+    }
+
+    /* copy the matrix and describe the assignment. */
+    memcpy(
+        matrix->work, matrix->rows,
+        matrix->row_count * words * sizeof(uint64_t));
+    build_masks(matrix, values, value_count);
+
+    /* Gauss-Jordan elimination over the unassigned columns only. The assigned
+     * columns are carried along, so that each reduced row remains a valid
+     * combination of the original rows. */
+    for (size_t column = 0; column < matrix->column_count; ++column)
+    {
+        size_t bit = column + 1;
+        size_t found;
+        uint64_t* pivot;
+
+        if (!xor_row_test(matrix->unassigned_mask, bit))
+        {
+            continue;
+        }
+
+        /* find a row at or below the pivot row with this column set. */
+        for (found = pivot_row; found < matrix->row_count; ++found)
+        {
+            if (xor_row_test(matrix->work + found * words, bit))
+            {
+                break;
+            }
+        }
+
+        if (found == matrix->row_count)
+        {
+            continue;
+        }
+
+        /* move it into the pivot position. */
+        pivot = matrix->work + pivot_row * words;
+        if (found != pivot_row)
+        {
+            swap_rows(pivot, matrix->work + found * words, words);
+        }
+
+        /* clear this column from every other row. */
+        for (size_t i = 0; i < matrix->row_count; ++i)
+        {
+            uint64_t* row = matrix->work + i * words;
+
+            if (i != pivot_row && xor_row_test(row, bit))
+            {
+                xor_row_xor(row, pivot, words);
+            }
+        }
+
+        matrix->work_pivot[pivot_row] = column;
+        pivot_row += 1;
+    }
+
+    /* success. */
+    matrix->work_pivot_count = pivot_row;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
+
+/**
+ * \brief Make sure that the work matrix, pivot list, and masks can hold the
+ * current matrix.
+ *
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+static status ensure_work_capacity(libsat_xor_matrix* matrix)
+{
+    status retval;
+    size_t words = matrix->row_words;
+
+    /* the work matrix and pivot list track the row storage. */
+    if (
+        matrix->work_capacity < matrix->row_capacity
+     || matrix->mask_words < words)
+    {
+        retval =
+            memory_resize(
+                matrix->alloc, (void**)&matrix->work,
+                matrix->row_capacity * words * sizeof(uint64_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                matrix->alloc, (void**)&matrix->work_pivot,
+                matrix->row_capacity * sizeof(size_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        matrix->work_capacity = matrix->row_capacity;
+    }
+
+    /* the masks track the row width. */
+    if (matrix->mask_words < words)
+    {
+        retval =
+            memory_resize(
+                matrix->alloc, (void**)&matrix->unassigned_mask,
+                words * sizeof(uint64_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        retval =
+            memory_resize(
+                matrix->alloc, (void**)&matrix->true_mask,
+                words * sizeof(uint64_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+
+        matrix->mask_words = words;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * \brief Build the unassigned and true masks for an assignment.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param values        The current assignment, indexed by variable id.
+ * \param value_count   The number of entries in \p values.
+ */
+static void build_masks(
+    libsat_xor_matrix* matrix, const uint8_t* values, size_t value_count)
+{
+    memset(matrix->unassigned_mask, 0, matrix->row_words * sizeof(uint64_t));
+    memset(matrix->true_mask, 0, matrix->row_words * sizeof(uint64_t));
+
+    for (size_t column = 0; column < matrix->column_count; ++column)
+    {
+        size_t var_id = matrix->column_variable[column];
+        uint8_t value =
+            (var_id < value_count) ? values[var_id] : LIBSAT_VALUE_UNASSIGNED;
+
+        switch (value)
+        {
+            case LIBSAT_VALUE_TRUE:
+                xor_row_toggle(matrix->true_mask, column + 1);
+                break;
+
+            case LIBSAT_VALUE_FALSE:
+                break;
+
+            default:
+                xor_row_toggle(matrix->unassigned_mask, column + 1);
+                break;
+        }
+    }
+}
+
+/**
+ * \brief Swap two rows.
+ *
+ * \param lhs           The first row.
+ * \param rhs           The second row.
+ * \param words         The number of words in each row.
+ */
+static void swap_rows(uint64_t* lhs, uint64_t* rhs, size_t words)
+{
+    for (size_t i = 0; i < words; ++i)
+    {
+        uint64_t tmp = lhs[i];
+        lhs[i] = rhs[i];
+        rhs[i] = tmp;
+    }
+}
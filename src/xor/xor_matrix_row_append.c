@@ -0,0 +1,65 @@
+/**
+ * \file xor/xor_matrix_row_append.c
+ *
+ * \brief Append an empty row to a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <string.h>
+
+#include "../base/libsat_base_internal.h"
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_base_internal;
+LIBSAT_IMPORT_xor;
+
+/**
+ * \brief Append an all-zero row to the matrix.
+ *
+ * \param row           Pointer to receive the new row on success.
+ * \param matrix        The matrix for this operation.
+ *
+ * \returns a status code indicating success or failure.
+ *      - STATUS_SUCCESS on success.
+ *      - a non-zero error code on failure.
+ */
+status FN_DECL_MUST_CHECK
+LIBSAT_SYM(xor_matrix_row_append)(
+    uint64_t** row, LIBSAT_SYM(libsat_xor_matrix)* matrix)
+{
+    status retval;
+    uint64_t* tmp;
+
+    /* grow the row storage if needed. */
+    if (matrix->row_count == matrix->row_capacity)
+    {
+        size_t capacity =
+            (0 == matrix->row_capacity) ? 16 : 2 * matrix->row_capacity;
+
+        retval =
+            memory_resize(
+                matrix->alloc, (void**)&matrix->rows,
+                capacity * matrix->row_words * sizeof(uint64_t));
+        if (STATUS_SUCCESS != retval)
+        {
+            goto done;
+        }
+
+        matrix->row_capacity = capacity;
+    }
+
+    /* clear the new row. */
+    tmp = matrix->rows + matrix->row_count * matrix->row_words;
+    memset(tmp, 0, matrix->row_words * sizeof(uint64_t));
+    matrix->row_count += 1;
+
+    /* success. */
+    *row = tmp;
+    retval = STATUS_SUCCESS;
+    goto done;
+
+done:
+    return retval;
+}
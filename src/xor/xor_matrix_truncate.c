@@ -0,0 +1,45 @@
+/**
+ * \file xor/xor_matrix_truncate.c
+ *
+ * \brief Drop recent rows and columns from a \ref libsat_xor_matrix.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include "xor_internal.h"
+
+LIBSAT_IMPORT_xor;
+
+/**
+ * \brief Drop the rows and columns added to a matrix since it had the given
+ * size.
+ *
+ * The rows that are kept were added before the dropped columns existed, so
+ * they have no bits in them.
+ *
+ * \param matrix        The matrix for this operation.
+ * \param row_count     The number of rows to keep.
+ * \param column_count  The number of columns to keep.
+ */
+void
+LIBSAT_SYM(xor_matrix_truncate)(
+    LIBSAT_SYM(libsat_xor_matrix)* matrix, size_t row_count,
+    size_t column_count)
+{
+    for (size_t c = column_count; c < matrix->column_count; ++c)
+    {
+        matrix->variable_column[matrix->column_variable[c]] =
+            LIBSAT_XOR_NO_COLUMN;
+    }
+
+    if (row_count < matrix->row_count)
+    {
+        matrix->row_count = row_count;
+    }
+
+    if (column_count < matrix->column_count)
+    {
+        matrix->column_count = column_count;
+    }
+}
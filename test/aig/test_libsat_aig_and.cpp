@@ -0,0 +1,177 @@
+/**
+ * \file aig/test_libsat_aig_and.cpp
+ *
+ * \brief Unit tests for libsat_aig_and.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_aig_and);
+
+/**
+ * The same AND is only built once, in either order, and constants, repeated
+ * edges, and complementary edges are folded away.
+ */
+TEST(strash_and_folding)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    size_t a_id, b_id;
+    libsat_aig_edge a, b, ab, ba, edge;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &a_id, context, "a", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &b_id, context, "b", LIBSAT_VARIABLE_GET_DEFAULT));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&a, aig, a_id));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&b, aig, b_id));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&edge, aig, a_id));
+    TEST_EXPECT(a == edge);
+    TEST_EXPECT(a != b);
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&ab, aig, a, b));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&ba, aig, b, a));
+    TEST_EXPECT(ab == ba);
+    TEST_EXPECT(1 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&edge, aig, a, a));
+    TEST_EXPECT(a == edge);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(&edge, aig, a, LIBSAT_AIG_EDGE_NOT(a)));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_FALSE == edge);
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_and(&edge, aig, LIBSAT_AIG_EDGE_TRUE, b));
+    TEST_EXPECT(b == edge);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(&edge, aig, ab, LIBSAT_AIG_EDGE_FALSE));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_FALSE == edge);
+    TEST_EXPECT(1 == libsat_aig_and_count(aig));
+
+    /* a complemented fanin is a different AND. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(&edge, aig, a, LIBSAT_AIG_EDGE_NOT(b)));
+    TEST_EXPECT(ab != edge);
+    TEST_EXPECT(2 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An edge to a node that is not in the graph is rejected.
+ */
+TEST(bad_edge)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_edge edge;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_AIG_BAD_EDGE
+            == libsat_aig_and(
+                    &edge, aig, LIBSAT_AIG_EDGE_TRUE,
+                    LIBSAT_AIG_EDGE_MAKE(5, false)));
+    TEST_EXPECT(0 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Operators are lowered to ANDs, and negation costs nothing.
+ */
+TEST(add_ast)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_ast_node* node = nullptr;
+    libsat_aig_edge edge, list;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(&node, context, "¬¬a; a ⊻ b; b ⊻ a; a ∨ b;"));
+
+    /* the statements of the list are in reverse order. */
+    auto statement = node->value.list.head;
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, statement));
+    TEST_EXPECT(1 == libsat_aig_and_count(aig));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge));
+
+    statement = statement->next;
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, statement));
+    TEST_EXPECT(4 == libsat_aig_and_count(aig));
+
+    /* a ⊻ b shares every AND with b ⊻ a. */
+    statement = statement->next;
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, statement));
+    TEST_EXPECT(4 == libsat_aig_and_count(aig));
+
+    statement = statement->next;
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, statement));
+    TEST_EXPECT(4 == libsat_aig_and_count(aig));
+    TEST_EXPECT(!LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge));
+
+    /* the list is the AND of its statements. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_add_ast(&list, aig, node));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_TRUE != list);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
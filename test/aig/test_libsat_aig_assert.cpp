@@ -0,0 +1,265 @@
+/**
+ * \file aig/test_libsat_aig_assert.cpp
+ *
+ * \brief Unit tests for libsat_aig_assert.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_aig_assert);
+
+/**
+ * Assert an edge in a new scope, solve with the given assumptions, and close
+ * the scope.
+ */
+static int solve_edge(
+    libsat_aig* aig, libsat_context* context, libsat_aig_edge edge,
+    const libsat_literal* lits, size_t count)
+{
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    if (
+        STATUS_SUCCESS != libsat_context_push(context)
+     || STATUS_SUCCESS != libsat_aig_assert(aig, edge)
+     || STATUS_SUCCESS
+            != libsat_solve_with_assumptions(&result, context, lits, count)
+     || STATUS_SUCCESS != libsat_context_pop(context))
+    {
+        return -1;
+    }
+
+    return result;
+}
+
+/**
+ * A contradiction is unsatisfiable, and a disjunction needs one of its sides.
+ */
+TEST(unsat)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_ast_node* node = nullptr;
+    libsat_aig_edge edge;
+    libsat_literal lits[2];
+    size_t a, b;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_parse(&node, context, "a ∧ ¬a; a ∨ b;"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_add_ast(&edge, aig, node->value.list.head->next));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_FALSE == edge);
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+            == solve_edge(aig, context, edge, nullptr, 0));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_add_ast(&edge, aig, node->value.list.head));
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_SATISFIABLE
+            == solve_edge(aig, context, edge, nullptr, 0));
+
+    /* ¬a and ¬b together falsify a ∨ b. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &a, context, "a", LIBSAT_VARIABLE_GET_REF));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &b, context, "b", LIBSAT_VARIABLE_GET_REF));
+    lits[0] = LIBSAT_LITERAL_MAKE(a, true);
+    lits[1] = LIBSAT_LITERAL_MAKE(b, true);
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+            == solve_edge(aig, context, edge, lits, 2));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A frozen context is not changed, and an edge that is not in the graph is
+ * rejected.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_AIG_BAD_EDGE
+            == libsat_aig_assert(aig, LIBSAT_AIG_EDGE_MAKE(3, false)));
+
+    libsat_context_freeze(context);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_aig_assert(aig, LIBSAT_AIG_EDGE_TRUE));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * On random statements over four variables, the rewritten graph and its
+ * complement are satisfiable under exactly the assignments on which the
+ * statement is true and false, respectively.
+ */
+TEST(random_statements)
+{
+    static const char* operators[] = { " ∧ ", " ∨ ", " ⊻ ", " → ", " ↔ " };
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_ast_node* node = nullptr;
+    std::mt19937 rng(5);
+    std::string input;
+    size_t vars[4], count = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    for (int i = 0; i < 40; ++i)
+    {
+        size_t terms = 2 + rng() % 6;
+
+        for (size_t j = 0; j < terms; ++j)
+        {
+            if (j > 0)
+            {
+                input += operators[rng() % 5];
+            }
+
+            if (0 == rng() % 3)
+            {
+                input += "¬";
+            }
+
+            input += "n" + std::to_string(rng() % 4);
+        }
+
+        input += "; ";
+    }
+
+    /* every variable appears, so each is named before any is asked for. */
+    input += "n0 ∨ n1 ∨ n2 ∨ n3;";
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+
+    for (size_t v = 0; v < 4; ++v)
+    {
+        std::string name = "n" + std::to_string(v);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &vars[v], context, name.c_str(),
+                        LIBSAT_VARIABLE_GET_REF));
+        count = std::max(count, vars[v] + 1);
+    }
+
+    std::vector<const libsat_ast_node*> statements;
+    std::vector<libsat_aig_edge> roots;
+    for (auto i = node->value.list.head; nullptr != i; i = i->next)
+    {
+        libsat_aig_edge edge;
+
+        TEST_ASSERT(STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, i));
+        statements.push_back(i);
+        roots.push_back(edge);
+    }
+
+    size_t before = libsat_aig_and_count(aig);
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_rewrite(aig, roots.data(), roots.size()));
+    TEST_EXPECT(libsat_aig_and_count(aig) <= before);
+
+    for (size_t i = 0; i < statements.size(); ++i)
+    {
+        for (unsigned m = 0; m < 16; ++m)
+        {
+            uint64_t assignment = 0;
+            libsat_literal lits[4];
+            bool value;
+
+            for (size_t v = 0; v < 4; ++v)
+            {
+                assignment |= (uint64_t)((m >> v) & 1) << vars[v];
+                lits[v] = LIBSAT_LITERAL_MAKE(vars[v], 0 == ((m >> v) & 1));
+            }
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_ast_evaluate(
+                            &value, statements[i], &assignment, count));
+            TEST_EXPECT(
+                (value
+                    ? LIBSAT_SOLVE_RESULT_SATISFIABLE
+                    : LIBSAT_SOLVE_RESULT_UNSATISFIABLE)
+                        == solve_edge(aig, context, roots[i], lits, 4));
+            TEST_EXPECT(
+                (value
+                    ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+                    : LIBSAT_SOLVE_RESULT_SATISFIABLE)
+                        == solve_edge(
+                                aig, context, LIBSAT_AIG_EDGE_NOT(roots[i]),
+                                lits, 4));
+        }
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,238 @@
+/**
+ * \file aig/test_libsat_aig_read_aiger.cpp
+ *
+ * \brief Unit tests for libsat_aig_read_aiger.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string>
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_aig_read_aiger);
+
+/**
+ * Read AIGER data from a string.
+ */
+static status read(
+    libsat_aig_circuit* circuit, libsat_aig* aig, const std::string& data)
+{
+    return
+        libsat_aig_read_aiger(
+            circuit, aig, (const uint8_t*)data.data(), data.size());
+}
+
+/**
+ * Get the variable of a name, or -1 if it does not exist.
+ */
+static size_t variable(libsat_context* context, const char* name)
+{
+    size_t var_id;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * The ASCII and binary forms of an AND read to the same named circuit.
+ */
+TEST(and_gate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+    libsat_aig_edge x, y, o;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == read(
+                    &circuit, aig,
+                    "aag 3 2 0 1 1\n2\n4\n6\n6 2 4\n"
+                    "i0 x\ni1 y\no0 o\nc\nan AND gate\n"));
+    TEST_ASSERT(2 == circuit.input_count);
+    TEST_ASSERT(0 == circuit.latch_count);
+    TEST_ASSERT(1 == circuit.output_count);
+    TEST_EXPECT(variable(context, "x") == circuit.inputs[0]);
+    TEST_EXPECT(variable(context, "y") == circuit.inputs[1]);
+    TEST_EXPECT(variable(context, "o") == circuit.output_names[0]);
+    TEST_EXPECT(1 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&x, aig, circuit.inputs[0]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&y, aig, circuit.inputs[1]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&o, aig, x, y));
+    TEST_EXPECT(o == circuit.outputs[0]);
+
+    /* the binary form has implicit inputs and delta-compressed ANDs. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == read(
+                    &circuit, aig,
+                    std::string("aig 3 2 0 1 1\n6\n\x02\x02i0 x\ni1 y\n", 28)));
+    TEST_EXPECT(variable(context, "x") == circuit.inputs[0]);
+    TEST_EXPECT(variable(context, "y") == circuit.inputs[1]);
+    TEST_EXPECT(LIBSAT_AIG_NO_VARIABLE == circuit.output_names[0]);
+    TEST_EXPECT(o == circuit.outputs[0]);
+    TEST_EXPECT(1 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * ASCII ANDs may be listed before their fanins are defined.
+ */
+TEST(half_adder)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+    libsat_aig_edge x, y, c, n, s;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == read(
+                    &circuit, aig,
+                    "aag 7 2 0 2 3\n2\n4\n6\n12\n6 13 15\n12 2 4\n14 3 5\n"
+                    "i0 x\ni1 y\no0 s\no1 c\n"));
+    TEST_EXPECT(3 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&x, aig, circuit.inputs[0]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&y, aig, circuit.inputs[1]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&c, aig, x, y));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(
+                    &n, aig, LIBSAT_AIG_EDGE_NOT(x), LIBSAT_AIG_EDGE_NOT(y)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(
+                    &s, aig, LIBSAT_AIG_EDGE_NOT(c), LIBSAT_AIG_EDGE_NOT(n)));
+    TEST_EXPECT(s == circuit.outputs[0]);
+    TEST_EXPECT(c == circuit.outputs[1]);
+    TEST_EXPECT(3 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A latch is an input variable, with its next state as an edge.
+ */
+TEST(toggle)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+    libsat_aig_edge q;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == read(&circuit, aig, "aag 1 0 1 2 0\n2 3 0\n2\n3\n"));
+    TEST_ASSERT(0 == circuit.input_count);
+    TEST_ASSERT(1 == circuit.latch_count);
+    TEST_ASSERT(2 == circuit.output_count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_input(&q, aig, circuit.latches[0]));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_NOT(q) == circuit.next[0]);
+    TEST_EXPECT(q == circuit.outputs[0]);
+    TEST_EXPECT(LIBSAT_AIG_EDGE_NOT(q) == circuit.outputs[1]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Malformed data, and features that can't be read, are rejected.
+ */
+TEST(bad_format)
+{
+    static const char* inputs[] = {
+        "aac 0 0 0 0 0\n",
+        "abg 1 1 0 0 0\n2\n",
+        "aag 1 1 0 0\n2\n",
+        "aag 1 1 0 0 0 1\n2\n",
+        "aag 1 1 0 0 0\n3\n",
+        "aag 1 2 0 0 0\n2\n2\n",
+        "aag 1 0 1 0 0\n2 2 1\n",
+        "aag 2 1 0 1 1\n2\n4\n4 4 2\n",
+        "aag 2 1 0 1 0\n2\n4\n",
+        "aag 1 1 0 1 0\n2\n4\n",
+        "aag 1 1 0 0 0\n2\ni1 x\n",
+        "aag 1 1 0 0 0\n2\nx0 x\n",
+        "aig 2 1 0 1 1\n4\n",
+        "aig 2 1 0 1 1\n4\n\x05\x01",
+        "aig 2 1 0 1 1\n4\n\x02\x03",
+        "aig 3 1 0 0 1\n",
+    };
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    for (auto input : inputs)
+    {
+        TEST_EXPECT(ERROR_LIBSAT_AIG_BAD_FORMAT == read(&circuit, aig, input));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,163 @@
+/**
+ * \file aig/test_libsat_aig_rewrite.cpp
+ *
+ * \brief Unit tests for libsat_aig_rewrite.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_aig_rewrite);
+
+/**
+ * Parse a single statement, add it to the graph, and rewrite the graph from
+ * it.
+ */
+static status add_and_rewrite(
+    libsat_aig_edge* edge, libsat_aig* aig, libsat_context* context,
+    const char* input)
+{
+    libsat_ast_node* node = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&node, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_aig_add_ast(edge, aig, node);
+    if (STATUS_SUCCESS == retval)
+    {
+        retval = libsat_aig_rewrite(aig, edge, 1);
+    }
+
+    release_retval = resource_release(libsat_ast_node_resource_handle(node));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the input edge for a named variable.
+ */
+static libsat_aig_edge input(
+    libsat_aig* aig, libsat_context* context, const char* name)
+{
+    size_t var_id;
+    libsat_aig_edge edge = LIBSAT_AIG_EDGE_FALSE;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF)
+     || STATUS_SUCCESS != libsat_aig_input(&edge, aig, var_id))
+    {
+        return LIBSAT_AIG_EDGE_FALSE;
+    }
+
+    return edge;
+}
+
+/**
+ * Redundant logic over a small cut collapses to a wire.
+ */
+TEST(collapse_to_wire)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_edge edge;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == add_and_rewrite(&edge, aig, context, "a ∧ b ∨ a ∧ ¬b;"));
+    TEST_EXPECT(0 == libsat_aig_and_count(aig));
+    TEST_EXPECT(input(aig, context, "a") == edge);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == add_and_rewrite(&edge, aig, context, "a ⊻ b ⊻ a;"));
+    TEST_EXPECT(0 == libsat_aig_and_count(aig));
+    TEST_EXPECT(input(aig, context, "b") == edge);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == add_and_rewrite(&edge, aig, context, "a → b ∨ a;"));
+    TEST_EXPECT(0 == libsat_aig_and_count(aig));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_TRUE == edge);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Logic that is already small is kept, and nodes that no root needs are
+ * dropped.
+ */
+TEST(keep_and_drop)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_ast_node* node = nullptr;
+    libsat_aig_edge edge, unused;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_parse(&node, context, "c ∧ d; a ⊻ b;"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_add_ast(&edge, aig, node->value.list.head));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_add_ast(
+                    &unused, aig, node->value.list.head->next));
+    TEST_EXPECT(4 == libsat_aig_and_count(aig));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_rewrite(aig, &edge, 1));
+    TEST_EXPECT(3 == libsat_aig_and_count(aig));
+    TEST_EXPECT(LIBSAT_AIG_EDGE_IS_COMPLEMENTED(edge));
+
+    /* the unused AND is gone. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_AIG_BAD_EDGE == libsat_aig_rewrite(aig, &unused, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,337 @@
+/**
+ * \file aig/test_libsat_aig_write_aiger.cpp
+ *
+ * \brief Unit tests for libsat_aig_write_aiger.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_aig;
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_aig_write_aiger);
+
+/**
+ * Write a circuit to a string.
+ */
+static std::string write(
+    libsat_aig* aig, const libsat_aig_circuit* circuit, bool binary)
+{
+    const uint8_t* data;
+    size_t size;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_aig_write_aiger(&data, &size, aig, circuit, binary))
+    {
+        return "";
+    }
+
+    return std::string((const char*)data, size);
+}
+
+/**
+ * Get the variable of a name, creating it if needed.
+ */
+static size_t variable(libsat_context* context, const char* name)
+{
+    size_t var_id;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_DEFAULT))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * An AND is written with its names, and its binary form with deltas.
+ */
+TEST(and_gate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+    libsat_aig_edge x, y, o;
+    size_t inputs[2], names[1];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    inputs[0] = variable(context, "x");
+    inputs[1] = variable(context, "y");
+    names[0] = variable(context, "o");
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&x, aig, inputs[0]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&y, aig, inputs[1]));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&o, aig, y, x));
+
+    circuit.inputs = inputs;
+    circuit.input_count = 2;
+    circuit.latches = nullptr;
+    circuit.next = nullptr;
+    circuit.latch_count = 0;
+    circuit.outputs = &o;
+    circuit.output_names = names;
+    circuit.output_count = 1;
+
+    TEST_EXPECT(
+        "aag 3 2 0 1 1\n2\n4\n6\n6 4 2\ni0 x\ni1 y\no0 o\n"
+            == write(aig, &circuit, false));
+    TEST_EXPECT(
+        std::string("aig 3 2 0 1 1\n6\n\x02\x02i0 x\ni1 y\no0 o\n", 33)
+            == write(aig, &circuit, true));
+
+    /* inputs are numbered in the order given, and outputs can be unnamed. */
+    inputs[0] = variable(context, "y");
+    inputs[1] = variable(context, "x");
+    o = LIBSAT_AIG_EDGE_NOT(o);
+    circuit.output_names = nullptr;
+    TEST_EXPECT(
+        "aag 3 2 0 1 1\n2\n4\n7\n6 4 2\ni0 y\ni1 x\n"
+            == write(aig, &circuit, false));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Writing what was read gives the same data back, in either format, and the
+ * binary format is smaller.
+ */
+TEST(round_trip)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig* copy;
+    libsat_ast_node* node = nullptr;
+    libsat_aig_circuit circuit, read;
+    std::vector<libsat_aig_edge> outputs;
+    std::vector<size_t> inputs;
+    size_t latches[1];
+    libsat_aig_edge next[1];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(
+                    &node, context,
+                    "a ∧ b ∨ ¬c; c ⊻ d ⊻ e ↔ a; e → ¬a ∧ b ∨ q; "
+                    "d ∧ e ∧ a ∧ ¬b ⊻ c;"));
+
+    for (auto i = node->value.list.head; nullptr != i; i = i->next)
+    {
+        libsat_aig_edge edge;
+
+        TEST_ASSERT(STATUS_SUCCESS == libsat_aig_add_ast(&edge, aig, i));
+        outputs.push_back(edge);
+    }
+
+    for (auto name : { "a", "b", "c", "d", "e" })
+    {
+        inputs.push_back(variable(context, name));
+    }
+
+    /* q is a latch that remembers whether a held. */
+    latches[0] = variable(context, "q");
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&next[0], aig, inputs[0]));
+
+    circuit.inputs = inputs.data();
+    circuit.input_count = inputs.size();
+    circuit.latches = latches;
+    circuit.next = next;
+    circuit.latch_count = 1;
+    circuit.outputs = outputs.data();
+    circuit.output_names = nullptr;
+    circuit.output_count = outputs.size();
+
+    for (bool binary : { false, true })
+    {
+        std::string data = write(aig, &circuit, binary);
+        TEST_ASSERT(!data.empty());
+
+        TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&copy, context));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_aig_read_aiger(
+                        &read, copy, (const uint8_t*)data.data(),
+                        data.size()));
+        TEST_EXPECT(read.input_count == inputs.size());
+        TEST_EXPECT(1 == read.latch_count);
+        TEST_EXPECT(latches[0] == read.latches[0]);
+        TEST_EXPECT(read.output_count == outputs.size());
+        TEST_EXPECT(data == write(copy, &read, binary));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_aig_resource_handle(copy)));
+    }
+
+    TEST_EXPECT(
+        write(aig, &circuit, true).size()
+            < write(aig, &circuit, false).size());
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Deltas too large for one byte take several, and unnamed inputs are written
+ * without a symbol.
+ */
+TEST(wide)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig* copy;
+    libsat_aig_circuit circuit, read;
+    libsat_aig_edge input, chain, output;
+    size_t inputs[200];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    /* the last AND reaches back past every other AND to the first input. */
+    chain = LIBSAT_AIG_EDGE_TRUE;
+    for (size_t i = 0; i < 200; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &inputs[i], context, nullptr,
+                        LIBSAT_VARIABLE_GET_CREATE
+                            | LIBSAT_VARIABLE_GET_UNIQUE));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_aig_input(&input, aig, inputs[i]));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_aig_and(&chain, aig, chain, input));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&input, aig, inputs[0]));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_and(
+                    &output, aig, LIBSAT_AIG_EDGE_NOT(chain),
+                    LIBSAT_AIG_EDGE_NOT(input)));
+
+    circuit.inputs = inputs;
+    circuit.input_count = 200;
+    circuit.latches = nullptr;
+    circuit.next = nullptr;
+    circuit.latch_count = 0;
+    circuit.outputs = &output;
+    circuit.output_names = nullptr;
+    circuit.output_count = 1;
+
+    std::string data = write(aig, &circuit, true);
+    TEST_ASSERT(!data.empty());
+    TEST_EXPECT(std::string::npos == data.find('i', data.size() - 8));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&copy, context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_aig_read_aiger(
+                    &read, copy, (const uint8_t*)data.data(), data.size()));
+    TEST_EXPECT(200 == read.input_count);
+    TEST_EXPECT(200 == libsat_aig_and_count(copy));
+    TEST_EXPECT(data == write(copy, &read, true));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(copy)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Every edge must be in the graph, and every input node that the circuit
+ * needs must be an input or a latch.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_aig* aig;
+    libsat_aig_circuit circuit;
+    libsat_aig_edge x, y, o;
+    size_t inputs[1];
+    const uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_create(&aig, context));
+
+    inputs[0] = variable(context, "x");
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_input(&x, aig, inputs[0]));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_aig_input(&y, aig, variable(context, "y")));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_aig_and(&o, aig, x, y));
+
+    circuit.inputs = inputs;
+    circuit.input_count = 1;
+    circuit.latches = nullptr;
+    circuit.next = nullptr;
+    circuit.latch_count = 0;
+    circuit.outputs = &o;
+    circuit.output_names = nullptr;
+    circuit.output_count = 1;
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_AIG_UNBOUND_INPUT
+            == libsat_aig_write_aiger(&data, &size, aig, &circuit, false));
+
+    o = LIBSAT_AIG_EDGE_MAKE(9, false);
+    TEST_EXPECT(
+        ERROR_LIBSAT_AIG_BAD_EDGE
+            == libsat_aig_write_aiger(&data, &size, aig, &circuit, true));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_aig_resource_handle(aig)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
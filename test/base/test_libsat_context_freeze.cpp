@@ -0,0 +1,146 @@
+/**
+ * \file base/test_libsat_context_freeze.cpp
+ *
+ * \brief Unit tests for libsat_context_freeze.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_freeze);
+
+/**
+ * A frozen context returns the variables it knows, but creates no others.
+ */
+TEST(lookups_only)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t x_id = 0, var_id = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create x, then freeze the context. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &x_id, context, "x", LIBSAT_VARIABLE_GET_CREATE));
+    libsat_context_freeze(context);
+
+    /* x can still be found. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, "x", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(x_id == var_id);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, "x", LIBSAT_VARIABLE_GET_REF));
+    TEST_EXPECT(x_id == var_id);
+
+    /* y can't be created, by name or as a unique variable. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_variable_get(
+                    &var_id, context, "y", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_variable_get(
+                    &var_id, context, NULL,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND
+            == libsat_context_variable_get(
+                    &var_id, context, "y", LIBSAT_VARIABLE_GET_REF));
+
+    /* once thawed, y can be created. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, "y", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(x_id + 1 == var_id);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A frozen context can be parsed against, but can't be asserted into or have
+ * its scopes changed.
+ */
+TEST(parse_but_no_changes)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* ast;
+    int result = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* assert a statement, open a scope, and freeze the context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&ast, context, "a ∨ b;"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(context, ast));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    libsat_context_freeze(context);
+
+    /* known names can be parsed; unknown names can't. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&ast, context, "¬a;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_parse(&ast, context, "c;"));
+
+    /* the parsed statement can't be asserted, and scopes can't change. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_assert(context, ast));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN == libsat_context_push(context));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN == libsat_context_pop(context));
+
+    /* thawing allows it again. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(context, ast));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, NULL, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,202 @@
+/**
+ * \file base/test_libsat_context_overlay_create.cpp
+ *
+ * \brief Unit tests for libsat_context_overlay_create.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_overlay_create);
+
+/**
+ * An overlay can only be created over a frozen context that is not itself an
+ * overlay.
+ */
+TEST(requires_frozen_base)
+{
+    allocator* alloc;
+    libsat_context* base;
+    libsat_context* overlay;
+    libsat_context* nested;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&base, alloc));
+
+    /* the base must be frozen. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_NOT_FROZEN
+            == libsat_context_overlay_create(&overlay, base));
+
+    /* once frozen, an overlay can be created. */
+    libsat_context_freeze(base);
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_context_overlay_create(&overlay, base));
+
+    /* overlays don't nest. */
+    libsat_context_freeze(overlay);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_IS_OVERLAY
+            == libsat_context_overlay_create(&nested, overlay));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(overlay)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An overlay sees the variables of its base, and numbers its own variables
+ * after them.
+ */
+TEST(sees_base_variables)
+{
+    allocator* alloc;
+    libsat_context* base;
+    libsat_context* overlay;
+    size_t x_id = 0, y_id = 0, var_id = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create a base with x and y, and freeze it. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&base, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &x_id, base, "x", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &y_id, base, "y", LIBSAT_VARIABLE_GET_DEFAULT));
+    libsat_context_freeze(base);
+
+    /* create the overlay. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_context_overlay_create(&overlay, base));
+
+    /* the variables of the base keep their ids. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, overlay, "y", LIBSAT_VARIABLE_GET_REF));
+    TEST_EXPECT(y_id == var_id);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_VARIABLE_GET_CREATE_ALREADY_EXISTS
+            == libsat_context_variable_get(
+                    &var_id, overlay, "x", LIBSAT_VARIABLE_GET_CREATE));
+
+    /* new variables follow those of the base. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, overlay, "z", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(2 == var_id);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, overlay, "z", LIBSAT_VARIABLE_GET_REF));
+    TEST_EXPECT(2 == var_id);
+
+    /* the base doesn't see them. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND
+            == libsat_context_variable_get(
+                    &var_id, base, "z", LIBSAT_VARIABLE_GET_REF));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(overlay)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An overlay has no solver state until it is used, and can then be solved
+ * like any other context.
+ */
+TEST(solves_on_first_use)
+{
+    allocator* alloc;
+    libsat_context* base;
+    libsat_context* overlay;
+    libsat_ast_node* ast;
+    size_t x_id = 0, z_id = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    uint8_t value = LIBSAT_VALUE_UNASSIGNED;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create a base with x, and freeze it. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&base, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &x_id, base, "x", LIBSAT_VARIABLE_GET_DEFAULT));
+    libsat_context_freeze(base);
+
+    /* create the overlay. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_context_overlay_create(&overlay, base));
+
+    /* nothing has been solved yet. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_NO_MODEL
+            == libsat_model_value(&value, overlay, x_id));
+
+    /* assert and solve in the overlay. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&ast, overlay, "x ∧ ¬z;"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(overlay, ast));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, overlay, NULL, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    /* the model covers the variables of the base and the overlay. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &z_id, overlay, "z", LIBSAT_VARIABLE_GET_REF));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_model_value(&value, overlay, x_id));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value);
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_model_value(&value, overlay, z_id));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(overlay)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,297 @@
+/**
+ * \file base/test_libsat_context_overlay_merge.cpp
+ *
+ * \brief Unit tests for libsat_context_overlay_merge.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_overlay_merge);
+
+/**
+ * Get a variable by name.
+ */
+static size_t var(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * Merging assigns base ids in overlay order, and reuses the ids of names that
+ * an earlier merge added.
+ */
+TEST(merge_order)
+{
+    allocator* alloc;
+    libsat_context* base;
+    libsat_context* first;
+    libsat_context* second;
+    size_t var_id = 0, unique_id = 0, base_id = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create a base that knows x. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&base, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, base, "x", LIBSAT_VARIABLE_GET_DEFAULT));
+    libsat_context_freeze(base);
+
+    /* the first overlay creates b, a unique variable, and a. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_overlay_create(&first, base));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, first, "b", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &unique_id, first, NULL,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, first, "a", LIBSAT_VARIABLE_GET_DEFAULT));
+
+    /* the second overlay creates a and c. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_overlay_create(&second, base));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, second, "a", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, second, "c", LIBSAT_VARIABLE_GET_DEFAULT));
+
+    /* an overlay can't be translated before it is merged. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_OVERLAY_NOT_MERGED
+            == libsat_context_overlay_translate(&base_id, first, unique_id));
+
+    /* an overlay only merges into its own base. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY
+            == libsat_context_overlay_merge(first, second));
+
+    /* merge the second overlay first. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_overlay_merge(base, second));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_overlay_merge(base, first));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_OVERLAY_MERGED
+            == libsat_context_overlay_merge(base, first));
+
+    /* the base numbers a, c, b, then the unique variable. */
+    TEST_EXPECT(0 == var(base, "x"));
+    TEST_EXPECT(1 == var(base, "a"));
+    TEST_EXPECT(2 == var(base, "c"));
+    TEST_EXPECT(3 == var(base, "b"));
+
+    /* the overlays translate to the base ids. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_overlay_translate(
+                    &base_id, first, var(first, "a")));
+    TEST_EXPECT(1 == base_id);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_overlay_translate(&base_id, first, unique_id));
+    TEST_EXPECT(4 == base_id);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_overlay_translate(&base_id, second, 0));
+    TEST_EXPECT(0 == base_id);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND
+            == libsat_context_overlay_translate(&base_id, second, 3));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_NOT_OVERLAY
+            == libsat_context_overlay_translate(&base_id, base, 0));
+
+    /* the base is still frozen, and the merged overlays are frozen too. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_variable_get(
+                    &var_id, base, "d", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_variable_get(
+                    &var_id, first, "d", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(ERROR_LIBSAT_BASE_OVERLAY_MERGED == libsat_context_thaw(first));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(first)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(second)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Inputs parsed in parallel against overlays of a shared vocabulary number
+ * their variables exactly as a sequential parse does, and can be asserted
+ * into the base once rebased.
+ */
+TEST(parallel_parse)
+{
+    const size_t INPUTS = 64;
+    allocator* alloc;
+    libsat_context* sequential;
+    libsat_context* base;
+    std::vector<std::string> inputs;
+    std::vector<libsat_context*> overlays(INPUTS, nullptr);
+    std::vector<libsat_ast_node*> asts(INPUTS, nullptr);
+    std::vector<status> results(INPUTS, STATUS_SUCCESS);
+    std::vector<std::thread> threads;
+    libsat_ast_node* ast;
+    int result = 0;
+
+    /* each input mixes the vocabulary with names shared by its neighbors. */
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        std::string n = std::to_string(i);
+        std::string m = std::to_string((i + 1) % INPUTS);
+
+        inputs.push_back(
+            "v" + std::to_string(i % 4) + " ∨ p" + n + " ∨ p" + m + ";"
+            + " ¬p" + n + " ∨ q" + n + ";");
+    }
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* parse every input in order against a single context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&sequential, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_parse(&ast, sequential, "v0; v1; v2; v3;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_parse(&ast, sequential, inputs[i].c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_ast_node_resource_handle(ast)));
+    }
+
+    /* create the shared vocabulary, and freeze it. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&base, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&ast, base, "v0; v1; v2; v3;"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(base, ast));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    libsat_context_freeze(base);
+
+    /* parse the inputs in parallel, each against its own overlay. */
+    for (size_t t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&, t]() {
+            for (size_t i = t; i < INPUTS; i += 4)
+            {
+                results[i] = libsat_context_overlay_create(&overlays[i], base);
+                if (STATUS_SUCCESS == results[i])
+                {
+                    results[i] =
+                        libsat_parse(
+                            &asts[i], overlays[i], inputs[i].c_str());
+                }
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    /* merge in input order. */
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == results[i]);
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_context_overlay_merge(base, overlays[i]));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_ast_node_rebase(asts[i], overlays[i]));
+    }
+
+    /* every name has the same id as in the sequential parse. */
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        for (const char* prefix : { "p", "q" })
+        {
+            std::string name = prefix + std::to_string(i);
+
+            TEST_EXPECT(
+                var(sequential, name.c_str()) == var(base, name.c_str()));
+        }
+    }
+
+    /* the rebased statements can be asserted into the thawed base. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(base));
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(base, asts[i]));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, base, NULL, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    /* clean up. */
+    for (size_t i = 0; i < INPUTS; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_ast_node_resource_handle(asts[i])));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(
+                        libsat_context_resource_handle(overlays[i])));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(sequential)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
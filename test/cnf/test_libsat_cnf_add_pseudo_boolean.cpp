@@ -0,0 +1,350 @@
+/**
+ * \file cnf/test_libsat_cnf_add_pseudo_boolean.cpp
+ *
+ * \brief Unit tests for libsat_cnf_add_pseudo_boolean.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_cnf_add_pseudo_boolean);
+
+/**
+ * Get the value of a literal.
+ */
+static uint8_t literal_value(
+    const std::vector<uint8_t>& values, libsat_literal lit)
+{
+    uint8_t value = values[LIBSAT_LITERAL_VARIABLE(lit)];
+
+    if (LIBSAT_VALUE_UNASSIGNED == value || !LIBSAT_LITERAL_IS_NEGATED(lit))
+    {
+        return value;
+    }
+
+    return
+        (LIBSAT_VALUE_TRUE == value) ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+}
+
+/**
+ * Decide whether the database can be satisfied by extending the given
+ * assignment, using unit propagation and backtracking.
+ */
+static bool satisfiable(const libsat_cnf* cnf, std::vector<uint8_t> values)
+{
+    bool changed = true;
+
+    /* propagate units. */
+    while (changed)
+    {
+        changed = false;
+
+        for (size_t c = 0; c < libsat_cnf_clause_count(cnf); ++c)
+        {
+            const libsat_literal* lits;
+            size_t count, unassigned = 0;
+            libsat_literal last = 0;
+            bool satisfied = false;
+
+            if (STATUS_SUCCESS != libsat_cnf_clause_get(&lits, &count, cnf, c))
+            {
+                return false;
+            }
+
+            for (size_t i = 0; i < count && !satisfied; ++i)
+            {
+                switch (literal_value(values, lits[i]))
+                {
+                    case LIBSAT_VALUE_TRUE:
+                        satisfied = true;
+                        break;
+
+                    case LIBSAT_VALUE_UNASSIGNED:
+                        unassigned += 1;
+                        last = lits[i];
+                        break;
+                }
+            }
+
+            if (satisfied)
+            {
+                continue;
+            }
+
+            if (0 == unassigned)
+            {
+                return false;
+            }
+
+            if (1 == unassigned)
+            {
+                values[LIBSAT_LITERAL_VARIABLE(last)] =
+                    LIBSAT_LITERAL_IS_NEGATED(last)
+                        ? LIBSAT_VALUE_FALSE : LIBSAT_VALUE_TRUE;
+                changed = true;
+            }
+        }
+    }
+
+    /* branch on the first unassigned variable. */
+    for (size_t v = 0; v < values.size(); ++v)
+    {
+        if (LIBSAT_VALUE_UNASSIGNED == values[v])
+        {
+            values[v] = LIBSAT_VALUE_TRUE;
+            if (satisfiable(cnf, values))
+            {
+                return true;
+            }
+
+            values[v] = LIBSAT_VALUE_FALSE;
+            return satisfiable(cnf, values);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Get the number of variables used by the database, which is at least five.
+ */
+static size_t variable_count(const libsat_cnf* cnf)
+{
+    size_t count = 5;
+
+    for (size_t c = 0; c < libsat_cnf_clause_count(cnf); ++c)
+    {
+        const libsat_literal* lits;
+        size_t lit_count;
+
+        if (STATUS_SUCCESS == libsat_cnf_clause_get(&lits, &lit_count, cnf, c))
+        {
+            for (size_t i = 0; i < lit_count; ++i)
+            {
+                if (LIBSAT_LITERAL_VARIABLE(lits[i]) >= count)
+                {
+                    count = LIBSAT_LITERAL_VARIABLE(lits[i]) + 1;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+/**
+ * Check that an encoded constraint over five inputs agrees with its
+ * definition on every assignment of the inputs.
+ */
+static bool encoding_matches(
+    const uint64_t* weights, int relation, uint64_t bound, int encoding)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_cnf* cnf;
+    libsat_literal lits[5];
+    bool result = true;
+
+    if (STATUS_SUCCESS != malloc_allocator_create(&alloc))
+    {
+        return false;
+    }
+
+    if (STATUS_SUCCESS != libsat_context_create(&context, alloc))
+    {
+        return false;
+    }
+
+    if (STATUS_SUCCESS != libsat_cnf_create(&cnf, context))
+    {
+        return false;
+    }
+
+    /* the inputs are variables 0 through 4; the middle one is negated. */
+    for (size_t i = 0; i < 5; ++i)
+    {
+        size_t var_id;
+
+        if (STATUS_SUCCESS
+                != libsat_context_variable_get(
+                    &var_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE))
+        {
+            return false;
+        }
+
+        lits[i] = LIBSAT_LITERAL_MAKE(var_id, 2 == i);
+    }
+
+    if (STATUS_SUCCESS
+            != libsat_cnf_add_pseudo_boolean(
+                cnf, lits, weights, 5, relation, bound, encoding))
+    {
+        return false;
+    }
+
+    /* compare against every input assignment. */
+    for (unsigned mask = 0; mask < 32 && result; ++mask)
+    {
+        std::vector<uint8_t> values(
+            variable_count(cnf), LIBSAT_VALUE_UNASSIGNED);
+        uint64_t sum = 0;
+        bool expected;
+
+        for (size_t i = 0; i < 5; ++i)
+        {
+            values[i] =
+                (mask & (1 << i)) ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE;
+
+            if (LIBSAT_VALUE_TRUE == literal_value(values, lits[i]))
+            {
+                sum += (nullptr == weights) ? 1 : weights[i];
+            }
+        }
+
+        switch (relation)
+        {
+            case LIBSAT_CNF_RELATION_AT_MOST:
+                expected = sum <= bound;
+                break;
+
+            case LIBSAT_CNF_RELATION_AT_LEAST:
+                expected = sum >= bound;
+                break;
+
+            default:
+                expected = sum == bound;
+                break;
+        }
+
+        result = (expected == satisfiable(cnf, values));
+    }
+
+    /* clean up. */
+    if (
+        STATUS_SUCCESS != resource_release(libsat_cnf_resource_handle(cnf))
+     || STATUS_SUCCESS
+            != resource_release(libsat_context_resource_handle(context))
+     || STATUS_SUCCESS != resource_release(allocator_resource_handle(alloc)))
+    {
+        return false;
+    }
+
+    return result;
+}
+
+/**
+ * Check every relation and bound for an encoding.
+ */
+static bool encoding_correct(const uint64_t* weights, int encoding)
+{
+    const int relations[] = {
+        LIBSAT_CNF_RELATION_AT_MOST, LIBSAT_CNF_RELATION_AT_LEAST,
+        LIBSAT_CNF_RELATION_EXACTLY };
+
+    for (int relation : relations)
+    {
+        for (uint64_t bound = 0; bound <= 10; ++bound)
+        {
+            if (!encoding_matches(weights, relation, bound, encoding))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The sequential counter encodes cardinality and weighted constraints.
+ */
+TEST(sequential_counter)
+{
+    const uint64_t weights[] = { 1, 2, 3, 1, 2 };
+
+    TEST_EXPECT(
+        encoding_correct(nullptr, LIBSAT_CNF_ENCODING_SEQUENTIAL_COUNTER));
+    TEST_EXPECT(
+        encoding_correct(weights, LIBSAT_CNF_ENCODING_SEQUENTIAL_COUNTER));
+}
+
+/**
+ * The totalizer encodes cardinality and weighted constraints.
+ */
+TEST(totalizer)
+{
+    const uint64_t weights[] = { 1, 2, 3, 1, 2 };
+
+    TEST_EXPECT(encoding_correct(nullptr, LIBSAT_CNF_ENCODING_TOTALIZER));
+    TEST_EXPECT(encoding_correct(weights, LIBSAT_CNF_ENCODING_TOTALIZER));
+}
+
+/**
+ * The sorting network encodes cardinality and weighted constraints.
+ */
+TEST(sorting_network)
+{
+    const uint64_t weights[] = { 1, 2, 3, 1, 2 };
+
+    TEST_EXPECT(
+        encoding_correct(nullptr, LIBSAT_CNF_ENCODING_SORTING_NETWORK));
+    TEST_EXPECT(
+        encoding_correct(weights, LIBSAT_CNF_ENCODING_SORTING_NETWORK));
+}
+
+/**
+ * Bad relations, bad encodings, and overflowing weights are rejected.
+ */
+TEST(bad_arguments)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_cnf* cnf;
+    const libsat_literal lits[] = { 0, 2 };
+    const uint64_t weights[] = { UINT64_MAX, 1 };
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create cnf. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_cnf_create(&cnf, context));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_CNF_BAD_RELATION
+            == libsat_cnf_add_cardinality(
+                    cnf, lits, 2, 17, 1, LIBSAT_CNF_ENCODING_TOTALIZER));
+    TEST_EXPECT(
+        ERROR_LIBSAT_CNF_BAD_ENCODING
+            == libsat_cnf_add_cardinality(
+                    cnf, lits, 2, LIBSAT_CNF_RELATION_AT_MOST, 1, 17));
+    TEST_EXPECT(
+        ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW
+            == libsat_cnf_add_pseudo_boolean(
+                    cnf, lits, weights, 2, LIBSAT_CNF_RELATION_AT_MOST, 1,
+                    LIBSAT_CNF_ENCODING_TOTALIZER));
+    TEST_EXPECT(0 == libsat_cnf_clause_count(cnf));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_cnf_resource_handle(cnf)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,135 @@
+/**
+ * \file cnf/test_libsat_cnf_native_propagate.cpp
+ *
+ * \brief Unit tests for libsat_cnf_native_propagate.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_cnf_native_propagate);
+
+/**
+ * Once an at-most-k constraint is full, every other literal is false.
+ */
+TEST(at_most_full)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_cnf* cnf;
+    const libsat_literal lits[] = {
+        LIBSAT_LITERAL_MAKE(0, false), LIBSAT_LITERAL_MAKE(1, false),
+        LIBSAT_LITERAL_MAKE(2, false), LIBSAT_LITERAL_MAKE(3, true) };
+    uint8_t values[] = { LIBSAT_VALUE_TRUE, LIBSAT_VALUE_TRUE };
+    libsat_literal implied[4];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create cnf. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_cnf_create(&cnf, context));
+
+    /* at most two of these are true, natively. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_cardinality(
+                    cnf, lits, 4, LIBSAT_CNF_RELATION_AT_MOST, 2,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+    TEST_EXPECT(0 == libsat_cnf_clause_count(cnf));
+    TEST_EXPECT(1 == libsat_cnf_native_count(cnf));
+
+    /* with two true, the other two are false. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_native_propagate(
+                    &implied_count, cnf, values, 2, implied, 4));
+    TEST_ASSERT(2 == implied_count);
+    TEST_EXPECT(LIBSAT_LITERAL_MAKE(2, true) == implied[0]);
+    TEST_EXPECT(LIBSAT_LITERAL_MAKE(3, false) == implied[1]);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_cnf_resource_handle(cnf)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A weighted at-least constraint forces literals and detects conflicts.
+ */
+TEST(at_least_weighted)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_cnf* cnf;
+    const libsat_literal lits[] = {
+        LIBSAT_LITERAL_MAKE(0, false), LIBSAT_LITERAL_MAKE(1, false),
+        LIBSAT_LITERAL_MAKE(2, false) };
+    const uint64_t weights[] = { 5, 3, 1 };
+    uint8_t values[] = { LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_FALSE };
+    uint8_t conflict[] = {
+        LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_FALSE, LIBSAT_VALUE_FALSE };
+    libsat_literal implied[3];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create cnf. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_cnf_create(&cnf, context));
+
+    /* 5a + 3b + c >= 6. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_pseudo_boolean(
+                    cnf, lits, weights, 3, LIBSAT_CNF_RELATION_AT_LEAST, 6,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+
+    /* a can't be left out at all, so it is fixed by a unit clause; the rest
+     * is kept natively as 3¬b + ¬c <= 3. */
+    TEST_EXPECT(1 == libsat_cnf_clause_count(cnf));
+    TEST_EXPECT(1 == libsat_cnf_native_count(cnf));
+
+    /* without b, c is needed. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_native_propagate(
+                    &implied_count, cnf, values, 2, implied, 3));
+    TEST_ASSERT(1 == implied_count);
+    TEST_EXPECT(LIBSAT_LITERAL_MAKE(2, false) == implied[0]);
+
+    /* without b and c, the most that can be reached is 5. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_CNF_CONFLICT
+            == libsat_cnf_native_propagate(
+                    &implied_count, cnf, conflict, 3, implied, 3));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(libsat_cnf_resource_handle(cnf)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,283 @@
+/**
+ * \file parser/test_libsat_ast_evaluate.cpp
+ *
+ * \brief Unit tests for libsat_ast_evaluate.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_ast_evaluate);
+
+/**
+ * Get the id of a named variable.
+ */
+static size_t var(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * Parse the input and evaluate it with a and b set as given.
+ */
+static status evaluate(
+    bool* result, libsat_context* context, const char* input, bool a, bool b)
+{
+    libsat_ast_node* node = nullptr;
+    uint64_t assignment = 0;
+    status retval, release_retval;
+
+    retval = libsat_parse(&node, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    assignment |= (uint64_t)a << var(context, "a");
+    assignment |= (uint64_t)b << var(context, "b");
+
+    retval = libsat_ast_evaluate(result, node, &assignment, 64);
+
+    release_retval = resource_release(libsat_ast_node_resource_handle(node));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Each operator follows its truth table.
+ */
+TEST(operators)
+{
+    allocator* alloc;
+    libsat_context* context;
+    bool result = false;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (int i = 0; i < 4; ++i)
+    {
+        bool a = (i & 1), b = (i & 2);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a ∧ b;", a, b));
+        TEST_EXPECT((a && b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a ∨ b;", a, b));
+        TEST_EXPECT((a || b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a ⊻ b;", a, b));
+        TEST_EXPECT((a != b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a → b;", a, b));
+        TEST_EXPECT((!a || b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a ↔ b;", a, b));
+        TEST_EXPECT((a == b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a ↔ ¬b;", a, b));
+        TEST_EXPECT((a != b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "¬a;", a, b));
+        TEST_EXPECT(!a == result);
+
+        /* a list holds when all of its hard statements do. */
+        TEST_ASSERT(
+            STATUS_SUCCESS == evaluate(&result, context, "a; b;", a, b));
+        TEST_EXPECT((a && b) == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == evaluate(&result, context, "a; [3] ¬a; [1] b;", a, b));
+        TEST_EXPECT(a == result);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == evaluate(&result, context, "[2] a; [1] b;", a, b));
+        TEST_EXPECT(result);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A model found by the solver satisfies the statements it was found for.
+ */
+TEST(validate_model)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    std::vector<uint64_t> assignment;
+    std::string input;
+    size_t count = 0;
+    uint8_t value;
+    bool result = false;
+    int solve_result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* a chain of implications across more than one assignment word. */
+    for (int i = 0; i < 99; ++i)
+    {
+        input +=
+            "x" + std::to_string(i) + " → x" + std::to_string(i + 1) + "; ";
+    }
+
+    input += "x0 ∨ x50; ¬x99 ∨ x7 ∧ x3;";
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(context, node));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &solve_result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve_result);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        size_t var_id = var(context, ("x" + std::to_string(i)).c_str());
+
+        if (var_id >= count)
+        {
+            count = var_id + 1;
+            assignment.resize((count + 63) / 64, 0);
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_model_value(&value, context, var_id));
+        if (LIBSAT_VALUE_TRUE == value)
+        {
+            assignment[var_id / 64] |= (uint64_t)1 << (var_id % 64);
+        }
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_evaluate(&result, node, assignment.data(), count));
+    TEST_EXPECT(result);
+
+    /* x0 alone breaks the first implication. */
+    size_t first = var(context, "x0");
+    std::fill(assignment.begin(), assignment.end(), 0);
+    assignment[first / 64] |= (uint64_t)1 << (first % 64);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_evaluate(&result, node, assignment.data(), count));
+    TEST_EXPECT(!result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Long chains are evaluated without recursion.
+ */
+TEST(long_chain)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    uint64_t assignment = 0;
+    std::string input = "a";
+    bool result = true;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* an odd number of a terms xor'd together is a. */
+    for (int i = 0; i < 20000; ++i)
+    {
+        input += " ⊻ a";
+    }
+
+    input += ";";
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_ast_evaluate(&result, node, &assignment, 1));
+    TEST_EXPECT(!result);
+
+    assignment = 1;
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_ast_evaluate(&result, node, &assignment, 1));
+    TEST_EXPECT(result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A variable outside of the assignment is rejected.
+ */
+TEST(bad_variable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    uint64_t assignment = 0;
+    bool result = false;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∨ b;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_VARIABLE
+            == libsat_ast_evaluate(
+                    &result, node, &assignment,
+                    std::min(var(context, "a"), var(context, "b"))));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,216 @@
+/**
+ * \file parser/test_libsat_ast_evaluate_batch.cpp
+ *
+ * \brief Unit tests for libsat_ast_evaluate_batch.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_ast_evaluate_batch);
+
+/**
+ * Generate a random statement over six names.
+ */
+static std::string generate(std::mt19937& rng)
+{
+    static const char* operators[] = { " ∧ ", " ∨ ", " ⊻ ", " → ", " ↔ " };
+    size_t terms = 1 + rng() % 6;
+    std::string input;
+
+    for (size_t j = 0; j < terms; ++j)
+    {
+        if (j > 0)
+        {
+            input += operators[rng() % 5];
+        }
+
+        if (0 == rng() % 3)
+        {
+            input += "¬";
+        }
+
+        input += "n" + std::to_string(rng() % 6);
+    }
+
+    return input + ";";
+}
+
+/**
+ * Evaluate an AST recursively under assignment i, in which bit i of lanes[v]
+ * is the value of variable v.
+ */
+static bool reference(
+    const libsat_ast_node* node, const std::vector<uint64_t>& lanes,
+    unsigned i)
+{
+    bool lhs, rhs;
+
+    switch (node->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            return 0 != ((lanes[node->value.variable_index] >> i) & 1);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            return !reference(node->value.unary, lanes, i);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            return reference(node->value.unary, lanes, i);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            for (auto j = node->value.list.head; nullptr != j; j = j->next)
+            {
+                if (!reference(j, lanes, i))
+                {
+                    return false;
+                }
+            }
+            return true;
+
+        default:
+            lhs = reference(node->value.binary.lhs, lanes, i);
+            rhs = reference(node->value.binary.rhs, lanes, i);
+            switch (node->type)
+            {
+                case LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION:
+                    return lhs && rhs;
+                case LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION:
+                    return lhs || rhs;
+                case LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION:
+                    return lhs != rhs;
+                case LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION:
+                    return !lhs || rhs;
+                default:
+                    return lhs == rhs;
+            }
+    }
+}
+
+/**
+ * Random statements over six variables agree with a brute-force evaluation
+ * on all 64 assignments at once, and with the single-assignment evaluator.
+ */
+TEST(random_formulas)
+{
+    allocator* alloc;
+    libsat_context* context;
+    std::mt19937 rng(7);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (int round = 0; round < 200; ++round)
+    {
+        libsat_ast_node* node = nullptr;
+        std::vector<uint64_t> lanes;
+        uint64_t result = 0, expected = 0;
+        std::string input = generate(rng) + " " + generate(rng);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+
+        /* lane i of each variable is its value in assignment i. */
+        for (unsigned name = 0; name < 6; ++name)
+        {
+            size_t var_id = 0;
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context,
+                            ("n" + std::to_string(name)).c_str(),
+                            LIBSAT_VARIABLE_GET_DEFAULT));
+            if (var_id >= lanes.size())
+            {
+                lanes.resize(var_id + 1, 0);
+            }
+
+            for (unsigned i = 0; i < 64; ++i)
+            {
+                lanes[var_id] |= (uint64_t)((i >> name) & 1) << i;
+            }
+        }
+
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            expected |= (uint64_t)reference(node, lanes, i) << i;
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_evaluate_batch(
+                        &result, node, lanes.data(), lanes.size()));
+        TEST_EXPECT(expected == result);
+
+        /* each lane agrees with the single-assignment evaluator. */
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            std::vector<uint64_t> assignment((lanes.size() + 63) / 64, 0);
+            bool value = false;
+
+            for (size_t v = 0; v < lanes.size(); ++v)
+            {
+                assignment[v / 64] |= ((lanes[v] >> i) & 1) << (v % 64);
+            }
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_ast_evaluate(
+                            &value, node, assignment.data(), lanes.size()));
+            TEST_EXPECT(value == (0 != ((result >> i) & 1)));
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_ast_node_resource_handle(node)));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A variable outside of the lanes is rejected.
+ */
+TEST(bad_variable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    uint64_t lanes[1] = { 0 };
+    uint64_t result = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∧ b ∧ c;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_VARIABLE
+            == libsat_ast_evaluate_batch(&result, node, lanes, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
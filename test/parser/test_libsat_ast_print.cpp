@@ -0,0 +1,382 @@
+/**
+ * \file parser/test_libsat_ast_print.cpp
+ *
+ * \brief Unit tests for libsat_ast_print.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_ast_print);
+
+/**
+ * Parse an input and print it back, returning the text, or an error marker.
+ */
+static std::string reprint(
+    allocator* alloc, libsat_context* context, const char* input)
+{
+    libsat_ast_node* node;
+    char* text = nullptr;
+    size_t capacity = 0, size = 0;
+    std::string result = "<error>";
+
+    if (STATUS_SUCCESS != libsat_parse(&node, context, input))
+    {
+        return result;
+    }
+
+    if (
+        STATUS_SUCCESS
+            == libsat_ast_print(
+                    &text, &capacity, &size, alloc, context, node))
+    {
+        result.assign(text, size);
+    }
+
+    if (
+        (nullptr != text && STATUS_SUCCESS != allocator_reclaim(alloc, text))
+     || STATUS_SUCCESS
+            != resource_release(libsat_ast_node_resource_handle(node)))
+    {
+        result = "<error>";
+    }
+
+    return result;
+}
+
+/**
+ * Returns true if two ASTs have the same statements, weights, and shape.
+ */
+static bool same_ast(const libsat_ast_node* x, const libsat_ast_node* y)
+{
+    if (x->type != y->type || x->weight != y->weight)
+    {
+        return false;
+    }
+
+    switch (x->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            return x->value.variable_index == y->value.variable_index;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+            return x->value.boolean_literal == y->value.boolean_literal;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            return same_ast(x->value.unary, y->value.unary);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            x = x->value.list.head;
+            y = y->value.list.head;
+            for (; nullptr != x && nullptr != y; x = x->next, y = y->next)
+            {
+                if (!same_ast(x, y))
+                {
+                    return false;
+                }
+            }
+            return nullptr == x && nullptr == y;
+
+        default:
+            return
+                same_ast(x->value.binary.lhs, y->value.binary.lhs)
+             && same_ast(x->value.binary.rhs, y->value.binary.rhs);
+    }
+}
+
+/**
+ * Write a random, fully parenthesized expression.
+ */
+static void random_expression(
+    std::string& out, std::mt19937_64& rng, int depth)
+{
+    static const char* variables[] = { "a", "b", "c", "t", "x1", "_y" };
+    static const char* operators[] = { " ∧ ", " ∨ ", " ⊻ ", " → ", " ↔ " };
+
+    switch ((0 == depth) ? rng() % 3 : rng() % 9)
+    {
+        case 0:
+        case 1:
+            out += variables[rng() % 6];
+            break;
+
+        case 2:
+            out += (rng() % 2) ? "true" : "false";
+            break;
+
+        case 3:
+            out += "¬";
+            random_expression(out, rng, depth - 1);
+            break;
+
+        case 4:
+            out += "(";
+            out += variables[rng() % 6];
+            out += " := ";
+            random_expression(out, rng, depth - 1);
+            out += ")";
+            break;
+
+        default:
+            out += "(";
+            random_expression(out, rng, depth - 1);
+            out += operators[rng() % 5];
+            random_expression(out, rng, depth - 1);
+            out += ")";
+            break;
+    }
+}
+
+/**
+ * Operators are printed with the symbols that the scanner reads, and
+ * statements in the order that they were parsed.
+ */
+TEST(operators)
+{
+    allocator* alloc;
+    libsat_context* context;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_EXPECT(
+        "a ∧ b ∨ ¬c ⊻ d;\n"
+        "[7] a → b ↔ true;\n"
+        "x := false;"
+            == reprint(
+                    alloc, context,
+                    "a∧b∨¬c⊻d; [7] a→b↔true; x:=false"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Only the parentheses that the precedence of the parser needs are printed.
+ */
+TEST(minimal_parentheses)
+{
+    allocator* alloc;
+    libsat_context* context;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* redundant parentheses are dropped. */
+    TEST_EXPECT(
+        "a ∧ b ∨ c;" == reprint(alloc, context, "((a ∧ b)) ∨ (c);"));
+    TEST_EXPECT("¬¬a;" == reprint(alloc, context, "¬(¬(a));"));
+    TEST_EXPECT("a → b → c;" == reprint(alloc, context, "a → (b → c);"));
+    TEST_EXPECT("x := y ↔ z;" == reprint(alloc, context, "x := (y ↔ z);"));
+    TEST_EXPECT("a ∧ b ∧ c;" == reprint(alloc, context, "(a ∧ b) ∧ c;"));
+
+    /* needed parentheses are kept. */
+    TEST_EXPECT(
+        "(a ∨ b) ∧ c;" == reprint(alloc, context, "(a ∨ b) ∧ c;"));
+    TEST_EXPECT(
+        "a ∧ (b ∧ c);" == reprint(alloc, context, "a ∧ (b ∧ c);"));
+    TEST_EXPECT(
+        "(a → b) → c;" == reprint(alloc, context, "(a → b) → c;"));
+    TEST_EXPECT("¬(a ⊻ b);" == reprint(alloc, context, "¬(a ⊻ b);"));
+    TEST_EXPECT(
+        "(x := a) ∧ b;" == reprint(alloc, context, "(x := a) ∧ b;"));
+    TEST_EXPECT(
+        "a ∨ (x := b);" == reprint(alloc, context, "a ∨ (x := b);"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random ASTs parse back from their text to the same AST, and print to the
+ * same text again.
+ */
+TEST(round_trip)
+{
+    allocator* alloc;
+    libsat_context* context;
+    std::mt19937_64 rng(7);
+    char* text = nullptr;
+    size_t capacity = 0, size = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (int i = 0; i < 200; ++i)
+    {
+        libsat_ast_node* node;
+        libsat_ast_node* reparsed;
+        std::string input, printed;
+
+        for (int j = 0; j < 3; ++j)
+        {
+            if (rng() % 2)
+            {
+                input += "[" + std::to_string(1 + rng() % 1000) + "] ";
+            }
+
+            random_expression(input, rng, 5);
+            input += "; ";
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+
+        /* the buffer is reused between prints. */
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_print(
+                        &text, &capacity, &size, alloc, context, node));
+        TEST_ASSERT(size < capacity);
+        TEST_EXPECT(0 == text[size]);
+        printed.assign(text, size);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_parse(&reparsed, context, text));
+        TEST_EXPECT(same_ast(node, reparsed));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_print(
+                        &text, &capacity, &size, alloc, context, reparsed));
+        TEST_EXPECT(printed == std::string(text, size));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_ast_node_resource_handle(node)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(
+                        libsat_ast_node_resource_handle(reparsed)));
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == allocator_reclaim(alloc, text));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Deep ASTs are printed without recursion.
+ */
+TEST(deep)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node;
+    char* text = nullptr;
+    size_t capacity = 0, size = 0;
+    std::string input, expected;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* a long left-associative chain nests to the left. */
+    input = "a";
+    for (int i = 0; i < 20000; ++i)
+    {
+        input += " ∧ a";
+    }
+    input += ";";
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_print(&text, &capacity, &size, alloc, context, node));
+    TEST_EXPECT(input == std::string(text, size));
+
+    TEST_ASSERT(STATUS_SUCCESS == allocator_reclaim(alloc, text));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Variables that could not be read back are rejected.
+ */
+TEST(bad_variable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* unnamed;
+    libsat_context* renamed;
+    libsat_ast_node* node;
+    char* text = nullptr;
+    size_t capacity = 0, size = 0, var_id;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&unnamed, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&renamed, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∨ b;"));
+
+    /* the variables have no names in this context. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, unnamed, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_VARIABLE
+            == libsat_ast_print(
+                    &text, &capacity, &size, alloc, unnamed, node));
+
+    /* the names in this context would not scan as variables. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, renamed, "true", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, renamed, "b c", LIBSAT_VARIABLE_GET_DEFAULT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_VARIABLE
+            == libsat_ast_print(
+                    &text, &capacity, &size, alloc, renamed, node));
+
+    if (nullptr != text)
+    {
+        TEST_ASSERT(STATUS_SUCCESS == allocator_reclaim(alloc, text));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(renamed)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(unnamed)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
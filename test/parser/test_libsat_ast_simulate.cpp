@@ -0,0 +1,257 @@
+/**
+ * \file parser/test_libsat_ast_simulate.cpp
+ *
+ * \brief Unit tests for libsat_ast_simulate.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_ast_simulate);
+
+/**
+ * Get the statements of a list in the order that they were parsed.
+ */
+static std::vector<const libsat_ast_node*> statements(
+    const libsat_ast_node* list)
+{
+    std::vector<const libsat_ast_node*> result;
+
+    for (auto i = list->value.list.head; nullptr != i; i = i->next)
+    {
+        result.push_back(i);
+    }
+
+    std::reverse(result.begin(), result.end());
+
+    return result;
+}
+
+/**
+ * Get the number of variables in a context.
+ */
+static size_t variable_count(libsat_context* context)
+{
+    size_t var_id = 0;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE))
+    {
+        return 0;
+    }
+
+    return var_id;
+}
+
+/**
+ * Equivalent statements share a class, complements share a class only when
+ * polarity is asked for, and others get their own class.
+ */
+TEST(classes)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    size_t classes[7];
+    bool negated[7];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(
+                    &node, context,
+                    "a → b; ¬a ∨ b; a ∧ ¬b; b → a; "
+                    "a ⊻ b ⊻ c; c ⊻ b ⊻ a; ¬a ↔ b ⊻ c;"));
+
+    auto nodes = statements(node);
+    TEST_ASSERT(7 == nodes.size());
+    size_t count = variable_count(context);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_simulate(
+                    classes, nullptr, nodes.data(), nodes.size(), count, 4,
+                    1));
+    TEST_EXPECT(0 == classes[0]);
+    TEST_EXPECT(0 == classes[1]);
+    TEST_EXPECT(2 == classes[2]);
+    TEST_EXPECT(3 == classes[3]);
+    TEST_EXPECT(4 == classes[4]);
+    TEST_EXPECT(4 == classes[5]);
+    TEST_EXPECT(4 == classes[6]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_simulate(
+                    classes, negated, nodes.data(), nodes.size(), count, 1,
+                    1));
+    TEST_EXPECT(0 == classes[0] && !negated[0]);
+    TEST_EXPECT(0 == classes[1] && !negated[1]);
+    TEST_EXPECT(0 == classes[2] && negated[2]);
+    TEST_EXPECT(3 == classes[3] && !negated[3]);
+    TEST_EXPECT(4 == classes[4] && !negated[4]);
+    TEST_EXPECT(4 == classes[5] && !negated[5]);
+    TEST_EXPECT(4 == classes[6] && !negated[6]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * On random statements over four variables, every assignment is simulated, so
+ * the classes match the truth tables exactly.
+ */
+TEST(random_statements)
+{
+    static const char* operators[] = { " ∧ ", " ∨ ", " ⊻ ", " → ", " ↔ " };
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    std::mt19937 rng(11);
+    std::string input;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (int i = 0; i < 300; ++i)
+    {
+        size_t terms = 1 + rng() % 4;
+
+        for (size_t j = 0; j < terms; ++j)
+        {
+            if (j > 0)
+            {
+                input += operators[rng() % 5];
+            }
+
+            if (0 == rng() % 3)
+            {
+                input += "¬";
+            }
+
+            input += "n" + std::to_string(rng() % 4);
+        }
+
+        input += "; ";
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, input.c_str()));
+
+    auto nodes = statements(node);
+    size_t count = variable_count(context);
+    std::vector<size_t> classes(nodes.size());
+    std::vector<uint64_t> tables(nodes.size());
+    std::vector<uint64_t> lanes(count, 0);
+
+    /* lane i of each variable is bit v of i, for every assignment. */
+    for (size_t v = 0; v < count; ++v)
+    {
+        for (unsigned i = 0; i < 64; ++i)
+        {
+            lanes[v] |= (uint64_t)((i >> (v % 6)) & 1) << i;
+        }
+    }
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_evaluate_batch(
+                        &tables[i], nodes[i], lanes.data(), count));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_ast_simulate(
+                    classes.data(), nullptr, nodes.data(), nodes.size(),
+                    count, 4, 99));
+
+    for (size_t i = 0; i < nodes.size(); ++i)
+    {
+        size_t expected = i;
+
+        /* the class is the first statement with the same truth table. */
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (tables[j] == tables[i])
+            {
+                expected = j;
+                break;
+            }
+        }
+
+        TEST_EXPECT(expected == classes[i]);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A zero width and variables outside of the simulation are rejected.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* node = nullptr;
+    size_t classes[1];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∨ b;"));
+
+    const libsat_ast_node* nodes[1] = { node };
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_WIDTH
+            == libsat_ast_simulate(classes, nullptr, nodes, 1, 2, 0, 1));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_BAD_VARIABLE
+            == libsat_ast_simulate(classes, nullptr, nodes, 1, 0, 4, 1));
+
+    /* nothing to cluster is not an error. */
+    TEST_EXPECT(
+        STATUS_SUCCESS
+            == libsat_ast_simulate(classes, nullptr, nodes, 0, 2, 4, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -960,3 +960,436 @@ TEST(two_conjunction_statements)
     TEST_ASSERT(
         STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
 }
+
+/**
+ * A negation only binds to the expression immediately to its right.
+ */
+TEST(negation_disjunction)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_ast_node* node = nullptr;
+    libsat_ast_node* disjunction = nullptr;
+    const char* input = R"(¬a ∨ b)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the statement child node should be a disjunction. */
+    node = base->value.list.head;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT == node->type);
+    disjunction = node->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION == disjunction->type);
+
+    /* The left-hand side of the disjunction should be a negated variable. */
+    node = disjunction->value.binary.lhs;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_NEGATION == node->type);
+    node = node->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->type);
+    TEST_EXPECT(0 == node->value.variable_index);
+
+    /* The right-hand side of the disjunction should be a variable. */
+    node = disjunction->value.binary.rhs;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->type);
+    TEST_EXPECT(1 == node->value.variable_index);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A folded right-hand side does not consume the following statement.
+ */
+TEST(folded_rhs_statements)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_ast_node* node = nullptr;
+    const char* input = R"(a → b ∧ c; d;)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* statements are pushed to the head; the first is the last statement. */
+    node = base->value.list.head;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->value.unary->type);
+    TEST_EXPECT(3 == node->value.unary->value.variable_index);
+
+    /* the second is the implication, with a conjunction on the right. */
+    node = node->next;
+    TEST_ASSERT(nullptr != node);
+    node = node->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION
+            == node->value.binary.rhs->type);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Each statement records the span of input it was parsed from.
+ */
+TEST(statement_spans)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    const libsat_ast_node* node;
+    const char* input = "x;\n  y\n ∧ z;\nw";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the last statement has no semicolon, so its span ends at its token. */
+    node = base->value.list.head;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(4 == node->span.begin_line);
+    TEST_EXPECT(1 == node->span.begin_col);
+    TEST_EXPECT(4 == node->span.end_line);
+    TEST_EXPECT(1 == node->span.end_col);
+
+    /* a statement can cover several lines. */
+    node = node->next;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(2 == node->span.begin_line);
+    TEST_EXPECT(3 == node->span.begin_col);
+    TEST_EXPECT(3 == node->span.end_line);
+    TEST_EXPECT(4 == node->span.end_col);
+
+    /* the span includes the semicolon. */
+    node = node->next;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(1 == node->span.begin_line);
+    TEST_EXPECT(1 == node->span.begin_col);
+    TEST_EXPECT(1 == node->span.end_line);
+    TEST_EXPECT(2 == node->span.end_col);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A statement may be marked soft by a leading weight.
+ */
+TEST(soft_statements)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    const libsat_ast_node* node;
+    const char* input = "[5] a ∨ b; c; [2] ¬c";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the span of a soft statement starts at its weight. */
+    node = base->value.list.head;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(2 == node->weight);
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_NEGATION == node->value.unary->type);
+    TEST_EXPECT(14 == node->span.begin_col);
+
+    /* a statement without a weight is hard. */
+    node = node->next;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(0 == node->weight);
+
+    node = node->next;
+    TEST_ASSERT(nullptr != node);
+    TEST_EXPECT(5 == node->weight);
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION == node->value.unary->type);
+    TEST_EXPECT(1 == node->span.begin_col);
+    TEST_EXPECT(9 == node->span.end_col);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    base = nullptr;
+
+    /* a weight must be followed by a statement. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "[3];"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "a; [3] [4] b;"));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An operator that binds looser than the one before it continues the whole
+ * expression to its left.
+ */
+TEST(mixed_precedence)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_ast_node* node = nullptr;
+    const char* input = R"(a ⊻ b ∧ c ⊻ d ∨ e;)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* this is ((a ⊻ (b ∧ c)) ⊻ d) ∨ e. */
+    node = base->value.list.head->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->value.binary.rhs->type);
+    TEST_EXPECT(4 == node->value.binary.rhs->value.variable_index);
+
+    node = node->value.binary.lhs;
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->value.binary.rhs->type);
+    TEST_EXPECT(3 == node->value.binary.rhs->value.variable_index);
+
+    node = node->value.binary.lhs;
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_EXCLUSIVE_DISJUNCTION == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == node->value.binary.lhs->type);
+    TEST_EXPECT(0 == node->value.binary.lhs->value.variable_index);
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION
+            == node->value.binary.rhs->type);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Parentheses group an expression, and literals parse as boolean literals.
+ */
+TEST(groups_and_literals)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_ast_node* node = nullptr;
+    const char* input = R"((a ∨ b) ∧ ¬(c → false); ((true));)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the last statement is a true literal. */
+    node = base->value.list.head;
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL
+            == node->value.unary->type);
+    TEST_EXPECT(node->value.unary->value.boolean_literal);
+
+    /* the first is a conjunction of the grouped disjunction. */
+    node = node->next->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION == node->type);
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_DISJUNCTION
+            == node->value.binary.lhs->type);
+
+    /* ... and the negation of the grouped implication. */
+    node = node->value.binary.rhs;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_NEGATION == node->type);
+    node = node->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_IMPLICATION == node->type);
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL
+            == node->value.binary.rhs->type);
+    TEST_EXPECT(!node->value.binary.rhs->value.boolean_literal);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    base = nullptr;
+
+    /* a group must be closed. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "(a ∨ b;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "a ∧ (b"));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Assignment binds loosest, associates to the right, and requires a variable
+ * on its left-hand side.
+ */
+TEST(assignment)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_ast_node* node = nullptr;
+    const char* input = R"(a := b := c ↔ d;)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* this is a := (b := (c ↔ d)). */
+    node = base->value.list.head->value.unary;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT == node->type);
+    TEST_EXPECT(0 == node->value.binary.lhs->value.variable_index);
+    node = node->value.binary.rhs;
+    TEST_ASSERT(LIBSAT_PARSER_AST_NODE_TYPE_ASSIGNMENT == node->type);
+    TEST_EXPECT(1 == node->value.binary.lhs->value.variable_index);
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_BICONDITIONAL
+            == node->value.binary.rhs->type);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    base = nullptr;
+
+    /* only a variable can be assigned. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_LEFT_HAND_SIDE_MUST_BE_VARIABLE
+            == libsat_parse(&base, context, "a ∧ b := c;"));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Errors deep in an expression release everything parsed so far.
+ */
+TEST(nested_errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_INCOMPLETE_EXPRESSION
+            == libsat_parse(&base, context, "a; a ∧ b ∨ c ∧"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_LEFT_HAND_SIDE_MUST_BE_VARIABLE
+            == libsat_parse(&base, context, "a ∧ b ∧ c := d;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_LEFT_HAND_SIDE_MUST_BE_VARIABLE
+            == libsat_parse(&base, context, "true → a := b;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_LEFT_HAND_SIDE_MUST_BE_VARIABLE
+            == libsat_parse(&base, context, "¬a ⊻ b := c;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "¬a ∨ (b ∧;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "(a) ↔ (b;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNEXPECTED_TOKEN
+            == libsat_parse(&base, context, "x := a → ;"));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,299 @@
+/**
+ * \file parser/test_libsat_parse_parallel.cpp
+ *
+ * \brief Unit tests for libsat_parse_parallel.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/parser.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_parse_parallel);
+
+/**
+ * Generate a large input of random statements over the given number of names.
+ */
+static std::string generate(size_t statements, size_t names, unsigned seed)
+{
+    static const char* operators[] = { " ∧ ", " ∨ ", " ⊻ ", " → ", " ↔ " };
+    std::mt19937 rng(seed);
+    std::string input;
+
+    for (size_t i = 0; i < statements; ++i)
+    {
+        size_t terms = 1 + rng() % 4;
+
+        for (size_t j = 0; j < terms; ++j)
+        {
+            if (j > 0)
+            {
+                input += operators[rng() % 5];
+            }
+
+            if (0 == rng() % 3)
+            {
+                input += "¬";
+            }
+
+            input += "n" + std::to_string(rng() % names);
+        }
+
+        input += (0 == i % 7) ? ";\n" : "; ";
+    }
+
+    return input;
+}
+
+/**
+ * Return true if two ASTs are the same, including their variable ids and the
+ * spans of their statements.
+ */
+static bool same_tree(const libsat_ast_node* lhs, const libsat_ast_node* rhs)
+{
+    if (lhs->type != rhs->type)
+    {
+        return false;
+    }
+
+    switch (lhs->type)
+    {
+        case LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE:
+            return lhs->value.variable_index == rhs->value.variable_index;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL:
+            return lhs->value.boolean_literal == rhs->value.boolean_literal;
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_NEGATION:
+            return same_tree(lhs->value.unary, rhs->value.unary);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT:
+            return
+                lhs->span.begin_line == rhs->span.begin_line
+             && lhs->span.begin_col == rhs->span.begin_col
+             && lhs->span.end_line == rhs->span.end_line
+             && lhs->span.end_col == rhs->span.end_col
+             && same_tree(lhs->value.unary, rhs->value.unary);
+
+        case LIBSAT_PARSER_AST_NODE_TYPE_STATEMENT_LIST:
+            lhs = lhs->value.list.head;
+            rhs = rhs->value.list.head;
+            while (nullptr != lhs && nullptr != rhs)
+            {
+                if (!same_tree(lhs, rhs))
+                {
+                    return false;
+                }
+
+                lhs = lhs->next;
+                rhs = rhs->next;
+            }
+
+            return nullptr == lhs && nullptr == rhs;
+
+        default:
+            return
+                same_tree(lhs->value.binary.lhs, rhs->value.binary.lhs)
+             && same_tree(lhs->value.binary.rhs, rhs->value.binary.rhs);
+    }
+}
+
+/**
+ * A parallel parse produces the same statements, spans and variable ids as a
+ * sequential parse, and leaves the context unfrozen.
+ */
+TEST(matches_sequential_parse)
+{
+    allocator* alloc;
+    libsat_context* sequential;
+    libsat_context* parallel;
+    libsat_ast_node* expected = nullptr;
+    libsat_ast_node* actual = nullptr;
+    std::string input = generate(20000, 3000, 7);
+    size_t var_id = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create contexts that already know a few names. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&sequential, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&parallel, alloc));
+    for (const char* name : { "n42", "other", "n7" })
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &var_id, sequential, name,
+                        LIBSAT_VARIABLE_GET_DEFAULT));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &var_id, parallel, name,
+                        LIBSAT_VARIABLE_GET_DEFAULT));
+    }
+
+    /* parse the input both ways. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(&expected, sequential, input.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse_parallel(&actual, parallel, input.c_str(), 4));
+
+    /* the statements and their variable ids are the same. */
+    TEST_EXPECT(same_tree(expected, actual));
+
+    /* so is the variable table. */
+    for (size_t i = 0; i < 3000; ++i)
+    {
+        std::string name = "n" + std::to_string(i);
+        size_t expected_id = 0, actual_id = 0;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &expected_id, sequential, name.c_str(),
+                        LIBSAT_VARIABLE_GET_REF));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &actual_id, parallel, name.c_str(),
+                        LIBSAT_VARIABLE_GET_REF));
+        TEST_EXPECT(expected_id == actual_id);
+    }
+
+    /* the context is not left frozen. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, parallel, "fresh", LIBSAT_VARIABLE_GET_CREATE));
+    TEST_EXPECT(3001 == var_id);
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(parallel, actual));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(expected)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(actual)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(sequential)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(parallel)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A frozen context is parsed against directly, so names it does not know are
+ * rejected just as a sequential parse rejects them.
+ */
+TEST(frozen_context)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* ast = nullptr;
+    libsat_ast_node* expected = nullptr;
+    std::string input = generate(5000, 100, 11);
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create a context that knows every name, and freeze it. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_parse(&expected, context, input.c_str()));
+    libsat_context_freeze(context);
+
+    /* parsing the same input again gives the same statements. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse_parallel(&ast, context, input.c_str(), 3));
+    TEST_EXPECT(same_tree(expected, ast));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+
+    /* an unknown name is rejected. */
+    input += " unknown;";
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_parse_parallel(&ast, context, input.c_str(), 3));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(expected)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A syntax error in any chunk fails the parse as it fails a sequential parse,
+ * and an input of whitespace is empty.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* sequential;
+    libsat_ast_node* ast = nullptr;
+    std::string input = generate(5000, 100, 13);
+    std::string bad = input;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create contexts. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&sequential, alloc));
+
+    /* an incomplete expression in the middle of the input. */
+    bad.insert(bad.find(';', bad.size() / 2) + 1, " a ∧ ;");
+    status expected = libsat_parse(&ast, sequential, bad.c_str());
+    TEST_EXPECT(STATUS_SUCCESS != expected);
+    TEST_EXPECT(
+        expected == libsat_parse_parallel(&ast, context, bad.c_str(), 4));
+
+    /* an input with no statements. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_EMPTY_INPUT
+            == libsat_parse_parallel(
+                    &ast, context, std::string(20000, ' ').c_str(), 4));
+
+    /* the context is still usable. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse_parallel(&ast, context, input.c_str(), 4));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_assert(context, ast));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(ast)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(sequential)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
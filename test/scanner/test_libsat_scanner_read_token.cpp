@@ -431,6 +431,55 @@ TEST(false_literal)
         STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
 }
 
+/**
+ * A literal followed by an underscore is the start of a variable.
+ */
+TEST(literal_prefixed_variable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_scanner* scanner;
+    libsat_scanner_token details;
+    const char* input = R"( true_x false_ )";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_scanner_create(&scanner, context, input));
+
+    /* both tokens are variables. */
+    int token = libsat_scanner_read_token(&details, scanner);
+    TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_VARIABLE == token);
+    TEST_EXPECT(1 == details.begin_index);
+    TEST_EXPECT(6 == details.end_index);
+
+    token = libsat_scanner_read_token(&details, scanner);
+    TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_VARIABLE == token);
+    TEST_EXPECT(8 == details.begin_index);
+    TEST_EXPECT(13 == details.end_index);
+
+    /* read a token from the scanner. */
+    token = libsat_scanner_read_token(&details, scanner);
+
+    /* this token should be EOF. */
+    TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_EOF == token);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_scanner_resource_handle(scanner)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
 /**
  * We can scan a variable.
  */
@@ -958,3 +1007,102 @@ TEST(logic_expression1_no_spaces)
     TEST_ASSERT(
         STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
 }
+
+/**
+ * We can scan the weight of a soft statement.
+ */
+TEST(weight)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_scanner* scanner;
+    libsat_scanner_token details;
+    const char* input = R"( [18446744073709551615] )";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create scanner. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_scanner_create(&scanner, context, input));
+
+    /* read a token from the scanner. */
+    int token = libsat_scanner_read_token(&details, scanner);
+
+    /* this token should be WEIGHT. */
+    TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_WEIGHT == token);
+
+    /* verify the details. */
+    TEST_EXPECT(token == details.type);
+    TEST_EXPECT(UINT64_MAX == details.value.u64);
+    TEST_EXPECT(1 == details.begin_index);
+    TEST_EXPECT(22 == details.end_index);
+    TEST_EXPECT(1 == details.begin_line);
+    TEST_EXPECT(1 == details.end_line);
+    TEST_EXPECT(2 == details.begin_col);
+    TEST_EXPECT(23 == details.end_col);
+
+    /* read a token from the scanner. */
+    token = libsat_scanner_read_token(&details, scanner);
+
+    /* this token should be EOF. */
+    TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_EOF == token);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_scanner_resource_handle(scanner)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A weight that is empty, zero, unclosed, or too large is bad input.
+ */
+TEST(bad_weight)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_scanner* scanner;
+    libsat_scanner_token details;
+    const char* inputs[] = {
+        "[]", "[0]", "[12", "[1a]", "[18446744073709551616]" };
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (const char* input : inputs)
+    {
+        /* create scanner. */
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_scanner_create(&scanner, context, input));
+
+        /* the token is bad input, and nothing is consumed. */
+        int token = libsat_scanner_read_token(&details, scanner);
+        TEST_EXPECT(LIBSAT_SCANNER_TOKEN_TYPE_BAD_INPUT == token);
+        TEST_EXPECT(0 == details.begin_index);
+        TEST_EXPECT(0 == details.end_index);
+
+        /* clean up the scanner. */
+        TEST_ASSERT(
+            STATUS_SUCCESS ==
+                resource_release(libsat_scanner_resource_handle(scanner)));
+    }
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
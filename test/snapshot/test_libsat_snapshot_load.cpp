@@ -0,0 +1,375 @@
+/**
+ * \file snapshot/test_libsat_snapshot_load.cpp
+ *
+ * \brief Unit tests for libsat_snapshot_load.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_snapshot;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_snapshot_load);
+
+/**
+ * Get the variable of a name, creating it if needed.
+ */
+static size_t variable(libsat_context* context, const char* name)
+{
+    size_t var_id;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_DEFAULT))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * Load a snapshot held in a string.
+ */
+static status load(
+    const libsat_ast_node** node, libsat_snapshot* snapshot,
+    const std::string& data)
+{
+    return
+        libsat_snapshot_load(
+            node, snapshot, (const uint8_t*)data.data(), data.size());
+}
+
+/**
+ * Set a little-endian word of a snapshot held in a string.
+ */
+static std::string put(std::string data, size_t offset, uint64_t value)
+{
+    for (size_t i = 0; i < 8; ++i)
+    {
+        data[offset + i] = (char)(value >> (8 * i));
+    }
+
+    return data;
+}
+
+/**
+ * Loading a snapshot into an empty context gives back the same variables and
+ * the same AST, which writes the same snapshot.
+ */
+TEST(round_trip)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* loaded;
+    libsat_snapshot* snapshot;
+    libsat_snapshot* reload;
+    libsat_ast_node* node = nullptr;
+    const libsat_ast_node* copy;
+    const uint8_t* data;
+    size_t size, unnamed;
+    uint64_t assignment;
+    bool expected, actual;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&loaded, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&reload, loaded));
+    TEST_ASSERT(0 == variable(context, "a"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &unnamed, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(
+                    &node, context,
+                    "[5] a ∨ b; c ⊻ ¬a;\nd → e ↔ a ∧ b; ¬¬c;"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+    std::string original((const char*)data, size);
+
+    TEST_ASSERT(STATUS_SUCCESS == load(&copy, reload, original));
+    TEST_ASSERT(nullptr != copy);
+
+    for (auto name : { "a", "b", "c", "d", "e" })
+    {
+        TEST_EXPECT(variable(context, name) == variable(loaded, name));
+    }
+
+    TEST_EXPECT(5 == copy->value.list.head->next->next->next->weight);
+    TEST_EXPECT(2 == copy->value.list.head->next->span.begin_line);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_snapshot_write(&data, &size, reload, copy));
+    TEST_EXPECT(original == std::string((const char*)data, size));
+
+    for (assignment = 0; assignment < 64; ++assignment)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_evaluate(&expected, node, &assignment, 6));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_ast_evaluate(&actual, copy, &assignment, 6));
+        TEST_EXPECT(expected == actual);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(reload)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(loaded)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Loading into a context that already has variables maps each name to its
+ * variable in that context.
+ */
+TEST(remap)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* loaded;
+    libsat_snapshot* snapshot;
+    libsat_snapshot* reload;
+    libsat_ast_node* node = nullptr;
+    const libsat_ast_node* copy;
+    const libsat_ast_node* conjunction;
+    const uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&loaded, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&reload, loaded));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∧ ¬b;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+
+    TEST_ASSERT(0 == variable(loaded, "x"));
+    TEST_ASSERT(1 == variable(loaded, "b"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_load(&copy, reload, data, size));
+
+    conjunction = copy->value.list.head->value.unary;
+    TEST_ASSERT(
+        LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION == conjunction->type);
+    TEST_EXPECT(2 == conjunction->value.binary.lhs->value.variable_index);
+    TEST_EXPECT(
+        1 == conjunction->value.binary.rhs->value.unary->value.variable_index);
+    TEST_EXPECT(2 == variable(loaded, "a"));
+
+    /* a snapshot without an AST only loads its variables, and the next load
+     * replaces the AST of the last. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, nullptr));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_load(&copy, reload, data, size));
+    TEST_EXPECT(nullptr == copy);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(reload)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(loaded)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Malformed snapshots are rejected, and so are snapshots of other versions.
+ */
+TEST(bad_format)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* loaded;
+    libsat_snapshot* snapshot;
+    libsat_snapshot* reload;
+    libsat_ast_node* node = nullptr;
+    const libsat_ast_node* copy;
+    const uint8_t* data;
+    size_t size;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&loaded, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&reload, loaded));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "¬a;"));
+
+    /* a, ¬a, the statement, and the list, after two words of names. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+    std::string good((const char*)data, size);
+    const size_t nodes = 56 + 16;
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SNAPSHOT_BAD_VERSION
+            == load(&copy, reload, put(good, 8, 2)));
+
+    const std::string bad[] = {
+        good.substr(0, 40),
+        good.substr(0, good.size() - 1),
+        good + std::string(1, '\0'),
+        good.substr(0, good.size() - 1) + "x",
+        "LSATSNAQ" + good.substr(8),
+        put(good, 16, 0),
+        put(good, 16, LIBSAT_SNAPSHOT_VARIABLE_MAX + 1),
+        put(good, 24, 2),
+        put(good, 24, 1000),
+        put(good, 32, 5),
+        put(good, 40, 3),
+        put(good, 48, 5),
+        put(good, 56, 1),
+        put(good, 64, 1),
+        put(good, 64, 2),
+        put(good, nodes, 99),
+        put(good, nodes + 16, 1),
+        put(good, nodes + 72 + 16, 2),
+        put(good, nodes + 72 + 16, 0),
+        put(good, nodes + 3 * 72 + 16, 4),
+        put(good, nodes + 3 * 72 + 8, 4),
+        put(put(good, nodes, LIBSAT_PARSER_AST_NODE_TYPE_BOOLEAN_LITERAL),
+            nodes + 16, 2),
+        put(put(good, nodes + 2 * 72, LIBSAT_PARSER_AST_NODE_TYPE_CONJUNCTION),
+            nodes + 2 * 72 + 24, 0),
+    };
+
+    for (const auto& input : bad)
+    {
+        TEST_EXPECT(
+            ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT == load(&copy, reload, input));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(reload)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(loaded)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A snapshot that fails to load leaves the context as it was, even when only
+ * its last node is malformed.
+ */
+TEST(bad_format_leaves_context)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_context* loaded;
+    libsat_snapshot* snapshot;
+    libsat_snapshot* reload;
+    libsat_ast_node* node = nullptr;
+    const libsat_ast_node* copy;
+    const uint8_t* data;
+    size_t size, var_id;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&loaded, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&reload, loaded));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_parse(&node, context, "a ∧ b; c ∨ d;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+
+    /* the type of the last node, after the header and four names. */
+    std::string good((const char*)data, size);
+    const size_t last = 56 + 4 * 16 + (data[32] - 1) * 72;
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SNAPSHOT_BAD_FORMAT
+            == load(&copy, reload, put(good, last, 99)));
+
+    /* no name was interned, and no variable was created. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_VARIABLE_GET_REF_NOT_FOUND
+            == libsat_context_variable_get(
+                    &var_id, loaded, "a", LIBSAT_VARIABLE_GET_REF));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, loaded, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(0 == var_id);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(reload)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(loaded)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,187 @@
+/**
+ * \file snapshot/test_libsat_snapshot_write.cpp
+ *
+ * \brief Unit tests for libsat_snapshot_write.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_snapshot;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_snapshot_write);
+
+/**
+ * Read a little-endian word of a snapshot.
+ */
+static uint64_t word(const uint8_t* data, size_t offset)
+{
+    uint64_t value = 0;
+
+    for (int i = 7; i >= 0; --i)
+    {
+        value = (value << 8) | data[offset + i];
+    }
+
+    return value;
+}
+
+/**
+ * A snapshot is a header, a name table, a node table, and the names, with
+ * children before their parents.
+ */
+TEST(layout)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_snapshot* snapshot;
+    libsat_ast_node* node = nullptr;
+    const uint8_t* data;
+    size_t size, unnamed;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "¬a ∧ b;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &unnamed, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+
+    /* a, ¬a, b, ∧, the statement, and the list, and "a" and "b". */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+    TEST_ASSERT(56 + 2 * 16 + 6 * 72 + 4 == size);
+    TEST_EXPECT(0 == memcmp(data, "LSATSNAP", 8));
+    TEST_EXPECT(LIBSAT_SNAPSHOT_VERSION == word(data, 8));
+    TEST_EXPECT(3 == word(data, 16));
+    TEST_EXPECT(2 == word(data, 24));
+    TEST_EXPECT(6 == word(data, 32));
+    TEST_EXPECT(4 == word(data, 40));
+    TEST_EXPECT(6 == word(data, 48));
+
+    /* names are sorted by variable, and the unnamed variable has none. */
+    TEST_EXPECT(0 == word(data, 56));
+    TEST_EXPECT(0 == word(data, 64));
+    TEST_EXPECT(1 == word(data, 72));
+    TEST_EXPECT(2 == word(data, 80));
+    TEST_EXPECT(0 == memcmp(data + size - 4, "a\0b\0", 4));
+
+    /* the first node is the variable a, and ¬a refers to it. */
+    TEST_EXPECT(LIBSAT_PARSER_AST_NODE_TYPE_VARIABLE == word(data, 88));
+    TEST_EXPECT(0 == word(data, 88 + 16));
+    TEST_EXPECT(
+        LIBSAT_PARSER_AST_NODE_TYPE_NEGATION == word(data, 88 + 72));
+    TEST_EXPECT(1 == word(data, 88 + 72 + 16));
+
+    /* without an AST, only the variables are written. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_snapshot_write(&data, &size, snapshot, nullptr));
+    TEST_EXPECT(56 + 2 * 16 + 4 == size);
+    TEST_EXPECT(0 == word(data, 32));
+    TEST_EXPECT(0 == word(data, 48));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An AST with an unknown node type can't be written.
+ */
+TEST(unsupported_node_type)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_snapshot* snapshot;
+    libsat_ast_node* node = nullptr;
+    const uint8_t* data;
+    size_t size;
+    int type;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&node, context, "a ∨ b;"));
+
+    type = node->value.list.head->value.unary->type;
+    node->value.list.head->value.unary->type = 99;
+    TEST_EXPECT(
+        ERROR_LIBSAT_PARSER_UNSUPPORTED_AST_NODE_TYPE
+            == libsat_snapshot_write(&data, &size, snapshot, node));
+    node->value.list.head->value.unary->type = type;
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(node)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A context with more variables than a snapshot can hold can't be written.
+ */
+TEST(too_many_variables)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_snapshot* snapshot;
+    const uint8_t* data;
+    size_t size, var_id;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_snapshot_create(&snapshot, context));
+
+    for (size_t i = 0; i <= LIBSAT_SNAPSHOT_VARIABLE_MAX; ++i)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &var_id, context, nullptr,
+                        LIBSAT_VARIABLE_GET_CREATE
+                            | LIBSAT_VARIABLE_GET_UNIQUE));
+    }
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SNAPSHOT_TOO_LARGE
+            == libsat_snapshot_write(&data, &size, snapshot, nullptr));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_snapshot_resource_handle(snapshot)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
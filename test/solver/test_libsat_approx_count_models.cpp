@@ -0,0 +1,257 @@
+/**
+ * \file solver/test_libsat_approx_count_models.cpp
+ *
+ * \brief Unit tests for libsat_approx_count_models.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_approx_count_models);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the id of a named variable.
+ */
+static size_t var(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * A count below the threshold is exact, and needs no hashes.
+ */
+TEST(small_count_is_exact)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t projection[3];
+    size_t cells = 0, hashes = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b ∨ c;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "c");
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 3, 0.8,
+                    0.2, 1));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(7 == cells);
+    TEST_EXPECT(0 == hashes);
+
+    /* an unsatisfiable context has no models. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬a; ¬b; ¬c;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 3, 0.8,
+                    0.2, 1));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(0 == cells);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A large count is estimated within the tolerance of the exact count, the same
+ * seed gives the same estimate, and the context is left as it was.
+ */
+TEST(large_count_estimate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    std::vector<size_t> projection;
+    const uint32_t* words = nullptr;
+    size_t word_count = 0;
+    size_t cells = 0, hashes = 0, again_cells = 0, again_hashes = 0;
+    size_t var_id = 0, next_id;
+    double exact, estimate;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    std::string input;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* 3^8 choices for the pairs, halved by a parity statement. */
+    for (int i = 0; i < 8; ++i)
+    {
+        input +=
+            "a" + std::to_string(i) + " ∨ b" + std::to_string(i) + "; ";
+    }
+
+    input += "a0 ⊻ a1 ⊻ b7;";
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+    for (int i = 0; i < 8; ++i)
+    {
+        projection.push_back(var(context, ("a" + std::to_string(i)).c_str()));
+        projection.push_back(var(context, ("b" + std::to_string(i)).c_str()));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_count_models(
+                    &result, &words, &word_count, context, projection.data(),
+                    projection.size()));
+    TEST_ASSERT(1 == word_count);
+    exact = words[0];
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection.data(),
+                    projection.size(), 0.8, 0.2, 42));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(hashes > 0);
+    estimate = (double)cells * (double)((uint64_t)1 << hashes);
+    TEST_EXPECT(estimate <= exact * 1.8);
+    TEST_EXPECT(estimate >= exact / 1.8);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_approx_count_models(
+                    &result, &again_cells, &again_hashes, context,
+                    projection.data(), projection.size(), 0.8, 0.2, 42));
+    TEST_EXPECT(cells == again_cells);
+    TEST_EXPECT(hashes == again_hashes);
+
+    /* the hashes, their variables, and their scopes are gone. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_count_models(
+                    &result, &words, &word_count, context, projection.data(),
+                    projection.size()));
+    TEST_ASSERT(1 == word_count);
+    TEST_EXPECT(exact == words[0]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &next_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(var_id + 1 == next_id);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Bad options, unknown variables, and frozen contexts are rejected.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t projection[1] = { 0 };
+    size_t cells = 0, hashes = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 1, 0.0,
+                    0.2, 1));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 1, 0.8,
+                    1.0, 1));
+
+    projection[0] = 7;
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_VARIABLE
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 1, 0.8,
+                    0.2, 1));
+
+    projection[0] = 0;
+    libsat_context_freeze(context);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_approx_count_models(
+                    &result, &cells, &hashes, context, projection, 1, 0.8,
+                    0.2, 1));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,418 @@
+/**
+ * \file solver/test_libsat_context_pop.cpp
+ *
+ * \brief Unit tests for libsat_context_push and libsat_context_pop.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_pop);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the positive literal for a named variable.
+ */
+static libsat_literal lit(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (libsat_literal)-1;
+    }
+
+    return LIBSAT_LITERAL_MAKE(var_id, false);
+}
+
+/**
+ * Solve with the given assumptions and return the result.
+ */
+static int solve(
+    libsat_context* context, const libsat_literal* lits, size_t count)
+{
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_solve_with_assumptions(&result, context, lits, count))
+    {
+        return -1;
+    }
+
+    return result;
+}
+
+/**
+ * Popping without a scope fails.
+ */
+TEST(pop_without_push)
+{
+    allocator* alloc;
+    libsat_context* context;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_EXPECT(ERROR_LIBSAT_SOLVER_NO_SCOPE == libsat_context_pop(context));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_EXPECT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_EXPECT(ERROR_LIBSAT_SOLVER_NO_SCOPE == libsat_context_pop(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A contradiction asserted in a scope is retracted by the pop.
+ */
+TEST(retract_statement)
+{
+    allocator* alloc;
+    libsat_context* context;
+    const libsat_literal* core;
+    size_t core_count = 1;
+    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b; a → c;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(
+        STATUS_SUCCESS == assert_input(context, R"(¬c; ¬b ∨ ¬a ∧ d; ¬d;)"));
+
+    /* the scope is unsatisfiable, but the core holds no assumptions. */
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, nullptr, 0));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_EXPECT(0 == core_count);
+
+    /* after the pop, a can be true again. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    libsat_literal assume = lit(context, "a");
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, &assume, 1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_model_value(
+                    &val, context, LIBSAT_LITERAL_VARIABLE(lit(context, "c"))));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == val);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Variables created in a popped scope are forgotten, and their ids reused.
+ */
+TEST(reuse_variable_ids)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t first, unique, reused;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &first, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+
+    /* the scope creates a named variable, unique ids and auxiliaries. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∧ c ∨ b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &unique, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_ASSERT(unique > first + 1);
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, nullptr, 0));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+
+    /* c is gone, but a and b remain. */
+    TEST_EXPECT((libsat_literal)-1 == lit(context, "c"));
+    TEST_EXPECT((libsat_literal)-1 != lit(context, "a"));
+    TEST_EXPECT((libsat_literal)-1 != lit(context, "b"));
+
+    /* the next unique id picks up where the scope started. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &reused, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(first + 1 == reused);
+
+    /* a reused id starts out unconstrained. */
+    libsat_literal assume = LIBSAT_LITERAL_MAKE(reused, true);
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, &assume, 1));
+    assume = LIBSAT_LITERAL_MAKE(reused, false);
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, &assume, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Nested scopes are retracted one at a time.
+ */
+TEST(nested_scopes)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[2];
+    const libsat_literal* core;
+    size_t core_count = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b ∨ c;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a → b;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(¬b;)"));
+
+    /* assuming a fails, and the core only names a. */
+    lits[0] = lit(context, "a");
+    lits[1] = LIBSAT_LITERAL_NEGATE(lit(context, "b"));
+    TEST_ASSERT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, lits, 1));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_ASSERT(1 == core_count);
+    TEST_EXPECT(lits[0] == core[0]);
+
+    /* without the inner scope, a forces b. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 1));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, lits, 2));
+
+    /* without either scope, a and ¬b are fine. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 2));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Parity statements and native constraints in a scope are retracted too.
+ */
+TEST(scoped_parity_and_native)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[3];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b ∨ c;)"));
+    lits[0] = lit(context, "a");
+    lits[1] = lit(context, "b");
+    lits[2] = lit(context, "c");
+
+    /* in the scope, a ⊻ b and at most one of a, b, c. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ⊻ b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_cardinality(
+                    libsat_context_cnf(context), lits, 3,
+                    LIBSAT_CNF_RELATION_AT_MOST, 1,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, lits, 2));
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, lits + 1, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 1));
+
+    /* after the pop, all three can hold. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_EXPECT(0 == libsat_cnf_native_count(libsat_context_cnf(context)));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 3));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Repeatedly deepening and retracting random clauses agrees with brute force.
+ */
+TEST(random_push_pop)
+{
+    std::mt19937 rng(4321);
+    const size_t vars = 8;
+    allocator* alloc;
+    libsat_context* context;
+    std::vector<std::vector<int>> clauses;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* declare every variable first, so that x<i> has id i. */
+    for (size_t v = 0; v < vars; ++v)
+    {
+        size_t var_id;
+        std::string name = "x" + std::to_string(v);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &var_id, context, name.c_str(),
+                        LIBSAT_VARIABLE_GET_CREATE));
+    }
+
+    for (int round = 0; round < 150; ++round)
+    {
+        std::string input;
+        size_t base = clauses.size();
+        size_t count = 1 + rng() % 6;
+        bool expected = false;
+        bool keep = (0 == rng() % 10);
+
+        if (!keep)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+        }
+
+        /* add some random 3-clauses, written with auxiliaries. */
+        for (size_t c = 0; c < count; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+            }
+
+            /* the middle literal is repeated in a conjunction. */
+            for (int k = 0; k < 4; ++k)
+            {
+                int l = clause[(k + 1) / 2];
+
+                input += (0 == k ? "" : (2 == k ? " ∧ " : " ∨ "));
+                input += (l > 0 ? "x" : "¬x") + std::to_string(std::abs(l) - 1);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+        /* brute force. */
+        for (unsigned m = 0; m < (1u << vars) && !expected; ++m)
+        {
+            bool all = true;
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    int v = (l > 0 ? l : -l) - 1;
+                    any |= (((m >> v) & 1) != 0) == (l > 0);
+                }
+                all &= any;
+            }
+            expected = all;
+        }
+
+        TEST_ASSERT(
+            (expected
+                ? LIBSAT_SOLVE_RESULT_SATISFIABLE
+                : LIBSAT_SOLVE_RESULT_UNSATISFIABLE)
+                    == solve(context, nullptr, 0));
+
+        /* retract, unless this round keeps its clauses. */
+        if (!keep)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+            clauses.resize(base);
+        }
+        else if (!expected)
+        {
+            break;
+        }
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
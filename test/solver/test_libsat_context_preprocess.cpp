@@ -0,0 +1,600 @@
+/**
+ * \file solver/test_libsat_context_preprocess.cpp
+ *
+ * \brief Unit tests for libsat_context_preprocess.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_preprocess);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the positive literal for a named variable.
+ */
+static libsat_literal lit(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (libsat_literal)-1;
+    }
+
+    return LIBSAT_LITERAL_MAKE(var_id, false);
+}
+
+/**
+ * Get the model value of a named variable.
+ */
+static uint8_t value(libsat_context* context, const char* name)
+{
+    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_model_value(
+                    &val, context, LIBSAT_LITERAL_VARIABLE(lit(context, name))))
+    {
+        return LIBSAT_VALUE_UNASSIGNED;
+    }
+
+    return val;
+}
+
+/**
+ * Solve with the given assumptions and return the result.
+ */
+static int solve(
+    libsat_context* context, const libsat_literal* lits, size_t count)
+{
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_solve_with_assumptions(&result, context, lits, count))
+    {
+        return -1;
+    }
+
+    return result;
+}
+
+/**
+ * Preprocessing is refused while a scope is open or the context is frozen.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b;)"));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_SCOPE_OPEN == libsat_context_preprocess(context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+
+    libsat_context_freeze(context);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_context_preprocess(context));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+
+    TEST_EXPECT(STATUS_SUCCESS == libsat_context_preprocess(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A chain of definitions shrinks, and the model still gives every defined
+ * variable the value of its definition.
+ */
+TEST(definitions_shrink)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_cnf* cnf;
+    std::string input;
+    size_t before;
+    const size_t links = 30;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* t0 ↔ x0 ∧ x1, and each link alternates ∨ and ∧ with the next x. */
+    input = "t0 ↔ x0 ∧ x1; ";
+    for (size_t i = 1; i < links; ++i)
+    {
+        input += "t" + std::to_string(i) + " ↔ t" + std::to_string(i - 1);
+        input += (i % 2) ? " ∨ x" : " ∧ x";
+        input += std::to_string(i + 1) + "; ";
+    }
+
+    input += "t" + std::to_string(links - 1) + ";";
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+    cnf = libsat_context_cnf(context);
+    before = libsat_cnf_clause_count(cnf);
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+    TEST_EXPECT(libsat_cnf_clause_count(cnf) < before);
+
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, nullptr, 0));
+
+    /* every definition holds in the model. */
+    bool t =
+        LIBSAT_VALUE_TRUE == value(context, "x0")
+     && LIBSAT_VALUE_TRUE == value(context, "x1");
+    TEST_EXPECT(
+        (t ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE) == value(context, "t0"));
+    for (size_t i = 1; i < links; ++i)
+    {
+        std::string x = "x" + std::to_string(i + 1);
+        std::string name = "t" + std::to_string(i);
+        bool xv = LIBSAT_VALUE_TRUE == value(context, x.c_str());
+
+        t = (i % 2) ? (t || xv) : (t && xv);
+        TEST_EXPECT(
+            (t ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE)
+                == value(context, name.c_str()));
+    }
+
+    TEST_EXPECT(t);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A variable that is eliminated and then used again is added back, along
+ * with every clause it needs.
+ */
+TEST(reactivate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[2];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* every variable is pure in turn, so all of them are eliminated. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a → b; b → c;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+    TEST_EXPECT(0 == libsat_cnf_clause_count(libsat_context_cnf(context)));
+
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, nullptr, 0));
+    TEST_EXPECT(
+        LIBSAT_VALUE_FALSE == value(context, "a")
+     || LIBSAT_VALUE_TRUE == value(context, "b"));
+    TEST_EXPECT(
+        LIBSAT_VALUE_FALSE == value(context, "b")
+     || LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    /* assumptions bring back the chain from a to c. */
+    lits[0] = lit(context, "a");
+    lits[1] = LIBSAT_LITERAL_NEGATE(lit(context, "c"));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, lits, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 1));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    /* so does a new assertion, after another round of preprocessing. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a; ¬c;)"));
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, nullptr, 0));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Scopes opened after preprocessing see every original clause.
+ */
+TEST(push_after_preprocess)
+{
+    allocator* alloc;
+    libsat_context* context;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == assert_input(context, R"(a ∨ b; a → c; b → c;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(¬c;)"));
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, nullptr, 0));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Variables in native constraints are kept, so the constraints still hold.
+ */
+TEST(native_constraints_kept)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[3];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b ∨ c;)"));
+    lits[0] = lit(context, "a");
+    lits[1] = lit(context, "b");
+    lits[2] = lit(context, "c");
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_cardinality(
+                    libsat_context_cnf(context), lits, 3,
+                    LIBSAT_CNF_RELATION_AT_MOST, 1,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+    TEST_EXPECT(1 == libsat_cnf_clause_count(libsat_context_cnf(context)));
+
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 1));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "c"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random formulas keep their result, and every model satisfies the original
+ * clauses.
+ */
+TEST(random_formulas)
+{
+    std::mt19937 rng(34);
+    const size_t vars = 40;
+
+    for (int round = 0; round < 60; ++round)
+    {
+        allocator* alloc;
+        libsat_context* plain;
+        libsat_context* context;
+        std::vector<std::vector<int>> clauses;
+        std::string input;
+        size_t count = 120 + 3 * round;
+        int expected, result;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&plain, alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, plain, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t c = 0; c < count; ++c)
+        {
+            std::vector<int> clause;
+            int width = 2 + (int)(rng() % 3);
+
+            for (int k = 0; k < width; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+                input += (k > 0 ? " ∨ " : "");
+                input += (neg ? "¬x" : "x") + std::to_string(v);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(plain, input.c_str()));
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+
+        expected = solve(plain, nullptr, 0);
+        result = solve(context, nullptr, 0);
+        TEST_ASSERT(expected == result);
+
+        /* the reconstructed model satisfies every original clause. */
+        if (LIBSAT_SOLVE_RESULT_SATISFIABLE == result)
+        {
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    uint8_t val;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+                TEST_ASSERT(any);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(plain)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * A cycle of implications is replaced by a single variable, and the model
+ * still gives every variable of the cycle the same value.
+ */
+TEST(equivalent_literals)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[1];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* a, b, and ¬c are equivalent. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(
+                    context,
+                    R"(a → b; b → ¬c; ¬c → a; a ∨ d ∨ e; c ∨ ¬d ∨ f;
+                       b ∨ ¬e ∨ ¬f;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+
+    lits[0] = LIBSAT_LITERAL_NEGATE(lit(context, "b"));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, lits, 1));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    /* later statements see the equivalence as well. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(c;)"));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "b"));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a;)"));
+    TEST_EXPECT(
+        LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context, nullptr, 0));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random formulas with cycles of implications keep their result, and every
+ * model satisfies the original clauses.
+ */
+TEST(random_equivalences)
+{
+    std::mt19937 rng(35);
+    const size_t vars = 30;
+
+    for (int round = 0; round < 60; ++round)
+    {
+        allocator* alloc;
+        libsat_context* plain;
+        libsat_context* context;
+        std::vector<std::vector<int>> clauses;
+        std::string input;
+        size_t cycles = 4 + round % 8;
+        size_t count = 50 + round;
+        int expected, result;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&plain, alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, plain, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        /* each cycle l0 → l1 → ... → l0 makes its literals equivalent. */
+        for (size_t c = 0; c < cycles; ++c)
+        {
+            std::vector<int> cycle;
+            size_t length = 2 + rng() % 3;
+
+            for (size_t k = 0; k < length; ++k)
+            {
+                int v = (int)(rng() % vars) + 1;
+
+                cycle.push_back((rng() & 1) ? -v : v);
+            }
+
+            for (size_t k = 0; k < length; ++k)
+            {
+                clauses.push_back({ -cycle[k], cycle[(k + 1) % length] });
+            }
+        }
+
+        for (size_t c = 0; c < count; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars) + 1;
+
+                clause.push_back((rng() & 1) ? -v : v);
+            }
+
+            clauses.push_back(clause);
+        }
+
+        for (auto& clause : clauses)
+        {
+            for (size_t k = 0; k < clause.size(); ++k)
+            {
+                input += (k > 0 ? " ∨ " : "");
+                input += (clause[k] < 0 ? "¬x" : "x");
+                input +=
+                    std::to_string(
+                        (clause[k] < 0 ? -clause[k] : clause[k]) - 1);
+            }
+
+            input += "; ";
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(plain, input.c_str()));
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+
+        expected = solve(plain, nullptr, 0);
+        result = solve(context, nullptr, 0);
+        TEST_ASSERT(expected == result);
+
+        /* the reconstructed model satisfies every original clause. */
+        if (LIBSAT_SOLVE_RESULT_SATISFIABLE == result)
+        {
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    uint8_t val;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+                TEST_ASSERT(any);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(plain)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
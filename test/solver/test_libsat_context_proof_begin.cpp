@@ -0,0 +1,749 @@
+/**
+ * \file solver/test_libsat_context_proof_begin.cpp
+ *
+ * \brief Unit tests for libsat_context_proof_begin.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <map>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_context_proof_begin);
+
+/**
+ * A step of a binary proof: an added or deleted clause, with its number and
+ * hints in LRAT.
+ */
+struct proof_step
+{
+    bool add;
+    uint64_t id;
+    std::vector<libsat_literal> lits;
+    std::vector<uint64_t> hints;
+};
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the positive literal of a named variable.
+ */
+static libsat_literal lit(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (libsat_literal)-1;
+    }
+
+    return LIBSAT_LITERAL_MAKE(var_id, false);
+}
+
+/**
+ * Check whether a proof adds the given lemma, in any order.
+ */
+static bool has_lemma(
+    const std::vector<proof_step>& steps, std::vector<libsat_literal> lemma)
+{
+    std::sort(lemma.begin(), lemma.end());
+
+    for (const proof_step& step : steps)
+    {
+        std::vector<libsat_literal> sorted = step.lits;
+
+        std::sort(sorted.begin(), sorted.end());
+        if (step.add && sorted == lemma)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Build statements saying that the pigeons fit in the holes.
+ */
+static std::string pigeonhole(size_t pigeons, size_t holes)
+{
+    std::string input;
+
+    /* every pigeon is in some hole. */
+    for (size_t p = 0; p < pigeons; ++p)
+    {
+        for (size_t h = 0; h < holes; ++h)
+        {
+            input += (h > 0 ? " ∨ " : "");
+            input += "p" + std::to_string(p) + "h" + std::to_string(h);
+        }
+
+        input += "; ";
+    }
+
+    /* no two pigeons share a hole. */
+    for (size_t h = 0; h < holes; ++h)
+    {
+        for (size_t p = 0; p < pigeons; ++p)
+        {
+            for (size_t q = p + 1; q < pigeons; ++q)
+            {
+                input +=
+                    "¬p" + std::to_string(p) + "h" + std::to_string(h)
+                  + " ∨ ¬p" + std::to_string(q) + "h" + std::to_string(h)
+                  + "; ";
+            }
+        }
+    }
+
+    return input;
+}
+
+/**
+ * Build statements with a failed literal, x, and a literal that both phases of
+ * z imply, w, for probing to find.
+ */
+static std::string probe_gadget()
+{
+    return
+        "¬z ∨ a1; ¬a1 ∨ w; z ∨ a2; ¬a2 ∨ w; "
+        "¬x ∨ y; ¬x ∨ ¬y; ";
+}
+
+/**
+ * Get the clauses of the database of a context.
+ */
+static std::vector<std::vector<libsat_literal>> database(
+    libsat_context* context)
+{
+    libsat_cnf* cnf = libsat_context_cnf(context);
+    std::vector<std::vector<libsat_literal>> clauses;
+
+    for (size_t i = 0; i < libsat_cnf_clause_count(cnf); ++i)
+    {
+        const libsat_literal* lits;
+        size_t size;
+
+        if (STATUS_SUCCESS != libsat_cnf_clause_get(&lits, &size, cnf, i))
+        {
+            break;
+        }
+
+        clauses.emplace_back(lits, lits + size);
+    }
+
+    return clauses;
+}
+
+/**
+ * Read back everything written to a file.
+ */
+static std::vector<uint8_t> contents(FILE* file)
+{
+    std::vector<uint8_t> bytes;
+    int ch;
+
+    rewind(file);
+    while (EOF != (ch = fgetc(file)))
+    {
+        bytes.push_back((uint8_t)ch);
+    }
+
+    return bytes;
+}
+
+/**
+ * Decode a number written seven bits at a time.
+ */
+static bool get(uint64_t* value, const std::vector<uint8_t>& bytes, size_t* i)
+{
+    unsigned shift = 0;
+
+    *value = 0;
+    while (*i < bytes.size() && shift < 64)
+    {
+        uint8_t byte = bytes[(*i)++];
+
+        *value |= (uint64_t)(byte & 0x7f) << shift;
+        if (0 == (byte & 0x80))
+        {
+            return true;
+        }
+
+        shift += 7;
+    }
+
+    return false;
+}
+
+/**
+ * Decode the steps of a binary DRAT or LRAT proof.
+ */
+static bool decode(
+    std::vector<proof_step>* steps, const std::vector<uint8_t>& bytes,
+    bool lrat)
+{
+    size_t i = 0;
+    uint64_t value;
+
+    while (i < bytes.size())
+    {
+        proof_step step;
+        uint8_t marker = bytes[i++];
+
+        if ('a' != marker && 'd' != marker)
+        {
+            return false;
+        }
+
+        step.add = 'a' == marker;
+        step.id = 0;
+
+        /* an LRAT deletion lists numbers instead of literals. */
+        if (lrat && !step.add)
+        {
+            while (get(&value, bytes, &i) && 0 != value)
+            {
+                step.hints.push_back(value / 2);
+            }
+
+            steps->push_back(step);
+            continue;
+        }
+
+        if (lrat)
+        {
+            if (!get(&value, bytes, &i))
+            {
+                return false;
+            }
+
+            step.id = value / 2;
+        }
+
+        while (get(&value, bytes, &i) && 0 != value)
+        {
+            step.lits.push_back((libsat_literal)(value - 2));
+        }
+
+        if (lrat)
+        {
+            while (get(&value, bytes, &i) && 0 != value)
+            {
+                step.hints.push_back(value / 2);
+            }
+        }
+
+        steps->push_back(step);
+    }
+
+    return true;
+}
+
+/**
+ * Get the value of a literal under a partial assignment.
+ */
+static int lit_value(
+    const std::map<size_t, bool>& assignment, libsat_literal lit)
+{
+    auto found = assignment.find(LIBSAT_LITERAL_VARIABLE(lit));
+
+    if (assignment.end() == found)
+    {
+        return 0;
+    }
+
+    return (found->second != LIBSAT_LITERAL_IS_NEGATED(lit)) ? 1 : -1;
+}
+
+/**
+ * Assume the negation of a lemma.
+ */
+static std::map<size_t, bool> negation(const std::vector<libsat_literal>& lemma)
+{
+    std::map<size_t, bool> assignment;
+
+    for (libsat_literal lit : lemma)
+    {
+        assignment[LIBSAT_LITERAL_VARIABLE(lit)] =
+            LIBSAT_LITERAL_IS_NEGATED(lit);
+    }
+
+    return assignment;
+}
+
+/**
+ * Check an LRAT proof against the database, and count its empty clauses.
+ */
+static bool check_lrat(
+    size_t* empty, const std::vector<std::vector<libsat_literal>>& db,
+    const std::vector<proof_step>& steps)
+{
+    std::map<uint64_t, std::vector<libsat_literal>> clauses;
+    uint64_t last = db.size();
+
+    for (size_t i = 0; i < db.size(); ++i)
+    {
+        clauses[i + 1] = db[i];
+    }
+
+    *empty = 0;
+    for (const proof_step& step : steps)
+    {
+        if (!step.add)
+        {
+            for (uint64_t id : step.hints)
+            {
+                if (0 == clauses.erase(id))
+                {
+                    return false;
+                }
+            }
+
+            continue;
+        }
+
+        /* numbers only grow. */
+        if (step.id <= last)
+        {
+            return false;
+        }
+
+        last = step.id;
+
+        /* each hint is unit under the negated lemma, until one conflicts. */
+        std::map<size_t, bool> assignment = negation(step.lits);
+        bool conflict = false;
+
+        for (uint64_t id : step.hints)
+        {
+            auto found = clauses.find(id);
+            libsat_literal unit = 0;
+            size_t open = 0;
+
+            if (clauses.end() == found || conflict)
+            {
+                return false;
+            }
+
+            for (libsat_literal lit : found->second)
+            {
+                int value = lit_value(assignment, lit);
+
+                if (value > 0)
+                {
+                    return false;
+                }
+
+                if (0 == value)
+                {
+                    unit = lit;
+                    open += 1;
+                }
+            }
+
+            if (0 == open)
+            {
+                conflict = true;
+            }
+            else if (1 == open)
+            {
+                assignment[LIBSAT_LITERAL_VARIABLE(unit)] =
+                    !LIBSAT_LITERAL_IS_NEGATED(unit);
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (!conflict)
+        {
+            return false;
+        }
+
+        clauses[step.id] = step.lits;
+        if (step.lits.empty())
+        {
+            *empty += 1;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Check a DRAT proof of clauses that each follow by unit propagation, and
+ * count its empty clauses.
+ */
+static bool check_drat(
+    size_t* empty, const std::vector<std::vector<libsat_literal>>& db,
+    const std::vector<proof_step>& steps)
+{
+    std::vector<std::vector<libsat_literal>> clauses = db;
+
+    *empty = 0;
+    for (const proof_step& step : steps)
+    {
+        std::vector<libsat_literal> sorted = step.lits;
+
+        std::sort(sorted.begin(), sorted.end());
+
+        if (!step.add)
+        {
+            auto found =
+                std::find_if(
+                    clauses.begin(), clauses.end(),
+                    [&](std::vector<libsat_literal> clause) {
+                        std::sort(clause.begin(), clause.end());
+                        return clause == sorted; });
+            if (clauses.end() == found)
+            {
+                return false;
+            }
+
+            clauses.erase(found);
+            continue;
+        }
+
+        /* propagate the negated lemma until it conflicts. */
+        std::map<size_t, bool> assignment = negation(step.lits);
+        bool conflict = false, progress = true;
+
+        while (progress && !conflict)
+        {
+            progress = false;
+            for (const auto& clause : clauses)
+            {
+                libsat_literal unit = 0;
+                size_t open = 0;
+                bool satisfied = false;
+
+                for (libsat_literal lit : clause)
+                {
+                    int value = lit_value(assignment, lit);
+
+                    satisfied = satisfied || value > 0;
+                    if (0 == value)
+                    {
+                        unit = lit;
+                        open += 1;
+                    }
+                }
+
+                if (satisfied || open > 1)
+                {
+                    continue;
+                }
+
+                if (0 == open)
+                {
+                    conflict = true;
+                    break;
+                }
+
+                assignment[LIBSAT_LITERAL_VARIABLE(unit)] =
+                    !LIBSAT_LITERAL_IS_NEGATED(unit);
+                progress = true;
+            }
+        }
+
+        if (!conflict)
+        {
+            return false;
+        }
+
+        clauses.push_back(step.lits);
+        if (step.lits.empty())
+        {
+            *empty += 1;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Solve an unsatisfiable database while writing a proof in the given format,
+ * and check the proof. The database is big enough for inprocessing to run.
+ */
+static bool prove(size_t pigeons, size_t holes, int format, size_t* empty)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    std::vector<proof_step> steps;
+    bool lrat = LIBSAT_PROOF_FORMAT_LRAT == format;
+    bool checked = false;
+    FILE* file = tmpfile();
+
+    if (
+        nullptr == file
+     || STATUS_SUCCESS != malloc_allocator_create(&alloc))
+    {
+        return false;
+    }
+
+    if (
+        STATUS_SUCCESS == libsat_context_create(&context, alloc)
+     && STATUS_SUCCESS
+            == assert_input(
+                    context,
+                    (probe_gadget() + pigeonhole(pigeons, holes)).c_str())
+     && STATUS_SUCCESS
+            == libsat_context_proof_begin(context, fileno(file), format)
+     && STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0)
+     && LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result
+     && STATUS_SUCCESS == libsat_context_proof_end(context)
+     && decode(&steps, contents(file), lrat))
+    {
+        checked =
+            lrat
+                ? check_lrat(empty, database(context), steps)
+                : check_drat(empty, database(context), steps);
+    }
+
+    fclose(file);
+    if (
+        STATUS_SUCCESS
+            != resource_release(libsat_context_resource_handle(context))
+     || STATUS_SUCCESS
+            != resource_release(allocator_resource_handle(alloc)))
+    {
+        return false;
+    }
+
+    return checked;
+}
+
+/**
+ * An LRAT proof of the pigeonhole principle checks step by step against the
+ * database, through inprocessing and reduction, and ends with the empty
+ * clause.
+ */
+TEST(lrat)
+{
+    size_t empty = 0;
+
+    TEST_ASSERT(prove(8, 7, LIBSAT_PROOF_FORMAT_LRAT, &empty));
+    TEST_EXPECT(empty >= 1);
+}
+
+/**
+ * Each lemma of a DRAT proof follows from the clauses before it by unit
+ * propagation.
+ */
+TEST(drat)
+{
+    size_t empty = 0;
+
+    TEST_ASSERT(prove(6, 5, LIBSAT_PROOF_FORMAT_DRAT, &empty));
+    TEST_EXPECT(empty >= 1);
+}
+
+/**
+ * Under assumptions, the proof ends with the negation of the failed
+ * assumptions instead of the empty clause.
+ */
+TEST(assumptions)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    libsat_literal assumptions[2];
+    size_t empty = 0;
+    std::vector<proof_step> steps;
+    FILE* file = tmpfile();
+
+    TEST_ASSERT(nullptr != file);
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(
+                    context, R"(a ∨ b; ¬a ∨ c; ¬b ∨ c; ¬p ∨ q; ¬q ∨ r;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_proof_begin(
+                    context, fileno(file), LIBSAT_PROOF_FORMAT_LRAT));
+
+    /* c is learned as a fact, which the assumption contradicts. */
+    assumptions[0] = LIBSAT_LITERAL_NEGATE(lit(context, "c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 1));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    /* r follows from p through q. */
+    assumptions[0] = lit(context, "p");
+    assumptions[1] = LIBSAT_LITERAL_NEGATE(lit(context, "r"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 2));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    /* the database stays satisfiable, and the proof carries on. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_proof_end(context));
+
+    TEST_ASSERT(decode(&steps, contents(file), true));
+    TEST_ASSERT(check_lrat(&empty, database(context), steps));
+    TEST_EXPECT(0 == empty);
+
+    /* each core is negated in the proof. */
+    TEST_EXPECT(has_lemma(steps, { lit(context, "c") }));
+    TEST_EXPECT(
+        has_lemma(
+            steps,
+            { LIBSAT_LITERAL_NEGATE(lit(context, "p")), lit(context, "r") }));
+
+    fclose(file);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Proofs are refused where they could not be checked, and a solve reports a
+ * proof that could not be written.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    FILE* file = tmpfile();
+
+    TEST_ASSERT(nullptr != file);
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b; ¬a;)"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_NO_PROOF == libsat_context_proof_end(context));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_context_proof_begin(context, fileno(file), 99));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_proof_begin(
+                    context, fileno(file), LIBSAT_PROOF_FORMAT_DRAT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_ACTIVE
+            == libsat_context_proof_begin(
+                    context, fileno(file), LIBSAT_PROOF_FORMAT_DRAT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_ACTIVE
+            == libsat_context_preprocess(context));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 2));
+
+    /* a proof only covers the database it began with. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(c ∨ d;)"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_STALE
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(STATUS_SUCCESS == libsat_context_proof_end(context));
+
+    /* once the context has solved, the proof would miss what it knows. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED
+            == libsat_context_proof_begin(
+                    context, fileno(file), LIBSAT_PROOF_FORMAT_DRAT));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+
+    /* parity statements are solved natively, and have no clauses. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ⊻ b ⊻ c;)"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_UNSUPPORTED
+            == libsat_context_proof_begin(
+                    context, fileno(file), LIBSAT_PROOF_FORMAT_LRAT));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+
+    /* a proof that cannot be written fails the solve. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS == assert_input(context, R"(a ∨ b; ¬a; ¬b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_proof_begin(
+                    context, -1, LIBSAT_PROOF_FORMAT_DRAT));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_WRITE
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_PROOF_WRITE
+            == libsat_context_proof_end(context));
+
+    fclose(file);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,460 @@
+/**
+ * \file solver/test_libsat_count_models.cpp
+ *
+ * \brief Unit tests for libsat_count_models.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_count_models);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the id of a named variable.
+ */
+static size_t var(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * Count the models of a context, as a small number.
+ */
+static uint64_t count_small(
+    int* result, libsat_context* context, const size_t* projection,
+    size_t projection_count)
+{
+    const uint32_t* words = nullptr;
+    size_t word_count = 0;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_count_models(
+                    result, &words, &word_count, context, projection,
+                    projection_count)
+     || word_count > 2)
+    {
+        return (uint64_t)-1;
+    }
+
+    return
+        (0 == word_count) ? 0
+      : (1 == word_count) ? words[0]
+      : ((uint64_t)words[1] << 32) | words[0];
+}
+
+/**
+ * Small counts, over every variable, some of them, and none of them.
+ */
+TEST(small_counts)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t projection[3];
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b ∨ c;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "c");
+
+    TEST_EXPECT(7 == count_small(&result, context, projection, 3));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(2 == count_small(&result, context, projection, 1));
+    TEST_EXPECT(1 == count_small(&result, context, nullptr, 0));
+
+    /* a scope restricts the count until it is popped. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬a; ¬b;"));
+    TEST_EXPECT(1 == count_small(&result, context, projection, 3));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬c;"));
+    TEST_EXPECT(0 == count_small(&result, context, projection, 3));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(0 == count_small(&result, context, nullptr, 0));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_EXPECT(7 == count_small(&result, context, projection, 3));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random formulas with parity statements and native cardinality constraints,
+ * projected onto some of their variables, agree with brute force, before and
+ * after preprocessing.
+ */
+TEST(random_projection)
+{
+    std::mt19937 rng(31337);
+    const size_t vars = 12;
+
+    for (int round = 0; round < 60; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        std::vector<std::vector<int>> clauses;
+        std::vector<std::vector<int>> parities;
+        std::vector<int> at_most;
+        size_t shown = 3 + rng() % (vars - 2);
+        std::vector<bool> projected(1u << shown, false);
+        std::vector<size_t> projection;
+        uint64_t expected = 0;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        std::string input;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t i = 0; i < shown; ++i)
+        {
+            projection.push_back(i);
+        }
+
+        for (size_t c = 0; c < 3 + rng() % 14; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                int l = (rng() & 1) ? -(v + 1) : (v + 1);
+
+                input += (0 == k ? "" : " ∨ ");
+                input += (l > 0 ? "x" : "¬x") + std::to_string(v);
+                clause.push_back(l);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        /* a parity statement over distinct variables. */
+        if (0 == round % 2)
+        {
+            std::vector<int> parity;
+            int first = (int)(rng() % (vars - 2));
+
+            for (int v = first; v < first + 3; ++v)
+            {
+                input += (v == first ? "x" : " ⊻ x") + std::to_string(v);
+                parity.push_back(v);
+            }
+
+            input += "; ";
+            parities.push_back(parity);
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+        /* at most two of a few variables. */
+        if (0 == round % 3)
+        {
+            libsat_literal lits[4];
+
+            for (int i = 0; i < 4; ++i)
+            {
+                int v = (int)(rng() % vars);
+
+                lits[i] = LIBSAT_LITERAL_MAKE((size_t)v, false);
+                at_most.push_back(v);
+            }
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_cnf_add_cardinality(
+                            libsat_context_cnf(context), lits, 4,
+                            LIBSAT_CNF_RELATION_AT_MOST, 2,
+                            LIBSAT_CNF_ENCODING_NATIVE));
+        }
+
+        /* brute force. */
+        for (unsigned m = 0; m < (1u << vars); ++m)
+        {
+            bool all = true;
+            int ones = 0;
+
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    int v = (l > 0 ? l : -l) - 1;
+                    any |= (((m >> v) & 1) != 0) == (l > 0);
+                }
+                all &= any;
+            }
+
+            for (auto& parity : parities)
+            {
+                int odd = 0;
+                for (int v : parity)
+                {
+                    odd ^= (m >> v) & 1;
+                }
+                all &= (1 == odd);
+            }
+
+            for (int v : at_most)
+            {
+                ones += (m >> v) & 1;
+            }
+
+            all &= (ones <= 2);
+            if (all && !projected[m & ((1u << shown) - 1)])
+            {
+                projected[m & ((1u << shown) - 1)] = true;
+                expected += 1;
+            }
+        }
+
+        TEST_EXPECT(
+            expected
+                == count_small(
+                        &result, context, projection.data(), shown));
+        TEST_EXPECT(
+            (0 == expected
+                ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+                : LIBSAT_SOLVE_RESULT_SATISFIABLE)
+                    == result);
+
+        /* eliminated variables are counted through their removed clauses. */
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+        TEST_EXPECT(
+            expected
+                == count_small(
+                        &result, context, projection.data(), shown));
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Counts far beyond 64 bits come out exact: 3^600 for independent clauses,
+ * and 2^200 for free variables.
+ */
+TEST(large_counts)
+{
+    allocator* alloc;
+    libsat_context* context;
+    std::vector<size_t> projection;
+    std::vector<uint32_t> expected(1, 1);
+    const uint32_t* words = nullptr;
+    size_t word_count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    std::string input;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    for (int i = 0; i < 600; ++i)
+    {
+        input +=
+            "a" + std::to_string(i) + " ∨ b" + std::to_string(i) + "; ";
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+    for (int i = 0; i < 600; ++i)
+    {
+        projection.push_back(var(context, ("a" + std::to_string(i)).c_str()));
+        projection.push_back(var(context, ("b" + std::to_string(i)).c_str()));
+    }
+
+    /* 3^600. */
+    for (int i = 0; i < 600; ++i)
+    {
+        uint64_t carry = 0;
+
+        for (auto& word : expected)
+        {
+            carry += (uint64_t)word * 3;
+            word = (uint32_t)carry;
+            carry >>= 32;
+        }
+
+        if (0 != carry)
+        {
+            expected.push_back((uint32_t)carry);
+        }
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_count_models(
+                    &result, &words, &word_count, context, projection.data(),
+                    projection.size()));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_ASSERT(expected.size() == word_count);
+    for (size_t i = 0; i < word_count; ++i)
+    {
+        TEST_EXPECT(expected[i] == words[i]);
+    }
+
+    /* 200 more variables that nothing constrains. */
+    for (size_t i = 0; i < 200; ++i)
+    {
+        size_t var_id;
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_context_variable_get(
+                        &var_id, context, nullptr,
+                        LIBSAT_VARIABLE_GET_CREATE
+                      | LIBSAT_VARIABLE_GET_UNIQUE));
+        projection[i] = var_id;
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_count_models(
+                    &result, &words, &word_count, context, projection.data(),
+                    200));
+    TEST_ASSERT(7 == word_count);
+    for (size_t i = 0; i < 6; ++i)
+    {
+        TEST_EXPECT(0 == words[i]);
+    }
+
+    TEST_EXPECT(((uint32_t)1 << 8) == words[6]);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A request to terminate stops the count, and ends with it.
+ */
+TEST(terminate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t projection[2];
+    int result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+
+    libsat_context_terminate(context);
+    TEST_EXPECT(0 == count_small(&result, context, projection, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+    TEST_EXPECT(3 == count_small(&result, context, projection, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A projection variable must exist.
+ */
+TEST(bad_variable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    size_t projection[1] = { 5 };
+    const uint32_t* words = nullptr;
+    size_t word_count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_VARIABLE
+            == libsat_count_models(
+                    &result, &words, &word_count, context, projection, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,511 @@
+/**
+ * \file solver/test_libsat_enumerate_models.cpp
+ *
+ * \brief Unit tests for libsat_enumerate_models.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_enumerate_models);
+
+/**
+ * The models reported by an enumeration.
+ */
+struct collected
+{
+    std::vector<std::vector<uint8_t>> cubes;
+    size_t limit = (size_t)-1;
+};
+
+/**
+ * Collect a model, and stop once the limit is reached.
+ */
+static bool collect(void* user, const uint8_t* values, size_t count)
+{
+    collected* models = (collected*)user;
+
+    models->cubes.emplace_back(values, values + count);
+
+    return models->cubes.size() < models->limit;
+}
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the id of a named variable.
+ */
+static size_t var(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (size_t)-1;
+    }
+
+    return var_id;
+}
+
+/**
+ * Count the full assignments covered by a set of cubes.
+ */
+static size_t covered(const std::vector<std::vector<uint8_t>>& cubes)
+{
+    size_t total = 0;
+
+    for (auto& cube : cubes)
+    {
+        size_t free = 0;
+
+        for (uint8_t value : cube)
+        {
+            free += (LIBSAT_VALUE_UNASSIGNED == value);
+        }
+
+        total += (size_t)1 << free;
+    }
+
+    return total;
+}
+
+/**
+ * Return true if a full assignment, given as a bit mask, is in a cube.
+ */
+static bool in_cube(const std::vector<uint8_t>& cube, unsigned mask)
+{
+    for (size_t i = 0; i < cube.size(); ++i)
+    {
+        uint8_t want =
+            ((mask >> i) & 1) ? LIBSAT_VALUE_TRUE : LIBSAT_VALUE_FALSE;
+
+        if (LIBSAT_VALUE_UNASSIGNED != cube[i] && want != cube[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * The models of a clause are covered by fewer cubes than there are models,
+ * and the context is left as it was.
+ */
+TEST(prime_cubes)
+{
+    allocator* alloc;
+    libsat_context* context;
+    collected models;
+    size_t projection[3];
+    size_t count = 0;
+    size_t var_id = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b ∨ c;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "c");
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 3, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(count == models.cubes.size());
+    TEST_EXPECT(3 == count);
+    TEST_EXPECT(7 == covered(models.cubes));
+
+    /* every model is in exactly one cube, and no cube holds a ∧ b ∧ c false. */
+    for (unsigned mask = 0; mask < 8; ++mask)
+    {
+        size_t hits = 0;
+
+        for (auto& cube : models.cubes)
+        {
+            hits += in_cube(cube, mask);
+        }
+
+        TEST_EXPECT((0 == mask ? 0U : 1U) == hits);
+    }
+
+    /* the blocking clauses and their scope are gone. */
+    result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(3 == var_id);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A variable picked for one clause is left out again once a later pick covers
+ * that clause too.
+ */
+TEST(shared_pick)
+{
+    allocator* alloc;
+    libsat_context* context;
+    collected models;
+    size_t projection[3];
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬b ∨ ¬a; ¬c ∨ ¬b;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "c");
+
+    /* ¬b covers both clauses, so its cube leaves out a and c. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 3, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(count < 5);
+    TEST_EXPECT(5 == covered(models.cubes));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random formulas projected onto some of their variables agree with brute
+ * force, and the cubes reported never overlap.
+ */
+TEST(random_projection)
+{
+    std::mt19937 rng(2718);
+    const size_t vars = 8;
+    const size_t shown = 5;
+
+    for (int round = 0; round < 40; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        collected models;
+        std::vector<std::vector<int>> clauses;
+        std::vector<bool> projected(1u << shown, false);
+        size_t projection[shown];
+        size_t count = 0;
+        size_t expected = 0;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        std::string input;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t i = 0; i < shown; ++i)
+        {
+            projection[i] = i;
+        }
+
+        for (size_t c = 0; c < 4 + rng() % 12; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                int l = (rng() & 1) ? -(v + 1) : (v + 1);
+
+                input += (0 == k ? "" : " ∨ ");
+                input += (l > 0 ? "x" : "¬x") + std::to_string(v);
+                clause.push_back(l);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+        /* brute force. */
+        for (unsigned m = 0; m < (1u << vars); ++m)
+        {
+            bool all = true;
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    int v = (l > 0 ? l : -l) - 1;
+                    any |= (((m >> v) & 1) != 0) == (l > 0);
+                }
+                all &= any;
+            }
+
+            if (all && !projected[m & ((1u << shown) - 1)])
+            {
+                projected[m & ((1u << shown) - 1)] = true;
+                expected += 1;
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_enumerate_models(
+                        &result, &count, context, projection, shown,
+                        &collect, &models));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+        TEST_EXPECT(expected == covered(models.cubes));
+
+        /* each projected model is in exactly one cube. */
+        for (unsigned mask = 0; mask < (1u << shown); ++mask)
+        {
+            size_t hits = 0;
+
+            for (auto& cube : models.cubes)
+            {
+                hits += in_cube(cube, mask);
+            }
+
+            TEST_EXPECT((projected[mask] ? 1U : 0U) == hits);
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Fixed variables, variables projected twice, and an empty projection are
+ * reported as full models.
+ */
+TEST(fixed_and_repeated)
+{
+    allocator* alloc;
+    libsat_context* context;
+    collected models;
+    size_t projection[3];
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a; a → b ∨ c;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "b");
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 3, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(2 == count);
+    for (auto& cube : models.cubes)
+    {
+        TEST_EXPECT(LIBSAT_VALUE_TRUE == cube[0]);
+        TEST_EXPECT(LIBSAT_VALUE_UNASSIGNED != cube[1]);
+        TEST_EXPECT(cube[1] == cube[2]);
+    }
+
+    TEST_EXPECT(models.cubes[0][1] != models.cubes[1][1]);
+
+    /* with nothing projected, a satisfiable context has one model. */
+    models.cubes.clear();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, nullptr, 0, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(1 == count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Models under native constraints are reported whole, and the callback can
+ * stop the enumeration early.
+ */
+TEST(native_and_stop)
+{
+    allocator* alloc;
+    libsat_context* context;
+    collected models;
+    libsat_literal lits[3];
+    size_t projection[3];
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b ∨ c;"));
+    projection[0] = var(context, "a");
+    projection[1] = var(context, "b");
+    projection[2] = var(context, "c");
+    for (size_t i = 0; i < 3; ++i)
+    {
+        lits[i] = LIBSAT_LITERAL_MAKE(projection[i], false);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_cardinality(
+                    libsat_context_cnf(context), lits, 3,
+                    LIBSAT_CNF_RELATION_AT_MOST, 1,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 3, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(3 == count);
+    for (auto& cube : models.cubes)
+    {
+        for (uint8_t value : cube)
+        {
+            TEST_EXPECT(LIBSAT_VALUE_UNASSIGNED != value);
+        }
+    }
+
+    /* stop after the first model. */
+    models.cubes.clear();
+    models.limit = 1;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 3, &collect,
+                    &models));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(1 == count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Projection variables must exist, and a frozen context can't be changed.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    collected models;
+    size_t projection[1] = { 1 };
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_VARIABLE
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 1, &collect,
+                    &models));
+
+    libsat_context_freeze(context);
+    projection[0] = 0;
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_enumerate_models(
+                    &result, &count, context, projection, 1, &collect,
+                    &models));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+    TEST_EXPECT(models.cubes.empty());
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,407 @@
+/**
+ * \file solver/test_libsat_solve_maxsat.cpp
+ *
+ * \brief Unit tests for libsat_solve_maxsat.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <cstdlib>
+#include <minunit/minunit.h>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_solve_maxsat);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the model value of a named variable.
+ */
+static bool value_of(libsat_context* context, const char* name)
+{
+    size_t var_id;
+    uint8_t value = LIBSAT_VALUE_UNASSIGNED;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF)
+     || STATUS_SUCCESS != libsat_model_value(&value, context, var_id))
+    {
+        return false;
+    }
+
+    return LIBSAT_VALUE_TRUE == value;
+}
+
+/**
+ * A clause of the random instances, with its weight, or zero if it is hard.
+ */
+struct weighted_clause
+{
+    std::vector<int> lits;
+    uint64_t weight;
+};
+
+/**
+ * Step a small linear congruential generator.
+ */
+static uint32_t next_random(uint64_t* state)
+{
+    *state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+
+    return (uint32_t)(*state >> 33);
+}
+
+/**
+ * The cost of an assignment, or UINT64_MAX if it breaks a hard clause.
+ */
+static uint64_t price(
+    const std::vector<weighted_clause>& clauses, unsigned assignment)
+{
+    uint64_t cost = 0;
+
+    for (const auto& clause : clauses)
+    {
+        bool sat = false;
+
+        for (int lit : clause.lits)
+        {
+            bool value = (assignment >> (abs(lit) - 1)) & 1;
+            sat = sat || (value == (lit > 0));
+        }
+
+        if (!sat)
+        {
+            if (0 == clause.weight)
+            {
+                return UINT64_MAX;
+            }
+
+            cost += clause.weight;
+        }
+    }
+
+    return cost;
+}
+
+/**
+ * Both strategies find the cheapest violation, and leave an optimal model.
+ */
+TEST(small_instance)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int strategies[] = {
+        LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED, LIBSAT_MAXSAT_STRATEGY_LINEAR };
+    uint64_t cost = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(
+                    context, "a ∨ b; [3] ¬a; [2] ¬b; [4] a ∧ b; [1] c;"));
+
+    for (int strategy : strategies)
+    {
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_maxsat(&result, &cost, context, strategy));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+        TEST_EXPECT(5 == cost);
+        TEST_EXPECT(value_of(context, "a"));
+        TEST_EXPECT(value_of(context, "b"));
+        TEST_EXPECT(value_of(context, "c"));
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random instances agree with brute force, with and without preprocessing.
+ */
+TEST(random_instances)
+{
+    uint64_t state = 7;
+
+    for (int round = 0; round < 40; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        std::vector<weighted_clause> clauses;
+        std::string input;
+        uint64_t best = UINT64_MAX, cost, expected_cost;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        int expected;
+        unsigned model = 0;
+        const int var_count = 8;
+
+        /* a few hard clauses, and many soft ones. */
+        for (int i = 0; i < 24; ++i)
+        {
+            weighted_clause clause;
+            size_t width = 1 + next_random(&state) % 3;
+
+            clause.weight = (i < 6) ? 0 : 1 + next_random(&state) % 9;
+            for (size_t j = 0; j < width; ++j)
+            {
+                int var = 1 + next_random(&state) % var_count;
+                clause.lits.push_back((next_random(&state) & 1) ? var : -var);
+            }
+
+            if (0 != clause.weight)
+            {
+                input += "[" + std::to_string(clause.weight) + "] ";
+            }
+
+            for (size_t j = 0; j < clause.lits.size(); ++j)
+            {
+                input += (0 == j) ? "" : " ∨ ";
+                input += (clause.lits[j] < 0) ? "¬" : "";
+                input += "x" + std::to_string(abs(clause.lits[j]));
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        for (unsigned assignment = 0; assignment < (1u << var_count);
+             ++assignment)
+        {
+            cost = price(clauses, assignment);
+            best = (cost < best) ? cost : best;
+        }
+
+        expected =
+            (UINT64_MAX == best)
+                ? LIBSAT_SOLVE_RESULT_UNSATISFIABLE
+                : LIBSAT_SOLVE_RESULT_SATISFIABLE;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        if (round & 1)
+        {
+            TEST_ASSERT(STATUS_SUCCESS == libsat_context_preprocess(context));
+        }
+
+        for (int strategy = 0; strategy < 2; ++strategy)
+        {
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_solve_maxsat(&result, &cost, context, strategy));
+            TEST_EXPECT(expected == result);
+            TEST_EXPECT(best == cost);
+
+            /* the model left behind has the optimal cost. */
+            if (LIBSAT_SOLVE_RESULT_SATISFIABLE == result)
+            {
+                model = 0;
+                for (int var = 1; var <= var_count; ++var)
+                {
+                    std::string name = "x" + std::to_string(var);
+                    if (value_of(context, name.c_str()))
+                    {
+                        model |= 1u << (var - 1);
+                    }
+                }
+
+                expected_cost = price(clauses, model);
+                TEST_EXPECT(best == expected_cost);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Soft statements asserted in a scope are gone once it is popped, and a context
+ * whose hard statements can not hold is unsatisfiable.
+ */
+TEST(scopes_and_unsatisfiable)
+{
+    allocator* alloc;
+    libsat_context* context;
+    uint64_t cost = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* without soft statements, the cost is zero. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a; [2] ¬a ∨ b;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_maxsat(
+                    &result, &cost, context,
+                    LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(0 == cost);
+
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "[7] ¬b; [1] c ∧ ¬c;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_maxsat(
+                    &result, &cost, context,
+                    LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(3 == cost);
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_maxsat(
+                    &result, &cost, context, LIBSAT_MAXSAT_STRATEGY_LINEAR));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(0 == cost);
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬a;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_maxsat(
+                    &result, &cost, context,
+                    LIBSAT_MAXSAT_STRATEGY_CORE_GUIDED));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(UINT64_MAX == cost);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_maxsat(
+                    &result, &cost, context, LIBSAT_MAXSAT_STRATEGY_LINEAR));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(UINT64_MAX == cost);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A request to terminate stops the search, and ends with it.
+ */
+TEST(terminate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    uint64_t cost = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "a ∨ b; [1] ¬a;"));
+
+    for (int strategy = 0; strategy < 2; ++strategy)
+    {
+        libsat_context_terminate(context);
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_maxsat(&result, &cost, context, strategy));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+        TEST_EXPECT(UINT64_MAX == cost);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_maxsat(&result, &cost, context, strategy));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+        TEST_EXPECT(0 == cost);
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Bad strategies, overflowing weights, and frozen contexts are rejected.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    uint64_t cost = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "[1] a;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_solve_maxsat(&result, &cost, context, 2));
+
+    libsat_context_freeze(context);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_solve_maxsat(
+                    &result, &cost, context, LIBSAT_MAXSAT_STRATEGY_LINEAR));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, "[18446744073709551615] b;"));
+    TEST_EXPECT(
+        ERROR_LIBSAT_CNF_WEIGHT_OVERFLOW
+            == libsat_solve_maxsat(
+                    &result, &cost, context, LIBSAT_MAXSAT_STRATEGY_LINEAR));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
@@ -0,0 +1,407 @@
+/**
+ * \file solver/test_libsat_solve_portfolio.cpp
+ *
+ * \brief Unit tests for libsat_solve_portfolio.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_solve_portfolio);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the positive literal for a named variable.
+ */
+static libsat_literal lit(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (libsat_literal)-1;
+    }
+
+    return LIBSAT_LITERAL_MAKE(var_id, false);
+}
+
+/**
+ * Get the model value of a named variable.
+ */
+static uint8_t value(libsat_context* context, const char* name)
+{
+    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_model_value(
+                    &val, context, LIBSAT_LITERAL_VARIABLE(lit(context, name))))
+    {
+        return LIBSAT_VALUE_UNASSIGNED;
+    }
+
+    return val;
+}
+
+/**
+ * A portfolio finds the same model as a single solver on a forced instance.
+ */
+TEST(satisfiable_model)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, R"(a ∨ b; ¬a; b → c; c → ¬d; d ↔ ¬e;)"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 4));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "d"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "e"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * The failed assumptions of the winner are reported through the context.
+ */
+TEST(failed_assumptions)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const libsat_literal* core;
+    size_t core_count;
+    libsat_literal assumptions[3];
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a → b; c ∨ d;)"));
+
+    assumptions[0] = lit(context, "c");
+    assumptions[1] = lit(context, "a");
+    assumptions[2] = LIBSAT_LITERAL_NEGATE(lit(context, "b"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, assumptions, 3, 3));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_ASSERT(2 == core_count);
+    for (size_t i = 0; i < core_count; ++i)
+    {
+        TEST_EXPECT(assumptions[0] != core[i]);
+    }
+
+    /* without the assumptions, the statements are satisfiable. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 3));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * An assumption on a variable that does not exist is rejected.
+ */
+TEST(bad_assumption)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    libsat_literal assumption = LIBSAT_LITERAL_MAKE(100, false);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b;)"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION
+            == libsat_solve_portfolio(&result, context, &assumption, 1, 4));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Open scopes are honored by every worker, and left out of the core.
+ */
+TEST(scopes)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const libsat_literal* core;
+    size_t core_count;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b;)"));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_push(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(¬a; ¬b;)"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 4));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_EXPECT(0 == core_count);
+
+    /* once the scope is gone, the base statements are satisfiable again. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_pop(context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 4));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Seven pigeons do not fit in six holes, which takes enough conflicts for the
+ * workers to share clauses.
+ */
+TEST(pigeonhole)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const size_t pigeons = 7, holes = 6;
+    std::string input;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* every pigeon is in some hole. */
+    for (size_t p = 0; p < pigeons; ++p)
+    {
+        for (size_t h = 0; h < holes; ++h)
+        {
+            input += (h > 0 ? " ∨ " : "");
+            input += "p" + std::to_string(p) + "h" + std::to_string(h);
+        }
+
+        input += "; ";
+    }
+
+    /* no two pigeons share a hole. */
+    for (size_t h = 0; h < holes; ++h)
+    {
+        for (size_t p = 0; p < pigeons; ++p)
+        {
+            for (size_t q = p + 1; q < pigeons; ++q)
+            {
+                input +=
+                    "¬p" + std::to_string(p) + "h" + std::to_string(h)
+                  + " ∨ ¬p" + std::to_string(q) + "h" + std::to_string(h)
+                  + "; ";
+            }
+        }
+    }
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_portfolio(&result, context, nullptr, 0, 4));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random 3-SAT instances agree with brute force, and every model satisfies
+ * its instance.
+ */
+TEST(random_3sat)
+{
+    std::mt19937 rng(4321);
+    const size_t vars = 12;
+
+    for (int round = 0; round < 60; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        std::vector<std::vector<int>> clauses;
+        std::string input;
+        bool expected = false;
+        size_t count = 40 + round % 30;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t c = 0; c < count; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+                input += (k > 0 ? " ∨ " : "");
+                input += (neg ? "¬x" : "x") + std::to_string(v);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        /* brute force. */
+        for (unsigned m = 0; m < (1u << vars) && !expected; ++m)
+        {
+            bool all = true;
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    int v = (l > 0 ? l : -l) - 1;
+                    any |= (((m >> v) & 1) != 0) == (l > 0);
+                }
+                all &= any;
+            }
+            expected = all;
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_portfolio(&result, context, nullptr, 0, 4));
+        TEST_ASSERT(
+            (expected
+                ? LIBSAT_SOLVE_RESULT_SATISFIABLE
+                : LIBSAT_SOLVE_RESULT_UNSATISFIABLE) == result);
+
+        /* check the model. */
+        if (expected)
+        {
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+
+                TEST_ASSERT(any);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
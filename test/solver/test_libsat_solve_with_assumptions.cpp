@@ -0,0 +1,705 @@
+/**
+ * \file solver/test_libsat_solve_with_assumptions.cpp
+ *
+ * \brief Unit tests for libsat_solve_with_assumptions.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_cnf;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_solve_with_assumptions);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Get the positive literal for a named variable.
+ */
+static libsat_literal lit(libsat_context* context, const char* name)
+{
+    size_t var_id = (size_t)-1;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_context_variable_get(
+                    &var_id, context, name, LIBSAT_VARIABLE_GET_REF))
+    {
+        return (libsat_literal)-1;
+    }
+
+    return LIBSAT_LITERAL_MAKE(var_id, false);
+}
+
+/**
+ * Get the model value of a named variable.
+ */
+static uint8_t value(libsat_context* context, const char* name)
+{
+    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_model_value(
+                    &val, context, LIBSAT_LITERAL_VARIABLE(lit(context, name))))
+    {
+        return LIBSAT_VALUE_UNASSIGNED;
+    }
+
+    return val;
+}
+
+/**
+ * A satisfiable set of statements has a model that satisfies them.
+ */
+TEST(satisfiable_model)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const libsat_literal* core;
+    size_t core_count;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, R"(a ∨ b; ¬a; b → c; c → ¬d; d ↔ ¬e;)"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "d"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "e"));
+
+    /* there is no core after a satisfiable solve. */
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_NO_CORE
+            == libsat_failed_assumptions(&core, &core_count, context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Contradictory statements are unsatisfiable with an empty core.
+ */
+TEST(unsatisfiable_empty_core)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const libsat_literal* core;
+    size_t core_count = 1;
+    uint8_t val;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, R"(a ∨ b; a ∨ ¬b; ¬a ∨ b; ¬a ∨ ¬b;)"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_EXPECT(0 == core_count);
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_NO_MODEL == libsat_model_value(&val, context, 0));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Failed assumptions name the assumptions that conflict, and do not outlive
+ * the call that made them.
+ */
+TEST(failed_assumptions)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const libsat_literal* core;
+    size_t core_count = 0;
+    libsat_literal assumptions[3];
+    bool has_a = false, has_not_c = false;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == assert_input(context, R"(a → b; b → c; d ∨ e;)"));
+
+    /* d is irrelevant; a and ¬c cannot both hold. */
+    assumptions[0] = lit(context, "d");
+    assumptions[1] = lit(context, "a");
+    assumptions[2] = LIBSAT_LITERAL_NEGATE(lit(context, "c"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 3));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_ASSERT(2 == core_count);
+    for (size_t i = 0; i < core_count; ++i)
+    {
+        has_a |= (assumptions[1] == core[i]);
+        has_not_c |= (assumptions[2] == core[i]);
+    }
+    TEST_EXPECT(has_a);
+    TEST_EXPECT(has_not_c);
+
+    /* without ¬c, the same context is satisfiable. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 2));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "d"));
+
+    /* an assumption on an unknown variable is rejected. */
+    assumptions[0] = LIBSAT_LITERAL_MAKE(1000, false);
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_ASSUMPTION
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 1));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Statements asserted between solves are added to what is already known.
+ */
+TEST(incremental_assert)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b ∨ c;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(¬a; ¬b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(c → a;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Aliases between bare variables are merged instead of encoded, and every
+ * alias still gets the value of its root in the model.
+ */
+TEST(aliases)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_literal lits[2];
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* only the clause over the roots is added. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, R"(a ↔ b; b ↔ ¬c; c ∨ d; ¬a;)"));
+    TEST_EXPECT(2 == libsat_cnf_clause_count(libsat_context_cnf(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "b"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "c"));
+
+    /* an assumption on an alias brings its definition back. */
+    lits[0] = lit(context, "b");
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, lits, 1));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    /* variables that are already used keep their clauses. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(e ∨ f; e ↔ d;)"));
+    lits[0] = LIBSAT_LITERAL_NEGATE(lit(context, "d"));
+    lits[1] = lit(context, "e");
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, lits, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, lits, 1));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "e"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "f"));
+
+    /* an alias of its own negation can't hold. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(g ↔ ¬a; g ↔ b;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Parity statements are solved through the native xor matrix.
+ */
+TEST(native_xor)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    libsat_literal assumptions[3];
+    const libsat_literal* core;
+    size_t core_count = 0;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == assert_input(context, R"(a ⊻ b ⊻ c; b ⊻ c ⊻ d; a ∨ d;)"));
+
+    /* a ⊻ d is false, so a and d are both true. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "d"));
+    TEST_EXPECT(value(context, "b") == value(context, "c"));
+
+    /* b ≠ c contradicts the first row. */
+    assumptions[0] = lit(context, "b");
+    assumptions[1] = LIBSAT_LITERAL_NEGATE(lit(context, "c"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(
+                    &result, context, assumptions, 2));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_failed_assumptions(&core, &core_count, context));
+    TEST_EXPECT(2 == core_count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Native cardinality constraints take part in the search.
+ */
+TEST(native_cardinality)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    libsat_literal lits[3];
+    libsat_cnf* cnf;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS == assert_input(context, R"(a ∨ b ∨ c; ¬b;)"));
+    lits[0] = lit(context, "a");
+    lits[1] = lit(context, "b");
+    lits[2] = lit(context, "c");
+
+    /* at most one of a, b, c. */
+    cnf = libsat_context_cnf(context);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_cnf_add_cardinality(
+                    cnf, lits, 3, LIBSAT_CNF_RELATION_AT_MOST, 1,
+                    LIBSAT_CNF_ENCODING_NATIVE));
+    TEST_ASSERT(1 == libsat_cnf_native_count(cnf));
+
+    /* assuming a leaves c false. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, lits, 1));
+    TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(LIBSAT_VALUE_TRUE == value(context, "a"));
+    TEST_EXPECT(LIBSAT_VALUE_FALSE == value(context, "c"));
+
+    /* a and c together exceed the bound. */
+    lits[1] = lits[2];
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, lits, 2));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    /* requiring both again is unsatisfiable outright. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∧ c;)"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Random 3-SAT instances agree with brute force, and every model satisfies
+ * its instance.
+ */
+TEST(random_3sat)
+{
+    std::mt19937 rng(1234);
+    const size_t vars = 10;
+
+    for (int round = 0; round < 200; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+        std::vector<std::vector<int>> clauses;
+        std::string input;
+        bool expected = false;
+        size_t count = 30 + round % 25;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t c = 0; c < count; ++c)
+        {
+            std::vector<int> clause;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+                input += (k > 0 ? " ∨ " : "");
+                input += (neg ? "¬x" : "x") + std::to_string(v);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        /* brute force. */
+        for (unsigned m = 0; m < (1u << vars) && !expected; ++m)
+        {
+            bool all = true;
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    int v = (l > 0 ? l : -l) - 1;
+                    any |= (((m >> v) & 1) != 0) == (l > 0);
+                }
+                all &= any;
+            }
+            expected = all;
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_with_assumptions(
+                        &result, context, nullptr, 0));
+        TEST_ASSERT(
+            (expected
+                ? LIBSAT_SOLVE_RESULT_SATISFIABLE
+                : LIBSAT_SOLVE_RESULT_UNSATISFIABLE) == result);
+
+        /* check the model. */
+        if (expected)
+        {
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+                TEST_ASSERT(any);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Nine pigeons do not fit in eight holes, and a hard planted instance has a
+ * model. Both take enough conflicts for rounds of inprocessing to run.
+ */
+TEST(inprocessing)
+{
+    std::mt19937 rng(4321);
+    const size_t pigeons = 9, holes = 8, vars = 250, count = 1050;
+    std::vector<bool> planted;
+    std::vector<std::vector<int>> clauses;
+    std::string input;
+
+    /* pigeonhole. */
+    {
+        allocator* alloc;
+        libsat_context* context;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        for (size_t p = 0; p < pigeons; ++p)
+        {
+            for (size_t h = 0; h < holes; ++h)
+            {
+                input += (h > 0 ? " ∨ " : "");
+                input += "p" + std::to_string(p) + "h" + std::to_string(h);
+            }
+
+            input += "; ";
+        }
+
+        for (size_t h = 0; h < holes; ++h)
+        {
+            for (size_t p = 0; p < pigeons; ++p)
+            {
+                for (size_t q = p + 1; q < pigeons; ++q)
+                {
+                    input +=
+                        "¬p" + std::to_string(p) + "h" + std::to_string(h)
+                      + " ∨ ¬p" + std::to_string(q) + "h" + std::to_string(h)
+                      + "; ";
+                }
+            }
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_with_assumptions(
+                        &result, context, nullptr, 0));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+
+    /* a random instance near the threshold, with a planted model. */
+    {
+        allocator* alloc;
+        libsat_context* context;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+            planted.push_back(rng() & 1);
+        }
+
+        input.clear();
+        while (clauses.size() < count)
+        {
+            std::vector<int> clause;
+            bool satisfied = false;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+                satisfied |= planted[v] != neg;
+            }
+
+            if (!satisfied)
+            {
+                continue;
+            }
+
+            for (size_t k = 0; k < clause.size(); ++k)
+            {
+                int v = (clause[k] > 0 ? clause[k] : -clause[k]) - 1;
+
+                input += (k > 0 ? " ∨ " : "");
+                input += (clause[k] < 0 ? "¬x" : "x") + std::to_string(v);
+            }
+
+            input += "; ";
+            clauses.push_back(clause);
+        }
+
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_with_assumptions(
+                        &result, context, nullptr, 0));
+        TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+        for (auto& clause : clauses)
+        {
+            bool any = false;
+            for (int l : clause)
+            {
+                uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+                size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                TEST_ASSERT(
+                    STATUS_SUCCESS == libsat_model_value(&val, context, v));
+                any |=
+                    (l > 0)
+                        ? LIBSAT_VALUE_TRUE == val
+                        : LIBSAT_VALUE_FALSE == val;
+            }
+            TEST_EXPECT(any);
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
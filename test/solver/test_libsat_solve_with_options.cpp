@@ -0,0 +1,661 @@
+/**
+ * \file solver/test_libsat_solve_with_options.cpp
+ *
+ * \brief Unit tests for libsat_solve_with_options.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <chrono>
+#include <minunit/minunit.h>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_solve_with_options);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Build statements saying that the pigeons fit in the holes.
+ */
+static std::string pigeonhole(size_t pigeons, size_t holes)
+{
+    std::string input;
+
+    /* every pigeon is in some hole. */
+    for (size_t p = 0; p < pigeons; ++p)
+    {
+        for (size_t h = 0; h < holes; ++h)
+        {
+            input += (h > 0 ? " ∨ " : "");
+            input += "p" + std::to_string(p) + "h" + std::to_string(h);
+        }
+
+        input += "; ";
+    }
+
+    /* no two pigeons share a hole. */
+    for (size_t h = 0; h < holes; ++h)
+    {
+        for (size_t p = 0; p < pigeons; ++p)
+        {
+            for (size_t q = p + 1; q < pigeons; ++q)
+            {
+                input +=
+                    "¬p" + std::to_string(p) + "h" + std::to_string(h)
+                  + " ∨ ¬p" + std::to_string(q) + "h" + std::to_string(h)
+                  + "; ";
+            }
+        }
+    }
+
+    return input;
+}
+
+/**
+ * The default options decide with EVSIDS and restart on the Luby sequence
+ * without rephasing, and unknown heuristics or restart policies are rejected.
+ */
+TEST(defaults)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_solve_options options;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    libsat_solve_options_init(&options);
+    TEST_EXPECT(LIBSAT_SOLVE_HEURISTIC_EVSIDS == options.heuristic);
+    TEST_EXPECT(LIBSAT_SOLVE_RESTART_LUBY == options.restart);
+    TEST_EXPECT(!options.rephase);
+    TEST_EXPECT(0 == options.conflict_limit);
+    TEST_EXPECT(0 == options.propagation_limit);
+    TEST_EXPECT(0 == options.time_limit_ms);
+    TEST_EXPECT(0 == options.memory_limit);
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b; ¬a;)"));
+
+    options.heuristic = 99;
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+
+    options.heuristic = LIBSAT_SOLVE_HEURISTIC_EVSIDS;
+    options.restart = 99;
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_BAD_OPTION
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    options.restart = LIBSAT_SOLVE_RESTART_LUBY;
+
+    options.heuristic = LIBSAT_SOLVE_HEURISTIC_VMTF;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Clauses added one call at a time, with the heuristic switched on every
+ * call, agree with brute force, and every model satisfies the clauses so far.
+ */
+TEST(switch_heuristics)
+{
+    std::mt19937 rng(2468);
+    const size_t vars = 10;
+
+    for (int round = 0; round < 10; ++round)
+    {
+        allocator* alloc;
+        libsat_context* context;
+        libsat_solve_options options;
+        std::vector<std::vector<int>> clauses;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+        libsat_solve_options_init(&options);
+
+        /* declare every variable first, so that x<i> has id i. */
+        for (size_t v = 0; v < vars; ++v)
+        {
+            size_t var_id;
+            std::string name = "x" + std::to_string(v);
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_context_variable_get(
+                            &var_id, context, name.c_str(),
+                            LIBSAT_VARIABLE_GET_CREATE));
+        }
+
+        for (size_t call = 0; call < 60; ++call)
+        {
+            int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+            std::vector<int> clause;
+            std::string input;
+            bool expected = false;
+
+            for (int k = 0; k < 3; ++k)
+            {
+                int v = (int)(rng() % vars);
+                bool neg = rng() & 1;
+
+                clause.push_back(neg ? -(v + 1) : (v + 1));
+                input += (k > 0 ? " ∨ " : "");
+                input += (neg ? "¬x" : "x") + std::to_string(v);
+            }
+
+            input += ";";
+            clauses.push_back(clause);
+
+            /* brute force. */
+            for (unsigned m = 0; m < (1u << vars) && !expected; ++m)
+            {
+                bool all = true;
+                for (auto& c : clauses)
+                {
+                    bool any = false;
+                    for (int l : c)
+                    {
+                        int v = (l > 0 ? l : -l) - 1;
+                        any |= (((m >> v) & 1) != 0) == (l > 0);
+                    }
+                    all &= any;
+                }
+                expected = all;
+            }
+
+            options.heuristic =
+                (call % 2)
+                    ? LIBSAT_SOLVE_HEURISTIC_VMTF
+                    : LIBSAT_SOLVE_HEURISTIC_EVSIDS;
+
+            TEST_ASSERT(
+                STATUS_SUCCESS == assert_input(context, input.c_str()));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_solve_with_options(
+                            &result, context, &options, nullptr, 0));
+            TEST_ASSERT(
+                (expected
+                    ? LIBSAT_SOLVE_RESULT_SATISFIABLE
+                    : LIBSAT_SOLVE_RESULT_UNSATISFIABLE) == result);
+
+            if (!expected)
+            {
+                break;
+            }
+
+            /* check the model. */
+            for (auto& c : clauses)
+            {
+                bool any = false;
+                for (int l : c)
+                {
+                    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+                TEST_ASSERT(any);
+            }
+        }
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Seven pigeons do not fit in six holes under VMTF, which takes enough
+ * conflicts for the queue to be bumped and searched many times over.
+ */
+TEST(vmtf_pigeonhole)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_solve_options options;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    std::string input = pigeonhole(7, 6);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+    libsat_solve_options_init(&options);
+    options.heuristic = LIBSAT_SOLVE_HEURISTIC_VMTF;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A random 3-SAT instance of 150 variables above the threshold is refuted by
+ * both heuristics within a budget of conflicts. Under VMTF, this depends on
+ * the queue keeping the relative order of the variables that each conflict
+ * bumps.
+ */
+TEST(vmtf_random_unsat)
+{
+    std::mt19937 rng(1);
+    const size_t vars = 150;
+    const size_t clauses = 675;
+    std::string input;
+
+    for (size_t c = 0; c < clauses; ++c)
+    {
+        size_t v[3];
+
+        do
+        {
+            for (auto& x : v)
+            {
+                x = rng() % vars;
+            }
+        } while (v[0] == v[1] || v[0] == v[2] || v[1] == v[2]);
+
+        for (int k = 0; k < 3; ++k)
+        {
+            if (k > 0)
+            {
+                input += " ∨ ";
+            }
+
+            input += ((rng() & 1) ? "¬x" : "x") + std::to_string(v[k]);
+        }
+
+        input += ";\n";
+    }
+
+    for (int heuristic :
+            { LIBSAT_SOLVE_HEURISTIC_EVSIDS, LIBSAT_SOLVE_HEURISTIC_VMTF })
+    {
+        allocator* alloc;
+        libsat_context* context;
+        libsat_solve_options options;
+        int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+        TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+        TEST_ASSERT(
+            STATUS_SUCCESS == libsat_context_create(&context, alloc));
+        TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+        libsat_solve_options_init(&options);
+        options.heuristic = heuristic;
+        options.conflict_limit = 20000;
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_solve_with_options(
+                        &result, context, &options, nullptr, 0));
+        TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(libsat_context_resource_handle(context)));
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == resource_release(allocator_resource_handle(alloc)));
+    }
+}
+
+/**
+ * Every restart policy, with and without rephasing, refutes a pigeonhole
+ * instance and finds a model of a planted random instance, over enough
+ * conflicts to switch between stable and focused phases and to rephase.
+ */
+TEST(restart_policies)
+{
+    const int restarts[] = {
+        LIBSAT_SOLVE_RESTART_LUBY, LIBSAT_SOLVE_RESTART_GEOMETRIC,
+        LIBSAT_SOLVE_RESTART_GLUCOSE, LIBSAT_SOLVE_RESTART_STABILIZING };
+    const size_t vars = 200, count = 850;
+    std::string unsat = pigeonhole(8, 7);
+
+    for (int restart : restarts)
+    {
+        for (int rephase = 0; rephase < 2; ++rephase)
+        {
+            std::mt19937 rng(1357);
+            allocator* alloc;
+            libsat_context* context;
+            libsat_solve_options options;
+            int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+            std::vector<bool> planted;
+            std::vector<std::vector<int>> clauses;
+            std::string input;
+
+            libsat_solve_options_init(&options);
+            options.restart = restart;
+            options.rephase = (1 == rephase);
+
+            /* pigeonhole. */
+            TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+            TEST_ASSERT(
+                STATUS_SUCCESS == libsat_context_create(&context, alloc));
+            TEST_ASSERT(STATUS_SUCCESS == assert_input(context, unsat.c_str()));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_solve_with_options(
+                            &result, context, &options, nullptr, 0));
+            TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == resource_release(
+                            libsat_context_resource_handle(context)));
+
+            /* a random instance with a planted model. */
+            TEST_ASSERT(
+                STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+            for (size_t v = 0; v < vars; ++v)
+            {
+                size_t var_id;
+                std::string name = "x" + std::to_string(v);
+
+                TEST_ASSERT(
+                    STATUS_SUCCESS
+                        == libsat_context_variable_get(
+                                &var_id, context, name.c_str(),
+                                LIBSAT_VARIABLE_GET_CREATE));
+                planted.push_back(rng() & 1);
+            }
+
+            while (clauses.size() < count)
+            {
+                std::vector<int> clause;
+                bool satisfied = false;
+
+                for (int k = 0; k < 3; ++k)
+                {
+                    int v = (int)(rng() % vars);
+                    bool neg = rng() & 1;
+
+                    clause.push_back(neg ? -(v + 1) : (v + 1));
+                    satisfied |= planted[v] != neg;
+                }
+
+                if (!satisfied)
+                {
+                    continue;
+                }
+
+                for (size_t k = 0; k < clause.size(); ++k)
+                {
+                    int v = (clause[k] > 0 ? clause[k] : -clause[k]) - 1;
+
+                    input += (k > 0 ? " ∨ " : "");
+                    input += (clause[k] < 0 ? "¬x" : "x") + std::to_string(v);
+                }
+
+                input += "; ";
+                clauses.push_back(clause);
+            }
+
+            TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == libsat_solve_with_options(
+                            &result, context, &options, nullptr, 0));
+            TEST_ASSERT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+            for (auto& clause : clauses)
+            {
+                bool any = false;
+                for (int l : clause)
+                {
+                    uint8_t val = LIBSAT_VALUE_UNASSIGNED;
+                    size_t v = (size_t)((l > 0 ? l : -l) - 1);
+
+                    TEST_ASSERT(
+                        STATUS_SUCCESS
+                            == libsat_model_value(&val, context, v));
+                    any |=
+                        (l > 0)
+                            ? LIBSAT_VALUE_TRUE == val
+                            : LIBSAT_VALUE_FALSE == val;
+                }
+                TEST_EXPECT(any);
+            }
+
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == resource_release(
+                            libsat_context_resource_handle(context)));
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == resource_release(allocator_resource_handle(alloc)));
+        }
+    }
+}
+
+/**
+ * A solve gives up with an unknown result once it reaches a conflict,
+ * propagation, or memory limit. The limits only apply to that call, so the
+ * next call refutes the instance.
+ */
+TEST(limits)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_solve_options options;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    std::string input = pigeonhole(8, 7);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+    libsat_solve_options_init(&options);
+    options.conflict_limit = 10;
+    result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+
+    libsat_solve_options_init(&options);
+    options.propagation_limit = 100;
+    result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+
+    libsat_solve_options_init(&options);
+    options.memory_limit = 1;
+    result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+
+    libsat_solve_options_init(&options);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A solve of an instance far too hard to finish gives up soon after its time
+ * limit.
+ */
+TEST(time_limit)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_solve_options options;
+    int result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    std::string input = pigeonhole(13, 12);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+    libsat_solve_options_init(&options);
+    options.time_limit_ms = 50;
+
+    auto start = std::chrono::steady_clock::now();
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_options(
+                    &result, context, &options, nullptr, 0));
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+    TEST_EXPECT(elapsed < std::chrono::seconds(5));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A request to terminate from another thread stops a hard solve, whether it
+ * runs alone, as a portfolio, or as cubes. A request made before a solve stops
+ * that solve, and each solve clears the request for the next.
+ */
+TEST(terminate)
+{
+    allocator* alloc;
+    libsat_context* context;
+    int result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+    std::string input = pigeonhole(13, 12);
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, input.c_str()));
+
+    for (size_t threads = 1; threads <= 2; ++threads)
+    {
+        for (int cubes = 0; cubes <= 1; ++cubes)
+        {
+            std::thread stopper([context]() {
+                std::this_thread::sleep_for(std::chrono::milliseconds(50));
+                libsat_context_terminate(context);
+            });
+
+            result = LIBSAT_SOLVE_RESULT_SATISFIABLE;
+            TEST_ASSERT(
+                STATUS_SUCCESS
+                    == (cubes
+                            ? libsat_solve_cube_and_conquer(
+                                    &result, context, nullptr, 0, threads)
+                            : libsat_solve_portfolio(
+                                    &result, context, nullptr, 0, threads)));
+            stopper.join();
+
+            TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+        }
+    }
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+
+    /* a request made before the solve stops it. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, R"(a ∨ b; ¬a;)"));
+
+    libsat_context_terminate(context);
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNKNOWN == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_solve_with_assumptions(&result, context, nullptr, 0));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
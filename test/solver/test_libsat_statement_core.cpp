@@ -0,0 +1,337 @@
+/**
+ * \file solver/test_libsat_statement_core.cpp
+ *
+ * \brief Unit tests for libsat_statement_core.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <algorithm>
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <minunit/minunit.h>
+#include <vector>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_solver;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_statement_core);
+
+/**
+ * Parse and assert the given input.
+ */
+static status assert_input(libsat_context* context, const char* input)
+{
+    libsat_ast_node* base = nullptr;
+    status retval, release_retval;
+
+    retval = libsat_parse(&base, context, input);
+    if (STATUS_SUCCESS != retval)
+    {
+        return retval;
+    }
+
+    retval = libsat_context_assert(context, base);
+
+    release_retval =
+        resource_release(libsat_ast_node_resource_handle(base));
+    if (STATUS_SUCCESS != release_retval)
+    {
+        retval = release_retval;
+    }
+
+    return retval;
+}
+
+/**
+ * Solve the context without assumptions and return the result.
+ */
+static int solve(libsat_context* context)
+{
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    if (
+        STATUS_SUCCESS
+            != libsat_solve_with_assumptions(&result, context, nullptr, 0))
+    {
+        return -1;
+    }
+
+    return result;
+}
+
+/**
+ * Get the sorted first lines of the statements of a core.
+ */
+static std::vector<size_t> core_lines(
+    const libsat_ast_node** core, size_t count)
+{
+    std::vector<size_t> lines;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        lines.push_back(core[i]->span.begin_line);
+    }
+
+    std::sort(lines.begin(), lines.end());
+
+    return lines;
+}
+
+/**
+ * The core of an inconsistent configuration is its minimal unsatisfiable
+ * subset, reported by source line, and the statements are retracted after.
+ */
+TEST(minimal_core)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* list = nullptr;
+    const libsat_ast_node** core = nullptr;
+    size_t count = 0;
+    size_t var_id = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const char* input =
+        "a;\n"
+        "a → b;\n"
+        "d ∨ e;\n"
+        "b → c;\n"
+        "e → ¬a;\n"
+        "¬c;\n"
+        "f ↔ d;\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&list, context, input));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(
+        (std::vector<size_t>{ 1, 2, 4, 6 }) == core_lines(core, count));
+
+    /* each statement of the core carries its whole span. */
+    for (size_t i = 0; i < count; ++i)
+    {
+        TEST_EXPECT(1 == core[i]->span.begin_col);
+        TEST_EXPECT(core[i]->span.begin_line == core[i]->span.end_line);
+    }
+
+    /* nothing is left behind in the context. */
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_context_variable_get(
+                    &var_id, context, nullptr,
+                    LIBSAT_VARIABLE_GET_CREATE | LIBSAT_VARIABLE_GET_UNIQUE));
+    TEST_EXPECT(6 == var_id);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(list)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A statement on the path to the conflict is dropped when the others are
+ * enough without it.
+ */
+TEST(redundant_statement)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* list = nullptr;
+    const libsat_ast_node** core = nullptr;
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const char* input =
+        "¬r;\n"
+        "q ∧ s → r;\n"
+        "p → q ∧ s;\n"
+        "p;\n"
+        "q;\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&list, context, input));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(
+        (std::vector<size_t>{ 1, 2, 3, 4 }) == core_lines(core, count));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(list)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * The constants hold on their own, so a statement that only mentions them is
+ * not part of the core.
+ */
+TEST(constants)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* list = nullptr;
+    const libsat_ast_node** core = nullptr;
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+    const char* input =
+        "¬true ∨ a;\n"
+        "¬a;\n"
+        "b ∨ true;\n";
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&list, context, input));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT((std::vector<size_t>{ 1, 2 }) == core_lines(core, count));
+
+    /* the constants are retracted with the statements, and made again. */
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == solve(context));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬true;"));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == solve(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(list)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Statements asserted in the context take part in the core without being a
+ * part of it, and a satisfiable list has no core.
+ */
+TEST(background)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* list = nullptr;
+    libsat_ast_node* consistent = nullptr;
+    const libsat_ast_node** core = nullptr;
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "p → q ⊻ r;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(&list, context, "q ∧ r;\ns;\np;\n¬s ∨ t;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_parse(&consistent, context, "q;\n¬r;\np;"));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT((std::vector<size_t>{ 1, 3 }) == core_lines(core, count));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(
+                    &result, &core, &count, context, consistent));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_SATISFIABLE == result);
+    TEST_EXPECT(0 == count);
+
+    /* a single statement can be checked on its own. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "¬p;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(
+                    &result, &core, &count, context,
+                    list->value.list.head->next));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_ASSERT(1 == count);
+    TEST_EXPECT(list->value.list.head->next == core[0]);
+
+    /* an inconsistent context gives an empty core. */
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "p ∨ ¬s;"));
+    TEST_ASSERT(STATUS_SUCCESS == assert_input(context, "s;"));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_EXPECT(LIBSAT_SOLVE_RESULT_UNSATISFIABLE == result);
+    TEST_EXPECT(0 == count);
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(list)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(consistent)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Only statements can be checked, and a frozen context can't be changed.
+ */
+TEST(errors)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* list = nullptr;
+    const libsat_ast_node** core = nullptr;
+    size_t count = 0;
+    int result = LIBSAT_SOLVE_RESULT_UNKNOWN;
+
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&list, context, "a ∧ b;"));
+
+    TEST_EXPECT(
+        ERROR_LIBSAT_SOLVER_NOT_A_STATEMENT
+            == libsat_statement_core(
+                    &result, &core, &count, context,
+                    list->value.list.head->value.unary));
+
+    libsat_context_freeze(context);
+    TEST_EXPECT(
+        ERROR_LIBSAT_BASE_CONTEXT_FROZEN
+            == libsat_statement_core(&result, &core, &count, context, list));
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_thaw(context));
+
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(list)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(allocator_resource_handle(alloc)));
+}
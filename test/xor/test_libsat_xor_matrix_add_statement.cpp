@@ -0,0 +1,108 @@
+/**
+ * \file xor/test_libsat_xor_matrix_add_statement.cpp
+ *
+ * \brief Unit tests for libsat_xor_matrix_add_statement.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/parser.h>
+#include <libsat/status.h>
+#include <libsat/xor.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_xor_matrix_add_statement);
+
+/**
+ * An exclusive disjunction chain is added as a single row.
+ */
+TEST(exclusive_disjunction_chain)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_xor_matrix* matrix;
+    const char* input = R"(a⊻b⊻c)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the statement is a parity constraint. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_xor_matrix_add_statement(matrix, base->value.list.head));
+    TEST_EXPECT(1 == libsat_xor_matrix_row_count(matrix));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Any operator other than a parity operator is rejected.
+ */
+TEST(conjunction_rejected)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_xor_matrix* matrix;
+    const char* input = R"(a⊻b∧c)";
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* Parse should succeed. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+
+    /* the statement is not a parity constraint. */
+    TEST_ASSERT(
+        ERROR_LIBSAT_XOR_NOT_A_PARITY_CONSTRAINT
+            == libsat_xor_matrix_add_statement(matrix, base->value.list.head));
+    TEST_EXPECT(0 == libsat_xor_matrix_row_count(matrix));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
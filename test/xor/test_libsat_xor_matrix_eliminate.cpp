@@ -0,0 +1,105 @@
+/**
+ * \file xor/test_libsat_xor_matrix_eliminate.cpp
+ *
+ * \brief Unit tests for libsat_xor_matrix_eliminate.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/status.h>
+#include <libsat/xor.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_xor_matrix_eliminate);
+
+/**
+ * Rows that are sums of other rows are dropped.
+ */
+TEST(redundant_rows_dropped)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_xor_matrix* matrix;
+    const size_t ab[] = { 0, 1 };
+    const size_t bc[] = { 1, 2 };
+    const size_t ac[] = { 0, 2 };
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* a ⊻ b = 1, b ⊻ c = 1, a ⊻ c = 0. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_xor_matrix_add_row(matrix, ab, 2, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_xor_matrix_add_row(matrix, bc, 2, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_xor_matrix_add_row(matrix, ac, 2, false));
+    TEST_EXPECT(3 == libsat_xor_matrix_row_count(matrix));
+
+    /* the third row is the sum of the first two. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_eliminate(matrix));
+    TEST_EXPECT(2 == libsat_xor_matrix_row_count(matrix));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Contradictory rows are detected.
+ */
+TEST(inconsistent_rows)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_xor_matrix* matrix;
+    const size_t ab[] = { 0, 1 };
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* a ⊻ b = 1, a ⊻ b = 0. */
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_xor_matrix_add_row(matrix, ab, 2, true));
+    TEST_ASSERT(
+        STATUS_SUCCESS == libsat_xor_matrix_add_row(matrix, ab, 2, false));
+
+    /* elimination reaches 0 = 1. */
+    TEST_ASSERT(
+        ERROR_LIBSAT_XOR_INCONSISTENT == libsat_xor_matrix_eliminate(matrix));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
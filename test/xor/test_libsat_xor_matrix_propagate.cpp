@@ -0,0 +1,247 @@
+/**
+ * \file xor/test_libsat_xor_matrix_propagate.cpp
+ *
+ * \brief Unit tests for libsat_xor_matrix_propagate.
+ *
+ * \copyright 2025-2026 Justin Handville.  Please see license.txt in this
+ * distribution for the license terms under which this software is distributed.
+ */
+
+#include <libsat/libsat.h>
+#include <libsat/parser.h>
+#include <libsat/status.h>
+#include <libsat/xor.h>
+#include <minunit/minunit.h>
+
+LIBSAT_IMPORT_base;
+LIBSAT_IMPORT_literal;
+LIBSAT_IMPORT_parser;
+LIBSAT_IMPORT_xor;
+RCPR_IMPORT_allocator;
+RCPR_IMPORT_resource;
+
+TEST_SUITE(libsat_xor_matrix_propagate);
+
+/**
+ * Add every statement in a parsed statement list to the matrix.
+ */
+static status add_statements(libsat_xor_matrix* matrix, libsat_ast_node* base)
+{
+    for (libsat_ast_node* i = base->value.list.head; nullptr != i; i = i->next)
+    {
+        status retval = libsat_xor_matrix_add_statement(matrix, i);
+        if (STATUS_SUCCESS != retval)
+        {
+            return retval;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * A single row with one unassigned variable implies that variable.
+ */
+TEST(single_row_unit)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_xor_matrix* matrix;
+    const char* input = R"(a⊻b⊻c)";
+    uint8_t values[] = { LIBSAT_VALUE_TRUE, LIBSAT_VALUE_TRUE };
+    libsat_literal implied[1];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* parse and add the statement. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+    TEST_ASSERT(STATUS_SUCCESS == add_statements(matrix, base));
+
+    /* a = b = true forces c = true. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_xor_matrix_propagate(
+                    &implied_count, matrix, values, 2, implied, 1));
+    TEST_ASSERT(1 == implied_count);
+    TEST_EXPECT(LIBSAT_LITERAL_MAKE(2, false) == implied[0]);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Units that only follow from a combination of rows are found.
+ */
+TEST(combined_rows_unit)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_xor_matrix* matrix;
+    const char* input = R"(a⊻b⊻c; a⊻b⊻d)";
+    uint8_t values[] = {
+        LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_TRUE };
+    libsat_literal implied[2];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* parse and add the statements. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+    TEST_ASSERT(STATUS_SUCCESS == add_statements(matrix, base));
+
+    /* neither row is unit on its own, but their sum is c ⊻ d = 0. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_xor_matrix_propagate(
+                    &implied_count, matrix, values, 3, implied, 2));
+    TEST_ASSERT(1 == implied_count);
+    TEST_EXPECT(LIBSAT_LITERAL_MAKE(3, false) == implied[0]);
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * A conflict that only follows from a combination of rows is found.
+ */
+TEST(combined_rows_conflict)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_ast_node* base = nullptr;
+    libsat_xor_matrix* matrix;
+    const char* input = R"(a⊻b; a⊻b⊻c)";
+    uint8_t values[] = {
+        LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_UNASSIGNED, LIBSAT_VALUE_TRUE };
+    libsat_literal implied[2];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* parse and add the statements. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_parse(&base, context, input));
+    TEST_ASSERT(STATUS_SUCCESS == add_statements(matrix, base));
+
+    /* the rows sum to c = 0. */
+    TEST_ASSERT(
+        ERROR_LIBSAT_XOR_CONFLICT
+            == libsat_xor_matrix_propagate(
+                    &implied_count, matrix, values, 3, implied, 2));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_ast_node_resource_handle(base)));
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}
+
+/**
+ * Rows wider than a single word propagate along a chain.
+ */
+TEST(wide_chain)
+{
+    allocator* alloc;
+    libsat_context* context;
+    libsat_xor_matrix* matrix;
+    const size_t width = 150;
+    uint8_t values[150] = { LIBSAT_VALUE_TRUE };
+    libsat_literal implied[149];
+    size_t implied_count = 0;
+
+    /* create malloc allocator. */
+    TEST_ASSERT(STATUS_SUCCESS == malloc_allocator_create(&alloc));
+
+    /* create context. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_context_create(&context, alloc));
+
+    /* create matrix. */
+    TEST_ASSERT(STATUS_SUCCESS == libsat_xor_matrix_create(&matrix, context));
+
+    /* x_i ⊻ x_i+1 = 0. */
+    for (size_t i = 0; i + 1 < width; ++i)
+    {
+        const size_t vars[] = { i, i + 1 };
+        TEST_ASSERT(
+            STATUS_SUCCESS
+                == libsat_xor_matrix_add_row(matrix, vars, 2, false));
+    }
+
+    /* x_0 = true forces every other variable true. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == libsat_xor_matrix_propagate(
+                    &implied_count, matrix, values, 1, implied, 149));
+    TEST_ASSERT(149 == implied_count);
+    for (size_t i = 0; i < implied_count; ++i)
+    {
+        TEST_EXPECT(!LIBSAT_LITERAL_IS_NEGATED(implied[i]));
+        TEST_EXPECT(0 != LIBSAT_LITERAL_VARIABLE(implied[i]));
+    }
+
+    /* the buffer must be big enough for every implication. */
+    TEST_ASSERT(
+        ERROR_LIBSAT_XOR_IMPLIED_BUFFER_TOO_SMALL
+            == libsat_xor_matrix_propagate(
+                    &implied_count, matrix, values, 1, implied, 10));
+
+    /* clean up. */
+    TEST_ASSERT(
+        STATUS_SUCCESS
+            == resource_release(libsat_xor_matrix_resource_handle(matrix)));
+    TEST_ASSERT(
+        STATUS_SUCCESS ==
+            resource_release(libsat_context_resource_handle(context)));
+    TEST_ASSERT(
+        STATUS_SUCCESS == resource_release(allocator_resource_handle(alloc)));
+}